@@ -8,7 +8,12 @@
  ****************************************************************************************************/
 
 #include "button_driver.h"
+#include "checkpoint_driver.h"
 #include "cli_callback.h"
+#include "log_driver.h"
+#include "nest_driver.h"
+#include "power_driver.h"
+#include "random_callback.h"
 #include "system.h"
 
 /****************************************************************************************************
@@ -24,8 +29,9 @@
  ****************************************************************************************************/
 void main(void)
 {
-    /*** Initialize System ***/
-    system_init();
+    /*** Resume From A Power-Fail Checkpoint (Brownout Only), Otherwise Initialize System ***/
+    if(!checkpointDriver_resume(system_getResetCause()))
+        system_init();
 
     /*** Infinite Loop ***/
     while(1)
@@ -33,5 +39,11 @@ void main(void)
         /*** Tick ***/
     	buttonDriver_tick();
         cliCallback_tick();
+        logDriver_tick();
+        nestDriver_tick();
+        randomCallback_tick();
+
+        /*** Idle (LPM3 Once Quiet; CLI Start Bit Wakes) ***/
+        powerDriver_idle(cliCallback_isBusy());
     }
 }
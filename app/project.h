@@ -24,9 +24,21 @@
 
 #ifdef __UNIT_TEST__
   #include "button_driver_test.h"
+  #include "checkpoint_driver_test.h"
   #include "cli_callback_test.h"
   #include "cli_command_handler_callback_test.h"
+  #include "drbg_driver_test.h"
+  #include "entropy_driver_test.h"
   #include "led_driver_test.h"
+  #include "log_driver_test.h"
+  #include "memory_driver_test.h"
+  #include "nest_driver_test.h"
+  #include "port_driver_test.h"
+  #include "profile_driver_test.h"
+  #include "random_callback_test.h"
+  #include "system_test.h"
+  #include "trace_driver_test.h"
+  #include "vector_driver_test.h"
 #endif
 
 #endif
@@ -8,56 +8,166 @@
  ****************************************************************************************************/
 
 #include "button_driver.h"
+#include "checkpoint_driver.h"
 #include "cli.h"
 #include "cli_callback.h"
 #include "cli_command_handler_callback.h"
 #include "cs.h"
+#include "drbg_driver.h"
 #include "driver_config.h"
+#include "entropy_driver.h"
 #include "gpio.h"
+#include "inc/hw_memmap.h"
+#include "init_driver.h"
+#include "init_driver_table.h"
 #include "led_driver.h"
 #include "lcd_driver.h"
+#include "log_driver.h"
+#include "memory_driver.h"
+#include "msp430fr5xx_6xxgeneric.h"
 #include "msp430fr6989.h"
+#include "nest_driver.h"
 #include "pmm.h"
+#include "port_driver.h"
+#include "power_driver.h"
+#include "profile_driver.h"
 #include "project.h"
 #include "random.h"
 #include "random_callback.h"
+#include <stdbool.h>
 #include <stdint.h>
 #include "system.h"
+#include "timer_a.h"
+#include "trace_driver.h"
+#include "vector_driver.h"
 #include "wdt_a.h"
 
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+#pragma PERSISTENT(system_signatures)
+PROJECT_STATIC uint16_t system_signatures[SYSTEM_SUBSYSTEM_COUNT] = {0}; // FRAM: SYSTEM_SIGNATURE ^ Subsystem Once Configured
+PROJECT_STATIC system_boot_t system_boot;
+static bool system_resetCauseRead; // Until system_init() Takes It
+static uint16_t system_resetCause;
+
 /****************************************************************************************************
  * Function Prototypes
  ****************************************************************************************************/
 
 static void system_initApplication(void);
 static void system_initClocks(void);
+static void system_initSubsystem(const system_subsystem_t Subsystem, void (* const Initialize)(void));
+static bool system_isKept(const system_subsystem_t Subsystem);
+static void system_startBootTimer(void);
+static uint32_t system_stopBootTimer(const uint32_t Frequency);
 
 /****************************************************************************************************
  * Function Definitions (Public)
  ****************************************************************************************************/
 
+/****************************************************************************************************
+ * FUNCT:   system_configureLFXT
+ * BRIEF:   Configure Low-Frequency Crystal Oscillator (LFXT)
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ * NOTE:    Pins Only, Through driverlib; init_generator Turns It Into initDriverTable_lfxt
+ ****************************************************************************************************/
+void system_configureLFXT(void)
+{
+    /*** Configure ***/
+    GPIO_setAsPeripheralModuleFunctionInputPin(DRIVER_CONFIG_LFXT_GPIO_IN_PORT, DRIVER_CONFIG_LFXT_GPIO_IN_PIN, DRIVER_CONFIG_LFXT_GPIO_FUNCTION);
+    GPIO_setAsPeripheralModuleFunctionInputPin(DRIVER_CONFIG_LFXT_GPIO_OUT_PORT, DRIVER_CONFIG_LFXT_GPIO_OUT_PIN, DRIVER_CONFIG_LFXT_GPIO_FUNCTION);
+}
+
+/****************************************************************************************************
+ * FUNCT:   system_getBoot
+ * BRIEF:   Get Boot
+ * RETURN:  Returns Nothing
+ * ARG:     Boot: Reset Cause, Subsystems Kept And Boot To CLI Ready Time Of The Last system_init()
+ ****************************************************************************************************/
+void system_getBoot(system_boot_t * const Boot)
+{
+    /*** Get Boot ***/
+    *Boot = system_boot;
+}
+
+/****************************************************************************************************
+ * FUNCT:   system_getResetCause
+ * BRIEF:   Get Reset Cause
+ * RETURN:  uint16_t: SYSRSTIV Of The Last Reset (Highest Priority Pending Cause)
+ * ARG:     No Arguments
+ * NOTE:    Reading SYSRSTIV Clears The Cause, So It's Read (And The Rest Drained) Once, Then Shared
+ *          Between main() (checkpointDriver_resume()) And system_init()
+ ****************************************************************************************************/
+uint16_t system_getResetCause(void)
+{
+    uint8_t i;
+
+    /*** Read Once ***/
+    if(!system_resetCauseRead)
+    {
+        /* Every Brownout Cause Ranks Above Every PUC Cause */
+        system_resetCause = HWREG16(SYS_BASE + OFS_SYSRSTIV);
+        system_resetCauseRead = true;
+
+        /* Drain The Rest, So The Next Reset Reports Its Own Cause */
+        for(i = 0; (i < (SYSRSTIV_ACCTEIFG / 2)) && (HWREG16(SYS_BASE + OFS_SYSRSTIV) != SYSRSTIV_NONE); i++)
+            continue;
+    }
+
+    return system_resetCause;
+}
+
 /****************************************************************************************************
  * FUNCT:   system_init
  * BRIEF:   Initialize
  * RETURN:  Returns Nothing
  * ARG:     No Arguments
+ * NOTE:    Boot Time Error: The Window Up To The Clocks Is Converted At SYSTEM_RESET_SMCLK, But SMCLK
+ *          Runs At 2 MHz Through CS_setDCOFreq()'s Settling Delay (~45 Cycles) And At 8 MHz From
+ *          CS_initClockSignal(CS_SMCLK) To The Timer Read (~55 Cycles), So It Reads High By ~70 us
+ *          (Under Two 64 us Ticks) Plus The Tick Quantization, Against An LFXT Start Of Hundreds Of
+ *          Milliseconds; ACLK Wouldn't Do Better: Until The LFXT Is Stable It Falls Back To The VLO
  ****************************************************************************************************/
 void system_init(void)
 {
+    uint8_t i;
+
     /*** Disable Interrupts ***/
     __disable_interrupt();
 
     /*** Disable/Hold Watchdog Timer ***/
     WDT_A_hold(WDT_A_BASE);
 
+    /*** Boot Timer ***/
+    system_startBootTimer();
+
+    /*** Reset Cause ***/
+    system_boot.resetCause = system_getResetCause();
+    system_resetCauseRead = false; // Taken: The Next system_init() Reads Its Own Reset
+    system_boot.warm = (system_boot.resetCause >= SYSRSTIV_WDTTO);
+    system_boot.kept = 0;
+
+    /* Brownout: Nothing Is Still Configured */
+    if(!system_boot.warm)
+    {
+        for(i = 0; i < SYSTEM_SUBSYSTEM_COUNT; i++)
+            system_signatures[i] = 0;
+    }
+
     /*** Disable GPIO Power-On Default High-Impedance Mode ***/
     PMM_unlockLPM5();
 
     /*** Initialize Clocks ***/
     system_initClocks();
+    system_boot.time = system_stopBootTimer(SYSTEM_RESET_SMCLK); // Every Reset, PUC Included, Resets CS
+    system_startBootTimer(); // SMCLK Changed
 
     /*** Initialize Application ***/
     system_initApplication();
+    system_boot.time += system_stopBootTimer(CS_getSMCLK());
 
     /*** Enable Interrupts ***/
     __enable_interrupt();
@@ -91,13 +201,26 @@ void system_reset(void)
 static void system_initApplication(void)
 {
     /*** First Stage Initialization: No Dependencies ***/
-    buttonDriver_init();
+    checkpointDriver_init();
     cliCallback_init();
-    lcdDriver_init();
+    drbgDriver_init();
+    entropyDriver_init();
+    system_initSubsystem(SYSTEM_SUBSYSTEM_LCD, lcdDriver_init);
     ledDriver_init();
+    logDriver_init(cliCallback_writeCallback);
+    memoryDriver_init();
+    nestDriver_init();
+    portDriver_init();
+    powerDriver_init();
+    profileDriver_init();
     randomCallback_init();
+#if DRIVER_CONFIG_PROFILE || DRIVER_CONFIG_TRACE
+    traceDriver_init(cliCallback_writeCallback); // Starts The Shared Profile And Trace Timer (Its Overflow Interrupt Wakes The CPU)
+#endif
+    vectorDriver_init();
 
     /*** Second Stage Initialization: Dependent On First Stage ***/
+    buttonDriver_init();
     (void)cli_init(cliCallback_alertProcessInputCallback, cliCallback_printfCallback);
     (void)random_init(randomCallback_getRandomUnsigned32BitIntegerCallback);
 
@@ -118,13 +241,101 @@ static void system_initClocks(void)
     CS_setExternalClockSource(32768, 0); // 0 (No High-Frequency Crystal Oscillator (HFXT))
 
     /* Low-Frequency Crystal Oscillator (LFXT) */
-    GPIO_setAsPeripheralModuleFunctionInputPin(DRIVER_CONFIG_LFXT_GPIO_IN_PORT, DRIVER_CONFIG_LFXT_GPIO_IN_PIN, DRIVER_CONFIG_LFXT_GPIO_FUNCTION);
-    GPIO_setAsPeripheralModuleFunctionInputPin(DRIVER_CONFIG_LFXT_GPIO_OUT_PORT, DRIVER_CONFIG_LFXT_GPIO_OUT_PIN, DRIVER_CONFIG_LFXT_GPIO_FUNCTION);
+#if DRIVER_CONFIG_INIT_TABLE
+    initDriver_apply(initDriverTable_lfxt, INIT_DRIVER_TABLE_LFXT_LENGTH);
+#else
+    system_configureLFXT();
+#endif
     CS_turnOnLFXT(CS_LFXT_DRIVE_3); // Maximum Drive Strength
 
-    /* System Clocks */
+    /* System Clocks (driverlib: The DCO Change Needs A Settling Delay, Which A Table Can't Carry) */
     CS_setDCOFreq(CS_DCORSEL_0, CS_DCOFSEL_6); // Digitally Controlled Oscillator (DCO): 8 MHz
     CS_initClockSignal(CS_ACLK, CS_LFXTCLK_SELECT, CS_CLOCK_DIVIDER_1); // Auxiliary Clock (ACLK): 32768 Hz / 1 = 32768 Hz
     CS_initClockSignal(CS_MCLK, CS_DCOCLK_SELECT, CS_CLOCK_DIVIDER_1); // Master Clock (MCLK): 8 MHz / 1 = 8 MHz
     CS_initClockSignal(CS_SMCLK, CS_DCOCLK_SELECT, CS_CLOCK_DIVIDER_1); // Sub-Main CLock (SMCLK): 8 MHz / 1 = 8 MHz
 }
+
+/****************************************************************************************************
+ * FUNCT:   system_initSubsystem
+ * BRIEF:   Initialize Subsystem
+ * RETURN:  Returns Nothing
+ * ARG:     Subsystem: Subsystem
+ * ARG:     Initialize: Initialization, Skipped If The Subsystem Is Kept
+ * NOTE:    The Signature Is Cleared First And Written Last, So A Reset Part Way Through Initializes
+ *          Again
+ ****************************************************************************************************/
+static void system_initSubsystem(const system_subsystem_t Subsystem, void (* const Initialize)(void))
+{
+    /*** Still Configured ***/
+    if(system_isKept(Subsystem))
+    {
+        system_boot.kept |= (uint16_t)(1u << Subsystem);
+        return;
+    }
+
+    /*** Initialize ***/
+    system_signatures[Subsystem] = 0;
+    Initialize();
+    system_signatures[Subsystem] = (uint16_t)(SYSTEM_SIGNATURE ^ Subsystem);
+}
+
+/****************************************************************************************************
+ * FUNCT:   system_isKept
+ * BRIEF:   Is Kept
+ * RETURN:  bool: Still Configured (true) Or Not (false)
+ * ARG:     Subsystem: Subsystem
+ * NOTE:    Warm Reset, Valid Signature And The Registers Reset By A PUC Still Hold Their Configuration
+ *          (Checked, Not Assumed: Whatever The PUC Cleared Is Initialized Again)
+ ****************************************************************************************************/
+static bool system_isKept(const system_subsystem_t Subsystem)
+{
+    /*** Configured Since The Last Brownout ***/
+    if(!system_boot.warm || (system_signatures[Subsystem] != (uint16_t)(SYSTEM_SIGNATURE ^ Subsystem)))
+        return false;
+
+    /*** Registers ***/
+    switch(Subsystem)
+    {
+        case SYSTEM_SUBSYSTEM_LCD:
+            /* Charge Pump On */
+            return (HWREG16(LCD_C_BASE + OFS_LCDCVCTL) & LCDCPEN) != 0;
+        default:
+            return false;
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   system_startBootTimer
+ * BRIEF:   Start Boot Timer
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ ****************************************************************************************************/
+static void system_startBootTimer(void)
+{
+    Timer_A_initContinuousModeParam initContinuousModeParam;
+
+    /*** Start Boot Timer ***/
+    initContinuousModeParam.clockSource = TIMER_A_CLOCKSOURCE_SMCLK;
+    initContinuousModeParam.clockSourceDivider = TIMER_A_CLOCKSOURCE_DIVIDER_64; // SYSTEM_BOOT_TIMER_DIVIDER
+    initContinuousModeParam.timerInterruptEnable_TAIE = TIMER_A_TAIE_INTERRUPT_DISABLE;
+    initContinuousModeParam.timerClear = TIMER_A_DO_CLEAR;
+    initContinuousModeParam.startTimer = true;
+    Timer_A_initContinuousMode(DRIVER_CONFIG_BOOT_TIMER, &initContinuousModeParam);
+}
+
+/****************************************************************************************************
+ * FUNCT:   system_stopBootTimer
+ * BRIEF:   Stop Boot Timer
+ * RETURN:  uint32_t: Microseconds Since system_startBootTimer()
+ * ARG:     Frequency: SMCLK Frequency (Hz, Whole MHz) Since system_startBootTimer()
+ ****************************************************************************************************/
+static uint32_t system_stopBootTimer(const uint32_t Frequency)
+{
+    uint32_t count;
+
+    /*** Stop Boot Timer ***/
+    count = Timer_A_getCounterValue(DRIVER_CONFIG_BOOT_TIMER);
+    Timer_A_stop(DRIVER_CONFIG_BOOT_TIMER);
+
+    return (count * SYSTEM_BOOT_TIMER_DIVIDER) / (Frequency / 1000000u);
+}
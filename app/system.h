@@ -1,15 +1,56 @@
 /****************************************************************************************************
  * FILE:    system.h
  * BRIEF:   System Header File
+ * NOTE:    Reset Cause Aware: A Brownout (Or Power-On) Reset Initializes Everything; A Power-Up Clear
+ *          (PUC) Only (Watchdog, Password Violations) Keeps Each Slow Subsystem Whose FRAM Signature
+ *          Is Valid And Whose Registers Survived The PUC; "system --boot" Reports
+ * NOTE:    Clocks Aren't Kept: A PUC Resets The Clock System (LFXT Off, SMCLK 1 MHz), So Every Boot
+ *          Starts The LFXT And Waits For It
  ****************************************************************************************************/
 
 #ifndef SYSTEM_H
 #define SYSTEM_H
 
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define SYSTEM_BOOT_TIMER_DIVIDER (64)       // Boot Timer: SMCLK / 64 (16 Bits: 4.2 s Before Clocks, 524 ms After)
+#define SYSTEM_RESET_SMCLK        (1000000u) // Hz: DCO 8 MHz / 8 (CSCTL1, CSCTL3 Reset Values)
+#define SYSTEM_SIGNATURE          (0xB007)   // Per Subsystem: SYSTEM_SIGNATURE ^ Subsystem
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef enum system_subsystem_e
+{
+    SYSTEM_SUBSYSTEM_LCD, // LCD And Charge Pump
+    SYSTEM_SUBSYSTEM_COUNT
+} system_subsystem_t;
+
+typedef struct system_boot_s
+{
+    uint16_t resetCause; // SYSRSTIV (Highest Priority Cause)
+    bool warm;           // PUC Only
+    uint16_t kept;       // Bit Per system_subsystem_t: Not Reinitialized
+    uint32_t time;       // Microseconds: system_init() Entry To CLI Ready
+} system_boot_t;
+
 /****************************************************************************************************
  * Function Prototypes
  ****************************************************************************************************/
 
+extern void system_configureLFXT(void);
+extern void system_getBoot(system_boot_t * const Boot);
+extern uint16_t system_getResetCause(void);
 extern void system_init(void);
 extern void system_reset(void);
 
@@ -7,7 +7,9 @@
  * Defines
  ****************************************************************************************************/
 
-#define CLI_CALLBACK_PRINTF_CALLBACK_STRING_LENGTH (256)
+#define CLI_CALLBACK_FORMAT_DIGIT_LENGTH           (20)          // 18446744073709551615
+#define CLI_CALLBACK_TRANSMIT_BUFFER_LENGTH        (256)
+#define CLI_CALLBACK_RECIPROCAL_10                 (0xCCCCCCCDu) // ceil(2^35 / 10): x / 10 = (x * 0xCCCCCCCD) >> 35
 
 /****************************************************************************************************
  * Includes
@@ -19,18 +21,40 @@
 #include "eusci_a_uart.h"
 #include "dma.h"
 #include "gpio.h"
+#include "init_driver.h"
+#include "init_driver_table.h"
+#include "intrinsics.h"
 #include "msp430fr5xx_6xxgeneric.h"
+#include "profile_driver.h"
 #include "project.h"
 #include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
-#include <stdio.h>
 #include <string.h>
+#include "trace_driver.h"
 
 /****************************************************************************************************
  * Constants and Variables
  ****************************************************************************************************/
 
 static volatile uint8_t cliCallback_alertProcessInputCount;
+char cliCallback_receiveRing[CLI_CALLBACK_RECEIVE_RING_LENGTH]; // Not Static: Filled By The Inline Interrupt Handler (cli_callback.h)
+volatile uint8_t cliCallback_receiveHead, cliCallback_receiveTail; // Head: Interrupt Handler; Tail: Main Loop
+static char cliCallback_transmitBuffer[CLI_CALLBACK_TRANSMIT_BUFFER_LENGTH]; // DMA Source
+static size_t cliCallback_transmitLength;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static size_t cliCallback_convertDecimal(char * const Digits, uint64_t Value);
+static size_t cliCallback_convertHexadecimal(char * const Digits, uint64_t Value, const bool Uppercase);
+static uint32_t cliCallback_divideBy10(const uint32_t Dividend);
+static size_t cliCallback_fill(char * const String, size_t Index, const size_t Limit, const char Character, size_t Count);
+PROJECT_STATIC size_t cliCallback_format(char * const String, const size_t Size, const char *Format, va_list Arguments);
+static void cliCallback_startTransmit(void);
+static void cliCallback_waitForTransmit(void);
 
 /****************************************************************************************************
  * Function Definitions (Public)
@@ -49,19 +73,20 @@ void cliCallback_alertProcessInputCallback(void)
 }
 
 /****************************************************************************************************
- * FUNCT:   cliCallback_init
- * BRIEF:   Initialize
- * RETURN:  void: Returns Nothing
- * ARG:     void: No Arguments
+ * FUNCT:   cliCallback_configure
+ * BRIEF:   Configure
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ * NOTE:    Registers Only, Through driverlib; init_generator Turns It Into initDriverTable_cli
  ****************************************************************************************************/
-void cliCallback_init(void)
+void cliCallback_configure(void)
 {
     EUSCI_A_UART_initParam uartInit;
 
     /*** Deinitialize (May Have Dirty Settings After Reset) ***/
     DMA_disableTransfers(DRIVER_CONFIG_CLI_DMA_CHANNEL);
 
-    /*** Initialize ***/
+    /*** Configure ***/
     /* GPIO */
     GPIO_setAsPeripheralModuleFunctionInputPin(DRIVER_CONFIG_CLI_GPIO_RX_PORT, DRIVER_CONFIG_CLI_GPIO_RX_PIN, DRIVER_CONFIG_CLI_GPIO_FUNCTION);
     GPIO_setAsPeripheralModuleFunctionInputPin(DRIVER_CONFIG_CLI_GPIO_TX_PORT, DRIVER_CONFIG_CLI_GPIO_TX_PIN, DRIVER_CONFIG_CLI_GPIO_FUNCTION);
@@ -82,42 +107,44 @@ void cliCallback_init(void)
     /* UART Interrupt */
     EUSCI_A_UART_clearInterrupt(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS, EUSCI_A_UART_RECEIVE_INTERRUPT);
     EUSCI_A_UART_enableInterrupt(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS, EUSCI_A_UART_RECEIVE_INTERRUPT);
+}
 
-    /* Alert Process Input Count */
+/****************************************************************************************************
+ * FUNCT:   cliCallback_init
+ * BRIEF:   Initialize
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ ****************************************************************************************************/
+void cliCallback_init(void)
+{
+    /*** Registers ***/
+#if DRIVER_CONFIG_INIT_TABLE
+    initDriver_apply(initDriverTable_cli, INIT_DRIVER_TABLE_CLI_LENGTH);
+#else
+    cliCallback_configure();
+#endif
+
+    /*** Alert Process Input Count And Receive Ring ***/
     cliCallback_alertProcessInputCount = 0;
+    cliCallback_receiveHead = 0;
+    cliCallback_receiveTail = 0;
 }
 
 /****************************************************************************************************
- * FUNCT:   cliCallback_usciInterruptHandler
- * BRIEF:   Universal Serial Communications Interface (USCI) Interrupt Handler
- * RETURN:  Returns Nothing
- * ARG:     InterruptFlag: Interrupt Flag
+ * FUNCT:   cliCallback_isBusy
+ * BRIEF:   Is Busy
+ * RETURN:  bool: Busy (true) Or Idle (false)
+ * ARG:     void: No Arguments
+ * NOTE:    Busy While Input Waits To Be Received Or Processed, A Transmit Is In Flight (DMA Enabled
+ *          Until The Block Is Done) Or The UART Is Mid-Character; SMCLK Must Keep Running Until Idle
  ****************************************************************************************************/
-void cliCallback_usciInterruptHandler(uint16_t InterruptFlag)
+bool cliCallback_isBusy(void)
 {
-    /*** Handle Interrupt */
-    switch(InterruptFlag)
-    {
-        case USCI_NONE:
-            /*** No Interrupt ***/
-            break;
-        case USCI_UART_UCRXIFG:
-            /*** Receive Interrupt ***/
-            (void)cli_addReceiveCharacter((char)EUSCI_A_UART_receiveData(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS));
-            break;
-        case USCI_UART_UCTXIFG:
-            /*** Transmit Interrupt ***/
-            break;
-        case USCI_UART_UCSTTIFG:
-            /*** Start Bit Interrupt ***/
-            break;
-        case USCI_UART_UCTXCPTIFG:
-            /*** Transmit Complete Interrupt ***/
-            break;
-        default:
-            /*** Do Nothing ***/
-            break;
-    }
+    /*** Is Busy ***/
+    return (cliCallback_receiveHead != cliCallback_receiveTail) ||
+           (cliCallback_alertProcessInputCount > 0) ||
+           ((HWREG16(DMA_BASE + DRIVER_CONFIG_CLI_DMA_CHANNEL + OFS_DMA0CTL) & DMAEN) == DMAEN) ||
+           ((HWREG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxSTATW) & UCBUSY) == UCBUSY);
 }
 
 /****************************************************************************************************
@@ -130,53 +157,32 @@ void cliCallback_usciInterruptHandler(uint16_t InterruptFlag)
  ****************************************************************************************************/
 void cliCallback_printfCallback(const bool Flush, const char * const Format, ...)
 {
-    static char printfString[CLI_CALLBACK_PRINTF_CALLBACK_STRING_LENGTH];
-    static size_t i = 0;
-    DMA_initParam dmaInit;
     va_list arguments;
 
-    /*** Unit Test Only ***/
-#ifdef __UNIT_TEST__
-    DMA_disableTransfers(DRIVER_CONFIG_CLI_DMA_CHANNEL); // DMA Is Disabled After Completion Of Block Transfer
-#endif
-
-    /*** Wait Until DMA Disabled (Automatically Happens On Completion Of Block Transfer) And UART NOT Busy ***/
-    while(((HWREG16(DMA_BASE + DRIVER_CONFIG_CLI_DMA_CHANNEL + OFS_DMA0CTL) & DMAEN) == DMAEN) || ((HWREG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxSTATW) & UCBUSY) == UCBUSY))
-        continue;
+    /*** Wait Until The Previous Transmit Is Done ***/
+    cliCallback_waitForTransmit();
 
-    /*** Decode Format String And Optional Arguments And Write To Print String ***/
+    /*** Format Straight Into The DMA Source Buffer ***/
     va_start(arguments, Format);
-    i += (size_t)vsnprintf(&printfString[i], sizeof(printfString) - i, Format, arguments);
+    cliCallback_transmitLength += cliCallback_format(&cliCallback_transmitBuffer[cliCallback_transmitLength], sizeof(cliCallback_transmitBuffer) - cliCallback_transmitLength, Format, arguments);
     va_end(arguments);
 
     /*** Flush ***/
     if(Flush)
     {
-    	if(strlen(printfString) > 0)
-    	{
-			/* Initialize DMA */
-			dmaInit.channelSelect = DRIVER_CONFIG_CLI_DMA_CHANNEL;
-			dmaInit.transferModeSelect = DMA_TRANSFER_BLOCK;
-			dmaInit.transferSize = (uint16_t)strlen(printfString);
-			dmaInit.triggerSourceSelect = DRIVER_CONFIG_CLI_DMA_TRIGGER_SOURCE;
-			dmaInit.transferUnitSelect = DMA_SIZE_SRCBYTE_DSTBYTE;
-			dmaInit.triggerTypeSelect = DMA_TRIGGER_HIGH;
-			DMA_init(&dmaInit);
-
-			/* Set DMA Addresses And Start Transfer */
-			DMA_setSrcAddress(DRIVER_CONFIG_CLI_DMA_CHANNEL, (uint32_t)printfString, DMA_DIRECTION_INCREMENT);
-			DMA_setDstAddress(DRIVER_CONFIG_CLI_DMA_CHANNEL, EUSCI_A_UART_getTransmitBufferAddress(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS), DMA_DIRECTION_UNCHANGED);
-			DMA_enableTransfers(DRIVER_CONFIG_CLI_DMA_CHANNEL);
-			DMA_startTransfer(DRIVER_CONFIG_CLI_DMA_CHANNEL); // DMA Is Disabled After Completion Of Block Transfer
-
-        	/* Unit Test Only */
+        if(cliCallback_transmitLength > 0)
+        {
+            /* Start Transmit */
+            cliCallback_startTransmit();
+
+            /* Unit Test Only */
 #ifdef __UNIT_TEST__
-        	cliCallbackTest_copyPrintfOutput(printfString);
+            cliCallbackTest_copyPrintfOutput(cliCallback_transmitBuffer);
 #endif
-    	}
+        }
 
-        /* Reset Index */
-        i = 0;
+        /* Reset Length */
+        cliCallback_transmitLength = 0;
     }
 }
 
@@ -188,11 +194,348 @@ void cliCallback_printfCallback(const bool Flush, const char * const Format, ...
  ****************************************************************************************************/
 void cliCallback_tick(void)
 {
+    /*** Receive ***/
+    while(cliCallback_receiveTail != cliCallback_receiveHead)
+    {
+        (void)cli_addReceiveCharacter(cliCallback_receiveRing[cliCallback_receiveTail]);
+        cliCallback_receiveTail = (uint8_t)((cliCallback_receiveTail + 1) & (CLI_CALLBACK_RECEIVE_RING_LENGTH - 1));
+    }
+
     /*** Alert Process Input***/
     while(cliCallback_alertProcessInputCount > 0)
     {
         /*** Process Input ***/
+        TRACE_DRIVER_BEGIN(TRACE_DRIVER_EVENT_CLI_PROCESS_INPUT, cliCallback_alertProcessInputCount);
         (void)cli_processInput();
         cliCallback_alertProcessInputCount--;
+        TRACE_DRIVER_END(TRACE_DRIVER_EVENT_CLI_PROCESS_INPUT, cliCallback_alertProcessInputCount);
     }
 }
+
+/****************************************************************************************************
+ * FUNCT:   cliCallback_writeCallback
+ * BRIEF:   Write Callback
+ * RETURN:  void: Returns Nothing
+ * ARG:     Data: Data (Binary)
+ * ARG:     Length: Length (Bytes)
+ * NOTE:    Sends Raw Bytes (e.g. Log Records) Through The Same DMA Buffer As printf Output, After
+ *          Any Unflushed printf Output, In Buffer-Sized Pieces
+ ****************************************************************************************************/
+void cliCallback_writeCallback(const uint8_t * const Data, const size_t Length)
+{
+    size_t length, i;
+
+    /*** Write ***/
+    for(i = 0; i < Length; i += length)
+    {
+        /* Wait Until The Previous Transmit Is Done */
+        cliCallback_waitForTransmit();
+
+        /* Append And Transmit */
+        length = sizeof(cliCallback_transmitBuffer) - cliCallback_transmitLength;
+        if(length > (Length - i))
+            length = Length - i;
+        (void)memcpy(&cliCallback_transmitBuffer[cliCallback_transmitLength], &Data[i], length);
+        cliCallback_transmitLength += length;
+        cliCallback_startTransmit();
+        cliCallback_transmitLength = 0;
+    }
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   cliCallback_convertDecimal
+ * BRIEF:   Convert To Decimal
+ * RETURN:  size_t: Number Of Digits
+ * ARG:     Digits: Digits (Least Significant First; CLI_CALLBACK_FORMAT_DIGIT_LENGTH)
+ * ARG:     Value: Value
+ * NOTE:    Divides By 10 With The MPY32 Reciprocal Multiplication Instead Of Software Division;
+ *          Interrupts Are Disabled So A Handler Cannot Reload The Multiplier Mid-Conversion
+ ****************************************************************************************************/
+static size_t cliCallback_convertDecimal(char * const Digits, uint64_t Value)
+{
+    uint64_t quotient64;
+    uint32_t current, quotient, remainder, value;
+    size_t length;
+    uint8_t shift;
+    unsigned short interruptState;
+    PROFILE_DRIVER_COUNT(start);
+
+    /*** Load Reciprocal (Operand 1 Stays Loaded For Every Digit) ***/
+    interruptState = __get_interrupt_state();
+    __disable_interrupt();
+    PROFILE_DRIVER_START(start);
+    HWREG16(MPY32_BASE + OFS_MPY32L) = (uint16_t)CLI_CALLBACK_RECIPROCAL_10;
+    HWREG16(MPY32_BASE + OFS_MPY32H) = (uint16_t)(CLI_CALLBACK_RECIPROCAL_10 >> 16);
+
+    /*** Above 32 Bits: Long Division Over 16-Bit Limbs (Each Step Fits The 32-Bit Reciprocal) ***/
+    length = 0;
+    while((Value >> 32) != 0)
+    {
+        quotient64 = 0;
+        remainder = 0;
+        for(shift = 64; shift > 0; shift -= 16)
+        {
+            current = (remainder << 16) | (uint16_t)(Value >> (shift - 16));
+            quotient = cliCallback_divideBy10(current);
+            remainder = current - ((quotient << 3) + (quotient << 1));
+            quotient64 = (quotient64 << 16) | quotient;
+        }
+        Digits[length++] = (char)('0' + remainder);
+        Value = quotient64;
+    }
+
+    /*** 32 Bits ***/
+    value = (uint32_t)Value;
+    do
+    {
+        quotient = cliCallback_divideBy10(value);
+        Digits[length++] = (char)('0' + (value - ((quotient << 3) + (quotient << 1))));
+        value = quotient;
+    } while(value != 0);
+    PROFILE_DRIVER_CRITICAL_SECTION(start);
+    __set_interrupt_state(interruptState);
+
+    return length;
+}
+
+/****************************************************************************************************
+ * FUNCT:   cliCallback_convertHexadecimal
+ * BRIEF:   Convert To Hexadecimal
+ * RETURN:  size_t: Number Of Digits
+ * ARG:     Digits: Digits (Least Significant First; CLI_CALLBACK_FORMAT_DIGIT_LENGTH)
+ * ARG:     Value: Value
+ * ARG:     Uppercase: Uppercase (true) Or Lowercase (false) Digits
+ ****************************************************************************************************/
+static size_t cliCallback_convertHexadecimal(char * const Digits, uint64_t Value, const bool Uppercase)
+{
+    size_t length;
+    uint8_t nibble;
+
+    /*** Convert ***/
+    length = 0;
+    do
+    {
+        nibble = (uint8_t)(Value & 0xF);
+        Digits[length++] = (char)((nibble < 10) ? ('0' + nibble) : ((Uppercase ? 'A' : 'a') + (nibble - 10)));
+        Value >>= 4;
+    } while(Value != 0);
+
+    return length;
+}
+
+/****************************************************************************************************
+ * FUNCT:   cliCallback_divideBy10
+ * BRIEF:   Divide By 10
+ * RETURN:  uint32_t: Quotient
+ * ARG:     Dividend: Dividend
+ * NOTE:    MPY32 Operand 1 Must Hold CLI_CALLBACK_RECIPROCAL_10; Writing OP2H Starts The Unsigned
+ *          32 x 32 Multiplication, The Quotient Is The Upper 32 Bits Of The Product Shifted Right 3
+ ****************************************************************************************************/
+static uint32_t cliCallback_divideBy10(const uint32_t Dividend)
+{
+    uint32_t product;
+
+    /*** Multiply By Reciprocal ***/
+    HWREG16(MPY32_BASE + OFS_OP2L) = (uint16_t)Dividend;
+    HWREG16(MPY32_BASE + OFS_OP2H) = (uint16_t)(Dividend >> 16);
+    product = ((uint32_t)HWREG16(MPY32_BASE + OFS_RES3) << 16) | HWREG16(MPY32_BASE + OFS_RES2);
+
+    return product >> 3;
+}
+
+/****************************************************************************************************
+ * FUNCT:   cliCallback_fill
+ * BRIEF:   Fill
+ * RETURN:  size_t: Index After Fill
+ * ARG:     String: String
+ * ARG:     Index: Index
+ * ARG:     Limit: Limit (Index Of Terminator)
+ * ARG:     Character: Fill Character
+ * ARG:     Count: Fill Count
+ ****************************************************************************************************/
+static size_t cliCallback_fill(char * const String, size_t Index, const size_t Limit, const char Character, size_t Count)
+{
+    /*** Fill ***/
+    for(; (Count > 0) && (Index < Limit); Count--)
+        String[Index++] = Character;
+
+    return Index;
+}
+
+/****************************************************************************************************
+ * FUNCT:   cliCallback_format
+ * BRIEF:   Format
+ * RETURN:  size_t: Length Written (Excluding Terminator; Output Is Truncated To Fit)
+ * ARG:     String: String
+ * ARG:     Size: String Size (Including Terminator)
+ * ARG:     Format: Format String
+ * ARG:     Arguments: Arguments
+ * NOTE:    Compact Replacement For vsnprintf With Only The Conversions The CLI Uses: %d, %i, %u, %x,
+ *          %X, %c, %s And %%; Flags: '-' (Left Justify) And '0' (Zero Pad); Decimal Width
+ * NOTE:    Length Modifiers Are Fixed Width On Target And Host Alike: None: int, l: 32 Bits
+ *          (int32_t/uint32_t), ll: 64 Bits (int64_t/uint64_t)
+ ****************************************************************************************************/
+PROJECT_STATIC size_t cliCallback_format(char * const String, const size_t Size, const char *Format, va_list Arguments)
+{
+    char digits[CLI_CALLBACK_FORMAT_DIGIT_LENGTH];
+    const char *text;
+    size_t i, j, length, limit, padLength, width;
+    uint64_t value;
+    int64_t signedValue;
+    uint8_t longCount;
+    bool leftJustify, negative, reverse, zeroPad;
+
+    /*** Error Check ***/
+    if(Size == 0)
+        return 0;
+
+    /*** Format ***/
+    i = 0;
+    limit = Size - 1;
+    for(; *Format != '\0'; Format++)
+    {
+        /* Literal */
+        if(*Format != '%')
+        {
+            if(i < limit)
+                String[i++] = *Format;
+            continue;
+        }
+
+        /* Flags */
+        leftJustify = false;
+        zeroPad = false;
+        for(Format++; (*Format == '-') || (*Format == '0'); Format++)
+        {
+            if(*Format == '-')
+                leftJustify = true;
+            else
+                zeroPad = true;
+        }
+
+        /* Width */
+        for(width = 0; (*Format >= '0') && (*Format <= '9'); Format++)
+            width = (width << 3) + (width << 1) + (size_t)(*Format - '0');
+
+        /* Length */
+        for(longCount = 0; *Format == 'l'; Format++)
+            longCount++;
+
+        /* Conversion */
+        if(*Format == '\0')
+            break;
+        negative = false;
+        reverse = true;
+        text = digits;
+        switch(*Format)
+        {
+            case 'c':
+                digits[0] = (char)va_arg(Arguments, int);
+                length = 1;
+                break;
+            case 'd':
+            case 'i':
+                if(longCount >= 2)
+                    signedValue = va_arg(Arguments, int64_t);
+                else if(longCount == 1)
+                    signedValue = va_arg(Arguments, int32_t);
+                else
+                    signedValue = va_arg(Arguments, int);
+                negative = (signedValue < 0);
+                value = negative ? (0 - (uint64_t)signedValue) : (uint64_t)signedValue;
+                length = cliCallback_convertDecimal(digits, value);
+                break;
+            case 's':
+                text = va_arg(Arguments, const char *);
+                if(text == NULL)
+                    text = "(null)";
+                length = strlen(text);
+                reverse = false;
+                break;
+            case 'u':
+            case 'x':
+            case 'X':
+                if(longCount >= 2)
+                    value = va_arg(Arguments, uint64_t);
+                else if(longCount == 1)
+                    value = va_arg(Arguments, uint32_t);
+                else
+                    value = va_arg(Arguments, unsigned int);
+                if(*Format == 'u')
+                    length = cliCallback_convertDecimal(digits, value);
+                else
+                    length = cliCallback_convertHexadecimal(digits, value, (*Format == 'X'));
+                break;
+            default:
+                /* %% And Unsupported Conversions: Character Itself */
+                digits[0] = *Format;
+                length = 1;
+                break;
+        }
+
+        /* Pad (Right Justify), Sign, Text, Pad (Left Justify) */
+        padLength = (width > (length + (negative ? 1 : 0))) ? (width - length - (negative ? 1 : 0)) : 0;
+        if(!leftJustify && !zeroPad)
+            i = cliCallback_fill(String, i, limit, ' ', padLength);
+        if(negative)
+            i = cliCallback_fill(String, i, limit, '-', 1);
+        if(!leftJustify && zeroPad)
+            i = cliCallback_fill(String, i, limit, '0', padLength);
+        for(j = 0; (j < length) && (i < limit); j++)
+            String[i++] = reverse ? text[length - 1 - j] : text[j];
+        if(leftJustify)
+            i = cliCallback_fill(String, i, limit, ' ', padLength);
+    }
+    String[i] = '\0';
+
+    return i;
+}
+
+/****************************************************************************************************
+ * FUNCT:   cliCallback_startTransmit
+ * BRIEF:   Start Transmit
+ * RETURN:  void: Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    DMA Block Transfer Of The Transmit Buffer To The UART (Disabled On Completion)
+ ****************************************************************************************************/
+static void cliCallback_startTransmit(void)
+{
+    DMA_initParam dmaInit;
+
+    /*** Initialize DMA ***/
+    dmaInit.channelSelect = DRIVER_CONFIG_CLI_DMA_CHANNEL;
+    dmaInit.transferModeSelect = DMA_TRANSFER_BLOCK;
+    dmaInit.transferSize = (uint16_t)cliCallback_transmitLength;
+    dmaInit.triggerSourceSelect = DRIVER_CONFIG_CLI_DMA_TRIGGER_SOURCE;
+    dmaInit.transferUnitSelect = DMA_SIZE_SRCBYTE_DSTBYTE;
+    dmaInit.triggerTypeSelect = DMA_TRIGGER_HIGH;
+    DMA_init(&dmaInit);
+
+    /*** Set DMA Addresses And Start Transfer ***/
+    DMA_setSrcAddress(DRIVER_CONFIG_CLI_DMA_CHANNEL, (uint32_t)cliCallback_transmitBuffer, DMA_DIRECTION_INCREMENT);
+    DMA_setDstAddress(DRIVER_CONFIG_CLI_DMA_CHANNEL, EUSCI_A_UART_getTransmitBufferAddress(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS), DMA_DIRECTION_UNCHANGED);
+    DMA_enableTransfers(DRIVER_CONFIG_CLI_DMA_CHANNEL);
+    DMA_startTransfer(DRIVER_CONFIG_CLI_DMA_CHANNEL); // DMA Is Disabled After Completion Of Block Transfer
+}
+
+/****************************************************************************************************
+ * FUNCT:   cliCallback_waitForTransmit
+ * BRIEF:   Wait For Transmit
+ * RETURN:  void: Returns Nothing
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+static void cliCallback_waitForTransmit(void)
+{
+    /*** Unit Test Only ***/
+#ifdef __UNIT_TEST__
+    DMA_disableTransfers(DRIVER_CONFIG_CLI_DMA_CHANNEL); // DMA Is Disabled After Completion Of Block Transfer
+#endif
+
+    /*** Wait Until DMA Disabled (Automatically Happens On Completion Of Block Transfer) And UART NOT Busy ***/
+    while(((HWREG16(DMA_BASE + DRIVER_CONFIG_CLI_DMA_CHANNEL + OFS_DMA0CTL) & DMAEN) == DMAEN) || ((HWREG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxSTATW) & UCBUSY) == UCBUSY))
+        continue;
+}
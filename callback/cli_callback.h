@@ -6,21 +6,105 @@
 #ifndef CLI_CALLBACK_H
 #define CLI_CALLBACK_H
 
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define CLI_CALLBACK_RECEIVE_RING_LENGTH (32) // Power Of 2; Drained Into The CLI Each Main Loop
+
 /****************************************************************************************************
  * Includes
  ****************************************************************************************************/
 
+#include "driver_config.h"
+#include "inc/hw_memmap.h"
+#include "msp430fr6989.h"
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+/*** Receive Ring: Head Written Only By The Interrupt Handlers Below, Tail Only By cliCallback_tick() ***/
+extern char cliCallback_receiveRing[CLI_CALLBACK_RECEIVE_RING_LENGTH];
+extern volatile uint8_t cliCallback_receiveHead, cliCallback_receiveTail;
+
 /****************************************************************************************************
  * Function Prototypes
  ****************************************************************************************************/
 
 extern void cliCallback_alertProcessInputCallback(void);
+extern void cliCallback_configure(void);
 extern void cliCallback_init(void);
-extern void cliCallback_usciInterruptHandler(uint16_t InterruptFlag);
+extern bool cliCallback_isBusy(void);
 extern void cliCallback_printfCallback(const bool Flush, const char * const Format, ...);
 extern void cliCallback_tick(void);
+extern void cliCallback_writeCallback(const uint8_t * const Data, const size_t Length);
+
+/****************************************************************************************************
+ * Function Definitions (Inline)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   cliCallback_receiveInterruptHandler
+ * BRIEF:   Receive Interrupt Handler
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ * NOTE:    Reads UCAxRXBUF (Clears UCRXIFG) Into The Receive Ring And Nothing Else; cliCallback_tick()
+ *          Hands It To The CLI. Drops The Character If The Ring Is Full, Like cli_addReceiveCharacter()
+ * NOTE:    Static Inline So The USCI Vector Makes No Call: A Call Costs The Call And Return And Makes
+ *          The Vector Save R11-R15, Which Together Don't Fit In The 86 MCLK Cycles Between Characters
+ *          At 921600 Baud
+ ****************************************************************************************************/
+static inline void cliCallback_receiveInterruptHandler(void)
+{
+    uint8_t head, next;
+    char character;
+
+    /*** Receive ***/
+    character = (char)HWREG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxRXBUF);
+    head = cliCallback_receiveHead;
+    next = (uint8_t)((head + 1) & (CLI_CALLBACK_RECEIVE_RING_LENGTH - 1));
+    if(next != cliCallback_receiveTail)
+    {
+        cliCallback_receiveRing[head] = character;
+        cliCallback_receiveHead = next;
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   cliCallback_usciInterruptHandler
+ * BRIEF:   Universal Serial Communications Interface (USCI) Interrupt Handler
+ * RETURN:  Returns Nothing
+ * ARG:     InterruptFlag: Interrupt Flag
+ ****************************************************************************************************/
+static inline void cliCallback_usciInterruptHandler(const uint16_t InterruptFlag)
+{
+    /*** Handle Interrupt */
+    switch(InterruptFlag)
+    {
+        case USCI_NONE:
+            /*** No Interrupt ***/
+            break;
+        case USCI_UART_UCRXIFG:
+            /*** Receive Interrupt ***/
+            cliCallback_receiveInterruptHandler();
+            break;
+        case USCI_UART_UCTXIFG:
+            /*** Transmit Interrupt ***/
+            break;
+        case USCI_UART_UCSTTIFG:
+            /*** Start Bit Interrupt (Enabled Only In LPM3 To Wake The CPU; See power_driver.h) ***/
+            break;
+        case USCI_UART_UCTXCPTIFG:
+            /*** Transmit Complete Interrupt ***/
+            break;
+        default:
+            /*** Do Nothing ***/
+            break;
+    }
+}
 
 #endif
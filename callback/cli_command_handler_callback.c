@@ -9,6 +9,7 @@
 
 #define CLI_COMMAND_HANDLER_CALLBACK_LCD_COMMAND_NAME    ("lcd")
 #define CLI_COMMAND_HANDLER_CALLBACK_LED_COMMAND_NAME    ("led")
+#define CLI_COMMAND_HANDLER_CALLBACK_RANDOM_BINARY_COUNT (4) // 32-Bit Integers Per Write (Stack Buffer)
 #define CLI_COMMAND_HANDLER_CALLBACK_RANDOM_COMMAND_NAME ("random")
 #define CLI_COMMAND_HANDLER_CALLBACK_SYSTEM_COMMAND_NAME ("system")
 
@@ -20,9 +21,15 @@
 #include "cli_callback.h"
 #include "cli_command_handler_callback.h"
 #include "cs.h"
+#include "drbg_driver.h"
+#include "driver_config.h"
 #include "lcd_c.h"
 #include "lcd_driver.h"
 #include "led_driver.h"
+#include "log_driver.h"
+#include "memory_driver.h"
+#include "power_driver.h"
+#include "profile_driver.h"
 #include "random.h"
 #include "random_callback.h"
 #include "status.h"
@@ -31,6 +38,8 @@
 #include <stdint.h>
 #include <string.h>
 #include "system.h"
+#include "trace_driver.h"
+#include "vector_driver.h"
 
 /****************************************************************************************************
  * Constants and Variables
@@ -277,13 +286,17 @@ static status_t cliCommandHandlerCallback_ledCommandHandlerCallback(uint8_t argc
  ****************************************************************************************************/
 static status_t cliCommandHandlerCallback_randomCommandHandlerCallback(uint8_t argc, char *argv[])
 {
-    bool help, seed, signedInteger, unsignedInteger;
-    uint32_t count, i;
+    bool binary, help, reseed, secure, seed, signedInteger, unsignedInteger;
+    uint32_t count, i, length, value;
     cli_optionArgumentPair_t optionArgumentPair;
+    uint8_t buffer[CLI_COMMAND_HANDLER_CALLBACK_RANDOM_BINARY_COUNT * sizeof(uint32_t)];
 
     /*** Set Defaults ***/
+    binary = false;
     count = 1;
     help = false;
+    reseed = false;
+    secure = false;
     seed = false;
     signedInteger = false;
     unsignedInteger = false;
@@ -293,7 +306,13 @@ static status_t cliCommandHandlerCallback_randomCommandHandlerCallback(uint8_t a
     {
         if(cli_getOptionArgumentPairFromInput(argv[i], &optionArgumentPair) == STATUS_SUCCESS)
         {
-            if((strcmp(optionArgumentPair.option, "c") == 0) || (strcmp(optionArgumentPair.option, "count") == 0))
+            if((strcmp(optionArgumentPair.option, "b") == 0) || (strcmp(optionArgumentPair.option, "binary") == 0))
+            {
+                /* Random Binary */
+                if(optionArgumentPair.argument == NULL)
+                    binary = true;
+            }
+            else if((strcmp(optionArgumentPair.option, "c") == 0) || (strcmp(optionArgumentPair.option, "count") == 0))
             {
                 /* Set Random 32-Bit Integer Count */
                 if(optionArgumentPair.argument != NULL)
@@ -323,6 +342,12 @@ static status_t cliCommandHandlerCallback_randomCommandHandlerCallback(uint8_t a
                 if(optionArgumentPair.argument == NULL)
                     unsignedInteger = true;
             }
+            else if((strcmp(optionArgumentPair.option, "x") == 0) || (strcmp(optionArgumentPair.option, "secure") == 0))
+            {
+                /* Secure Random (DRBG) */
+                if(optionArgumentPair.argument == NULL)
+                    secure = true;
+            }
         }
     }
 
@@ -331,53 +356,91 @@ static status_t cliCommandHandlerCallback_randomCommandHandlerCallback(uint8_t a
     if(help)
     {
         cliCallback_printfCallback(false, "usage: %s [OPTION]\n", CLI_COMMAND_HANDLER_CALLBACK_RANDOM_COMMAND_NAME);
+        cliCallback_printfCallback(false, "  -b, --binary\n");
         cliCallback_printfCallback(false, "  -c[COUNT], --count=[COUNT]\n");
         cliCallback_printfCallback(false, "  -h, --help\n");
         cliCallback_printfCallback(false, "  -s, --seed\n");
         cliCallback_printfCallback(false, "  -S, --signed\n");
-        cliCallback_printfCallback(true, "  -u, --unsigned\n"); // Flush
+        cliCallback_printfCallback(false, "  -u, --unsigned\n");
+        cliCallback_printfCallback(true, "  -x, --secure\n"); // Flush
     }
 
     /* Seed */
     if(seed)
     	cliCallback_printfCallback(true, "Seed: %u\n", randomCallback_getSeed()); // Flush
 
+    /* Secure Random Not Seeded Yet (Requests Never Wait On Entropy) */
+    if(secure && (drbgDriver_getReseedCounter() == 0) && (signedInteger || unsignedInteger || binary))
+    {
+        cliCallback_printfCallback(true, "Secure Random Not Seeded\n"); // Flush
+        binary = false;
+        signedInteger = false;
+        unsignedInteger = false;
+    }
+
     /* Random Signed 32-Bit Integer */
     if(signedInteger)
     {
         cliCallback_printfCallback(false, "Random Signed 32-Bit Integer(s):\n");
         for(i = 0; i < count; i++)
         {
-#ifdef __UNIT_TEST__
+        	if(!secure)
+        		value = (uint32_t)random_getRandomSigned32BitInteger();
+        	else if(!randomCallback_fillSecure(&value, sizeof(value)))
+        		reseed = true;
+        	if(reseed)
+        		break;
         	if(((i + 1) % 10) == 0)
-        		cliCallback_printfCallback(true, "%u: %d\n", i + 1, random_getRandomSigned32BitInteger()); // Flush
+        		cliCallback_printfCallback(true, "%lu: %ld\n", i + 1, (int32_t)value); // Flush
         	else
-        		cliCallback_printfCallback(false, "%u: %d\n", i + 1, random_getRandomSigned32BitInteger());
-#else
-        	if(((i + 1) % 10) == 0)
-        		cliCallback_printfCallback(true, "%lu: %ld\n", i + 1, random_getRandomSigned32BitInteger()); // Flush
-        	else
-        		cliCallback_printfCallback(false, "%lu: %ld\n", i + 1, random_getRandomSigned32BitInteger());
-#endif
+        		cliCallback_printfCallback(false, "%lu: %ld\n", i + 1, (int32_t)value);
         }
         cliCallback_printfCallback(true, ""); // Flush
     }
 
     /* Random Unsigned 32-Bit Integer */
-    if(unsignedInteger)
+    if(unsignedInteger && !reseed)
     {
         cliCallback_printfCallback(false, "Random Unsigned 32-Bit Integer(s):\n");
         for(i = 0; i < count; i++)
         {
+        	if(!secure)
+        		value = random_getRandomUnsigned32BitInteger();
+        	else if(!randomCallback_fillSecure(&value, sizeof(value)))
+        		reseed = true;
+        	if(reseed)
+        		break;
         	if(((i + 1) % 10) == 0)
-        		cliCallback_printfCallback(true, "%lu: %lu\n", i + 1, random_getRandomUnsigned32BitInteger()); // Flush
+        		cliCallback_printfCallback(true, "%lu: %lu\n", i + 1, value); // Flush
         	else
-        		cliCallback_printfCallback(false, "%lu: %lu\n", i + 1, random_getRandomUnsigned32BitInteger());
+        		cliCallback_printfCallback(false, "%lu: %lu\n", i + 1, value);
         }
         cliCallback_printfCallback(true, ""); // Flush
     }
 
-	return STATUS_SUCCESS;
+    /* Random Binary (Raw Little-Endian 32-Bit Integers, e.g. For dieharder Or PractRand On The Host) */
+    if(binary && !reseed)
+    {
+        for(i = 0; i < count; i += length)
+        {
+            length = count - i;
+            if(length > CLI_COMMAND_HANDLER_CALLBACK_RANDOM_BINARY_COUNT)
+                length = CLI_COMMAND_HANDLER_CALLBACK_RANDOM_BINARY_COUNT;
+            if(!secure)
+                randomCallback_fill(NULL, buffer, (size_t)length * sizeof(uint32_t));
+            else if(!randomCallback_fillSecure(buffer, (size_t)length * sizeof(uint32_t)))
+                reseed = true;
+            if(reseed)
+                break;
+            cliCallback_writeCallback(buffer, (size_t)length * sizeof(uint32_t));
+        }
+    }
+
+    /* Secure Random Reseed Required (Only randomCallback_tick() Reseeds, From The Main Loop; Nothing Stale Is Output) */
+    if(reseed)
+        cliCallback_printfCallback(true, "Secure Random Reseed Required\n"); // Flush
+
+    return STATUS_SUCCESS;
 }
 
 /****************************************************************************************************
@@ -389,21 +452,43 @@ static status_t cliCommandHandlerCallback_randomCommandHandlerCallback(uint8_t a
  ****************************************************************************************************/
 static status_t cliCommandHandlerCallback_systemCommandHandlerCallback(uint8_t argc, char *argv[])
 {
-    bool clock, help, reset;
-    uint32_t i;
+    bool boot, clock, help, irq, irqReset, logging, loggingEnabled, memory, power, reset, trace;
+    uint32_t i, u32;
+    uint16_t quietPeriod;
+    uint8_t bin, subsystem, vector;
+    system_boot_t bootInformation;
     cli_optionArgumentPair_t optionArgumentPair;
+    memoryDriver_usage_t usage;
+    profileDriver_statistics_t statistics;
+    const char * const SubsystemNames[SYSTEM_SUBSYSTEM_COUNT] = {"LCD"};
+    const char * const VectorNames[PROFILE_DRIVER_VECTOR_COUNT] = {"PORT1", "PORT2", "PORT3", "PORT4", "TIMER0_A1", "TIMER0_B1", "USCI_A1"};
 
     /*** Set Defaults ***/
+    boot = false;
     clock = false;
     help = false;
+    irq = false;
+    irqReset = false;
+    logging = false;
+    loggingEnabled = logDriver_isEnabled();
+    memory = false;
+    power = false;
+    quietPeriod = powerDriver_getQuietPeriod();
     reset = false;
+    trace = false;
 
     /*** Process Arguments ***/
     for(i = 0; i < argc; i++)
     {
         if(cli_getOptionArgumentPairFromInput(argv[i], &optionArgumentPair) == STATUS_SUCCESS)
         {
-            if((strcmp(optionArgumentPair.option, "c") == 0) || (strcmp(optionArgumentPair.option, "clock") == 0))
+            if((strcmp(optionArgumentPair.option, "b") == 0) || (strcmp(optionArgumentPair.option, "boot") == 0))
+            {
+                /* Boot */
+                if(optionArgumentPair.argument == NULL)
+                    boot = true;
+            }
+            else if((strcmp(optionArgumentPair.option, "c") == 0) || (strcmp(optionArgumentPair.option, "clock") == 0))
             {
                 /* Clock */
                 if(optionArgumentPair.argument == NULL)
@@ -415,16 +500,86 @@ static status_t cliCommandHandlerCallback_systemCommandHandlerCallback(uint8_t a
                 if(optionArgumentPair.argument == NULL)
                     help = true;
             }
+            else if((strcmp(optionArgumentPair.option, "i") == 0) || (strcmp(optionArgumentPair.option, "irq") == 0))
+            {
+                /* Interrupt Profile (Argument: Reset After Reporting) */
+                if(optionArgumentPair.argument == NULL)
+                {
+                    irq = true;
+                }
+                else if(strcmp(optionArgumentPair.argument, "RESET") == 0)
+                {
+                    irq = true;
+                    irqReset = true;
+                }
+            }
+            else if((strcmp(optionArgumentPair.option, "l") == 0) || (strcmp(optionArgumentPair.option, "log") == 0))
+            {
+                /* Log (No Argument: Report Only) */
+                if(optionArgumentPair.argument == NULL)
+                {
+                    logging = true;
+                }
+                else if(strcmp(optionArgumentPair.argument, "ON") == 0)
+                {
+                    logging = true;
+                    loggingEnabled = true;
+                }
+                else if(strcmp(optionArgumentPair.argument, "OFF") == 0)
+                {
+                    logging = true;
+                    loggingEnabled = false;
+                }
+            }
+            else if((strcmp(optionArgumentPair.option, "m") == 0) || (strcmp(optionArgumentPair.option, "mem") == 0))
+            {
+                /* Memory */
+                if(optionArgumentPair.argument == NULL)
+                    memory = true;
+            }
+            else if((strcmp(optionArgumentPair.option, "p") == 0) || (strcmp(optionArgumentPair.option, "power") == 0))
+            {
+                /* Power (Argument: Quiet Period In Milliseconds Before LPM3; 0: Never Sleep) */
+                power = true;
+                if(optionArgumentPair.argument != NULL)
+                {
+                    if(cli_getUnsigned32BitIntegerFromInput(optionArgumentPair.argument, &u32) == STATUS_SUCCESS)
+                        quietPeriod = (u32 > UINT16_MAX) ? UINT16_MAX : (uint16_t)u32;
+                    else
+                        power = false;
+                }
+            }
             else if((strcmp(optionArgumentPair.option, "r") == 0) || (strcmp(optionArgumentPair.option, "reset") == 0))
             {
                 /* Reset */
                 if(optionArgumentPair.argument == NULL)
                     reset = true;
             }
+            else if((strcmp(optionArgumentPair.option, "t") == 0) || (strcmp(optionArgumentPair.option, "trace") == 0))
+            {
+                /* Trace */
+                if(optionArgumentPair.argument == NULL)
+                    trace = true;
+            }
         }
     }
 
     /*** Handle Arguments ***/
+    /* Boot (Last system_init(): Reset Cause, Subsystems Kept By A Warm Reset, Boot To CLI Ready Time) */
+    if(boot)
+    {
+        system_getBoot(&bootInformation);
+        cliCallback_printfCallback(false, "Reset: %s (SYSRSTIV: 0x%04X)\n", bootInformation.warm ? "Warm" : "Cold", bootInformation.resetCause);
+        cliCallback_printfCallback(false, "Kept:");
+        for(subsystem = 0; subsystem < SYSTEM_SUBSYSTEM_COUNT; subsystem++)
+        {
+            if(bootInformation.kept & (1u << subsystem))
+                cliCallback_printfCallback(false, " %s", SubsystemNames[subsystem]);
+        }
+        cliCallback_printfCallback(false, "%s\n", (bootInformation.kept == 0) ? " None" : "");
+        cliCallback_printfCallback(true, "Boot To CLI Ready: %lu us\n", bootInformation.time); // Flush
+    }
+
     /* Clock */
     if(clock)
     {
@@ -437,11 +592,75 @@ static status_t cliCommandHandlerCallback_systemCommandHandlerCallback(uint8_t a
     if(help)
     {
         cliCallback_printfCallback(false, "usage: %s [OPTION]\n", CLI_COMMAND_HANDLER_CALLBACK_SYSTEM_COMMAND_NAME);
+        cliCallback_printfCallback(false, "  -b, --boot\n");
         cliCallback_printfCallback(false, "  -c, --clock\n");
         cliCallback_printfCallback(false, "  -h, --help\n");
-        cliCallback_printfCallback(true, "  -r, --reset\n"); // Flush
+        cliCallback_printfCallback(false, "  -i[RESET], --irq=[RESET]\n");
+        cliCallback_printfCallback(false, "  -l[ON|OFF], --log=[ON|OFF]\n");
+        cliCallback_printfCallback(false, "  -m, --mem\n");
+        cliCallback_printfCallback(false, "  -p[MILLISECONDS], --power=[MILLISECONDS]\n");
+        cliCallback_printfCallback(false, "  -r, --reset\n");
+        cliCallback_printfCallback(true, "  -t, --trace\n"); // Flush
+    }
+
+    /* Interrupt Profile (Profile Timer Cycles; Interrupt Handlers Count As Interrupts Disabled Windows, Nested Ones Only Their Entry And Exit) */
+    if(irq)
+    {
+        cliCallback_printfCallback(false, "%-10s%10s%7s%7s %s\n", "Vector", "Count", "Min", "Max", "Log2:Count");
+        for(vector = 0; vector < PROFILE_DRIVER_VECTOR_COUNT; vector++)
+        {
+            profileDriver_getStatistics((profileDriver_vector_t)vector, &statistics);
+            cliCallback_printfCallback(false, "%-10s%10lu%7u%7u", VectorNames[vector], statistics.count, (statistics.count > 0) ? statistics.minimum : 0, statistics.maximum);
+            for(bin = 0; bin < PROFILE_DRIVER_HISTOGRAM_BIN_COUNT; bin++)
+            {
+                if(statistics.histogram[bin] > 0)
+                    cliCallback_printfCallback(false, " %u:%u", bin, statistics.histogram[bin]);
+            }
+            cliCallback_printfCallback(true, "\n"); // Flush
+        }
+        cliCallback_printfCallback(true, "Interrupts Disabled Max: %u\n", profileDriver_getDisabledMaximum()); // Flush
+        if(irqReset)
+            profileDriver_reset();
+    }
+
+    /* Log (Binary Records Follow On The Same Wire While On; See log_driver.h) */
+    if(logging)
+    {
+        logDriver_setEnabled(loggingEnabled);
+        cliCallback_printfCallback(true, "Log: %s (Dropped Records: %u)\n", loggingEnabled ? "ON" : "OFF", logDriver_getDropCount()); // Flush
     }
 
+    /* Memory (Stack High Water Mark Since Boot) */
+    if(memory)
+    {
+        memoryDriver_getUsage(&usage);
+        cliCallback_printfCallback(false, "RAM: %u B\n", MEMORY_DRIVER_RAM_LENGTH);
+        cliCallback_printfCallback(false, ".bss: %u B\n", usage.bssLength);
+        cliCallback_printfCallback(false, ".data: %u B\n", usage.dataLength);
+        cliCallback_printfCallback(false, ".TI.noinit: %u B\n", usage.noinitLength);
+#if DRIVER_CONFIG_VECTOR_RAM
+        cliCallback_printfCallback(false, ".TI.ramfunc: %u B (Budget: %u B)\n", usage.ramfuncLength, VECTOR_DRIVER_RAMFUNC_BUDGET);
+        cliCallback_printfCallback(false, "Vectors: %u B\n", VECTOR_DRIVER_RAM_LENGTH);
+#endif
+        cliCallback_printfCallback(false, "Stack: %u B (High Water: %u B, Interrupt Entry: %u B%s)\n", usage.stackLength, usage.stackHighWater, usage.interruptEntryMaximum, usage.stackOverflow ? ", Overflow" : "");
+        cliCallback_printfCallback(true, "Free: %u B\n", usage.freeLength); // Flush
+    }
+
+    /* Power (Idle In LPM3 Once Quiet For The Quiet Period; CLI Start Bit Wakes) */
+    if(power)
+    {
+        if(quietPeriod != powerDriver_getQuietPeriod())
+            powerDriver_setQuietPeriod(quietPeriod);
+        if(quietPeriod == 0)
+            cliCallback_printfCallback(true, "Power: Never Sleep (Sleeps: %lu)\n", powerDriver_getSleepCount()); // Flush
+        else
+            cliCallback_printfCallback(true, "Power: LPM3 After %u ms Quiet (Sleeps: %lu)\n", quietPeriod, powerDriver_getSleepCount()); // Flush
+    }
+
+    /* Trace (Binary Dump; See trace_driver.h) */
+    if(trace)
+        traceDriver_dump();
+
     /* Reset (Must Come Last) */
     if(reset)
     {
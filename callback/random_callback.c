@@ -1,29 +1,128 @@
 /****************************************************************************************************
  * FILE:    random_callback.c
  * BRIEF:   Random Callback Source File
+ * NOTE:    xoshiro128** Engine (Blackman And Vigna): 128-Bit State, Period 2^128 - 1, Shifts, XORs And
+ *          Rotates Plus Two Multiplies By Small Constants Per 32-Bit Value; Streams Are 2^64 Values
+ *          Apart (Jump), So Up To 2^64 Streams Never Overlap
+ * NOTE:    Secure Random: The CTR_DRBG (drbg_driver) Is Seeded From The Entropy Driver In The
+ *          Background (randomCallback_tick) And Keeps A Pool Filled, So Requests Never Wait On Entropy
  ****************************************************************************************************/
 
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+/*** Secure Random (Security Strength 256 Bits) ***/
+#define RANDOM_CALLBACK_SECURE_INSTANTIATE_LENGTH ((256 + 128) / ENTROPY_DRIVER_MIN_ENTROPY) // Samples: Entropy Input And Nonce
+#define RANDOM_CALLBACK_SECURE_POOL_LENGTH        (32)                                       // Bytes
+#define RANDOM_CALLBACK_SECURE_RESEED_LENGTH      (256 / ENTROPY_DRIVER_MIN_ENTROPY)         // Samples: Entropy Input
+#define RANDOM_CALLBACK_SECURE_RESEED_THRESHOLD   (DRBG_DRIVER_RESEED_INTERVAL / 2)          // Reseed Well Before Generate Refuses
+
 /****************************************************************************************************
  * Includes
  ****************************************************************************************************/
 
+#include "drbg_driver.h"
+#include "entropy_driver.h"
 #include "project.h"
 #include "random_callback.h"
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
-#include <stdlib.h>
+#include <string.h>
 #include "tlv.h"
 
 /****************************************************************************************************
  * Constants and Variables
  ****************************************************************************************************/
 
+static const uint32_t randomCallback_jumpPolynomial[4] = {0x8764000Bu, 0xF542D2D3u, 0x6FA035C3u, 0x77F2DB5Bu}; // 2^64 Steps
+
 #pragma PERSISTENT(randomCallback_seed)
 PROJECT_STATIC uint16_t randomCallback_seed = 0;
+PROJECT_STATIC randomCallback_stream_t randomCallback_stream; // Stream 0: random_getRandom*() And randomCallback_fill(NULL, ...)
+static uint8_t randomCallback_securePool[RANDOM_CALLBACK_SECURE_POOL_LENGTH];
+PROJECT_STATIC uint8_t randomCallback_securePoolLength; // Unused Bytes, At The Start Of The Pool
+static uint16_t randomCallback_secureSeedCount;
+PROJECT_STATIC uint16_t randomCallback_secureSeedLength; // 0: Not Seeding
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static uint32_t randomCallback_rotateLeft(const uint32_t Value, const uint8_t Count);
+static uint64_t randomCallback_splitMix64(uint64_t * const State);
 
 /****************************************************************************************************
  * Function Definitions (Public)
  ****************************************************************************************************/
 
+/****************************************************************************************************
+ * FUNCT:   randomCallback_fill
+ * BRIEF:   Fill
+ * RETURN:  void: Returns Nothing
+ * ARG:     Stream: Stream (NULL: Stream 0, Shared With random_getRandom*())
+ * ARG:     Buffer: Buffer
+ * ARG:     Length: Length (Bytes)
+ * NOTE:    Little-Endian 32-Bit Values; A Partial Trailing Value Still Advances The Stream By One
+ ****************************************************************************************************/
+void randomCallback_fill(randomCallback_stream_t * const Stream, void * const Buffer, const size_t Length)
+{
+    randomCallback_stream_t *stream;
+    uint8_t *buffer;
+    size_t i;
+    uint32_t value;
+
+    /*** Fill ***/
+    stream = (Stream != NULL) ? Stream : &randomCallback_stream;
+    buffer = (uint8_t *)Buffer;
+    for(i = 0; (i + sizeof(value)) <= Length; i += sizeof(value))
+    {
+        value = randomCallback_next(stream);
+        buffer[i] = (uint8_t)value;
+        buffer[i + 1] = (uint8_t)(value >> 8);
+        buffer[i + 2] = (uint8_t)(value >> 16);
+        buffer[i + 3] = (uint8_t)(value >> 24);
+    }
+
+    /*** Partial Trailing Value ***/
+    if(i < Length)
+    {
+        for(value = randomCallback_next(stream); i < Length; i++, value >>= 8)
+            buffer[i] = (uint8_t)value;
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   randomCallback_fillSecure
+ * BRIEF:   Fill Secure
+ * RETURN:  bool: Filled (true) Or Not Seeded Yet (false)
+ * ARG:     Buffer: Buffer
+ * ARG:     Length: Length (Bytes)
+ * NOTE:    Never Waits On Entropy: The Pool Is Drained First, The Rest Generated Directly
+ ****************************************************************************************************/
+bool randomCallback_fillSecure(void * const Buffer, const size_t Length)
+{
+    uint8_t *buffer;
+    size_t length;
+
+    /*** Error Check ***/
+    if(drbgDriver_getReseedCounter() == 0)
+        return false;
+
+    /*** Drain Pool (Used Bytes Are Zeroized) ***/
+    buffer = (uint8_t *)Buffer;
+    length = (Length < randomCallback_securePoolLength) ? Length : randomCallback_securePoolLength;
+    randomCallback_securePoolLength = (uint8_t)(randomCallback_securePoolLength - length);
+    (void)memcpy(buffer, &randomCallback_securePool[randomCallback_securePoolLength], length);
+    (void)memset(&randomCallback_securePool[randomCallback_securePoolLength], 0, length);
+
+    /*** Generate The Rest ***/
+    if(length == Length)
+        return true;
+    return drbgDriver_generate(&buffer[length], Length - length);
+}
+
 /****************************************************************************************************
  * FUNCT:   randomCallback_getRandomUnsigned32BitIntegerCallback
  * BRIEF:   Get Random Unsigned 32-Bit Integer Callback
@@ -34,11 +133,7 @@ PROJECT_STATIC uint16_t randomCallback_seed = 0;
 uint32_t randomCallback_getRandomUnsigned32BitIntegerCallback(void)
 {
     /*** Get Random Unsigned 32-Bit Integer ***/
-#ifdef __UNIT_TEST_
-	return (uint32_t)(((rand() & 0xFFFF) << 16) | (rand() & 0xFFFF)); // Returns Value Between 0 And RAND_MAX (2,147,483,647 For Unit Test)
-#else
-	return ((((uint32_t)rand() & 0xFF) << 24) | (((uint32_t)rand() & 0xFF) << 16) | (((uint32_t)rand() & 0xFF) << 8) | ((uint32_t)rand() & 0xFF)); // Returns Value Between 0 And RAND_MAX (32,767 For MSP430)
-#endif
+    return randomCallback_next(&randomCallback_stream);
 }
 
 /****************************************************************************************************
@@ -64,5 +159,180 @@ void randomCallback_init(void)
 	/*** Initialize ***/
 	if(randomCallback_seed == 0)
 		randomCallback_seed = TLV_getDeviceType(); // Unique Device ID
-	srand(randomCallback_seed++);
+	randomCallback_seed++;
+	randomCallback_initStream(&randomCallback_stream, 0);
+
+	/*** Initialize Secure Random (Seeded In The Background) ***/
+	(void)memset(randomCallback_securePool, 0, sizeof(randomCallback_securePool));
+	randomCallback_securePoolLength = 0;
+	randomCallback_secureSeedCount = 0;
+	randomCallback_secureSeedLength = 0;
+}
+
+/****************************************************************************************************
+ * FUNCT:   randomCallback_initStream
+ * BRIEF:   Initialize Stream
+ * RETURN:  void: Returns Nothing
+ * ARG:     Stream: Stream
+ * ARG:     Index: Stream Index (0: Same Sequence As random_getRandom*() After randomCallback_init)
+ * NOTE:    The Seed Is Expanded With SplitMix64, Then Jumped Index Times, So Streams With Different
+ *          Indexes Are Independent (Non-Overlapping) For 2^64 Values Each
+ ****************************************************************************************************/
+void randomCallback_initStream(randomCallback_stream_t * const Stream, const uint16_t Index)
+{
+    uint64_t seed, value;
+    uint16_t i;
+
+    /*** Expand Seed (SplitMix64 Never Yields An All-Zero State From Two Consecutive Outputs) ***/
+    seed = randomCallback_getSeed();
+    value = randomCallback_splitMix64(&seed);
+    Stream->state[0] = (uint32_t)value;
+    Stream->state[1] = (uint32_t)(value >> 32);
+    value = randomCallback_splitMix64(&seed);
+    Stream->state[2] = (uint32_t)value;
+    Stream->state[3] = (uint32_t)(value >> 32);
+
+    /*** Jump To Stream ***/
+    for(i = 0; i < Index; i++)
+        randomCallback_jump(Stream);
+}
+
+/****************************************************************************************************
+ * FUNCT:   randomCallback_jump
+ * BRIEF:   Jump
+ * RETURN:  void: Returns Nothing
+ * ARG:     Stream: Stream
+ * NOTE:    Equivalent To 2^64 Calls To randomCallback_next (128 Calls In Practice)
+ ****************************************************************************************************/
+void randomCallback_jump(randomCallback_stream_t * const Stream)
+{
+    uint32_t state[4];
+    uint8_t bit, i, word;
+
+    /*** Jump ***/
+    (void)memset(state, 0, sizeof(state));
+    for(word = 0; word < 4; word++)
+    {
+        for(bit = 0; bit < 32; bit++)
+        {
+            if((randomCallback_jumpPolynomial[word] & ((uint32_t)1 << bit)) != 0)
+            {
+                for(i = 0; i < 4; i++)
+                    state[i] ^= Stream->state[i];
+            }
+            (void)randomCallback_next(Stream);
+        }
+    }
+    (void)memcpy(Stream->state, state, sizeof(state));
+}
+
+/****************************************************************************************************
+ * FUNCT:   randomCallback_next
+ * BRIEF:   Next
+ * RETURN:  uint32_t: Random Unsigned 32-Bit Integer
+ * ARG:     Stream: Stream
+ ****************************************************************************************************/
+uint32_t randomCallback_next(randomCallback_stream_t * const Stream)
+{
+    uint32_t result, temporary;
+
+    /*** Scramble (** : Multiply By 5, Rotate, Multiply By 9; Shifts And Adds On A 16-Bit Core) ***/
+    result = randomCallback_rotateLeft(Stream->state[1] * 5, 7) * 9;
+
+    /*** Advance ***/
+    temporary = Stream->state[1] << 9;
+    Stream->state[2] ^= Stream->state[0];
+    Stream->state[3] ^= Stream->state[1];
+    Stream->state[1] ^= Stream->state[2];
+    Stream->state[0] ^= Stream->state[3];
+    Stream->state[2] ^= temporary;
+    Stream->state[3] = randomCallback_rotateLeft(Stream->state[3], 11);
+
+    return result;
+}
+
+/****************************************************************************************************
+ * FUNCT:   randomCallback_tick
+ * BRIEF:   Tick
+ * RETURN:  void: Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Idle Work For Secure Random: Feeds Ready Entropy Samples To The DRBG While It Needs Seeding
+ *          (Instantiate, Or Reseed Past RANDOM_CALLBACK_SECURE_RESEED_THRESHOLD Requests) And Refills
+ *          The Pool Once It Is Empty
+ ****************************************************************************************************/
+void randomCallback_tick(void)
+{
+    uint32_t reseedCounter;
+    uint8_t sample;
+
+    /*** Gather Entropy ***/
+    reseedCounter = drbgDriver_getReseedCounter();
+    if((reseedCounter == 0) || (reseedCounter > RANDOM_CALLBACK_SECURE_RESEED_THRESHOLD))
+    {
+        /* Start Seed */
+        if(randomCallback_secureSeedLength == 0)
+        {
+            randomCallback_secureSeedCount = 0;
+            randomCallback_secureSeedLength = (reseedCounter == 0) ? RANDOM_CALLBACK_SECURE_INSTANTIATE_LENGTH : RANDOM_CALLBACK_SECURE_RESEED_LENGTH;
+            drbgDriver_startSeed(randomCallback_secureSeedLength);
+        }
+
+        /* Add Sample */
+        switch(entropyDriver_getSample(&sample))
+        {
+            case ENTROPY_DRIVER_RESULT_SAMPLE:
+                drbgDriver_addSeed(sample);
+                if(++randomCallback_secureSeedCount >= randomCallback_secureSeedLength)
+                {
+                    (void)drbgDriver_finishSeed();
+                    randomCallback_secureSeedLength = 0;
+                }
+                break;
+            case ENTROPY_DRIVER_RESULT_FAILURE:
+                randomCallback_secureSeedLength = 0; // Discard The Seed In Progress, Start Over
+                break;
+            default:
+                break;
+        }
+    }
+
+    /*** Refill Pool ***/
+    if((randomCallback_securePoolLength == 0) && drbgDriver_generate(randomCallback_securePool, sizeof(randomCallback_securePool)))
+        randomCallback_securePoolLength = sizeof(randomCallback_securePool);
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   randomCallback_rotateLeft
+ * BRIEF:   Rotate Left
+ * RETURN:  uint32_t: Rotated Value
+ * ARG:     Value: Value
+ * ARG:     Count: Count (1 To 31)
+ ****************************************************************************************************/
+static uint32_t randomCallback_rotateLeft(const uint32_t Value, const uint8_t Count)
+{
+    /*** Rotate Left ***/
+    return (Value << Count) | (Value >> (32 - Count));
+}
+
+/****************************************************************************************************
+ * FUNCT:   randomCallback_splitMix64
+ * BRIEF:   SplitMix64
+ * RETURN:  uint64_t: Next Output
+ * ARG:     State: State (Advanced)
+ * NOTE:    Seeding Only (64-Bit Multiplies Are Slow On The MSP430, But Run Once Per Stream)
+ ****************************************************************************************************/
+static uint64_t randomCallback_splitMix64(uint64_t * const State)
+{
+    uint64_t value;
+
+    /*** SplitMix64 ***/
+    *State += 0x9E3779B97F4A7C15u;
+    value = *State;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9u;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBu;
+    return value ^ (value >> 31);
 }
@@ -10,14 +10,31 @@
  * Includes
  ****************************************************************************************************/
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef struct randomCallback_stream_s
+{
+    uint32_t state[4]; // xoshiro128** State (Never All Zero)
+} randomCallback_stream_t;
+
 /****************************************************************************************************
  * Function Prototypes
  ****************************************************************************************************/
 
+extern void randomCallback_fill(randomCallback_stream_t * const Stream, void * const Buffer, const size_t Length);
+extern bool randomCallback_fillSecure(void * const Buffer, const size_t Length);
 extern uint32_t randomCallback_getRandomUnsigned32BitIntegerCallback(void);
 extern uint16_t randomCallback_getSeed(void);
 extern void randomCallback_init(void);
+extern void randomCallback_initStream(randomCallback_stream_t * const Stream, const uint16_t Index);
+extern void randomCallback_jump(randomCallback_stream_t * const Stream);
+extern uint32_t randomCallback_next(randomCallback_stream_t * const Stream);
+extern void randomCallback_tick(void);
 
 #endif
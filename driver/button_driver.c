@@ -10,8 +10,12 @@
 #include "button_driver.h"
 #include "driver_config.h"
 #include "gpio.h"
+#include "init_driver.h"
+#include "init_driver_table.h"
 #include "led_driver.h"
+#include "log_driver.h"
 #include "msp430fr5xx_6xxgeneric.h"
+#include "port_driver.h"
 #include "project.h"
 #include <stdbool.h>
 #include <stdint.h>
@@ -22,19 +26,26 @@
 
 PROJECT_STATIC volatile uint8_t buttonDriver_state;
 
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void buttonDriver_portCallback(const portDriver_event_t * const Event);
+
 /****************************************************************************************************
  * Function Definitions (Public)
  ****************************************************************************************************/
 
 /****************************************************************************************************
- * FUNCT:   buttonDriver_init
- * BRIEF:   Initialize
+ * FUNCT:   buttonDriver_configure
+ * BRIEF:   Configure
  * RETURN:  Returns Nothing
  * ARG:     No Arguments
+ * NOTE:    Registers Only, Through driverlib; init_generator Turns It Into initDriverTable_button
  ****************************************************************************************************/
-void buttonDriver_init(void)
+void buttonDriver_configure(void)
 {
-    /*** Initialize ***/
+    /*** Configure ***/
     /* GPIO Pins */
     GPIO_setAsInputPinWithPullUpResistor(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT, DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PIN);
     GPIO_setAsInputPinWithPullUpResistor(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_2_PORT, DRIVER_CONFIG_BUTTON_GPIO_BUTTON_2_PIN);
@@ -48,81 +59,29 @@ void buttonDriver_init(void)
     GPIO_selectInterruptEdge(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_2_PORT, DRIVER_CONFIG_BUTTON_GPIO_BUTTON_2_PIN, GPIO_HIGH_TO_LOW_TRANSITION);
     GPIO_clearInterrupt(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_2_PORT, DRIVER_CONFIG_BUTTON_GPIO_BUTTON_2_PIN);
     GPIO_enableInterrupt(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_2_PORT, DRIVER_CONFIG_BUTTON_GPIO_BUTTON_2_PIN);
-
-    /* Button State */
-    buttonDriver_state = 0x00;
 }
 
 /****************************************************************************************************
- * FUNCT:   buttonDriver_portInterruptHandler
- * BRIEF:   Port Interrupt Handler
+ * FUNCT:   buttonDriver_init
+ * BRIEF:   Initialize
  * RETURN:  Returns Nothing
- * ARG:     InterruptFlag: Interrupt Flag
+ * ARG:     No Arguments
  ****************************************************************************************************/
-void buttonDriver_portInterruptHandler(uint16_t InterruptFlag)
+void buttonDriver_init(void)
 {
-    /*** Handle Interrupt */
-    switch(InterruptFlag)
-    {
-        case P1IV_NONE:
-            /*** No Interrupt ***/
-            break;
-        case P1IV_P1IFG0:
-            /*** P1.0 Interrupt ***/
-            break;
-        case P1IV_P1IFG1:
-            /*** BUTTON 1 (P1.1) Interrupt ***/
-            /* Change Button State */
-            buttonDriver_state ^= BUTTON_DRIVER_BUTTON_1;
-
-            /* Switch Edge Direction */
-            if((buttonDriver_state & BUTTON_DRIVER_BUTTON_1) == BUTTON_DRIVER_BUTTON_1)
-            {
-                /* Button Is Pressed; Button Edge Was High To Low; Switch To Low To High To Detect Button Release (Active Low) */
-                GPIO_selectInterruptEdge(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT, DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PIN, GPIO_LOW_TO_HIGH_TRANSITION);
-            }
-            else
-            {
-                /* Button Is Released;Button Edge Was Low To High; Switch To High To Low To Detect Button Press (Active Low) */
-                GPIO_selectInterruptEdge(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT, DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PIN, GPIO_HIGH_TO_LOW_TRANSITION);
-            }
-            break;
-        case P1IV_P1IFG2:
-            /*** BUTTON 2 (P1.2) Interrupt ***/
-            /* Change Button State */
-            buttonDriver_state ^= BUTTON_DRIVER_BUTTON_2;
-
-            /* Switch Edge Direction */
-            if((buttonDriver_state & BUTTON_DRIVER_BUTTON_2) == BUTTON_DRIVER_BUTTON_2)
-            {
-                /* Button Is Pressed; Button Edge Was High To Low; Switch To Low To High To Detect Button Release (Active Low) */
-                GPIO_selectInterruptEdge(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_2_PORT, DRIVER_CONFIG_BUTTON_GPIO_BUTTON_2_PIN, GPIO_LOW_TO_HIGH_TRANSITION);
-            }
-            else
-            {
-                /* Button Is Released;Button Edge Was Low To High; Switch To High To Low To Detect Button Press (Active Low) */
-                GPIO_selectInterruptEdge(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_2_PORT, DRIVER_CONFIG_BUTTON_GPIO_BUTTON_2_PIN, GPIO_HIGH_TO_LOW_TRANSITION);
-            }
-            break;
-        case P1IV_P1IFG3:
-            /*** P1.3 Interrupt ***/
-            break;
-        case P1IV_P1IFG4:
-            /*** P1.4 Interrupt ***/
-            break;
-        case P1IV_P1IFG5:
-            /*** P1.5 Interrupt ***/
-            break;
-        case P1IV_P1IFG6:
-            /*** P1.6 Interrupt ***/
-            break;
-        case P1IV_P1IFG7:
-            /*** P1.7 Interrupt ***/
-            break;
-        default:
-            /*** Do Nothing */
-            break;
-    }
+    /*** Port Callbacks (Both Edges: Press And Release) ***/
+    (void)portDriver_register(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT, DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PIN, buttonDriver_portCallback, PORT_DRIVER_FLAG_TOGGLE_EDGE);
+    (void)portDriver_register(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_2_PORT, DRIVER_CONFIG_BUTTON_GPIO_BUTTON_2_PIN, buttonDriver_portCallback, PORT_DRIVER_FLAG_TOGGLE_EDGE);
+
+    /*** Registers ***/
+#if DRIVER_CONFIG_INIT_TABLE
+    initDriver_apply(initDriverTable_button, INIT_DRIVER_TABLE_BUTTON_LENGTH);
+#else
+    buttonDriver_configure();
+#endif
+
+    /*** Button State ***/
+    buttonDriver_state = 0x00;
 }
 
 /****************************************************************************************************
@@ -152,3 +111,33 @@ void buttonDriver_tick(void)
 			ledDriver_setState(LED_DRIVER_LED_2, false);
 	}
 }
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   buttonDriver_portCallback
+ * BRIEF:   Port Callback
+ * RETURN:  Returns Nothing
+ * ARG:     Event: Edge (The Port Driver Already Switched PxIES To The Opposite Edge)
+ ****************************************************************************************************/
+static void buttonDriver_portCallback(const portDriver_event_t * const Event)
+{
+    uint8_t button;
+
+    /*** Button ***/
+    if((Event->port == DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT) && (Event->pin == DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PIN))
+        button = BUTTON_DRIVER_BUTTON_1;
+    else
+        button = BUTTON_DRIVER_BUTTON_2;
+
+    /*** Change Button State (Active Low: High To Low Is A Press, Low To High A Release) ***/
+    if(Event->rising)
+        buttonDriver_state &= (uint8_t)~button;
+    else
+        buttonDriver_state |= button;
+
+    /*** Log ***/
+    LOG_DRIVER_LOG2("Button Interrupt: Pin 0x%02X, State 0x%02X", Event->pin, buttonDriver_state);
+}
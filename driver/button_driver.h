@@ -23,8 +23,8 @@
  * Function Prototypes
  ****************************************************************************************************/
 
+extern void buttonDriver_configure(void);
 extern void buttonDriver_init(void);
-extern void buttonDriver_portInterruptHandler(uint16_t InterruptFlag);
 extern void buttonDriver_tick(void);
 
 #endif
@@ -0,0 +1,447 @@
+/****************************************************************************************************
+ * FILE:    checkpoint_driver.c
+ * BRIEF:   Checkpoint Driver Source File
+ * NOTE:    Comp_E Rather Than The PMM: On FR Devices The High-Side Supervisor (SVSH) Triggers A
+ *          Brownout Reset, Not An Interrupt, So It Can't Give Any Warning
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#ifdef __UNIT_TEST__
+/*** Host: Stand-In For The .checkpoint Section, In Simulated FRAM (checkpoint_driver_test.h) ***/
+#define CHECKPOINT_DRIVER_SLOT_ADDRESS(SLOT) ((uint16_t)(CHECKPOINT_DRIVER_TEST_SLOT_START + ((SLOT) * sizeof(checkpointDriver_slot_t))))
+#else
+/*** Target: .checkpoint Section (lnk_msp430fr6989.cmd) ***/
+#define CHECKPOINT_DRIVER_SLOT_ADDRESS(SLOT) ((uint16_t)(uintptr_t)&checkpointDriver_slots[(SLOT)])
+#endif
+
+#define CHECKPOINT_DRIVER_FIELD_ADDRESS(SLOT, FIELD) ((uint16_t)(CHECKPOINT_DRIVER_SLOT_ADDRESS(SLOT) + offsetof(checkpointDriver_slot_t, FIELD)))
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "checkpoint_driver.h"
+#include "comp_e.h"
+#include "cs.h"
+#include "driver_config.h"
+#include "inc/hw_memmap.h"
+#include "intrinsics.h"
+#include "memory_driver.h"
+#include "msp430fr5xx_6xxgeneric.h"
+#include "msp430fr6989.h"
+#include "pmm.h"
+#include "project.h"
+#ifndef __UNIT_TEST__
+#include <setjmp.h>
+#endif
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "wdt_a.h"
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+#ifndef __UNIT_TEST__
+#pragma DATA_SECTION(checkpointDriver_slots, ".checkpoint")
+static checkpointDriver_slot_t checkpointDriver_slots[CHECKPOINT_DRIVER_SLOT_COUNT]; // FRAM, Not Initialized
+static jmp_buf checkpointDriver_context;                                             // RAM: Saved In The Image
+#else
+static uint16_t checkpointDriver_resumeSlot; // Target: In A Register (checkpointDriver_jumpToImage())
+#endif
+
+PROJECT_STATIC uint8_t checkpointDriver_newestSlot = CHECKPOINT_DRIVER_SLOT_NONE; // Newest Committed Slot
+PROJECT_STATIC uint16_t checkpointDriver_sequence;                                // Of The Newest Committed Slot
+
+/*** Peripheral Registers Configured By system_init() (Read Back On Save, Written In Order On Resume) ***/
+static const checkpointDriver_registerRange_t checkpointDriver_registerRanges[] =
+{
+    /* System Control: SYSRIVECT (The RAM Vector Table Itself Is Part Of The Image) */
+    {SYS_BASE + OFS_SYSCTL, 1},
+
+    /* Clock System (Unlocked Around The Restore) */
+    {CS_BASE + OFS_CSCTL1, 6},
+
+    /* Ports: OUT, DIR, REN, SEL0, SEL1; IES, IE (Take Effect Once LPM5 Is Unlocked) */
+    {PA_BASE + OFS_PAOUT, 6}, {PA_BASE + OFS_PAIES, 2},
+    {PB_BASE + OFS_PAOUT, 6}, {PB_BASE + OFS_PAIES, 2},
+    {PC_BASE + OFS_PAOUT, 6}, {PC_BASE + OFS_PAIES, 2},
+    {PD_BASE + OFS_PAOUT, 6}, {PD_BASE + OFS_PAIES, 2},
+    {PE_BASE + OFS_PAOUT, 6}, {PE_BASE + OFS_PAIES, 2},
+    {PJ_BASE + OFS_PJOUT, 6},
+
+    /* LCD: Configuration, Memory, Blinking Memory, Then LCDON */
+    {LCD_C_BASE + OFS_LCDCCTL1, 9},
+    {LCD_C_BASE + OFS_LCDM1, 11},
+    {LCD_C_BASE + OFS_LCDBM1, 11},
+    {LCD_C_BASE + OFS_LCDCCTL0, 1},
+
+    /* Timers: Capture/Compare, Count, Expansion, Then The Mode (LED/Log/Power, Entropy, Trace) */
+    {DRIVER_CONFIG_LED_TIMER + OFS_TAxCCTL0, 3}, {DRIVER_CONFIG_LED_TIMER + OFS_TAxR, 4}, {DRIVER_CONFIG_LED_TIMER + OFS_TAxEX0, 1}, {DRIVER_CONFIG_LED_TIMER + OFS_TAxCTL, 1},
+    {DRIVER_CONFIG_ENTROPY_TIMER + OFS_TAxCCTL0, 3}, {DRIVER_CONFIG_ENTROPY_TIMER + OFS_TAxR, 4}, {DRIVER_CONFIG_ENTROPY_TIMER + OFS_TAxEX0, 1}, {DRIVER_CONFIG_ENTROPY_TIMER + OFS_TAxCTL, 1},
+    {DRIVER_CONFIG_TRACE_TIMER + OFS_TBxR, 1}, {DRIVER_CONFIG_TRACE_TIMER + OFS_TBxEX0, 1}, {DRIVER_CONFIG_TRACE_TIMER + OFS_TBxCTL, 1},
+
+    /* CLI UART: Baud Rate While Held In Reset, Release, Then The Interrupt Enables */
+    {DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxBRW, 2}, {DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxCTLW0, 1}, {DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxIE, 1}
+};
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void checkpointDriver_copyRegisters(const uint16_t SlotAddress, const bool Restore);
+static void checkpointDriver_finishResume(void);
+static void checkpointDriver_initComparator(void);
+static void checkpointDriver_invalidate(void);
+#ifdef __UNIT_TEST__
+static void checkpointDriver_restoreImage(void);
+#else
+#pragma FUNC_NEVER_RETURNS(checkpointDriver_jumpToImage)
+extern void checkpointDriver_jumpToImage(jmp_buf Context, const uint16_t ImageAddress); // checkpoint_driver_resume.asm
+#endif
+static bool checkpointDriver_save(void);
+static void checkpointDriver_scan(void);
+static void checkpointDriver_watchSupply(const uint16_t Edge);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   checkpointDriver_comparatorInterruptHandler
+ * BRIEF:   Comparator Interrupt Handler
+ * RETURN:  void: Returns Nothing
+ * ARG:     InterruptFlag: CEIV
+ * NOTE:    The Output Level Tells The Edge: Low, The Supply Is Collapsing (Checkpoint, Then Watch For
+ *          The Rising Edge); High, It Recovered And The Code Carries On, So The Checkpoint Is Stale
+ *          (Invalidate, Then Watch For The Next Dip)
+ ****************************************************************************************************/
+void checkpointDriver_comparatorInterruptHandler(const uint16_t InterruptFlag)
+{
+    if(InterruptFlag != CEIV_CEIFG)
+        return;
+
+    /*** Supply Collapsing ***/
+    if((HWREG16(COMP_E_BASE + OFS_CECTL1) & CEOUT) == 0)
+    {
+        if(checkpointDriver_save())
+            return; // Resumed: checkpointDriver_finishResume() Armed The Falling Edge
+        checkpointDriver_watchSupply(COMP_E_RISINGEDGE);
+    }
+
+    /*** Supply Recovered ***/
+    else
+    {
+        checkpointDriver_invalidate();
+        checkpointDriver_watchSupply(COMP_E_FALLINGEDGE);
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   checkpointDriver_getSequence
+ * BRIEF:   Get Sequence
+ * RETURN:  uint16_t: Sequence Number Of The Newest Checkpoint Saved Or Resumed (0: None)
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+uint16_t checkpointDriver_getSequence(void)
+{
+    /*** Get Sequence ***/
+    return checkpointDriver_sequence;
+}
+
+/****************************************************************************************************
+ * FUNCT:   checkpointDriver_init
+ * BRIEF:   Initialize
+ * RETURN:  void: Returns Nothing
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+void checkpointDriver_init(void)
+{
+    /*** Slots ***/
+    checkpointDriver_scan();
+
+    /*** Supply Monitor ***/
+    checkpointDriver_initComparator();
+}
+
+/****************************************************************************************************
+ * FUNCT:   checkpointDriver_resume
+ * BRIEF:   Resume
+ * RETURN:  bool: Resumed (true) Or No Committed Checkpoint, So Initialize As Usual (false)
+ * ARG:     ResetCause: SYSRSTIV Of This Reset (system_getResetCause())
+ * NOTE:    Only A Power Failure (Brownout Or High-Side Supervisor) Resumes; Any Other Reset (RST Pin,
+ *          Watchdog, Software BOR/POR, PUC) Discards A Committed Checkpoint And Starts Cleanly
+ * NOTE:    Call First Thing After Reset; On The Target It Doesn't Return On Success: Execution
+ *          Continues In The Interrupted Code; On The Host It Returns With RAM And The Stack Pointer
+ *          And Status Register (As They Were In The Interrupt Handler) Restored
+ * NOTE:    Idempotent Until The Image Is Back In RAM, So A Power Cut While Resuming Just Resumes
+ *          Again On The Next Boot
+ ****************************************************************************************************/
+bool checkpointDriver_resume(const uint16_t ResetCause)
+{
+    uint16_t slotAddress;
+
+    /*** Newest Committed Checkpoint ***/
+    checkpointDriver_scan();
+    if(checkpointDriver_newestSlot == CHECKPOINT_DRIVER_SLOT_NONE)
+        return false;
+
+    /*** Power Failure Only ***/
+    if((ResetCause != SYSRSTIV_BOR) && (ResetCause != SYSRSTIV_SVSHIFG))
+    {
+        checkpointDriver_invalidate();
+        return false;
+    }
+    slotAddress = CHECKPOINT_DRIVER_SLOT_ADDRESS(checkpointDriver_newestSlot);
+
+    /*** Peripheral Registers ***/
+    WDT_A_hold(WDT_A_BASE);
+    HWREG8(CS_BASE + OFS_CSCTL0_H) = CSKEY_H;
+    checkpointDriver_copyRegisters(slotAddress, true);
+    HWREG8(CS_BASE + OFS_CSCTL0_H) = 0; // Lock
+    PMM_unlockLPM5();
+
+    /*** RAM And CPU Context ***/
+#ifdef __UNIT_TEST__
+    checkpointDriver_resumeSlot = slotAddress;
+    checkpointDriver_restoreImage();
+    __set_SP_register(HWREG16(slotAddress + offsetof(checkpointDriver_slot_t, header.stackPointer)));
+    __set_interrupt_state(HWREG16(slotAddress + offsetof(checkpointDriver_slot_t, header.statusRegister)));
+    checkpointDriver_finishResume();
+    return true;
+#else
+    /* Assembly: Copies On The TINYRAM Stack, Then Returns From setjmp() In checkpointDriver_save() */
+    checkpointDriver_jumpToImage(checkpointDriver_context, (uint16_t)(slotAddress + offsetof(checkpointDriver_slot_t, image)));
+#endif
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   checkpointDriver_copyRegisters
+ * BRIEF:   Copy Registers
+ * RETURN:  void: Returns Nothing
+ * ARG:     SlotAddress: Slot
+ * ARG:     Restore: Slot To Registers (true) Or Registers To Slot (false)
+ ****************************************************************************************************/
+static void checkpointDriver_copyRegisters(const uint16_t SlotAddress, const bool Restore)
+{
+    uint16_t address, end, offset;
+    uint8_t range;
+
+    /*** Ranges In Table Order ***/
+    offset = offsetof(checkpointDriver_slot_t, registers);
+    for(range = 0; range < (sizeof(checkpointDriver_registerRanges) / sizeof(checkpointDriver_registerRanges[0])); range++)
+    {
+        end = (uint16_t)(checkpointDriver_registerRanges[range].address + (checkpointDriver_registerRanges[range].length * sizeof(uint16_t)));
+        for(address = checkpointDriver_registerRanges[range].address; (address < end) && (offset < offsetof(checkpointDriver_slot_t, image)); address += sizeof(uint16_t))
+        {
+            if(Restore)
+                HWREG16(address) = HWREG16(SlotAddress + offset);
+            else
+                HWREG16(SlotAddress + offset) = HWREG16(address);
+            offset += sizeof(uint16_t);
+        }
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   checkpointDriver_finishResume
+ * BRIEF:   Finish Resume
+ * RETURN:  void: Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    The Checkpoint Is Consumed, So A Later Power Failure Before The Next Dip Starts Cleanly
+ ****************************************************************************************************/
+static void checkpointDriver_finishResume(void)
+{
+    /*** Supply Monitor (Comp_E Isn't Part Of The Saved Registers) ***/
+    checkpointDriver_initComparator();
+
+    /*** Consume ***/
+    checkpointDriver_scan();
+    checkpointDriver_invalidate();
+
+    /*** Low-Frequency Crystal Oscillator (LFXT): Restarted By CSCTL4, Wait Until Stable ***/
+    CS_turnOnLFXT(CS_LFXT_DRIVE_3);
+}
+
+/****************************************************************************************************
+ * FUNCT:   checkpointDriver_initComparator
+ * BRIEF:   Initialize Comparator
+ * RETURN:  void: Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    V+ Is VCC Through The Divider, V- The Reference Ladder; The Output Falls As VCC Drops
+ *          Through The Trip Point; The Filter Rejects Load Transients
+ ****************************************************************************************************/
+static void checkpointDriver_initComparator(void)
+{
+    Comp_E_initParam comparatorInit;
+
+    /*** Comparator ***/
+    comparatorInit.posTerminalInput = DRIVER_CONFIG_CHECKPOINT_COMPARATOR_INPUT;
+    comparatorInit.negTerminalInput = COMP_E_VREF;
+    comparatorInit.outputFilterEnableAndDelayLevel = COMP_E_FILTEROUTPUT_DLYLVL4;
+    comparatorInit.invertedOutputPolarity = COMP_E_NORMALOUTPUTPOLARITY;
+    (void)Comp_E_init(COMP_E_BASE, &comparatorInit);
+    Comp_E_setReferenceVoltage(COMP_E_BASE, DRIVER_CONFIG_CHECKPOINT_COMPARATOR_REFERENCE, DRIVER_CONFIG_CHECKPOINT_COMPARATOR_LEVEL, DRIVER_CONFIG_CHECKPOINT_COMPARATOR_LEVEL);
+    Comp_E_setReferenceAccuracy(COMP_E_BASE, COMP_E_ACCURACY_CLOCKED);
+    Comp_E_setPowerMode(COMP_E_BASE, COMP_E_NORMAL_MODE);
+
+    /*** Falling Edge Interrupt ***/
+    Comp_E_setInterruptEdgeDirection(COMP_E_BASE, COMP_E_FALLINGEDGE);
+    Comp_E_clearInterrupt(COMP_E_BASE, COMP_E_OUTPUT_INTERRUPT_FLAG);
+    Comp_E_enableInterrupt(COMP_E_BASE, COMP_E_OUTPUT_INTERRUPT);
+    Comp_E_enable(COMP_E_BASE);
+}
+
+/****************************************************************************************************
+ * FUNCT:   checkpointDriver_invalidate
+ * BRIEF:   Invalidate
+ * RETURN:  void: Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Both Markers, Older Slot First, So A Cut In Between Never Leaves Only The Older One
+ ****************************************************************************************************/
+static void checkpointDriver_invalidate(void)
+{
+    uint8_t slot;
+
+    /*** Invalidate ***/
+    if(checkpointDriver_newestSlot == CHECKPOINT_DRIVER_SLOT_NONE)
+        return;
+    slot = (checkpointDriver_newestSlot == 0) ? 1 : 0;
+    HWREG16(CHECKPOINT_DRIVER_FIELD_ADDRESS(slot, header.marker)) = 0;
+    HWREG16(CHECKPOINT_DRIVER_FIELD_ADDRESS(checkpointDriver_newestSlot, header.marker)) = 0;
+    checkpointDriver_newestSlot = CHECKPOINT_DRIVER_SLOT_NONE;
+}
+
+#ifdef __UNIT_TEST__
+/****************************************************************************************************
+ * FUNCT:   checkpointDriver_restoreImage
+ * BRIEF:   Restore Image
+ * RETURN:  void: Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Host Only: The Same Copy As checkpointDriver_jumpToImage(), Which Can't Be C On The Target
+ *          (It Overwrites The Stack It Runs On); The Slot Comes From checkpointDriver_resumeSlot
+ ****************************************************************************************************/
+static void checkpointDriver_restoreImage(void)
+{
+    uint16_t address, offset;
+
+    /*** RAM ***/
+    offset = offsetof(checkpointDriver_slot_t, image);
+    for(address = MEMORY_DRIVER_RAM_START; address < (MEMORY_DRIVER_RAM_START + CHECKPOINT_DRIVER_IMAGE_LENGTH); address += sizeof(uint16_t))
+    {
+        HWREG16(address) = HWREG16(checkpointDriver_resumeSlot + offset);
+        offset += sizeof(uint16_t);
+    }
+}
+#endif
+
+/****************************************************************************************************
+ * FUNCT:   checkpointDriver_save
+ * BRIEF:   Save
+ * RETURN:  bool: Resumed From This Checkpoint (true) Or Saved (false)
+ * ARG:     void: No Arguments
+ * NOTE:    Called From The Comparator Interrupt Handler (Interrupts Disabled), So The Image Is
+ *          Consistent; The Interrupted Program Counter And Status Register Are On The Stack
+ ****************************************************************************************************/
+static bool checkpointDriver_save(void)
+{
+    uint16_t address, offset, sequence, slotAddress;
+    uint8_t slot;
+
+    /*** Slot: Never The Newest Committed One ***/
+    slot = (checkpointDriver_newestSlot == 0) ? 1 : 0;
+    slotAddress = CHECKPOINT_DRIVER_SLOT_ADDRESS(slot);
+    sequence = (uint16_t)(checkpointDriver_sequence + 1);
+
+#ifndef __UNIT_TEST__
+    /*** CPU Context: checkpointDriver_resume() longjmp()s Back Here ***/
+    if(setjmp(checkpointDriver_context) != 0)
+    {
+        checkpointDriver_finishResume();
+        return true;
+    }
+#endif
+
+    /*** Invalidate ***/
+    HWREG16(slotAddress + offsetof(checkpointDriver_slot_t, header.marker)) = 0;
+
+    /*** Peripheral Registers ***/
+    checkpointDriver_copyRegisters(slotAddress, false);
+
+    /*** CPU Context ***/
+    HWREG16(slotAddress + offsetof(checkpointDriver_slot_t, header.stackPointer)) = __get_SP_register();
+    HWREG16(slotAddress + offsetof(checkpointDriver_slot_t, header.statusRegister)) = __get_SR_register();
+
+    /*** RAM ***/
+    offset = offsetof(checkpointDriver_slot_t, image);
+    for(address = MEMORY_DRIVER_RAM_START; address < (MEMORY_DRIVER_RAM_START + CHECKPOINT_DRIVER_IMAGE_LENGTH); address += sizeof(uint16_t))
+    {
+        HWREG16(slotAddress + offset) = HWREG16(address);
+        offset += sizeof(uint16_t);
+    }
+
+    /*** Commit ***/
+    HWREG16(slotAddress + offsetof(checkpointDriver_slot_t, header.sequence)) = sequence;
+    HWREG16(slotAddress + offsetof(checkpointDriver_slot_t, header.marker)) = CHECKPOINT_DRIVER_MARKER;
+    checkpointDriver_newestSlot = slot;
+    checkpointDriver_sequence = sequence;
+
+    return false;
+}
+
+/****************************************************************************************************
+ * FUNCT:   checkpointDriver_scan
+ * BRIEF:   Scan
+ * RETURN:  void: Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Finds The Newest Committed Slot (Sequence Numbers Compared Modulo 2^16)
+ ****************************************************************************************************/
+static void checkpointDriver_scan(void)
+{
+    uint16_t sequence;
+    uint8_t slot;
+
+    /*** Newest Committed Slot ***/
+    checkpointDriver_newestSlot = CHECKPOINT_DRIVER_SLOT_NONE;
+    for(slot = 0; slot < CHECKPOINT_DRIVER_SLOT_COUNT; slot++)
+    {
+        if(HWREG16(CHECKPOINT_DRIVER_FIELD_ADDRESS(slot, header.marker)) != CHECKPOINT_DRIVER_MARKER)
+            continue;
+        sequence = HWREG16(CHECKPOINT_DRIVER_FIELD_ADDRESS(slot, header.sequence));
+        if((checkpointDriver_newestSlot == CHECKPOINT_DRIVER_SLOT_NONE) || ((int16_t)(sequence - checkpointDriver_sequence) > 0))
+        {
+            checkpointDriver_newestSlot = slot;
+            checkpointDriver_sequence = sequence;
+        }
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   checkpointDriver_watchSupply
+ * BRIEF:   Watch Supply
+ * RETURN:  void: Returns Nothing
+ * ARG:     Edge: COMP_E_FALLINGEDGE (Next Dip) Or COMP_E_RISINGEDGE (Recovery)
+ * NOTE:    If The Output Already Passed The Edge While The Handler Ran, The Flag Is Set So The
+ *          Handler Runs Again
+ ****************************************************************************************************/
+static void checkpointDriver_watchSupply(const uint16_t Edge)
+{
+    bool high;
+
+    /*** Edge ***/
+    Comp_E_setInterruptEdgeDirection(COMP_E_BASE, Edge);
+    Comp_E_clearInterrupt(COMP_E_BASE, COMP_E_OUTPUT_INTERRUPT_FLAG);
+
+    /*** Already Passed ***/
+    high = ((HWREG16(COMP_E_BASE + OFS_CECTL1) & CEOUT) != 0);
+    if(high == (Edge == COMP_E_RISINGEDGE))
+        HWREG16(COMP_E_BASE + OFS_CEINT) |= CEIFG;
+}
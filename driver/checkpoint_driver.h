@@ -0,0 +1,76 @@
+/****************************************************************************************************
+ * FILE:    checkpoint_driver.h
+ * BRIEF:   Checkpoint Driver Header File
+ * NOTE:    Power-Fail Checkpoints: Comp_E Watches VCC (Through A Divider) Against The Reference
+ *          Ladder, And Its Falling Edge Interrupt Copies The Peripheral Registers, The CPU Context
+ *          And All Of RAM Into One Of Two FRAM Slots Within The Hold-Up Time; At Boot
+ *          checkpointDriver_resume() Copies The Newest Committed Slot Back And Returns Into The
+ *          Interrupted Code Instead Of Running system_init()
+ * NOTE:    Atomic: The Slot Being Written Is Never The Newest Committed One, Its Marker Is Cleared
+ *          First And Written Last, So A Power Cut At Any Point Leaves The Previous Checkpoint Intact
+ * NOTE:    Stale: If The Supply Recovers (Rising Edge) The Checkpoint Is Invalidated, And Only A
+ *          Brownout-Class Reset Resumes, So A Watchdog, RST Pin Or Software Reset Never Restores An
+ *          Old Image
+ * NOTE:    Hold-Up: A Checkpoint Is About 1150 Word Copies (~1 ms At 8 MHz); From The 2.25 V Trip
+ *          Point Down To 1.8 V (FRAM Writes Still Valid) At ~2 mA That Takes >= 4.7 uF On VCC
+ * NOTE:    Target Resume: checkpointDriver_jumpToImage() (checkpoint_driver_resume.asm) Switches To
+ *          The TINYRAM Stack, Copies The Image And longjmp()s, Using No Stack Of Its Own
+ ****************************************************************************************************/
+
+#ifndef CHECKPOINT_DRIVER_H
+#define CHECKPOINT_DRIVER_H
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define CHECKPOINT_DRIVER_IMAGE_LENGTH    (MEMORY_DRIVER_RAM_LENGTH) // Bytes: All Of RAM, Stack Included
+#define CHECKPOINT_DRIVER_MARKER          (0xC4EC)                   // Committed
+#define CHECKPOINT_DRIVER_REGISTER_LENGTH (128)                      // Words: Peripheral Registers
+#define CHECKPOINT_DRIVER_RESUME_STACK    (0x0020)                   // End Of TINYRAM: Not Part Of The Image
+#define CHECKPOINT_DRIVER_SLOT_COUNT      (2)
+#define CHECKPOINT_DRIVER_SLOT_NONE       (CHECKPOINT_DRIVER_SLOT_COUNT)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "memory_driver.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef struct checkpointDriver_header_s
+{
+    uint16_t marker;         // CHECKPOINT_DRIVER_MARKER Once Committed (Cleared First, Written Last)
+    uint16_t sequence;       // The Committed Slot With The Newest Sequence Resumes
+    uint16_t stackPointer;   // CPU Context (Registers And Program Counter: setjmp() Buffer In The Image)
+    uint16_t statusRegister;
+} checkpointDriver_header_t;
+
+typedef struct checkpointDriver_registerRange_s
+{
+    uint16_t address;
+    uint16_t length; // Words; Restored In Table Order (Control Registers That Start A Module Last)
+} checkpointDriver_registerRange_t;
+
+typedef struct checkpointDriver_slot_s
+{
+    checkpointDriver_header_t header;
+    uint16_t registers[CHECKPOINT_DRIVER_REGISTER_LENGTH];
+    uint16_t image[CHECKPOINT_DRIVER_IMAGE_LENGTH / sizeof(uint16_t)];
+} checkpointDriver_slot_t;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern void checkpointDriver_comparatorInterruptHandler(const uint16_t InterruptFlag);
+extern uint16_t checkpointDriver_getSequence(void);
+extern void checkpointDriver_init(void);
+extern bool checkpointDriver_resume(const uint16_t ResetCause);
+
+#endif
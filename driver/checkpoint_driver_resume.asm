@@ -0,0 +1,50 @@
+;****************************************************************************************************
+;* FILE:    checkpoint_driver_resume.asm
+;* BRIEF:   Checkpoint Driver Resume Routine
+;* NOTE:    Assembly, Not C: It Moves The Stack Pointer And Overwrites The Stack It Was Called On, So
+;*          Nothing May Live In A Frame; Every Value Stays In A Register (Target Only: The Host Path
+;*          Uses checkpointDriver_restoreImage())
+;****************************************************************************************************
+
+;****************************************************************************************************
+;* Includes
+;****************************************************************************************************
+
+        .cdecls C, NOLIST, "checkpoint_driver.h" ; CHECKPOINT_DRIVER_RESUME_STACK, MEMORY_DRIVER_RAM_*
+
+;****************************************************************************************************
+;* Symbols
+;****************************************************************************************************
+
+        .def    checkpointDriver_jumpToImage
+        .ref    longjmp
+
+;****************************************************************************************************
+;* Function Definitions (Public)
+;****************************************************************************************************
+
+        .text
+
+;****************************************************************************************************
+;* FUNCT:   checkpointDriver_jumpToImage
+;* BRIEF:   Jump To Image
+;* RETURN:  void: Doesn't Return: Continues From setjmp() In checkpointDriver_save()
+;* ARG:     Context (R12): jmp_buf In RAM, Valid Once The Image Is Back; Passed Through To longjmp()
+;* ARG:     ImageAddress (R13): Image Of The Slot Being Resumed (FRAM)
+;* NOTE:    Stack Depth: 0 Bytes; The Copy Loop Uses R12-R14 Only And longjmp() Is Entered With BRA,
+;*          Which Pushes Nothing; longjmp() Loads The Saved Stack Pointer Before Using The Stack
+;* NOTE:    The 26-Byte TINYRAM Stack (0x0006-0x001F) Only Has To Hold What Can Still Interrupt With
+;*          GIE Clear: A System NMI's 4-Byte Frame
+;****************************************************************************************************
+checkpointDriver_jumpToImage:
+        MOV.W   #CHECKPOINT_DRIVER_RESUME_STACK, SP      ; TINYRAM: Not Part Of The Image
+        MOV.W   #MEMORY_DRIVER_RAM_START, R14
+copyImage:
+        MOV.W   @R13+, 0(R14)                            ; All Of RAM, Stack Included
+        INCD.W  R14
+        CMP.W   #(MEMORY_DRIVER_RAM_START + MEMORY_DRIVER_RAM_LENGTH), R14
+        JNE     copyImage
+        MOV.W   #1, R13                                  ; setjmp() Returns 1
+        BRA     #longjmp
+
+        .end
@@ -0,0 +1,300 @@
+/****************************************************************************************************
+ * FILE:    drbg_driver.c
+ * BRIEF:   Deterministic Random Bit Generator (DRBG) Driver Source File
+ * NOTE:    Block_Cipher_df Runs Its Three BCC Chains (One Per 16-Byte Block Of Seed Material) Side By
+ *          Side Over IV || L || N || Input || 0x80 || Padding As The Input Arrives
+ * NOTE:    Main Loop Only: The AES256 Key Register Is Reloaded Before Every Batch Of Blocks
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define DRBG_DRIVER_CHAIN_COUNT (DRBG_DRIVER_SEED_LENGTH / DRBG_DRIVER_BLOCK_LENGTH)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "aes256.h"
+#include "drbg_driver.h"
+#include "msp430fr6989.h"
+#include "project.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+static const uint8_t drbgDriver_derivationKey[DRBG_DRIVER_KEY_LENGTH] = // 0x00, 0x01, ... 0x1F (SP 800-90A 10.3.2)
+{
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F
+};
+
+static uint8_t drbgDriver_block[DRBG_DRIVER_BLOCK_LENGTH]; // Derivation Function: Partial Input Block
+static uint8_t drbgDriver_blockLength;
+static uint8_t drbgDriver_chains[DRBG_DRIVER_CHAIN_COUNT][DRBG_DRIVER_BLOCK_LENGTH]; // Derivation Function: BCC Chaining Values
+static uint8_t drbgDriver_key[DRBG_DRIVER_KEY_LENGTH];
+PROJECT_STATIC uint32_t drbgDriver_reseedCounter; // 0: Not Instantiated
+static uint16_t drbgDriver_seedCount, drbgDriver_seedLength;
+static uint8_t drbgDriver_v[DRBG_DRIVER_BLOCK_LENGTH];
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void drbgDriver_absorb(const uint8_t Byte);
+static void drbgDriver_increment(void);
+static void drbgDriver_update(const uint8_t * const ProvidedData);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   drbgDriver_addSeed
+ * BRIEF:   Add Seed
+ * RETURN:  void: Returns Nothing
+ * ARG:     Byte: Seed Material Byte (Entropy Input, Then Nonce When Instantiating)
+ ****************************************************************************************************/
+void drbgDriver_addSeed(const uint8_t Byte)
+{
+    /*** Add Seed ***/
+    drbgDriver_absorb(Byte);
+    drbgDriver_seedCount++;
+}
+
+/****************************************************************************************************
+ * FUNCT:   drbgDriver_finishSeed
+ * BRIEF:   Finish Seed
+ * RETURN:  bool: Instantiated Or Reseeded (true) Or Seed Length Mismatch (false)
+ * ARG:     void: No Arguments
+ * NOTE:    Instantiates On The First Seed, Reseeds After That
+ ****************************************************************************************************/
+bool drbgDriver_finishSeed(void)
+{
+    /*** Error Check ***/
+    if(drbgDriver_seedCount != drbgDriver_seedLength)
+        return false;
+
+    /*** Derivation Function: 0x80, Zero Padding To A Whole Block ***/
+    drbgDriver_absorb(0x80);
+    while(drbgDriver_blockLength != 0)
+        drbgDriver_absorb(0x00);
+
+    /*** Derivation Function: Key = Chains 0 And 1, X = Chain 2; Seed Material = E(X), E(E(X)), ... ***/
+    /* In Place (The Key Is Held By The Accelerator Once Loaded; Saves 48 Bytes Of Stack) */
+    (void)AES256_setCipherKey(AES256_BASE, drbgDriver_chains[0], AES256_KEYLENGTH_256BIT);
+    AES256_encryptData(AES256_BASE, drbgDriver_chains[2], drbgDriver_chains[0]);
+    AES256_encryptData(AES256_BASE, drbgDriver_chains[0], drbgDriver_chains[1]);
+    AES256_encryptData(AES256_BASE, drbgDriver_chains[1], drbgDriver_chains[2]);
+
+    /*** Instantiate (Key = 0, V = 0) Or Reseed ***/
+    if(drbgDriver_reseedCounter == 0)
+    {
+        (void)memset(drbgDriver_key, 0, sizeof(drbgDriver_key));
+        (void)memset(drbgDriver_v, 0, sizeof(drbgDriver_v));
+    }
+    drbgDriver_update(&drbgDriver_chains[0][0]);
+    (void)memset(drbgDriver_chains, 0, sizeof(drbgDriver_chains));
+    drbgDriver_reseedCounter = 1;
+    drbgDriver_seedLength = 0;
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   drbgDriver_generate
+ * BRIEF:   Generate
+ * RETURN:  bool: Generated (true) Or Not Instantiated Or Reseed Required (false)
+ * ARG:     Buffer: Buffer
+ * ARG:     Length: Length (Bytes)
+ ****************************************************************************************************/
+bool drbgDriver_generate(uint8_t * const Buffer, const size_t Length)
+{
+    uint8_t block[DRBG_DRIVER_BLOCK_LENGTH];
+    size_t i, length;
+
+    /*** Error Check ***/
+    if((drbgDriver_reseedCounter == 0) || (drbgDriver_reseedCounter > DRBG_DRIVER_RESEED_INTERVAL))
+        return false;
+
+    /*** Generate (V = V + 1, Output Encrypt(Key, V)) ***/
+    (void)AES256_setCipherKey(AES256_BASE, drbgDriver_key, AES256_KEYLENGTH_256BIT);
+    for(i = 0; i < Length; i += length)
+    {
+        drbgDriver_increment();
+        length = Length - i;
+        if(length >= DRBG_DRIVER_BLOCK_LENGTH)
+        {
+            length = DRBG_DRIVER_BLOCK_LENGTH;
+            AES256_encryptData(AES256_BASE, drbgDriver_v, &Buffer[i]);
+        }
+        else
+        {
+            AES256_encryptData(AES256_BASE, drbgDriver_v, block);
+            (void)memcpy(&Buffer[i], block, length);
+            (void)memset(block, 0, sizeof(block));
+        }
+    }
+
+    /*** Backtracking Resistance ***/
+    drbgDriver_update(NULL);
+    drbgDriver_reseedCounter++;
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   drbgDriver_getReseedCounter
+ * BRIEF:   Get Reseed Counter
+ * RETURN:  uint32_t: Generate Requests Since The Last Seed Plus 1 (0: Not Instantiated)
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+uint32_t drbgDriver_getReseedCounter(void)
+{
+    /*** Get Reseed Counter ***/
+    return drbgDriver_reseedCounter;
+}
+
+/****************************************************************************************************
+ * FUNCT:   drbgDriver_init
+ * BRIEF:   Initialize
+ * RETURN:  void: Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Uninstantiated Until The First drbgDriver_finishSeed
+ ****************************************************************************************************/
+void drbgDriver_init(void)
+{
+    /*** Initialize (Zeroize) ***/
+    (void)memset(drbgDriver_block, 0, sizeof(drbgDriver_block));
+    (void)memset(drbgDriver_chains, 0, sizeof(drbgDriver_chains));
+    (void)memset(drbgDriver_key, 0, sizeof(drbgDriver_key));
+    (void)memset(drbgDriver_v, 0, sizeof(drbgDriver_v));
+    drbgDriver_blockLength = 0;
+    drbgDriver_reseedCounter = 0;
+    drbgDriver_seedCount = 0;
+    drbgDriver_seedLength = 0;
+}
+
+/****************************************************************************************************
+ * FUNCT:   drbgDriver_startSeed
+ * BRIEF:   Start Seed
+ * RETURN:  void: Returns Nothing
+ * ARG:     Length: Seed Material Length (Bytes; 1 Or More)
+ * NOTE:    Discards Any Seed In Progress (e.g. After An Entropy Health Test Failure)
+ ****************************************************************************************************/
+void drbgDriver_startSeed(const uint16_t Length)
+{
+    uint8_t i;
+
+    /*** Start Seed ***/
+    drbgDriver_blockLength = 0;
+    drbgDriver_seedCount = 0;
+    drbgDriver_seedLength = Length;
+
+    /*** Derivation Function: Chain i Starts With Encrypt(K, IV = i || 0^96) ***/
+    (void)AES256_setCipherKey(AES256_BASE, drbgDriver_derivationKey, AES256_KEYLENGTH_256BIT);
+    (void)memset(drbgDriver_block, 0, sizeof(drbgDriver_block));
+    for(i = 0; i < DRBG_DRIVER_CHAIN_COUNT; i++)
+    {
+        drbgDriver_block[3] = i;
+        AES256_encryptData(AES256_BASE, drbgDriver_block, drbgDriver_chains[i]);
+    }
+
+    /*** Derivation Function: L (Input Length), N (Seed Material Length), Big Endian ***/
+    drbgDriver_absorb(0x00);
+    drbgDriver_absorb(0x00);
+    drbgDriver_absorb((uint8_t)(Length >> 8));
+    drbgDriver_absorb((uint8_t)Length);
+    drbgDriver_absorb(0x00);
+    drbgDriver_absorb(0x00);
+    drbgDriver_absorb(0x00);
+    drbgDriver_absorb(DRBG_DRIVER_SEED_LENGTH);
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   drbgDriver_absorb
+ * BRIEF:   Absorb
+ * RETURN:  void: Returns Nothing
+ * ARG:     Byte: Derivation Function Input Byte
+ * NOTE:    A Whole Block Advances All BCC Chains: Chain = Encrypt(K, Chain XOR Block)
+ ****************************************************************************************************/
+static void drbgDriver_absorb(const uint8_t Byte)
+{
+    uint8_t i, j;
+
+    /*** Append ***/
+    drbgDriver_block[drbgDriver_blockLength++] = Byte;
+    if(drbgDriver_blockLength < DRBG_DRIVER_BLOCK_LENGTH)
+        return;
+
+    /*** BCC ***/
+    (void)AES256_setCipherKey(AES256_BASE, drbgDriver_derivationKey, AES256_KEYLENGTH_256BIT);
+    for(i = 0; i < DRBG_DRIVER_CHAIN_COUNT; i++)
+    {
+        for(j = 0; j < DRBG_DRIVER_BLOCK_LENGTH; j++)
+            drbgDriver_chains[i][j] ^= drbgDriver_block[j];
+        AES256_encryptData(AES256_BASE, drbgDriver_chains[i], drbgDriver_chains[i]);
+    }
+    (void)memset(drbgDriver_block, 0, sizeof(drbgDriver_block));
+    drbgDriver_blockLength = 0;
+}
+
+/****************************************************************************************************
+ * FUNCT:   drbgDriver_increment
+ * BRIEF:   Increment
+ * RETURN:  void: Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    V = (V + 1) mod 2^128, Big Endian
+ ****************************************************************************************************/
+static void drbgDriver_increment(void)
+{
+    uint8_t i;
+
+    /*** Increment ***/
+    for(i = DRBG_DRIVER_BLOCK_LENGTH; i > 0; i--)
+    {
+        if(++drbgDriver_v[i - 1] != 0)
+            break;
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   drbgDriver_update
+ * BRIEF:   Update
+ * RETURN:  void: Returns Nothing
+ * ARG:     ProvidedData: Seed Material (DRBG_DRIVER_SEED_LENGTH Bytes; NULL: All Zero)
+ * NOTE:    CTR_DRBG_Update: Three Encrypt(Key, ++V) Blocks XOR Provided Data Become The New Key And V;
+ *          Written Straight Over Key And V, As The Accelerator Holds The Old Key Once Loaded
+ ****************************************************************************************************/
+static void drbgDriver_update(const uint8_t * const ProvidedData)
+{
+    uint8_t i;
+
+    /*** Keystream: New Key (Blocks 1 And 2), New V (Block 3) ***/
+    (void)AES256_setCipherKey(AES256_BASE, drbgDriver_key, AES256_KEYLENGTH_256BIT);
+    drbgDriver_increment();
+    AES256_encryptData(AES256_BASE, drbgDriver_v, &drbgDriver_key[0]);
+    drbgDriver_increment();
+    AES256_encryptData(AES256_BASE, drbgDriver_v, &drbgDriver_key[DRBG_DRIVER_BLOCK_LENGTH]);
+    drbgDriver_increment();
+    AES256_encryptData(AES256_BASE, drbgDriver_v, drbgDriver_v);
+
+    /*** XOR Provided Data ***/
+    if(ProvidedData != NULL)
+    {
+        for(i = 0; i < DRBG_DRIVER_KEY_LENGTH; i++)
+            drbgDriver_key[i] ^= ProvidedData[i];
+        for(i = 0; i < DRBG_DRIVER_BLOCK_LENGTH; i++)
+            drbgDriver_v[i] ^= ProvidedData[DRBG_DRIVER_KEY_LENGTH + i];
+    }
+}
@@ -0,0 +1,41 @@
+/****************************************************************************************************
+ * FILE:    drbg_driver.h
+ * BRIEF:   Deterministic Random Bit Generator (DRBG) Driver Header File
+ * NOTE:    NIST SP 800-90A CTR_DRBG On The AES256 Accelerator: AES-256, Derivation Function, No
+ *          Prediction Resistance, No Personalization Or Additional Input; Seed Material Is Streamed
+ *          In A Byte At A Time (drbgDriver_startSeed/addSeed/finishSeed), So Entropy Samples Are
+ *          Never Buffered
+ ****************************************************************************************************/
+
+#ifndef DRBG_DRIVER_H
+#define DRBG_DRIVER_H
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define DRBG_DRIVER_BLOCK_LENGTH    (16)     // AES Block (V)
+#define DRBG_DRIVER_KEY_LENGTH      (32)     // AES-256 Key
+#define DRBG_DRIVER_RESEED_INTERVAL (1024ul) // Generate Requests Per Seed (SP 800-90A Maximum: 2^48)
+#define DRBG_DRIVER_SEED_LENGTH     (DRBG_DRIVER_KEY_LENGTH + DRBG_DRIVER_BLOCK_LENGTH)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern void drbgDriver_addSeed(const uint8_t Byte);
+extern bool drbgDriver_finishSeed(void);
+extern bool drbgDriver_generate(uint8_t * const Buffer, const size_t Length);
+extern uint32_t drbgDriver_getReseedCounter(void);
+extern void drbgDriver_init(void);
+extern void drbgDriver_startSeed(const uint16_t Length);
+
+#endif
@@ -10,6 +10,8 @@
  * Includes
  ****************************************************************************************************/
 
+#include "adc12_b.h"
+#include "comp_e.h"
 #include "dma.h"
 #include "gpio.h"
 #include "led_driver.h"
@@ -20,6 +22,10 @@
  * Defines
  ****************************************************************************************************/
 
+/*** Boot ***/
+/* Timer */
+#define DRIVER_CONFIG_BOOT_TIMER (TIMER_A3_BASE) // Boot To CLI Ready Time; Runs Only During system_init() (SMCLK)
+
 /*** Button ***/
 /* GPIO */
 #define DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT (GPIO_PORT_P1)
@@ -27,6 +33,15 @@
 #define DRIVER_CONFIG_BUTTON_GPIO_BUTTON_2_PORT (GPIO_PORT_P1)
 #define DRIVER_CONFIG_BUTTON_GPIO_BUTTON_2_PIN  (GPIO_PIN2)
 
+/*** Checkpoint ***/
+/* Comparator */
+#define DRIVER_CONFIG_CHECKPOINT_COMPARATOR_INPUT     (COMP_E_INPUT10)     // VCC Through A 1:1 Divider (Board Addition: Not On The LaunchPad)
+#define DRIVER_CONFIG_CHECKPOINT_COMPARATOR_LEVEL     (30)                 // Ladder Tap (Of 32): 1.2 V * 30 / 32 = 1.125 V, So VCC Trips At 2.25 V
+#define DRIVER_CONFIG_CHECKPOINT_COMPARATOR_REFERENCE (COMP_E_VREFBASE1_2V)
+
+/*** Clock ***/
+#define DRIVER_CONFIG_MCLK_HZ (8000000) // system_initClocks(): DCO 8 MHz; Above 8 MHz FRAM Needs Wait States (NWAITS)
+
 /*** Command Line Interface (CLI) ***/
 /* DMA */
 #define DRIVER_CONFIG_CLI_DMA_CHANNEL        (DMA_CHANNEL_0)
@@ -42,6 +57,30 @@
 /* UART */
 #define DRIVER_CONFIG_CLI_UART_BASE_ADDRESS (EUSCI_A1_BASE)
 
+/*** Debug ***/
+#ifndef DRIVER_CONFIG_DEBUG
+  #ifdef DEBUG
+    #define DRIVER_CONFIG_DEBUG (1) // Default For The Instrumentation Options Below (Profile, Stack Entry, Trace)
+  #else
+    #define DRIVER_CONFIG_DEBUG (0)
+  #endif
+#endif
+
+/*** Entropy ***/
+/* ADC */
+#define DRIVER_CONFIG_ENTROPY_ADC_CHANNEL_MAP (ADC12_B_BATTMAP)      // AVCC / 2 On ADC12INCH_31
+#define DRIVER_CONFIG_ENTROPY_ADC_INPUT       (ADC12_B_INPUT_BATMAP) // Only The Least Significant Bits (Noise) Are Used
+
+/* Timer */
+#define DRIVER_CONFIG_ENTROPY_TIMER               (TIMER_A1_BASE) // Free Running (Continuous Mode, SMCLK)
+#define DRIVER_CONFIG_ENTROPY_TIMER_CAPTURE_INPUT (TIMER_A_CAPTURE_INPUTSELECT_CCIxB) // ACLK (See MSP430FR698x Datasheet: Timer1_A3 Signal Connections)
+#define DRIVER_CONFIG_ENTROPY_TIMER_CCR           (TIMER_A_CAPTURECOMPARE_REGISTER_2)
+
+/*** Init ***/
+#ifndef DRIVER_CONFIG_INIT_TABLE
+#define DRIVER_CONFIG_INIT_TABLE (1) // Registers From The Generated Tables (init_driver_table.c), Not driverlib Calls (init_generator Builds With 0)
+#endif
+
 /*** Low-Frequency Crystal Oscillator (LFXT) ***/
 /* GPIO */
 #define DRIVER_CONFIG_LFXT_GPIO_FUNCTION (GPIO_PRIMARY_MODULE_FUNCTION)
@@ -62,4 +101,50 @@
 #define DRIVER_CONFIG_LED_TIMER_LED_1_CCR (TIMER_A_CAPTURECOMPARE_REGISTER_1)
 #define DRIVER_CONFIG_LED_TIMER_LED_2_CCR (TIMER_A_CAPTURECOMPARE_REGISTER_2)
 
+/*** Log ***/
+/* Timer */
+#define DRIVER_CONFIG_LOG_TIMER (TIMER_A0_BASE) // Timestamps; Free Running (Continuous Mode, ACLK) For The LED Driver
+
+/*** Memory ***/
+#ifndef DRIVER_CONFIG_STACK_ENTRY
+#define DRIVER_CONFIG_STACK_ENTRY (DRIVER_CONFIG_DEBUG) // Deepest Stack On Interrupt Entry (memory_driver.h); 0: Not Recorded, Reports 0
+#endif
+
+/*** Nest ***/
+#ifndef DRIVER_CONFIG_NEST
+#define DRIVER_CONFIG_NEST (1) // Low Priority Handlers Re-Enable Interrupts (nest_driver.h); 0: Every Handler Runs With Interrupts Disabled
+#endif
+
+/*** Port ***/
+/* Timer */
+#define DRIVER_CONFIG_PORT_TIMER (TIMER_A0_BASE) // Edge Timestamps; Free Running (Continuous Mode, ACLK) For The LED Driver
+
+/*** Power ***/
+/* Timer */
+#define DRIVER_CONFIG_POWER_TIMER (TIMER_A0_BASE) // Quiet Period; Free Running (Continuous Mode, ACLK) For The LED Driver, Runs In LPM3
+
+/* UART */
+#define DRIVER_CONFIG_POWER_WAKE_UART (DRIVER_CONFIG_CLI_UART_BASE_ADDRESS) // Start Bit Wakes The CPU From LPM3
+
+/*** Profile ***/
+#ifndef DRIVER_CONFIG_PROFILE
+#define DRIVER_CONFIG_PROFILE (DRIVER_CONFIG_DEBUG) // Interrupt Handler And Critical Section Times (profile_driver.h); 0: Not Recorded, "system --irq" Reports 0
+#endif
+
+/* Timer */
+#define DRIVER_CONFIG_PROFILE_TIMER (DRIVER_CONFIG_TRACE_TIMER) // Execution Times; Shares The Trace Timer (SMCLK = MCLK)
+
+/*** Trace ***/
+#ifndef DRIVER_CONFIG_TRACE
+#define DRIVER_CONFIG_TRACE (DRIVER_CONFIG_DEBUG) // Interrupt Handler And Main Loop Spans (trace_driver.h); 0: Not Recorded, "system --trace" Dumps An Empty Ring
+#endif
+
+/* Timer */
+#define DRIVER_CONFIG_TRACE_TIMER (TIMER_B0_BASE) // Timestamps; Free Running (Continuous Mode, SMCLK)
+
+/*** Vector ***/
+#ifndef DRIVER_CONFIG_VECTOR_RAM
+#define DRIVER_CONFIG_VECTOR_RAM (DRIVER_CONFIG_MCLK_HZ > 8000000) // Vector Table And Hot Interrupt Paths In RAM (vector_driver.h), Only Worth It With FRAM Wait States; 1 Also Needs The Linker --define
+#endif
+
 #endif
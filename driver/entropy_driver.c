@@ -0,0 +1,222 @@
+/****************************************************************************************************
+ * FILE:    entropy_driver.c
+ * BRIEF:   Entropy Driver Source File
+ * NOTE:    Polled, Never Blocks: A Sample Is Taken Once Both A Capture And A Conversion Are Ready
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+/*** Health Tests (SP 800-90B 4.4, False Positive Probability 2^-20, ENTROPY_DRIVER_MIN_ENTROPY = 1) ***/
+#define ENTROPY_DRIVER_PROPORTION_CUTOFF (410) // Adaptive Proportion: Occurrences Of The First Sample Per Window
+#define ENTROPY_DRIVER_PROPORTION_WINDOW (512) // Adaptive Proportion: Samples Per Window (Non-Binary)
+#define ENTROPY_DRIVER_REPETITION_CUTOFF (21)  // Repetition Count: 1 + ceil(20 / H) Identical Samples In A Row
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "adc12_b.h"
+#include "driver_config.h"
+#include "entropy_driver.h"
+#include "msp430fr6989.h"
+#include "project.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include "timer_a.h"
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+static uint16_t entropyDriver_capture; // Previous Capture
+static uint8_t entropyDriver_proportionSample;
+static uint16_t entropyDriver_proportionCount, entropyDriver_proportionIndex;
+static uint8_t entropyDriver_repetitionSample;
+static uint8_t entropyDriver_repetitionCount;
+PROJECT_STATIC uint16_t entropyDriver_startupCount; // Samples Left Before Use
+static entropyDriver_statistics_t entropyDriver_statistics;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static bool entropyDriver_test(const uint8_t Sample);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   entropyDriver_getSample
+ * BRIEF:   Get Sample
+ * RETURN:  entropyDriver_result_t: Result
+ * ARG:     Sample: Raw Sample (Set On ENTROPY_DRIVER_RESULT_SAMPLE Only)
+ * NOTE:    Bits 7:4: Low Bits Of The SMCLK Count Between ACLK Edges; Bits 3:0: Low Bits Of The ADC Result
+ ****************************************************************************************************/
+entropyDriver_result_t entropyDriver_getSample(uint8_t * const Sample)
+{
+    uint16_t capture, conversion;
+    uint8_t sample;
+
+    /*** Ready ***/
+    if((Timer_A_getCaptureCompareInterruptStatus(DRIVER_CONFIG_ENTROPY_TIMER, DRIVER_CONFIG_ENTROPY_TIMER_CCR, TIMER_A_CAPTURECOMPARE_INTERRUPT_FLAG) == 0) ||
+       (ADC12_B_getInterruptStatus(ADC12_B_BASE, 0, ADC12_B_IFG0) == 0))
+        return ENTROPY_DRIVER_RESULT_NONE;
+
+    /*** Sample (Next Capture Is Already Armed; Start The Next Conversion) ***/
+    capture = Timer_A_getCaptureCompareCount(DRIVER_CONFIG_ENTROPY_TIMER, DRIVER_CONFIG_ENTROPY_TIMER_CCR);
+    Timer_A_clearCaptureCompareInterrupt(DRIVER_CONFIG_ENTROPY_TIMER, DRIVER_CONFIG_ENTROPY_TIMER_CCR);
+    conversion = ADC12_B_getResults(ADC12_B_BASE, ADC12_B_MEMORY_0); // Clears ADC12IFG0
+    ADC12_B_startConversion(ADC12_B_BASE, ADC12_B_START_AT_ADC12MEM0, ADC12_B_SINGLECHANNEL);
+    sample = (uint8_t)((uint8_t)((capture - entropyDriver_capture) << 4) | (conversion & 0x0F));
+    entropyDriver_capture = capture;
+    entropyDriver_statistics.sampleCount++;
+
+    /*** Health Tests ***/
+    if(!entropyDriver_test(sample))
+        return ENTROPY_DRIVER_RESULT_FAILURE;
+
+    /*** Startup Samples Are Tested Only ***/
+    if(entropyDriver_startupCount > 0)
+    {
+        entropyDriver_startupCount--;
+        return ENTROPY_DRIVER_RESULT_NONE;
+    }
+
+    *Sample = sample;
+    return ENTROPY_DRIVER_RESULT_SAMPLE;
+}
+
+/****************************************************************************************************
+ * FUNCT:   entropyDriver_getStatistics
+ * BRIEF:   Get Statistics
+ * RETURN:  void: Returns Nothing
+ * ARG:     Statistics: Statistics
+ ****************************************************************************************************/
+void entropyDriver_getStatistics(entropyDriver_statistics_t * const Statistics)
+{
+    /*** Get Statistics ***/
+    *Statistics = entropyDriver_statistics;
+}
+
+/****************************************************************************************************
+ * FUNCT:   entropyDriver_init
+ * BRIEF:   Initialize
+ * RETURN:  void: Returns Nothing
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+void entropyDriver_init(void)
+{
+    ADC12_B_configureMemoryParam configureMemoryParam;
+    ADC12_B_initParam initParam;
+    Timer_A_initCaptureModeParam initCaptureModeParam;
+    Timer_A_initContinuousModeParam initContinuousModeParam;
+
+    /*** Initialize ***/
+    /* Health Tests */
+    entropyDriver_capture = 0;
+    entropyDriver_proportionCount = 0;
+    entropyDriver_proportionIndex = 0;
+    entropyDriver_proportionSample = 0;
+    entropyDriver_repetitionCount = 0;
+    entropyDriver_repetitionSample = 0;
+    entropyDriver_startupCount = ENTROPY_DRIVER_STARTUP_COUNT;
+    entropyDriver_statistics.sampleCount = 0;
+    entropyDriver_statistics.repetitionFailureCount = 0;
+    entropyDriver_statistics.proportionFailureCount = 0;
+
+    /* Timer (SMCLK Count Captured On Every ACLK Rising Edge) */
+    initContinuousModeParam.clockSource = TIMER_A_CLOCKSOURCE_SMCLK;
+    initContinuousModeParam.clockSourceDivider = TIMER_A_CLOCKSOURCE_DIVIDER_1;
+    initContinuousModeParam.timerInterruptEnable_TAIE = TIMER_A_TAIE_INTERRUPT_DISABLE;
+    initContinuousModeParam.timerClear = TIMER_A_DO_CLEAR;
+    initContinuousModeParam.startTimer = true;
+    Timer_A_initContinuousMode(DRIVER_CONFIG_ENTROPY_TIMER, &initContinuousModeParam);
+    initCaptureModeParam.captureRegister = DRIVER_CONFIG_ENTROPY_TIMER_CCR;
+    initCaptureModeParam.captureMode = TIMER_A_CAPTUREMODE_RISING_EDGE;
+    initCaptureModeParam.captureInputSelect = DRIVER_CONFIG_ENTROPY_TIMER_CAPTURE_INPUT;
+    initCaptureModeParam.synchronizeCaptureSource = TIMER_A_CAPTURE_ASYNCHRONOUS; // Synchronizing Would Hide The Jitter
+    initCaptureModeParam.captureInterruptEnable = TIMER_A_CAPTURECOMPARE_INTERRUPT_DISABLE;
+    initCaptureModeParam.captureOutputMode = TIMER_A_OUTPUTMODE_OUTBITVALUE;
+    Timer_A_initCaptureMode(DRIVER_CONFIG_ENTROPY_TIMER, &initCaptureModeParam);
+
+    /* ADC (Single Conversions, Software Started) */
+    initParam.sampleHoldSignalSourceSelect = ADC12_B_SAMPLEHOLDSOURCE_SC;
+    initParam.clockSourceSelect = ADC12_B_CLOCKSOURCE_ADC12OSC;
+    initParam.clockSourceDivider = ADC12_B_CLOCKDIVIDER_1;
+    initParam.clockSourcePredivider = ADC12_B_CLOCKPREDIVIDER__1;
+    initParam.internalChannelMap = DRIVER_CONFIG_ENTROPY_ADC_CHANNEL_MAP;
+    (void)ADC12_B_init(ADC12_B_BASE, &initParam);
+    ADC12_B_enable(ADC12_B_BASE);
+    ADC12_B_setupSamplingTimer(ADC12_B_BASE, ADC12_B_CYCLEHOLD_16_CYCLES, ADC12_B_CYCLEHOLD_4_CYCLES, ADC12_B_MULTIPLESAMPLESDISABLE);
+    configureMemoryParam.memoryBufferControlIndex = ADC12_B_MEMORY_0;
+    configureMemoryParam.inputSourceSelect = DRIVER_CONFIG_ENTROPY_ADC_INPUT;
+    configureMemoryParam.refVoltageSourceSelect = ADC12_B_VREFPOS_AVCC_VREFNEG_VSS;
+    configureMemoryParam.endOfSequence = ADC12_B_ENDOFSEQUENCE;
+    configureMemoryParam.windowComparatorSelect = ADC12_B_WINDOW_COMPARATOR_DISABLE;
+    configureMemoryParam.differentialModeSelect = ADC12_B_DIFFERENTIAL_MODE_DISABLE;
+    ADC12_B_configureMemory(ADC12_B_BASE, &configureMemoryParam);
+    ADC12_B_startConversion(ADC12_B_BASE, ADC12_B_START_AT_ADC12MEM0, ADC12_B_SINGLECHANNEL);
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   entropyDriver_test
+ * BRIEF:   Test
+ * RETURN:  bool: Sample Passed (true) Or Failed (false) The Health Tests
+ * ARG:     Sample: Raw Sample
+ * NOTE:    A Failure Restarts Both Tests (And The Startup Count), So The Source Recovers Only After
+ *          ENTROPY_DRIVER_STARTUP_COUNT Good Samples
+ ****************************************************************************************************/
+static bool entropyDriver_test(const uint8_t Sample)
+{
+    bool pass;
+
+    /*** Repetition Count ***/
+    pass = true;
+    if((entropyDriver_repetitionCount > 0) && (Sample == entropyDriver_repetitionSample))
+    {
+        if(++entropyDriver_repetitionCount >= ENTROPY_DRIVER_REPETITION_CUTOFF)
+        {
+            entropyDriver_statistics.repetitionFailureCount++;
+            pass = false;
+        }
+    }
+    else
+    {
+        entropyDriver_repetitionSample = Sample;
+        entropyDriver_repetitionCount = 1;
+    }
+
+    /*** Adaptive Proportion ***/
+    if(entropyDriver_proportionIndex == 0)
+    {
+        entropyDriver_proportionSample = Sample;
+        entropyDriver_proportionCount = 1;
+    }
+    else if(Sample == entropyDriver_proportionSample)
+    {
+        if(++entropyDriver_proportionCount >= ENTROPY_DRIVER_PROPORTION_CUTOFF)
+        {
+            entropyDriver_statistics.proportionFailureCount++;
+            pass = false;
+        }
+    }
+    if(++entropyDriver_proportionIndex >= ENTROPY_DRIVER_PROPORTION_WINDOW)
+        entropyDriver_proportionIndex = 0;
+
+    /*** Failure: Restart ***/
+    if(!pass)
+    {
+        entropyDriver_proportionIndex = 0;
+        entropyDriver_repetitionCount = 0;
+        entropyDriver_startupCount = ENTROPY_DRIVER_STARTUP_COUNT;
+    }
+
+    return pass;
+}
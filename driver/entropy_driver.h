@@ -0,0 +1,51 @@
+/****************************************************************************************************
+ * FILE:    entropy_driver.h
+ * BRIEF:   Entropy Driver Header File
+ * NOTE:    Physical Noise Source: DCO Jitter (SMCLK Timer Count Between ACLK Capture Edges) And ADC
+ *          Least Significant Bit Noise, 4 Bits Each Per 8-Bit Raw Sample; Samples Pass The NIST SP
+ *          800-90B Continuous Health Tests (Repetition Count, Adaptive Proportion) Before Use
+ ****************************************************************************************************/
+
+#ifndef ENTROPY_DRIVER_H
+#define ENTROPY_DRIVER_H
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define ENTROPY_DRIVER_MIN_ENTROPY   (1)    // Claimed Min-Entropy Per Raw Sample (Bits; Health Test Cutoffs Follow)
+#define ENTROPY_DRIVER_STARTUP_COUNT (1024) // Samples Health Tested, Not Used, After Initialization (SP 800-90B 4.3)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef enum entropyDriver_result_e
+{
+    ENTROPY_DRIVER_RESULT_NONE,   // No Sample Ready (Or Startup Testing)
+    ENTROPY_DRIVER_RESULT_SAMPLE,
+    ENTROPY_DRIVER_RESULT_FAILURE // Health Test Failure: Discard Entropy Gathered So Far
+} entropyDriver_result_t;
+
+typedef struct entropyDriver_statistics_s
+{
+    uint32_t sampleCount;
+    uint16_t repetitionFailureCount;
+    uint16_t proportionFailureCount;
+} entropyDriver_statistics_t;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern entropyDriver_result_t entropyDriver_getSample(uint8_t * const Sample);
+extern void entropyDriver_getStatistics(entropyDriver_statistics_t * const Statistics);
+extern void entropyDriver_init(void);
+
+#endif
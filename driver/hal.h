@@ -0,0 +1,99 @@
+/****************************************************************************************************
+ * FILE:    hal.h
+ * BRIEF:   HAL (Hardware Abstraction Layer) Header File
+ * NOTE:    Header-Only GPIO And Timer_A Accessors For Hot Paths: Static Inline, So With The Port, Pins,
+ *          Timer And Register Known At Compile Time (driver_config.h) Each Call Folds To One
+ *          Instruction On A Fixed Address (BIS/BIC #Pins, &PxOUT; ADD Rn, &TAxCCRn) Instead Of A
+ *          driverlib Call That Looks Up GPIO_PORT_TO_BASE[] And Shifts The Pins At Run Time
+ * NOTE:    Same Word-Wide Register Accesses As driverlib, So Host Builds Run Them Against The Simulator
+ *          Unchanged; Keep driverlib For Anything Off The Hot Path (Initialization, Configuration)
+ ****************************************************************************************************/
+
+#ifndef HAL_H
+#define HAL_H
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+/*** GPIO: Port Pairs Share A Word Register (Odd Port: Low Byte, Even Port: High Byte) ***/
+#define HAL_GPIO_BASE(PORT) (((PORT) <= GPIO_PORT_P2) ? PA_BASE : \
+                             ((PORT) <= GPIO_PORT_P4) ? PB_BASE : \
+                             ((PORT) <= GPIO_PORT_P6) ? PC_BASE : \
+                             ((PORT) <= GPIO_PORT_P8) ? PD_BASE : \
+                             ((PORT) <= GPIO_PORT_P10) ? PE_BASE : PJ_BASE)
+#define HAL_GPIO_PINS(PORT, PINS) ((uint16_t)((((PORT) & 1) == 0) ? ((PINS) << 8) : (PINS)))
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "gpio.h"
+#include "inc/hw_memmap.h"
+#include "msp430fr6989.h"
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Function Definitions (Inline)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   hal_gpioSelectInterruptEdge
+ * BRIEF:   GPIO Select Interrupt Edge
+ * RETURN:  Returns Nothing
+ * ARG:     Port: Port (GPIO_PORT_Px)
+ * ARG:     Pins: Pins (GPIO_PINx)
+ * ARG:     Edge: GPIO_LOW_TO_HIGH_TRANSITION Or GPIO_HIGH_TO_LOW_TRANSITION
+ ****************************************************************************************************/
+static inline void hal_gpioSelectInterruptEdge(const uint8_t Port, const uint16_t Pins, const uint8_t Edge)
+{
+    /*** Select Interrupt Edge ***/
+    if(Edge == GPIO_LOW_TO_HIGH_TRANSITION)
+        HWREG16(HAL_GPIO_BASE(Port) + OFS_PAIES) &= (uint16_t)~HAL_GPIO_PINS(Port, Pins);
+    else
+        HWREG16(HAL_GPIO_BASE(Port) + OFS_PAIES) |= HAL_GPIO_PINS(Port, Pins);
+}
+
+/****************************************************************************************************
+ * FUNCT:   hal_gpioSetOutputHigh
+ * BRIEF:   GPIO Set Output High
+ * RETURN:  Returns Nothing
+ * ARG:     Port: Port (GPIO_PORT_Px)
+ * ARG:     Pins: Pins (GPIO_PINx)
+ ****************************************************************************************************/
+static inline void hal_gpioSetOutputHigh(const uint8_t Port, const uint16_t Pins)
+{
+    /*** Set Output High ***/
+    HWREG16(HAL_GPIO_BASE(Port) + OFS_PAOUT) |= HAL_GPIO_PINS(Port, Pins);
+}
+
+/****************************************************************************************************
+ * FUNCT:   hal_gpioSetOutputLow
+ * BRIEF:   GPIO Set Output Low
+ * RETURN:  Returns Nothing
+ * ARG:     Port: Port (GPIO_PORT_Px)
+ * ARG:     Pins: Pins (GPIO_PINx)
+ ****************************************************************************************************/
+static inline void hal_gpioSetOutputLow(const uint8_t Port, const uint16_t Pins)
+{
+    /*** Set Output Low ***/
+    HWREG16(HAL_GPIO_BASE(Port) + OFS_PAOUT) &= (uint16_t)~HAL_GPIO_PINS(Port, Pins);
+}
+
+/****************************************************************************************************
+ * FUNCT:   hal_timerAdvanceCompare
+ * BRIEF:   Timer Advance Compare
+ * RETURN:  Returns Nothing
+ * ARG:     Timer: Timer_A Base Address (TIMER_Ax_BASE)
+ * ARG:     Register: Capture/Compare Register (TIMER_A_CAPTURECOMPARE_REGISTER_x)
+ * ARG:     Ticks: Ticks After The Current Compare Value (Wraps With The Counter)
+ * NOTE:    Read-Modify-Write In Place, So The Next Match Is A Fixed Period After The Last One However
+ *          Late The Interrupt Was Serviced
+ ****************************************************************************************************/
+static inline void hal_timerAdvanceCompare(const uint16_t Timer, const uint16_t Register, const uint16_t Ticks)
+{
+    /*** Advance Compare ***/
+    HWREG16((uint16_t)(Timer + OFS_TAxR + Register)) += Ticks;
+}
+
+#endif
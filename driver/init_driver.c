@@ -0,0 +1,38 @@
+/****************************************************************************************************
+ * FILE:    init_driver.c
+ * BRIEF:   Init Driver Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "init_driver.h"
+#include "inc/hw_memmap.h"
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   initDriver_apply
+ * BRIEF:   Apply
+ * RETURN:  Returns Nothing
+ * ARG:     Table: Entries (Constant, In FRAM)
+ * ARG:     Length: Number Of Entries
+ ****************************************************************************************************/
+void initDriver_apply(const initDriver_entry_t * const Table, const uint16_t Length)
+{
+    const initDriver_entry_t *entry, *end;
+
+    /*** Entries In Order ***/
+    end = &Table[Length];
+    for(entry = Table; entry < end; entry++)
+    {
+        if(entry->andMask == 0)
+            HWREG16(entry->address) = entry->orValue;
+        else
+            HWREG16(entry->address) = (uint16_t)((HWREG16(entry->address) & entry->andMask) | entry->orValue);
+    }
+}
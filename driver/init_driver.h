@@ -0,0 +1,38 @@
+/****************************************************************************************************
+ * FILE:    init_driver.h
+ * BRIEF:   Init Driver Header File
+ * NOTE:    Table-Driven Register Initialization: Each Entry Is Applied In Order As
+ *          HWREG16(Address) = (HWREG16(Address) & AND Mask) | OR Value, Or As A Plain Store When The
+ *          AND Mask Is 0 (Nothing Read); The Tables (init_driver_table.c) Are Generated On The Host
+ *          From Each Module's driverlib Path (*_configure()) By init_generator ("make init_table")
+ * NOTE:    Tables Carry No Delays Or Polling, So Anything That Waits (LFXT Start, DCO Settling) Stays
+ *          In Code
+ ****************************************************************************************************/
+
+#ifndef INIT_DRIVER_H
+#define INIT_DRIVER_H
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef struct initDriver_entry_s
+{
+    uint16_t address; // Word Aligned
+    uint16_t andMask; // Bits Kept (0: Plain Store)
+    uint16_t orValue; // Bits Set (Within ~andMask)
+} initDriver_entry_t;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern void initDriver_apply(const initDriver_entry_t * const Table, const uint16_t Length);
+
+#endif
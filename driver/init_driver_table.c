@@ -0,0 +1,113 @@
+/****************************************************************************************************
+ * FILE:    init_driver_table.c
+ * BRIEF:   Init Driver Table Source File
+ * NOTE:    Generated By init_generator ("make init_table" In project/unit_test); Do Not Edit
+ * NOTE:    Entries: {Address, AND Mask, OR Value} (init_driver.h); Constant, So They Stay In FRAM
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "init_driver.h"
+#include "init_driver_table.h"
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+const initDriver_entry_t initDriverTable_button[INIT_DRIVER_TABLE_BUTTON_LENGTH] =
+{
+    {0x020A, 0xFFFD, 0x0000},
+    {0x020C, 0xFFFD, 0x0000},
+    {0x0204, 0xFFFD, 0x0000},
+    {0x0206, 0xFFFD, 0x0002},
+    {0x0202, 0xFFFD, 0x0002},
+    {0x020A, 0xFFF9, 0x0000},
+    {0x020C, 0xFFF9, 0x0000},
+    {0x0204, 0xFFF9, 0x0000},
+    {0x0206, 0xFFF9, 0x0006},
+    {0x0202, 0xFFF9, 0x0006},
+    {0x0218, 0xFFFD, 0x0002},
+    {0x021C, 0xFFFD, 0x0000},
+    {0x021A, 0xFFFD, 0x0002},
+    {0x0218, 0xFFF9, 0x0006},
+    {0x021C, 0xFFF9, 0x0000},
+    {0x021A, 0xFFF9, 0x0006}
+};
+
+const initDriver_entry_t initDriverTable_cli[INIT_DRIVER_TABLE_CLI_LENGTH] =
+{
+    {0x0510, 0xFFEF, 0x0000},
+    {0x0224, 0xFFDF, 0x0000},
+    {0x022A, 0xFFDF, 0x0020},
+    {0x022C, 0xFFDF, 0x0000},
+    {0x0224, 0xFFCF, 0x0000},
+    {0x022A, 0xFFCF, 0x0030},
+    {0x022C, 0xFFCF, 0x0000},
+    {0x05E0, 0xFFFE, 0x0001},
+    {0x05E0, 0xFF3E, 0x0001},
+    {0x05E0, 0xFF3E, 0x0081},
+    {0x05E0, 0xDF3E, 0x0081},
+    {0x05E0, 0xD73E, 0x0081},
+    {0x05E0, 0x573E, 0x0081},
+    {0x05E6, 0x0000, 0x0004},
+    {0x05E8, 0x0000, 0x5551},
+    {0x05E0, 0x403E, 0x0081},
+    {0x05E0, 0x4000, 0x0081},
+    {0x05E0, 0x4000, 0x0080},
+    {0x05FC, 0xFFFE, 0x0000},
+    {0x05FA, 0xFFFE, 0x0001}
+};
+
+const initDriver_entry_t initDriverTable_lcd[INIT_DRIVER_TABLE_LCD_LENGTH] =
+{
+    {0x0A00, 0xFFFE, 0x0000},
+    {0x0A0A, 0xFFEF, 0x0010},
+    {0x0A0C, 0xFFC0, 0x003F},
+    {0x0A0A, 0x002F, 0xFFD0},
+    {0x0A0C, 0x07C0, 0xF83F},
+    {0x0A0E, 0xFF07, 0x00F8},
+    {0x0A00, 0x0740, 0x0000},
+    {0x0A00, 0x0740, 0x0018},
+    {0x0A00, 0x0740, 0x001A},
+    {0x0A00, 0x0740, 0x001E},
+    {0x0A00, 0x0340, 0x041E},
+    {0x0A08, 0xFFEF, 0x0000},
+    {0x0A08, 0xFF6F, 0x0000},
+    {0x0A08, 0xFF4F, 0x0000},
+    {0x0A08, 0xFF0F, 0x0000},
+    {0x0A08, 0xE10F, 0x0000},
+    {0x0A08, 0xE10F, 0x0200},
+    {0x0A08, 0xE107, 0x0208},
+    {0x0A08, 0xE101, 0x0208},
+    {0x0A12, 0x7FFF, 0x0000},
+    {0x0A12, 0x7F00, 0x0000},
+    {0x0A12, 0x7F00, 0x8000},
+    {0x0A04, 0xFF00, 0x0000},
+    {0x0A04, 0xFF00, 0x0019}
+};
+
+const initDriver_entry_t initDriverTable_led[INIT_DRIVER_TABLE_LED_LENGTH] =
+{
+    {0x020A, 0xFFFE, 0x0000},
+    {0x020C, 0xFFFE, 0x0000},
+    {0x0204, 0xFFFE, 0x0001},
+    {0x028A, 0xFF7F, 0x0000},
+    {0x028C, 0xFF7F, 0x0000},
+    {0x0284, 0xFF7F, 0x0080},
+    {0x0340, 0xFC09, 0x0000},
+    {0x0360, 0xFFF8, 0x0000},
+    {0x0340, 0xFC09, 0x0104},
+    {0x0340, 0xFC09, 0x0124}
+};
+
+const initDriver_entry_t initDriverTable_lfxt[INIT_DRIVER_TABLE_LFXT_LENGTH] =
+{
+    {0x0324, 0xFFEF, 0x0000},
+    {0x032A, 0xFFEF, 0x0010},
+    {0x032C, 0xFFEF, 0x0000},
+    {0x0324, 0xFFCF, 0x0000},
+    {0x032A, 0xFFCF, 0x0030},
+    {0x032C, 0xFFCF, 0x0000}
+};
@@ -0,0 +1,36 @@
+/****************************************************************************************************
+ * FILE:    init_driver_table.h
+ * BRIEF:   Init Driver Table Header File
+ * NOTE:    Generated By init_generator ("make init_table" In project/unit_test); Do Not Edit
+ ****************************************************************************************************/
+
+#ifndef INIT_DRIVER_TABLE_H
+#define INIT_DRIVER_TABLE_H
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define INIT_DRIVER_TABLE_BUTTON_LENGTH (16)
+#define INIT_DRIVER_TABLE_CLI_LENGTH    (20)
+#define INIT_DRIVER_TABLE_LCD_LENGTH    (24)
+#define INIT_DRIVER_TABLE_LED_LENGTH    (10)
+#define INIT_DRIVER_TABLE_LFXT_LENGTH   (6)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "init_driver.h"
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+extern const initDriver_entry_t initDriverTable_button[INIT_DRIVER_TABLE_BUTTON_LENGTH];
+extern const initDriver_entry_t initDriverTable_cli[INIT_DRIVER_TABLE_CLI_LENGTH];
+extern const initDriver_entry_t initDriverTable_lcd[INIT_DRIVER_TABLE_LCD_LENGTH];
+extern const initDriver_entry_t initDriverTable_led[INIT_DRIVER_TABLE_LED_LENGTH];
+extern const initDriver_entry_t initDriverTable_lfxt[INIT_DRIVER_TABLE_LFXT_LENGTH];
+
+#endif
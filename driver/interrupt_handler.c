@@ -7,22 +7,149 @@
  * Includes
  ****************************************************************************************************/
 
-#include "button_driver.h"
+#include "checkpoint_driver.h"
 #include "cli_callback.h"
+#include "gpio.h"
 #include "interrupt_handler.h"
 #include "intrinsics.h"
 #include "led_driver.h"
+#include "memory_driver.h"
+#include "nest_driver.h"
+#include "power_driver.h"
 #include "msp430fr6989.h"
+#include "port_driver.h"
+#include "profile_driver.h"
+#include <stdint.h>
+#include "trace_driver.h"
+#include "vector_driver.h"
 
 /****************************************************************************************************
  * Function Definitions (Public)
  ****************************************************************************************************/
 
+/****************************************************************************************************
+ * FUNCT:   interruptHandler_compEVector
+ * BRIEF:   Comparator E Vector Interrupt Handler
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ ****************************************************************************************************/
+#pragma vector=COMP_E_VECTOR
+__interrupt void interruptHandler_compEVector(void)
+{
+    /*** Postponed While A Handler Is Nested (nest_driver.h) ***/
+    if(NEST_DRIVER_POSTPONE())
+        return;
+
+    /*** Handle Interrupt (Not Profiled Or Traced: The Checkpoint Has To Fit In The Hold-Up Time) ***/
+    checkpointDriver_comparatorInterruptHandler((uint16_t)__even_in_range(CEIV, CEIV_CERDYIFG));
+}
+
+/****************************************************************************************************
+ * FUNCT:   interruptHandler_port1Vector
+ * BRIEF:   Port 1 Vector Interrupt Handler
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ ****************************************************************************************************/
 #pragma vector=PORT1_VECTOR
 __interrupt void interruptHandler_port1Vector(void)
 {
-	/*** Handle Interrupt ***/
-	buttonDriver_portInterruptHandler(__even_in_range(P1IV, P1IV_P1IFG7));
+    uint16_t interruptFlag;
+    PROFILE_DRIVER_COUNT(start);
+
+    /*** Postponed While A Handler Is Nested (nest_driver.h) ***/
+    if(NEST_DRIVER_POSTPONE())
+        return;
+
+    /*** Handle Interrupt ***/
+    PROFILE_DRIVER_START(start);
+    MEMORY_DRIVER_RECORD_INTERRUPT_ENTRY();
+    interruptFlag = (uint16_t)__even_in_range(P1IV, P1IV_P1IFG7);
+    TRACE_DRIVER_BEGIN(TRACE_DRIVER_EVENT_PORT1_VECTOR, interruptFlag);
+    portDriver_interruptHandler(GPIO_PORT_P1, interruptFlag);
+    TRACE_DRIVER_END(TRACE_DRIVER_EVENT_PORT1_VECTOR, interruptFlag);
+    PROFILE_DRIVER_INTERRUPT(PROFILE_DRIVER_VECTOR_PORT1, start);
+    POWER_DRIVER_WAKE_ON_EXIT(); // Button Tick
+}
+
+/****************************************************************************************************
+ * FUNCT:   interruptHandler_port2Vector
+ * BRIEF:   Port 2 Vector Interrupt Handler
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ ****************************************************************************************************/
+#pragma vector=PORT2_VECTOR
+__interrupt void interruptHandler_port2Vector(void)
+{
+    uint16_t interruptFlag;
+    PROFILE_DRIVER_COUNT(start);
+
+    /*** Postponed While A Handler Is Nested (nest_driver.h) ***/
+    if(NEST_DRIVER_POSTPONE())
+        return;
+
+    /*** Handle Interrupt ***/
+    PROFILE_DRIVER_START(start);
+    MEMORY_DRIVER_RECORD_INTERRUPT_ENTRY();
+    interruptFlag = (uint16_t)__even_in_range(P2IV, P2IV_P2IFG7);
+    TRACE_DRIVER_BEGIN(TRACE_DRIVER_EVENT_PORT2_VECTOR, interruptFlag);
+    portDriver_interruptHandler(GPIO_PORT_P2, interruptFlag);
+    TRACE_DRIVER_END(TRACE_DRIVER_EVENT_PORT2_VECTOR, interruptFlag);
+    PROFILE_DRIVER_INTERRUPT(PROFILE_DRIVER_VECTOR_PORT2, start);
+    POWER_DRIVER_WAKE_ON_EXIT(); // Owning Driver Tick
+}
+
+/****************************************************************************************************
+ * FUNCT:   interruptHandler_port3Vector
+ * BRIEF:   Port 3 Vector Interrupt Handler
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ ****************************************************************************************************/
+#pragma vector=PORT3_VECTOR
+__interrupt void interruptHandler_port3Vector(void)
+{
+    uint16_t interruptFlag;
+    PROFILE_DRIVER_COUNT(start);
+
+    /*** Postponed While A Handler Is Nested (nest_driver.h) ***/
+    if(NEST_DRIVER_POSTPONE())
+        return;
+
+    /*** Handle Interrupt ***/
+    PROFILE_DRIVER_START(start);
+    MEMORY_DRIVER_RECORD_INTERRUPT_ENTRY();
+    interruptFlag = (uint16_t)__even_in_range(P3IV, P3IV_P3IFG7);
+    TRACE_DRIVER_BEGIN(TRACE_DRIVER_EVENT_PORT3_VECTOR, interruptFlag);
+    portDriver_interruptHandler(GPIO_PORT_P3, interruptFlag);
+    TRACE_DRIVER_END(TRACE_DRIVER_EVENT_PORT3_VECTOR, interruptFlag);
+    PROFILE_DRIVER_INTERRUPT(PROFILE_DRIVER_VECTOR_PORT3, start);
+    POWER_DRIVER_WAKE_ON_EXIT(); // Owning Driver Tick
+}
+
+/****************************************************************************************************
+ * FUNCT:   interruptHandler_port4Vector
+ * BRIEF:   Port 4 Vector Interrupt Handler
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ ****************************************************************************************************/
+#pragma vector=PORT4_VECTOR
+__interrupt void interruptHandler_port4Vector(void)
+{
+    uint16_t interruptFlag;
+    PROFILE_DRIVER_COUNT(start);
+
+    /*** Postponed While A Handler Is Nested (nest_driver.h) ***/
+    if(NEST_DRIVER_POSTPONE())
+        return;
+
+    /*** Handle Interrupt ***/
+    PROFILE_DRIVER_START(start);
+    MEMORY_DRIVER_RECORD_INTERRUPT_ENTRY();
+    interruptFlag = (uint16_t)__even_in_range(P4IV, P4IV_P4IFG7);
+    TRACE_DRIVER_BEGIN(TRACE_DRIVER_EVENT_PORT4_VECTOR, interruptFlag);
+    portDriver_interruptHandler(GPIO_PORT_P4, interruptFlag);
+    TRACE_DRIVER_END(TRACE_DRIVER_EVENT_PORT4_VECTOR, interruptFlag);
+    PROFILE_DRIVER_INTERRUPT(PROFILE_DRIVER_VECTOR_PORT4, start);
+    POWER_DRIVER_WAKE_ON_EXIT(); // Owning Driver Tick
 }
 
 /****************************************************************************************************
@@ -30,12 +157,51 @@ __interrupt void interruptHandler_port1Vector(void)
  * BRIEF:   Timer A0, Capture/Compare Register 1-4 Vector Interrupt Handler
  * RETURN:  Returns Nothing
  * ARG:     No Arguments
+ * NOTE:    Low Priority: Nested (nest_driver.h), So USCI_A1 Receive Preempts The LED Driver
  ****************************************************************************************************/
 #pragma vector=TIMER0_A1_VECTOR // Timer A0, Capture/Compare Register 1-4; Timer A0, Capture/Compare Register 0 Has It's Own Interrupt Vector
-__interrupt void interruptHandler_timer0A1Vector(void)
+VECTOR_DRIVER_RAMFUNC __interrupt void interruptHandler_timer0A1Vector(void)
 {
-    /*** Handle Interrupt ***/
-    ledDriver_timerInterruptHandler(__even_in_range(TA0IV, TA0IV_TAIFG));
+    nestDriver_context_t context;
+    uint16_t interruptFlag;
+    PROFILE_DRIVER_COUNT(start);
+
+    /*** Postponed While A Handler Is Nested, Including This One For Another Timer A0 Source (nest_driver.h) ***/
+    if(NEST_DRIVER_POSTPONE())
+        return;
+
+    /*** Handle Interrupt (Interrupts Enabled Between Enter And Exit) ***/
+    PROFILE_DRIVER_START(start);
+    MEMORY_DRIVER_RECORD_INTERRUPT_ENTRY();
+    interruptFlag = (uint16_t)__even_in_range(TA0IV, TA0IV_TAIFG);
+    NEST_DRIVER_ENTER(&context, start);
+    TRACE_DRIVER_BEGIN(TRACE_DRIVER_EVENT_TIMER0_A1_VECTOR, interruptFlag);
+    ledDriver_timerInterruptHandler(interruptFlag);
+    TRACE_DRIVER_END(TRACE_DRIVER_EVENT_TIMER0_A1_VECTOR, interruptFlag);
+    NEST_DRIVER_EXIT(&context);
+    PROFILE_DRIVER_NESTED_INTERRUPT(PROFILE_DRIVER_VECTOR_TIMER0_A1, start, context.disabledStart);
+}
+
+/****************************************************************************************************
+ * FUNCT:   interruptHandler_timer0B1Vector
+ * BRIEF:   Timer B0, Capture/Compare Register 1-6 And Overflow Vector Interrupt Handler
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ ****************************************************************************************************/
+#pragma vector=TIMER0_B1_VECTOR // Timer B0, Capture/Compare Register 1-6 And Overflow; Timer B0, Capture/Compare Register 0 Has It's Own Interrupt Vector
+__interrupt void interruptHandler_timer0B1Vector(void)
+{
+    PROFILE_DRIVER_COUNT(start);
+
+    /*** Postponed While A Handler Is Nested (nest_driver.h) ***/
+    if(NEST_DRIVER_POSTPONE())
+        return;
+
+    /*** Handle Interrupt (Not Traced: It Extends The Trace Timestamps And Would Fill The Ring) ***/
+    PROFILE_DRIVER_START(start);
+    MEMORY_DRIVER_RECORD_INTERRUPT_ENTRY();
+    traceDriver_timerInterruptHandler((uint16_t)__even_in_range(TB0IV, TB0IV_TBIFG));
+    PROFILE_DRIVER_INTERRUPT(PROFILE_DRIVER_VECTOR_TIMER0_B1, start);
 }
 
 /****************************************************************************************************
@@ -43,10 +209,34 @@ __interrupt void interruptHandler_timer0A1Vector(void)
  * BRIEF:   Universal Serial Communications Interface (USCI) A1 Vector Interrupt Handler
  * RETURN:  Returns Nothing
  * ARG:     No Arguments
+ * NOTE:    High Priority: Not Nested, So Nothing Preempts It; Must Finish Within A Character Time
+ * NOTE:    A Received Character Is Read From UCA1RXBUF Before Anything Else, Without Reading UCA1IV;
+ *          The Profile, Stack And Trace Recording Follow (Profiled From The Read) And Compile Out
+ *          Unless Configured, Leaving A Path With No Calls (cli_callback.h, power_driver.h)
  ****************************************************************************************************/
 #pragma vector=USCI_A1_VECTOR
-__interrupt void interruptHandler_usciA1Vector(void)
+VECTOR_DRIVER_RAMFUNC __interrupt void interruptHandler_usciA1Vector(void)
 {
-    /*** Handle Interrupt ***/
-    cliCallback_usciInterruptHandler(__even_in_range(UCA1IV, USCI_UART_UCTXCPTIFG));
+    uint16_t interruptFlag;
+    PROFILE_DRIVER_COUNT(start);
+
+    /*** Handle Interrupt (Receive First) ***/
+    if((UCA1IFG & UCRXIFG) == UCRXIFG)
+    {
+        cliCallback_receiveInterruptHandler();
+        interruptFlag = USCI_UART_UCRXIFG;
+    }
+    else
+    {
+        interruptFlag = (uint16_t)__even_in_range(UCA1IV, USCI_UART_UCTXCPTIFG);
+        cliCallback_usciInterruptHandler(interruptFlag);
+    }
+
+    /*** Record ***/
+    PROFILE_DRIVER_START(start);
+    MEMORY_DRIVER_RECORD_INTERRUPT_ENTRY();
+    TRACE_DRIVER_BEGIN(TRACE_DRIVER_EVENT_USCI_A1_VECTOR, interruptFlag);
+    TRACE_DRIVER_END(TRACE_DRIVER_EVENT_USCI_A1_VECTOR, interruptFlag);
+    PROFILE_DRIVER_INTERRUPT(PROFILE_DRIVER_VECTOR_USCI_A1, start);
+    POWER_DRIVER_WAKE_ON_EXIT(); // Start Bit (Asleep) Or Received Character: CLI Tick
 }
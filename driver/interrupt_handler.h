@@ -6,12 +6,23 @@
 #ifndef INTERRUPT_HANDLER_H
 #define INTERRUPT_HANDLER_H
 
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "msp430fr6989.h"
+
 /****************************************************************************************************
  * Function Prototypes
  ****************************************************************************************************/
 
+extern __interrupt void interruptHandler_compEVector(void);
 extern __interrupt void interruptHandler_port1Vector(void);
+extern __interrupt void interruptHandler_port2Vector(void);
+extern __interrupt void interruptHandler_port3Vector(void);
+extern __interrupt void interruptHandler_port4Vector(void);
 extern __interrupt void interruptHandler_timer0A1Vector(void);
+extern __interrupt void interruptHandler_timer0B1Vector(void);
 extern __interrupt void interruptHandler_usciA1Vector(void);
 
 #endif
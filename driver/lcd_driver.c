@@ -7,6 +7,9 @@
  * Includes
  ****************************************************************************************************/
 
+#include "driver_config.h"
+#include "init_driver.h"
+#include "init_driver_table.h"
 #include "lcd_c.h"
 #include "lcd_driver.h"
 #include "msp430fr6989.h"
@@ -16,16 +19,17 @@
  ****************************************************************************************************/
 
 /****************************************************************************************************
- * FUNCT:   lcdDriver_init
- * BRIEF:   Initialize
+ * FUNCT:   lcdDriver_configure
+ * BRIEF:   Configure
  * RETURN:  Returns Nothing
  * ARG:     No Arguments
+ * NOTE:    Registers Only, Through driverlib; init_generator Turns It Into initDriverTable_lcd
  ****************************************************************************************************/
-void lcdDriver_init(void)
+void lcdDriver_configure(void)
 {
 	LCD_C_initParam lcdInit;
 
-	/*** Initialize ***/
+	/*** Configure ***/
 	/* GPIO Pins */
 	LCD_C_setPinAsLCDFunctionEx(LCD_C_BASE, LCD_C_SEGMENT_LINE_4, LCD_C_SEGMENT_LINE_4);
 	LCD_C_setPinAsLCDFunctionEx(LCD_C_BASE, LCD_C_SEGMENT_LINE_6, LCD_C_SEGMENT_LINE_21);
@@ -54,6 +58,22 @@ void lcdDriver_init(void)
 	LCD_C_setBlinkingControl(LCD_C_BASE, LCD_C_BLINK_FREQ_CLOCK_DIVIDER_1, LCD_C_BLINK_FREQ_CLOCK_PRESCALAR_32768, LCD_C_BLINK_MODE_INDIVIDUAL_SEGMENTS); // Blinking Frequency = 32768 Hz (ACLK Frequency) / (1 * 32768) = 1 Hz
 }
 
+/****************************************************************************************************
+ * FUNCT:   lcdDriver_init
+ * BRIEF:   Initialize
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ ****************************************************************************************************/
+void lcdDriver_init(void)
+{
+	/*** Registers ***/
+#if DRIVER_CONFIG_INIT_TABLE
+	initDriver_apply(initDriverTable_lcd, INIT_DRIVER_TABLE_LCD_LENGTH);
+#else
+	lcdDriver_configure();
+#endif
+}
+
 /****************************************************************************************************
  * FUNCT:   lcdDriver_set
  * BRIEF:   Set
@@ -17,6 +17,7 @@
  * Function Prototypes
  ****************************************************************************************************/
 
+extern void lcdDriver_configure(void);
 extern void lcdDriver_init(void);
 extern void lcdDriver_set(const uint8_t Segment, const uint8_t Value, const bool Clear, const bool Blink);
 
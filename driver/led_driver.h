@@ -34,14 +34,15 @@ typedef struct ledDriver_ledBlink_s
 {
 	bool enabled;
     bool on;
-    uint16_t onMilliseconds;
-    uint16_t offMilliseconds;
+    uint16_t onTicks;  // Converted Once By ledDriver_enableBlink(), Not In The Interrupt Handler
+    uint16_t offTicks;
 } ledDriver_ledBlink_t;
 
 /****************************************************************************************************
  * Function Prototypes
  ****************************************************************************************************/
 
+extern void ledDriver_configure(void);
 extern bool ledDriver_enableBlink(const ledDriver_led_t Led, const uint16_t OnMilliseconds, const uint16_t OffMilliseconds);
 extern void ledDriver_init(void);
 extern bool ledDriver_isEnabled(const ledDriver_led_t Led);
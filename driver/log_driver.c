@@ -0,0 +1,179 @@
+/****************************************************************************************************
+ * FILE:    log_driver.c
+ * BRIEF:   Log Driver Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "driver_config.h"
+#include "intrinsics.h"
+#include "log_driver.h"
+#include "msp430fr5xx_6xxgeneric.h"
+#include "profile_driver.h"
+#include "project.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "trace_driver.h"
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+PROJECT_STATIC uint8_t logDriver_buffer[LOG_DRIVER_BUFFER_LENGTH];
+PROJECT_STATIC volatile uint16_t logDriver_dropCount;
+PROJECT_STATIC volatile bool logDriver_enabled;
+PROJECT_STATIC volatile uint8_t logDriver_head; // Written By logDriver_record() Only
+PROJECT_STATIC volatile uint8_t logDriver_tail; // Written By logDriver_tick() Only
+static logDriver_writeCallback_t logDriver_writeCallback;
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   logDriver_getDropCount
+ * BRIEF:   Get Drop Count
+ * RETURN:  uint16_t: Number Of Records Dropped Because The Buffer Was Full (Saturates)
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+uint16_t logDriver_getDropCount(void)
+{
+    /*** Get Drop Count ***/
+    return logDriver_dropCount;
+}
+
+/****************************************************************************************************
+ * FUNCT:   logDriver_init
+ * BRIEF:   Initialize
+ * RETURN:  void: Returns Nothing
+ * ARG:     WriteCallback: Write Callback (Sends Queued Record Bytes From logDriver_tick())
+ * NOTE:    Logging Starts Disabled, So Binary Records Only Reach The Wire When Asked For
+ ****************************************************************************************************/
+void logDriver_init(const logDriver_writeCallback_t WriteCallback)
+{
+    /*** Initialize ***/
+    logDriver_dropCount = 0;
+    logDriver_enabled = false;
+    logDriver_head = 0;
+    logDriver_tail = 0;
+    logDriver_writeCallback = WriteCallback;
+}
+
+/****************************************************************************************************
+ * FUNCT:   logDriver_isEnabled
+ * BRIEF:   Is Enabled
+ * RETURN:  bool: Enabled (true) Or Disabled (false)
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+bool logDriver_isEnabled(void)
+{
+    /*** Is Enabled ***/
+    return logDriver_enabled;
+}
+
+/****************************************************************************************************
+ * FUNCT:   logDriver_record
+ * BRIEF:   Record
+ * RETURN:  void: Returns Nothing
+ * ARG:     Id: Format String ID (LOG_DRIVER_ID())
+ * ARG:     Count: Number Of Arguments (LOG_DRIVER_ARGUMENT_MAXIMUM Maximum)
+ * ARG:     Arguments: Arguments
+ * NOTE:    Called Through The LOG_DRIVER_LOGx() Macros; Safe From Interrupt Handlers: No
+ *          Formatting, Just A Timer Read And A Copy Into The Buffer With Interrupts Disabled
+ * NOTE:    The Timestamp Is The Log Timer Count (ACLK: 32768 Hz; Wraps Every 2 Seconds)
+ ****************************************************************************************************/
+void logDriver_record(const uint16_t Id, const uint8_t Count, const uint32_t * const Arguments)
+{
+    uint32_t argument;
+    uint16_t timestamp;
+    uint8_t i, index, length;
+    unsigned short interruptState;
+    PROFILE_DRIVER_COUNT(start);
+
+    /*** Error Check ***/
+    if(!logDriver_enabled || (Count > LOG_DRIVER_ARGUMENT_MAXIMUM))
+        return;
+
+    /*** Timestamp ***/
+    timestamp = HWREG16(DRIVER_CONFIG_LOG_TIMER + OFS_TAxR);
+
+    /*** Reserve And Fill (Interrupts Disabled So Records Never Interleave) ***/
+    length = (uint8_t)(LOG_DRIVER_RECORD_HEADER_LENGTH + (Count * sizeof(uint32_t)));
+    interruptState = __get_interrupt_state();
+    __disable_interrupt();
+    PROFILE_DRIVER_START(start);
+    if((uint8_t)(logDriver_tail - logDriver_head - 1) < length)
+    {
+        /* Full: Drop */
+        if(logDriver_dropCount < UINT16_MAX)
+            logDriver_dropCount++;
+    }
+    else
+    {
+        /* Header */
+        index = logDriver_head;
+        logDriver_buffer[index++] = (uint8_t)(LOG_DRIVER_RECORD_SYNC | Count);
+        logDriver_buffer[index++] = (uint8_t)Id;
+        logDriver_buffer[index++] = (uint8_t)(Id >> 8);
+        logDriver_buffer[index++] = (uint8_t)timestamp;
+        logDriver_buffer[index++] = (uint8_t)(timestamp >> 8);
+
+        /* Arguments */
+        for(i = 0; i < Count; i++)
+        {
+            argument = Arguments[i];
+            logDriver_buffer[index++] = (uint8_t)argument;
+            logDriver_buffer[index++] = (uint8_t)(argument >> 8);
+            logDriver_buffer[index++] = (uint8_t)(argument >> 16);
+            logDriver_buffer[index++] = (uint8_t)(argument >> 24);
+        }
+
+        /* Commit */
+        logDriver_head = index;
+    }
+    PROFILE_DRIVER_CRITICAL_SECTION(start);
+    __set_interrupt_state(interruptState);
+}
+
+/****************************************************************************************************
+ * FUNCT:   logDriver_setEnabled
+ * BRIEF:   Set Enabled
+ * RETURN:  void: Returns Nothing
+ * ARG:     Enabled: Enable (true) Or Disable (false)
+ ****************************************************************************************************/
+void logDriver_setEnabled(const bool Enabled)
+{
+    /*** Set Enabled ***/
+    logDriver_enabled = Enabled;
+}
+
+/****************************************************************************************************
+ * FUNCT:   logDriver_tick
+ * BRIEF:   Tick
+ * RETURN:  void: Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Drains Queued Records To The Write Callback (At Most Two Contiguous Pieces)
+ ****************************************************************************************************/
+void logDriver_tick(void)
+{
+    uint16_t length;
+    uint8_t head;
+
+    /*** Error Check ***/
+    if(logDriver_writeCallback == NULL)
+        return;
+
+    /*** Drain ***/
+    head = logDriver_head;
+    while(logDriver_tail != head)
+    {
+        length = (head > logDriver_tail) ? (uint16_t)(head - logDriver_tail) : (uint16_t)(LOG_DRIVER_BUFFER_LENGTH - logDriver_tail);
+        TRACE_DRIVER_BEGIN(TRACE_DRIVER_EVENT_LOG_DRAIN, length);
+        logDriver_writeCallback(&logDriver_buffer[logDriver_tail], length);
+        TRACE_DRIVER_END(TRACE_DRIVER_EVENT_LOG_DRAIN, length);
+        logDriver_tail = (uint8_t)(logDriver_tail + length);
+    }
+}
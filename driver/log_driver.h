@@ -0,0 +1,104 @@
+/****************************************************************************************************
+ * FILE:    log_driver.h
+ * BRIEF:   Log Driver Header File
+ * NOTE:    Tokenized Deferred Logging: Format Strings Live In A Section That Is Never Loaded Into
+ *          The Device, Only Their ID (Address In That Section), A Timestamp And The Raw Arguments Are
+ *          Queued; The Main Loop Drains The Queue To The CLI UART, And The Host Decoder
+ *          (project/unit_test/log/log_decoder.c) Looks The Format Strings Up In The ELF File
+ * NOTE:    Record (Little Endian): Sync | Argument Count (1 Byte), ID (2 Bytes), Timestamp (2 Bytes),
+ *          Arguments (4 Bytes Each); Sync Bytes Are Never Valid ASCII, So Records Interleave With
+ *          CLI Text On The Same Wire
+ ****************************************************************************************************/
+
+#ifndef LOG_DRIVER_H
+#define LOG_DRIVER_H
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define LOG_DRIVER_ARGUMENT_MAXIMUM     (4)
+#define LOG_DRIVER_BUFFER_LENGTH        (256)  // uint8_t Indices Wrap Around For Free
+#define LOG_DRIVER_RECORD_HEADER_LENGTH (5)
+#define LOG_DRIVER_RECORD_SYNC          (0xF0) // Upper Nibble; Lower Nibble: Argument Count
+#define LOG_DRIVER_RECORD_SYNC_MASK     (0xF0)
+
+/*** Format String Section And ID ***/
+#ifdef __UNIT_TEST__
+  #define LOG_DRIVER_ID(FORMAT) ((uint16_t)((FORMAT) - logDriver_sectionStart)) // Offset In Section (Host Addresses Don't Fit)
+  #define LOG_DRIVER_SECTION    __attribute__((section("logstr"), used))
+#else
+  #define LOG_DRIVER_ID(FORMAT) ((uint16_t)(uintptr_t)(FORMAT)) // Address In Section (Linked At 0, Never Loaded)
+  #define LOG_DRIVER_SECTION    __attribute__((section(".logstr"), retain))
+#endif
+
+/*** Log (Arguments Are Sent As uint32_t; The Decoder Reads Every Conversion As 32 Bits) ***/
+#define LOG_DRIVER_LOG0(FORMAT)                                                                              \
+    do                                                                                                       \
+    {                                                                                                        \
+        static const char logDriver_format[] LOG_DRIVER_SECTION = FORMAT;                                    \
+        logDriver_record(LOG_DRIVER_ID(logDriver_format), 0, NULL);                                          \
+    } while(0)
+#define LOG_DRIVER_LOG1(FORMAT, A)                                                                           \
+    do                                                                                                       \
+    {                                                                                                        \
+        static const char logDriver_format[] LOG_DRIVER_SECTION = FORMAT;                                    \
+        const uint32_t logDriver_arguments[] = {(uint32_t)(A)};                                              \
+        logDriver_record(LOG_DRIVER_ID(logDriver_format), 1, logDriver_arguments);                           \
+    } while(0)
+#define LOG_DRIVER_LOG2(FORMAT, A, B)                                                                        \
+    do                                                                                                       \
+    {                                                                                                        \
+        static const char logDriver_format[] LOG_DRIVER_SECTION = FORMAT;                                    \
+        const uint32_t logDriver_arguments[] = {(uint32_t)(A), (uint32_t)(B)};                               \
+        logDriver_record(LOG_DRIVER_ID(logDriver_format), 2, logDriver_arguments);                           \
+    } while(0)
+#define LOG_DRIVER_LOG3(FORMAT, A, B, C)                                                                     \
+    do                                                                                                       \
+    {                                                                                                        \
+        static const char logDriver_format[] LOG_DRIVER_SECTION = FORMAT;                                    \
+        const uint32_t logDriver_arguments[] = {(uint32_t)(A), (uint32_t)(B), (uint32_t)(C)};                \
+        logDriver_record(LOG_DRIVER_ID(logDriver_format), 3, logDriver_arguments);                           \
+    } while(0)
+#define LOG_DRIVER_LOG4(FORMAT, A, B, C, D)                                                                  \
+    do                                                                                                       \
+    {                                                                                                        \
+        static const char logDriver_format[] LOG_DRIVER_SECTION = FORMAT;                                    \
+        const uint32_t logDriver_arguments[] = {(uint32_t)(A), (uint32_t)(B), (uint32_t)(C), (uint32_t)(D)}; \
+        logDriver_record(LOG_DRIVER_ID(logDriver_format), 4, logDriver_arguments);                           \
+    } while(0)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef void (*logDriver_writeCallback_t)(const uint8_t * const Data, const size_t Length);
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+#ifdef __UNIT_TEST__
+extern const char logDriver_sectionStart[] __asm__("__start_logstr"); // Linker Provided
+#endif
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern uint16_t logDriver_getDropCount(void);
+extern void logDriver_init(const logDriver_writeCallback_t WriteCallback);
+extern bool logDriver_isEnabled(void);
+extern void logDriver_record(const uint16_t Id, const uint8_t Count, const uint32_t * const Arguments);
+extern void logDriver_setEnabled(const bool Enabled);
+extern void logDriver_tick(void);
+
+#endif
@@ -0,0 +1,143 @@
+/****************************************************************************************************
+ * FILE:    memory_driver.c
+ * BRIEF:   Memory Driver Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#ifdef __UNIT_TEST__
+/*** Host: Stand-Ins For The Linker Symbols, In Simulated RAM (memory_driver_test.h) ***/
+#define MEMORY_DRIVER_BSS_START     (MEMORY_DRIVER_TEST_BSS_START)
+#define MEMORY_DRIVER_BSS_END       (MEMORY_DRIVER_TEST_BSS_END)
+#define MEMORY_DRIVER_DATA_START    (MEMORY_DRIVER_TEST_DATA_START)
+#define MEMORY_DRIVER_DATA_END      (MEMORY_DRIVER_TEST_DATA_END)
+#define MEMORY_DRIVER_NOINIT_START  (MEMORY_DRIVER_TEST_NOINIT_START)
+#define MEMORY_DRIVER_NOINIT_END    (MEMORY_DRIVER_TEST_NOINIT_END)
+#define MEMORY_DRIVER_RAMFUNC_START (MEMORY_DRIVER_TEST_RAMFUNC_START)
+#define MEMORY_DRIVER_RAMFUNC_END   (MEMORY_DRIVER_TEST_RAMFUNC_END)
+#define MEMORY_DRIVER_STACK_START   (MEMORY_DRIVER_TEST_STACK_START)
+#define MEMORY_DRIVER_STACK_END     (MEMORY_DRIVER_TEST_STACK_END)
+#else
+/*** Target: Linker Symbols (lnk_msp430fr6989.cmd RUN_START/RUN_END) ***/
+#define MEMORY_DRIVER_BSS_START     ((uint16_t)(uintptr_t)ram_bss_start)
+#define MEMORY_DRIVER_BSS_END       ((uint16_t)(uintptr_t)ram_bss_end)
+#define MEMORY_DRIVER_DATA_START    ((uint16_t)(uintptr_t)ram_data_start)
+#define MEMORY_DRIVER_DATA_END      ((uint16_t)(uintptr_t)ram_data_end)
+#define MEMORY_DRIVER_NOINIT_START  ((uint16_t)(uintptr_t)ram_noinit_start)
+#define MEMORY_DRIVER_NOINIT_END    ((uint16_t)(uintptr_t)ram_noinit_end)
+#define MEMORY_DRIVER_RAMFUNC_START ((uint16_t)(uintptr_t)ram_ramfunc_start)
+#define MEMORY_DRIVER_RAMFUNC_END   ((uint16_t)(uintptr_t)ram_ramfunc_end)
+#define MEMORY_DRIVER_STACK_START   ((uint16_t)(uintptr_t)ram_stack_start)
+#define MEMORY_DRIVER_STACK_END     ((uint16_t)(uintptr_t)ram_stack_end)
+#endif
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "driver_config.h"
+#include "inc/hw_memmap.h"
+#include "intrinsics.h"
+#include "memory_driver.h"
+#include "msp430fr5xx_6xxgeneric.h"
+#include "project.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include "vector_driver.h"
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+#ifndef __UNIT_TEST__
+extern char ram_bss_start[], ram_bss_end[];
+extern char ram_data_start[], ram_data_end[];
+extern char ram_noinit_start[], ram_noinit_end[];
+#if DRIVER_CONFIG_VECTOR_RAM
+extern char ram_ramfunc_start[], ram_ramfunc_end[]; // Only Defined When The Linker Reserves RAMFUNC Too
+#endif
+extern char ram_stack_start[], ram_stack_end[];
+#endif
+
+PROJECT_STATIC volatile uint16_t memoryDriver_interruptEntryMaximum; // Bytes
+PROJECT_STATIC uint16_t memoryDriver_paintEnd;                       // Stack Painted Below This Address
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   memoryDriver_getUsage
+ * BRIEF:   Get Usage
+ * RETURN:  void: Returns Nothing
+ * ARG:     Usage: Usage
+ * NOTE:    Scans The Painted Stack From The Bottom Up To The First Overwritten Word; Everything
+ *          Above It Counts As Used (Stack Use Is Contiguous From The Top)
+ ****************************************************************************************************/
+void memoryDriver_getUsage(memoryDriver_usage_t * const Usage)
+{
+    uint16_t address;
+
+    /*** Sections ***/
+    Usage->bssLength = (uint16_t)(MEMORY_DRIVER_BSS_END - MEMORY_DRIVER_BSS_START);
+    Usage->dataLength = (uint16_t)(MEMORY_DRIVER_DATA_END - MEMORY_DRIVER_DATA_START);
+    Usage->noinitLength = (uint16_t)(MEMORY_DRIVER_NOINIT_END - MEMORY_DRIVER_NOINIT_START);
+    Usage->stackLength = (uint16_t)(MEMORY_DRIVER_STACK_END - MEMORY_DRIVER_STACK_START);
+#if DRIVER_CONFIG_VECTOR_RAM
+    Usage->ramfuncLength = (uint16_t)(MEMORY_DRIVER_RAMFUNC_END - MEMORY_DRIVER_RAMFUNC_START);
+    Usage->freeLength = (uint16_t)(MEMORY_DRIVER_RAM_LENGTH - Usage->bssLength - Usage->dataLength - Usage->noinitLength - Usage->stackLength - VECTOR_DRIVER_RAMFUNC_BUDGET - VECTOR_DRIVER_RAM_LENGTH); // Both Regions Reserved, Used Or Not
+#else
+    Usage->ramfuncLength = 0;
+    Usage->freeLength = (uint16_t)(MEMORY_DRIVER_RAM_LENGTH - Usage->bssLength - Usage->dataLength - Usage->noinitLength - Usage->stackLength);
+#endif
+
+    /*** Stack High Water Mark ***/
+    for(address = MEMORY_DRIVER_STACK_START; address < memoryDriver_paintEnd; address += sizeof(uint16_t))
+    {
+        if(HWREG16(address) != MEMORY_DRIVER_PAINT)
+            break;
+    }
+    Usage->stackHighWater = (uint16_t)(MEMORY_DRIVER_STACK_END - address);
+    Usage->stackOverflow = (HWREG16(MEMORY_DRIVER_STACK_START) != MEMORY_DRIVER_PAINT);
+    Usage->interruptEntryMaximum = memoryDriver_interruptEntryMaximum;
+}
+
+/****************************************************************************************************
+ * FUNCT:   memoryDriver_init
+ * BRIEF:   Initialize
+ * RETURN:  void: Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Call With Interrupts Disabled; Paints The Stack Below The Stack Pointer (Free Right Now)
+ ****************************************************************************************************/
+void memoryDriver_init(void)
+{
+    uint16_t address;
+
+    /*** Paint Free Stack ***/
+    memoryDriver_paintEnd = (uint16_t)(__get_SP_register() & ~1u);
+    for(address = MEMORY_DRIVER_STACK_START; address < memoryDriver_paintEnd; address += sizeof(uint16_t))
+        HWREG16(address) = MEMORY_DRIVER_PAINT;
+
+    /*** Interrupt Entry ***/
+    memoryDriver_interruptEntryMaximum = 0;
+}
+
+/****************************************************************************************************
+ * FUNCT:   memoryDriver_recordInterruptEntry
+ * BRIEF:   Record Interrupt Entry
+ * RETURN:  void: Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Called First In The Interrupt Handler: Stack Depth Of The Interrupted Context Plus The
+ *          Return Address And Status Register Pushed On Entry
+ ****************************************************************************************************/
+void memoryDriver_recordInterruptEntry(void)
+{
+    uint16_t depth;
+
+    /*** Deepest Entry ***/
+    depth = (uint16_t)(MEMORY_DRIVER_STACK_END - __get_SP_register());
+    if(depth > memoryDriver_interruptEntryMaximum)
+        memoryDriver_interruptEntryMaximum = depth;
+}
@@ -0,0 +1,60 @@
+/****************************************************************************************************
+ * FILE:    memory_driver.h
+ * BRIEF:   Memory Driver Header File
+ * NOTE:    RAM Accounting: Section Sizes From The Linker Command File, A Stack High Water Mark From
+ *          Painting The Free Stack At Boot, And The Deepest Stack Seen On Interrupt Entry;
+ *          "system --mem" Reports
+ ****************************************************************************************************/
+
+#ifndef MEMORY_DRIVER_H
+#define MEMORY_DRIVER_H
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "driver_config.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define MEMORY_DRIVER_PAINT      (0xA5A5)
+#define MEMORY_DRIVER_RAM_LENGTH (0x0800)
+#define MEMORY_DRIVER_RAM_START  (0x1C00)
+
+/*** Interrupt Entry (Interrupt Handlers Only, First; DRIVER_CONFIG_STACK_ENTRY: Expands To Nothing When Off) ***/
+#if DRIVER_CONFIG_STACK_ENTRY
+  #define MEMORY_DRIVER_RECORD_INTERRUPT_ENTRY() memoryDriver_recordInterruptEntry()
+#else
+  #define MEMORY_DRIVER_RECORD_INTERRUPT_ENTRY()
+#endif
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef struct memoryDriver_usage_s
+{
+    uint16_t bssLength;             // Bytes
+    uint16_t dataLength;            // Bytes
+    uint16_t noinitLength;          // Bytes (#pragma NOINIT)
+    uint16_t ramfuncLength;         // Bytes (.TI.ramfunc, Within VECTOR_DRIVER_RAMFUNC_BUDGET)
+    uint16_t stackLength;           // Bytes
+    uint16_t stackHighWater;        // Bytes (Deepest Stack Since Boot)
+    uint16_t interruptEntryMaximum; // Bytes (Deepest Stack On Interrupt Entry)
+    uint16_t freeLength;            // Bytes (RAM Not In The Sections Above, The RAMFUNC Budget Or The Vectors)
+    bool stackOverflow;             // Lowest Stack Word Overwritten
+} memoryDriver_usage_t;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern void memoryDriver_getUsage(memoryDriver_usage_t * const Usage);
+extern void memoryDriver_init(void);
+extern void memoryDriver_recordInterruptEntry(void);
+
+#endif
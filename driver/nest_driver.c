@@ -0,0 +1,172 @@
+/****************************************************************************************************
+ * FILE:    nest_driver.c
+ * BRIEF:   Nest Driver Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "driver_config.h"
+#include "inc/hw_memmap.h"
+#include "intrinsics.h"
+#include "nest_driver.h"
+#include "profile_driver.h"
+#include "project.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+PROJECT_STATIC volatile uint8_t nestDriver_workHead, nestDriver_workTail; // Empty When Equal
+PROJECT_STATIC nestDriver_work_t nestDriver_work[NEST_DRIVER_WORK_COUNT];
+
+/*** Software Priority Mask: Every Low Priority Interrupt Enable (All But USCI_A1) ***/
+static const nestDriver_enable_t nestDriver_enables[] =
+{
+    /* Comparator E */
+    {COMP_E_BASE + OFS_CEINT, CEIE | CEIIE},
+
+    /* Ports 1 To 4 (PxIE Pairs) */
+    {PA_BASE + OFS_PAIE, 0xFFFF}, {PB_BASE + OFS_PAIE, 0xFFFF},
+
+    /* Timer A0, Capture/Compare Register 1-4 And Overflow */
+    {TIMER_A0_BASE + OFS_TAxCTL, TAIE},
+    {TIMER_A0_BASE + OFS_TAxCCTL1, CCIE}, {TIMER_A0_BASE + OFS_TAxCCTL2, CCIE}, {TIMER_A0_BASE + OFS_TAxCCTL3, CCIE}, {TIMER_A0_BASE + OFS_TAxCCTL4, CCIE},
+
+    /* Timer B0, Capture/Compare Register 1-6 And Overflow */
+    {TIMER_B0_BASE + OFS_TBxCTL, TBIE},
+    {TIMER_B0_BASE + OFS_TBxCCTL1, CCIE}, {TIMER_B0_BASE + OFS_TBxCCTL2, CCIE}, {TIMER_B0_BASE + OFS_TBxCCTL3, CCIE},
+    {TIMER_B0_BASE + OFS_TBxCCTL4, CCIE}, {TIMER_B0_BASE + OFS_TBxCCTL5, CCIE}, {TIMER_B0_BASE + OFS_TBxCCTL6, CCIE}
+};
+
+static uint16_t nestDriver_maskedEnables[sizeof(nestDriver_enables) / sizeof(nestDriver_enables[0])]; // Bits The Mask Cleared
+volatile uint8_t nestDriver_depth; // Not Static: Used By The Inline Enter, Exit And Postpone (nest_driver.h)
+volatile bool nestDriver_masked;   // Not Static: Used By The Inline Exit And Postpone (nest_driver.h)
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   nestDriver_defer
+ * BRIEF:   Defer
+ * RETURN:  bool: Success (true) Or Failure (false) Because The Queue Is Full
+ * ARG:     Work: Work, Run Once By nestDriver_tick() In The Main Loop
+ * NOTE:    Work Already Queued Isn't Queued Twice; The Deferring Interrupt Handler Wakes The Main Loop
+ *          (POWER_DRIVER_WAKE_ON_EXIT())
+ ****************************************************************************************************/
+bool nestDriver_defer(const nestDriver_work_t Work)
+{
+    bool success;
+    uint8_t i, next;
+    unsigned short interruptState;
+    PROFILE_DRIVER_COUNT(start);
+
+    /*** Error Check ***/
+    if(Work == NULL)
+        return false;
+
+    /*** Queue (Interrupts Disabled: Nested Handlers Defer Too) ***/
+    interruptState = __get_interrupt_state();
+    __disable_interrupt();
+    PROFILE_DRIVER_START(start);
+    success = true;
+    for(i = nestDriver_workTail; (i != nestDriver_workHead) && (nestDriver_work[i] != Work); i = (uint8_t)((i + 1) % NEST_DRIVER_WORK_COUNT));
+    if(i == nestDriver_workHead)
+    {
+        next = (uint8_t)((nestDriver_workHead + 1) % NEST_DRIVER_WORK_COUNT);
+        if(next == nestDriver_workTail)
+        {
+            success = false;
+        }
+        else
+        {
+            nestDriver_work[nestDriver_workHead] = Work;
+            nestDriver_workHead = next;
+        }
+    }
+    PROFILE_DRIVER_CRITICAL_SECTION(start);
+    __set_interrupt_state(interruptState);
+
+    return success;
+}
+
+/****************************************************************************************************
+ * FUNCT:   nestDriver_init
+ * BRIEF:   Initialize
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ ****************************************************************************************************/
+void nestDriver_init(void)
+{
+    /*** Deferred Work ***/
+    nestDriver_workHead = 0;
+    nestDriver_workTail = 0;
+
+    /*** Priority Mask ***/
+    nestDriver_depth = 0;
+    nestDriver_masked = false;
+}
+
+/****************************************************************************************************
+ * FUNCT:   nestDriver_mask
+ * BRIEF:   Mask
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ * NOTE:    Applies The Software Priority Mask: Clears Every Low Priority Interrupt Enable
+ *          (nestDriver_enables) That Is Set, Until nestDriver_unmask(); Called By nestDriver_postpone()
+ ****************************************************************************************************/
+void nestDriver_mask(void)
+{
+    size_t i;
+
+    /*** Apply The Priority Mask ***/
+    for(i = 0; i < (sizeof(nestDriver_enables) / sizeof(nestDriver_enables[0])); i++)
+    {
+        nestDriver_maskedEnables[i] = (uint16_t)(HWREG16(nestDriver_enables[i].address) & nestDriver_enables[i].mask);
+        HWREG16(nestDriver_enables[i].address) &= (uint16_t)~nestDriver_enables[i].mask;
+    }
+    nestDriver_masked = true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   nestDriver_tick
+ * BRIEF:   Tick
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ * NOTE:    Runs Deferred Work In The Order It Was Queued, With Interrupts Enabled
+ ****************************************************************************************************/
+void nestDriver_tick(void)
+{
+    nestDriver_work_t work;
+
+    /*** Run Deferred Work ***/
+    while(nestDriver_workTail != nestDriver_workHead)
+    {
+        work = nestDriver_work[nestDriver_workTail];
+        nestDriver_workTail = (uint8_t)((nestDriver_workTail + 1) % NEST_DRIVER_WORK_COUNT);
+        work();
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   nestDriver_unmask
+ * BRIEF:   Unmask
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ * NOTE:    Lifts The Software Priority Mask; A Source The Nested Handler Turned Off While It Was
+ *          Applied Comes Back On; Called By The Outermost nestDriver_exit() (Interrupts Disabled)
+ ****************************************************************************************************/
+void nestDriver_unmask(void)
+{
+    size_t i;
+
+    /*** Lift The Priority Mask ***/
+    for(i = 0; i < (sizeof(nestDriver_enables) / sizeof(nestDriver_enables[0])); i++)
+        HWREG16(nestDriver_enables[i].address) |= nestDriver_maskedEnables[i];
+    nestDriver_masked = false;
+}
@@ -0,0 +1,171 @@
+/****************************************************************************************************
+ * FILE:    nest_driver.h
+ * BRIEF:   Nest Driver Header File
+ * NOTE:    Selective Interrupt Nesting (DRIVER_CONFIG_NEST): A Low Priority Handler Re-Enables GIE
+ *          For Its Body And Defers Anything Heavy To The Main Loop, So A High Priority Handler
+ *          (USCI_A1 Receive) Waits At Most For The Short Entry And Exit Windows; High Priority
+ *          Handlers Don't Use It And Stay Non-Preemptible
+ * NOTE:    Pattern: NEST_DRIVER_ENTER() Right After The Vector Register Is Read, NEST_DRIVER_EXIT()
+ *          Before The Handler Records Its Profile (PROFILE_DRIVER_NESTED_INTERRUPT())
+ * NOTE:    Software Priority Mask: Every Low Priority Handler Starts With NEST_DRIVER_POSTPONE(); While
+ *          A Handler Is Nested It Masks Every Low Priority Source And Returns With Its Flag Still Set,
+ *          So Only High Priority Handlers Preempt A Nested One (Its Own Source Included); The Postponed
+ *          Handler Runs Once The Outermost NEST_DRIVER_EXIT() Unmasks Them (After The Nested Handler's RETI)
+ * NOTE:    Enter, Exit And The Not Nested Postpone Check Are Inline And Touch No Enable Register: The
+ *          Entry And Exit Windows Must Stay Short Of A 921600 Baud Character (86 Cycles At 8 MHz)
+ ****************************************************************************************************/
+
+#ifndef NEST_DRIVER_H
+#define NEST_DRIVER_H
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "driver_config.h"
+#include "intrinsics.h"
+#include "msp430fr6989.h"
+#include "power_driver.h"
+#include "profile_driver.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define NEST_DRIVER_WORK_COUNT (8) // Deferred Work Queue Length
+
+/*** Enter (Interrupt Handlers Only): START Is The PROFILE_DRIVER_COUNT() Variable, Which Doesn't Exist When DRIVER_CONFIG_PROFILE Is Off ***/
+#if DRIVER_CONFIG_PROFILE
+  #define NEST_DRIVER_ENTER(CONTEXT, START) nestDriver_enter((CONTEXT), (START))
+#else
+  #define NEST_DRIVER_ENTER(CONTEXT, START) nestDriver_enter((CONTEXT), 0)
+#endif
+
+/*** Postpone (Low Priority Interrupt Handlers Only, Before The Vector Register Is Read): Return At Once If True ***/
+#if DRIVER_CONFIG_NEST
+  #define NEST_DRIVER_POSTPONE() nestDriver_postpone()
+#else
+  #define NEST_DRIVER_POSTPONE() (false)
+#endif
+
+/*** Exit (Interrupt Handlers Only): A Wake Requested By A Nested Handler Lands On This Frame ***/
+#define NEST_DRIVER_EXIT(CONTEXT)                     \
+    do                                                \
+    {                                                 \
+        if(nestDriver_exit((CONTEXT)))                \
+            __bic_SR_register_on_exit(LPM3_bits);     \
+    } while(0)
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef struct nestDriver_context_s
+{
+    uint16_t activityCount; // powerDriver_activityCount On Entry
+    uint16_t disabledStart; // Profile Timer Count When Interrupts Were Last Disabled
+} nestDriver_context_t;
+
+typedef struct nestDriver_enable_s
+{
+    uint16_t address; // Interrupt Enable Register
+    uint16_t mask;    // Interrupt Enable Bits
+} nestDriver_enable_t;
+
+typedef void (*nestDriver_work_t)(void);
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+extern volatile uint8_t nestDriver_depth; // Nested Handlers Running
+extern volatile bool nestDriver_masked;   // Priority Mask Applied
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern bool nestDriver_defer(const nestDriver_work_t Work);
+extern void nestDriver_init(void);
+extern void nestDriver_mask(void);
+extern void nestDriver_tick(void);
+extern void nestDriver_unmask(void);
+
+/****************************************************************************************************
+ * Function Definitions (Inline)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   nestDriver_enter
+ * BRIEF:   Enter
+ * RETURN:  Returns Nothing
+ * ARG:     Context: Context (On The Handler's Stack; Passed To NEST_DRIVER_EXIT())
+ * ARG:     Start: Profile Timer Count On Entry
+ * NOTE:    Use NEST_DRIVER_ENTER(); Interrupt Handlers Only, After The Flag Is Cleared (Vector Register
+ *          Read): Should The Source Fire Again While Nested, nestDriver_postpone() Masks It
+ ****************************************************************************************************/
+static inline void nestDriver_enter(nestDriver_context_t * const Context, const uint16_t Start)
+{
+    /*** Context ***/
+    Context->activityCount = powerDriver_activityCount;
+    Context->disabledStart = Start;
+
+#if DRIVER_CONFIG_NEST
+    /*** Entry Window Ends Here ***/
+    nestDriver_depth++;
+    PROFILE_DRIVER_CRITICAL_SECTION(Start);
+    __enable_interrupt();
+#endif
+}
+
+/****************************************************************************************************
+ * FUNCT:   nestDriver_exit
+ * BRIEF:   Exit
+ * RETURN:  bool: A Nested Handler Asked To Wake The Main Loop (true) Or Not (false)
+ * ARG:     Context: Context (From nestDriver_enter())
+ * NOTE:    Use NEST_DRIVER_EXIT(), Which Passes The Wake On: A Nested Handler's Wake On Exit Only
+ *          Clears The Low Power Mode Bits Stacked Over This Handler, Which Were Already Clear
+ * NOTE:    The Outermost Exit Lifts The Priority Mask (Postponed Handlers Run After RETI: Their Flags
+ *          Are Still Set)
+ ****************************************************************************************************/
+static inline bool nestDriver_exit(nestDriver_context_t * const Context)
+{
+#if DRIVER_CONFIG_NEST
+    /*** Exit Window Starts Here ***/
+    __disable_interrupt();
+    PROFILE_DRIVER_START(Context->disabledStart);
+
+    /*** Lift The Priority Mask ***/
+    nestDriver_depth--;
+    if((nestDriver_depth == 0) && nestDriver_masked)
+        nestDriver_unmask();
+#endif
+
+    return powerDriver_activityCount != Context->activityCount;
+}
+
+/****************************************************************************************************
+ * FUNCT:   nestDriver_postpone
+ * BRIEF:   Postpone
+ * RETURN:  bool: A Handler Is Nested, So Return At Once (true), Or Handle The Interrupt Now (false)
+ * ARG:     No Arguments
+ * NOTE:    Use NEST_DRIVER_POSTPONE(); Low Priority Interrupt Handlers Only, First Thing: When Nested,
+ *          Masks Every Low Priority Source Until The Outermost nestDriver_exit(), And The Caller Must
+ *          Leave Its Flag Set (Not Read The Vector Register) To Be Taken Again
+ ****************************************************************************************************/
+static inline bool nestDriver_postpone(void)
+{
+    /*** Not Nested ***/
+    if(nestDriver_depth == 0)
+        return false;
+
+    /*** Apply The Priority Mask ***/
+    if(!nestDriver_masked)
+        nestDriver_mask();
+
+    return true;
+}
+
+#endif
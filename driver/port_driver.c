@@ -0,0 +1,178 @@
+/****************************************************************************************************
+ * FILE:    port_driver.c
+ * BRIEF:   Port Driver Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "driver_config.h"
+#include "gpio.h"
+#include "hal.h"
+#include "intrinsics.h"
+#include "msp430fr6989.h"
+#include "port_driver.h"
+#include "project.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+PROJECT_STATIC portDriver_handler_t portDriver_handler[PORT_DRIVER_PORT_COUNT][PORT_DRIVER_PIN_COUNT + 1]; // [Port - GPIO_PORT_P1][PxIV >> 1]; Index 0 (PxIV_NONE) Stays Empty
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static portDriver_handler_t *portDriver_getHandler(const uint8_t Port, const uint8_t Pin);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   portDriver_init
+ * BRIEF:   Initialize
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ * NOTE:    Runs Before Any Driver Registers (First Stage)
+ ****************************************************************************************************/
+void portDriver_init(void)
+{
+    uint8_t i, port;
+
+    /*** Handlers ***/
+    for(port = 0; port < PORT_DRIVER_PORT_COUNT; port++)
+    {
+        for(i = 0; i <= PORT_DRIVER_PIN_COUNT; i++)
+        {
+            portDriver_handler[port][i].callback = NULL;
+            portDriver_handler[port][i].flags = PORT_DRIVER_FLAG_NONE;
+        }
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   portDriver_interruptHandler
+ * BRIEF:   Interrupt Handler
+ * RETURN:  Returns Nothing
+ * ARG:     Port: Port (GPIO_PORT_P1 To GPIO_PORT_P4)
+ * ARG:     InterruptFlag: Interrupt Flag (PxIV, Already Read: Reading Clears The Flag)
+ * NOTE:    An Interrupt On A Pin Nobody Owns Is Dropped (The Read Of PxIV Cleared It)
+ ****************************************************************************************************/
+void portDriver_interruptHandler(const uint8_t Port, const uint16_t InterruptFlag)
+{
+    const portDriver_handler_t *handler;
+    portDriver_event_t event;
+    uint16_t baseAddress, pins;
+
+    /*** Error Check ***/
+    if((Port < GPIO_PORT_P1) || (Port > GPIO_PORT_P4) || (InterruptFlag > P1IV_P1IFG7))
+        return;
+
+    /*** Look Up ***/
+    handler = &portDriver_handler[Port - GPIO_PORT_P1][InterruptFlag >> 1];
+    if(handler->callback == NULL)
+        return;
+
+    /*** Event ***/
+    event.timestamp = ((handler->flags & PORT_DRIVER_FLAG_TIMESTAMP) != 0) ? HWREG16(DRIVER_CONFIG_PORT_TIMER + OFS_TAxR) : 0;
+    event.port = Port;
+    event.pin = (uint8_t)(1 << ((InterruptFlag >> 1) - 1));
+    baseAddress = HAL_GPIO_BASE(Port);
+    pins = HAL_GPIO_PINS(Port, event.pin);
+    event.rising = ((HWREG16(baseAddress + OFS_PAIES) & pins) == 0);
+
+    /*** Toggle Edge ***/
+    if((handler->flags & PORT_DRIVER_FLAG_TOGGLE_EDGE) != 0)
+        HWREG16(baseAddress + OFS_PAIES) ^= pins;
+
+    /*** Dispatch ***/
+    handler->callback(&event);
+}
+
+/****************************************************************************************************
+ * FUNCT:   portDriver_register
+ * BRIEF:   Register
+ * RETURN:  bool: Success (true) Or Failure (false)
+ * ARG:     Port: Port (GPIO_PORT_P1 To GPIO_PORT_P4)
+ * ARG:     Pin: Pin (One GPIO_PINx)
+ * ARG:     Callback: Callback (Interrupt Context)
+ * ARG:     Flags: PORT_DRIVER_FLAG_x
+ * NOTE:    Fails If Another Callback Already Owns The Pin; Pin Configuration Stays With The Caller
+ ****************************************************************************************************/
+bool portDriver_register(const uint8_t Port, const uint8_t Pin, const portDriver_callback_t Callback, const uint8_t Flags)
+{
+    portDriver_handler_t *handler;
+    unsigned short interruptState;
+
+    /*** Error Check ***/
+    handler = portDriver_getHandler(Port, Pin);
+    if((handler == NULL) || (Callback == NULL) || ((handler->callback != NULL) && (handler->callback != Callback)))
+        return false;
+
+    /*** Register (Interrupts Disabled So The Handler Never Sees A Half Written Entry) ***/
+    interruptState = __get_interrupt_state();
+    __disable_interrupt();
+    handler->callback = Callback;
+    handler->flags = Flags;
+    __set_interrupt_state(interruptState);
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   portDriver_unregister
+ * BRIEF:   Unregister
+ * RETURN:  bool: Success (true) Or Failure (false)
+ * ARG:     Port: Port (GPIO_PORT_P1 To GPIO_PORT_P4)
+ * ARG:     Pin: Pin (One GPIO_PINx)
+ ****************************************************************************************************/
+bool portDriver_unregister(const uint8_t Port, const uint8_t Pin)
+{
+    portDriver_handler_t *handler;
+    unsigned short interruptState;
+
+    /*** Error Check ***/
+    handler = portDriver_getHandler(Port, Pin);
+    if(handler == NULL)
+        return false;
+
+    /*** Unregister ***/
+    interruptState = __get_interrupt_state();
+    __disable_interrupt();
+    handler->callback = NULL;
+    handler->flags = PORT_DRIVER_FLAG_NONE;
+    __set_interrupt_state(interruptState);
+
+    return true;
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   portDriver_getHandler
+ * BRIEF:   Get Handler
+ * RETURN:  portDriver_handler_t *: Handler, NULL If The Port Or Pin Is Invalid
+ * ARG:     Port: Port (GPIO_PORT_P1 To GPIO_PORT_P4)
+ * ARG:     Pin: Pin (One GPIO_PINx)
+ ****************************************************************************************************/
+static portDriver_handler_t *portDriver_getHandler(const uint8_t Port, const uint8_t Pin)
+{
+    uint8_t index;
+
+    /*** Error Check ***/
+    if((Port < GPIO_PORT_P1) || (Port > GPIO_PORT_P4) || (Pin == 0) || ((Pin & (Pin - 1)) != 0))
+        return NULL;
+
+    /*** Index (PxIV >> 1: Pin Number + 1) ***/
+    for(index = 1; (Pin >> (index - 1)) != 1; index++);
+
+    return &portDriver_handler[Port - GPIO_PORT_P1][index];
+}
@@ -0,0 +1,58 @@
+/****************************************************************************************************
+ * FILE:    port_driver.h
+ * BRIEF:   Port Driver Header File
+ * NOTE:    One Interrupt Service For Every Port With A Vector (P1 To P4; PJ Has No Interrupts On The
+ *          MSP430FR6989): Drivers Register A Callback Per Pin, Dispatched Through A Table Indexed By
+ *          PxIV >> 1, So The Cost Is The Same For Every Pin And No Central Switch Names The Owners
+ ****************************************************************************************************/
+
+#ifndef PORT_DRIVER_H
+#define PORT_DRIVER_H
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define PORT_DRIVER_FLAG_NONE        (0x00)
+#define PORT_DRIVER_FLAG_TIMESTAMP   (0x01) // Read The Port Timer Before Anything Else
+#define PORT_DRIVER_FLAG_TOGGLE_EDGE (0x02) // Flip PxIES Before The Callback, So Both Edges Interrupt
+#define PORT_DRIVER_PIN_COUNT        (8)
+#define PORT_DRIVER_PORT_COUNT       (4)    // GPIO_PORT_P1 To GPIO_PORT_P4
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef struct portDriver_event_s
+{
+    uint8_t port;       // GPIO_PORT_Px
+    uint8_t pin;        // GPIO_PINx
+    bool rising;        // Edge That Interrupted (PxIES Before Any Toggle)
+    uint16_t timestamp; // Port Timer Ticks (PORT_DRIVER_FLAG_TIMESTAMP, Otherwise 0)
+} portDriver_event_t;
+
+typedef void (*portDriver_callback_t)(const portDriver_event_t * const Event);
+
+typedef struct portDriver_handler_s
+{
+    portDriver_callback_t callback; // NULL: Pin Not Owned
+    uint8_t flags;                  // PORT_DRIVER_FLAG_x
+} portDriver_handler_t;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern void portDriver_init(void);
+extern void portDriver_interruptHandler(const uint8_t Port, const uint16_t InterruptFlag);
+extern bool portDriver_register(const uint8_t Port, const uint8_t Pin, const portDriver_callback_t Callback, const uint8_t Flags);
+extern bool portDriver_unregister(const uint8_t Port, const uint8_t Pin);
+
+#endif
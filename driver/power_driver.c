@@ -0,0 +1,193 @@
+/****************************************************************************************************
+ * FILE:    power_driver.c
+ * BRIEF:   Power Driver Source File
+ * NOTE:    SMCLK Timers (Trace/Profile, Entropy) Are Stopped While Asleep: A Running Timer Requests
+ *          Its Clock, Which Would Keep The DCO On In LPM3; Their Counts Don't Advance While Asleep
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define POWER_DRIVER_CONVERT_MILLISECONDS_TO_TICKS(MILLISECONDS) (((uint32_t)(MILLISECONDS) * 32768ul) / 1000ul) // ACLK
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "cs.h"
+#include "driver_config.h"
+#include "eusci_a_uart.h"
+#include "intrinsics.h"
+#include "msp430fr6989.h"
+#include "power_driver.h"
+#include "project.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include "timer_a.h"
+#include "timer_b.h"
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+volatile bool powerDriver_activity;                  // Not Static: Set By The Inline powerDriver_recordActivity() (power_driver.h)
+volatile uint16_t powerDriver_activityCount;         // Wraps
+static uint16_t powerDriver_count;                   // Power Timer Count At The Previous Idle
+static uint16_t powerDriver_quietPeriod;             // Milliseconds
+static uint32_t powerDriver_quietPeriodTicks;        // ACLK Ticks (Converted Outside The Interrupts Disabled Window)
+static uint32_t powerDriver_quietTicks;              // Since The Last Activity (Saturates At The Quiet Period)
+static uint32_t powerDriver_sleepCount;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void powerDriver_sleep(void);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   powerDriver_getQuietPeriod
+ * BRIEF:   Get Quiet Period
+ * RETURN:  uint16_t: Quiet Period (Milliseconds; 0: Never Sleep)
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+uint16_t powerDriver_getQuietPeriod(void)
+{
+    /*** Get Quiet Period ***/
+    return powerDriver_quietPeriod;
+}
+
+/****************************************************************************************************
+ * FUNCT:   powerDriver_getSleepCount
+ * BRIEF:   Get Sleep Count
+ * RETURN:  uint32_t: Number Of Times LPM3 Was Entered Since Initialization
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+uint32_t powerDriver_getSleepCount(void)
+{
+    /*** Get Sleep Count ***/
+    return powerDriver_sleepCount;
+}
+
+/****************************************************************************************************
+ * FUNCT:   powerDriver_idle
+ * BRIEF:   Idle
+ * RETURN:  void: Returns Nothing
+ * ARG:     Busy: Work Is Pending Or In Flight (e.g. A CLI Transmit), So Don't Sleep
+ * NOTE:    Call Once Per Main Loop; Quiet Time Is Accumulated Per Call In ACLK Ticks, So Periods
+ *          Longer Than The 16-Bit Power Timer Wrap Work As Long As The Loop Runs More Often Than That
+ * NOTE:    Interrupts Are Disabled Only To Take The Activity Flag, And To Check It Again Before
+ *          Sleeping: A Received Character Must Be Read Within A Character Time (86 MCLK Cycles At
+ *          921600 Baud), So The Quiet Time Arithmetic Runs With Interrupts Enabled
+ ****************************************************************************************************/
+void powerDriver_idle(const bool Busy)
+{
+    uint16_t count;
+    bool activity;
+
+    /*** Activity ***/
+    count = Timer_A_getCounterValue(DRIVER_CONFIG_POWER_TIMER);
+    __disable_interrupt();
+    activity = powerDriver_activity;
+    powerDriver_activity = false;
+    __enable_interrupt();
+
+    /*** Quiet Time ***/
+    if(activity || Busy)
+        powerDriver_quietTicks = 0;
+    else if(powerDriver_quietTicks < powerDriver_quietPeriodTicks)
+        powerDriver_quietTicks += (uint16_t)(count - powerDriver_count);
+    powerDriver_count = count;
+
+    /*** Sleep Once Quiet For The Quiet Period, Unless There Was Activity Since (Taken Next Call) ***/
+    if((powerDriver_quietPeriod != 0) && (powerDriver_quietTicks >= powerDriver_quietPeriodTicks))
+    {
+        __disable_interrupt();
+        if(powerDriver_activity)
+            __enable_interrupt();
+        else
+            powerDriver_sleep(); // Returns With Interrupts Enabled
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   powerDriver_init
+ * BRIEF:   Initialize
+ * RETURN:  void: Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Clocks And The Power Timer (Shared, Free Running On ACLK) Are Set Up First
+ ****************************************************************************************************/
+void powerDriver_init(void)
+{
+    /*** Initialize ***/
+    /* Clock Request: The UART Restarts SMCLK (DCO) In LPM3 When The Start Bit Arrives */
+    CS_enableClockRequest(CS_SMCLK);
+
+    /* Start Bit Interrupt Only While Asleep (Otherwise Every Received Byte Raises It) */
+    EUSCI_A_UART_disableInterrupt(DRIVER_CONFIG_POWER_WAKE_UART, EUSCI_A_UART_STARTBIT_INTERRUPT);
+    EUSCI_A_UART_clearInterrupt(DRIVER_CONFIG_POWER_WAKE_UART, EUSCI_A_UART_STARTBIT_INTERRUPT_FLAG);
+
+    /* Quiet Period */
+    powerDriver_activity = false;
+    powerDriver_count = Timer_A_getCounterValue(DRIVER_CONFIG_POWER_TIMER);
+    powerDriver_quietPeriod = POWER_DRIVER_QUIET_PERIOD_DEFAULT;
+    powerDriver_quietPeriodTicks = POWER_DRIVER_CONVERT_MILLISECONDS_TO_TICKS(POWER_DRIVER_QUIET_PERIOD_DEFAULT);
+    powerDriver_quietTicks = 0;
+    powerDriver_sleepCount = 0;
+}
+
+/****************************************************************************************************
+ * FUNCT:   powerDriver_setQuietPeriod
+ * BRIEF:   Set Quiet Period
+ * RETURN:  void: Returns Nothing
+ * ARG:     Milliseconds: Quiet Period Before Sleeping (0: Never Sleep)
+ ****************************************************************************************************/
+void powerDriver_setQuietPeriod(const uint16_t Milliseconds)
+{
+    /*** Set Quiet Period (Restarts It) ***/
+    powerDriver_quietPeriod = Milliseconds;
+    powerDriver_quietPeriodTicks = POWER_DRIVER_CONVERT_MILLISECONDS_TO_TICKS(Milliseconds);
+    powerDriver_recordActivity();
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   powerDriver_sleep
+ * BRIEF:   Sleep
+ * RETURN:  void: Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Called With Interrupts Disabled; Interrupts Are Enabled Atomically With Entering LPM3,
+ *          So A Start Bit Arriving In Between Still Wakes The CPU
+ ****************************************************************************************************/
+static void powerDriver_sleep(void)
+{
+    /*** Stop SMCLK Timers ***/
+    Timer_B_stop(DRIVER_CONFIG_TRACE_TIMER);
+    Timer_A_stop(DRIVER_CONFIG_ENTROPY_TIMER);
+
+    /*** Arm Start Bit Wake ***/
+    EUSCI_A_UART_clearInterrupt(DRIVER_CONFIG_POWER_WAKE_UART, EUSCI_A_UART_STARTBIT_INTERRUPT_FLAG);
+    EUSCI_A_UART_enableInterrupt(DRIVER_CONFIG_POWER_WAKE_UART, EUSCI_A_UART_STARTBIT_INTERRUPT);
+
+    /*** Sleep (Until An Interrupt Handler Wakes On Exit) ***/
+    powerDriver_sleepCount++;
+    (void)__bis_SR_register(LPM3_bits | GIE);
+    __no_operation();
+
+    /*** Awake: Disarm Start Bit Wake, Restart SMCLK Timers And The Quiet Period ***/
+    __disable_interrupt();
+    EUSCI_A_UART_disableInterrupt(DRIVER_CONFIG_POWER_WAKE_UART, EUSCI_A_UART_STARTBIT_INTERRUPT);
+    Timer_A_startCounter(DRIVER_CONFIG_ENTROPY_TIMER, TIMER_A_CONTINUOUS_MODE);
+    Timer_B_startCounter(DRIVER_CONFIG_TRACE_TIMER, TIMER_B_CONTINUOUS_MODE);
+    powerDriver_activity = false;
+    powerDriver_count = Timer_A_getCounterValue(DRIVER_CONFIG_POWER_TIMER);
+    powerDriver_quietTicks = 0;
+    __enable_interrupt();
+}
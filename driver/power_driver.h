@@ -0,0 +1,73 @@
+/****************************************************************************************************
+ * FILE:    power_driver.h
+ * BRIEF:   Power Driver Header File
+ * NOTE:    Idle In LPM3: The Main Loop Calls powerDriver_idle() After Its Ticks, And Once Nothing Has
+ *          Happened For The Quiet Period The CPU Sleeps With Only ACLK Running; The CLI UART Start
+ *          Bit (UCSTTIFG) Wakes It, And The SMCLK Clock Request Brings The DCO Back In Time To Receive
+ *          That First Byte
+ ****************************************************************************************************/
+
+#ifndef POWER_DRIVER_H
+#define POWER_DRIVER_H
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define POWER_DRIVER_QUIET_PERIOD_DEFAULT (5000) // Milliseconds (0: Never Sleep)
+
+/*** Wake On Exit (Interrupt Handlers Only): The Main Loop Runs Again, And The Quiet Period Restarts ***/
+#define POWER_DRIVER_WAKE_ON_EXIT()              \
+    do                                           \
+    {                                            \
+        powerDriver_recordActivity();            \
+        __bic_SR_register_on_exit(LPM3_bits);    \
+    } while(0)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "intrinsics.h"
+#include "msp430fr6989.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+/*** Activity: Set By Interrupt Handlers Through powerDriver_recordActivity() Below ***/
+extern volatile bool powerDriver_activity;
+extern volatile uint16_t powerDriver_activityCount; // Wraps; A Change Across A Nested Interrupt Handler Means A Handler That Preempted It Asked To Wake (nest_driver.h)
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern uint16_t powerDriver_getQuietPeriod(void);
+extern uint32_t powerDriver_getSleepCount(void);
+extern void powerDriver_idle(const bool Busy);
+extern void powerDriver_init(void);
+extern void powerDriver_setQuietPeriod(const uint16_t Milliseconds);
+
+/****************************************************************************************************
+ * Function Definitions (Inline)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   powerDriver_recordActivity
+ * BRIEF:   Record Activity
+ * RETURN:  void: Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Restarts The Quiet Period; Safe From Interrupt Handlers
+ * NOTE:    Static Inline So POWER_DRIVER_WAKE_ON_EXIT() Adds No Call To The USCI Vector's Receive Path
+ ****************************************************************************************************/
+static inline void powerDriver_recordActivity(void)
+{
+    /*** Record Activity ***/
+    powerDriver_activity = true;
+    powerDriver_activityCount++;
+}
+
+#endif
@@ -0,0 +1,232 @@
+/****************************************************************************************************
+ * FILE:    profile_driver.c
+ * BRIEF:   Profile Driver Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "driver_config.h"
+#include "intrinsics.h"
+#include "msp430fr5xx_6xxgeneric.h"
+#include "profile_driver.h"
+#include "project.h"
+#include <stdint.h>
+#include <string.h>
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+PROJECT_STATIC volatile uint16_t profileDriver_disabledMaximum; // Cycles
+PROJECT_STATIC profileDriver_statistics_t profileDriver_statistics[PROFILE_DRIVER_SLOT_COUNT];
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static uint8_t profileDriver_getBin(uint16_t Cycles);
+static uint16_t profileDriver_updateStatistics(const profileDriver_vector_t Vector, const uint16_t Start);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   profileDriver_getCount
+ * BRIEF:   Get Count
+ * RETURN:  uint16_t: Profile Timer Count (Cycles; Wraps)
+ * ARG:     void: No Arguments
+ * NOTE:    The Profile Timer Is Started By traceDriver_init
+ ****************************************************************************************************/
+uint16_t profileDriver_getCount(void)
+{
+    /*** Get Count ***/
+    return HWREG16(DRIVER_CONFIG_PROFILE_TIMER + OFS_TBxR);
+}
+
+/****************************************************************************************************
+ * FUNCT:   profileDriver_getDisabledMaximum
+ * BRIEF:   Get Disabled Maximum
+ * RETURN:  uint16_t: Longest Interrupts Disabled Window (Cycles)
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+uint16_t profileDriver_getDisabledMaximum(void)
+{
+    /*** Get Disabled Maximum ***/
+    return profileDriver_disabledMaximum;
+}
+
+/****************************************************************************************************
+ * FUNCT:   profileDriver_getStatistics
+ * BRIEF:   Get Statistics
+ * RETURN:  void: Returns Nothing
+ * ARG:     Vector: Vector
+ * ARG:     Statistics: Statistics (Copy, Consistent With Respect To The Interrupt Handler)
+ ****************************************************************************************************/
+void profileDriver_getStatistics(const profileDriver_vector_t Vector, profileDriver_statistics_t * const Statistics)
+{
+    unsigned short interruptState;
+
+    /*** Error Check ***/
+    if(Vector >= PROFILE_DRIVER_VECTOR_COUNT)
+        return;
+
+    /*** Copy ***/
+    interruptState = __get_interrupt_state();
+    __disable_interrupt();
+    (void)memcpy(Statistics, &profileDriver_statistics[PROFILE_DRIVER_SLOT(Vector)], sizeof(*Statistics));
+    __set_interrupt_state(interruptState);
+}
+
+/****************************************************************************************************
+ * FUNCT:   profileDriver_init
+ * BRIEF:   Initialize
+ * RETURN:  void: Returns Nothing
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+void profileDriver_init(void)
+{
+    /*** Initialize ***/
+    profileDriver_reset();
+}
+
+/****************************************************************************************************
+ * FUNCT:   profileDriver_recordCriticalSection
+ * BRIEF:   Record Critical Section
+ * RETURN:  void: Returns Nothing
+ * ARG:     Start: Profile Timer Count Right After Interrupts Were Disabled
+ * NOTE:    Called Right Before Interrupts Are Restored; Interrupt Handlers Count As Windows Too
+ ****************************************************************************************************/
+void profileDriver_recordCriticalSection(const uint16_t Start)
+{
+    uint16_t cycles;
+
+    /*** Longest Window (Interrupts Still Disabled) ***/
+    cycles = (uint16_t)(HWREG16(DRIVER_CONFIG_PROFILE_TIMER + OFS_TBxR) - Start);
+    if(cycles > profileDriver_disabledMaximum)
+        profileDriver_disabledMaximum = cycles;
+}
+
+/****************************************************************************************************
+ * FUNCT:   profileDriver_recordInterrupt
+ * BRIEF:   Record Interrupt
+ * RETURN:  void: Returns Nothing
+ * ARG:     Vector: Vector
+ * ARG:     Start: Profile Timer Count On Entry
+ * NOTE:    Called Last In The Interrupt Handler; Hardware Entry (6 Cycles) And RETI (5 Cycles) Are
+ *          Not Included
+ ****************************************************************************************************/
+void profileDriver_recordInterrupt(const profileDriver_vector_t Vector, const uint16_t Start)
+{
+    uint16_t cycles;
+
+    /*** Error Check ***/
+    if(Vector >= PROFILE_DRIVER_VECTOR_COUNT)
+        return;
+
+    /*** Statistics ***/
+    cycles = profileDriver_updateStatistics(Vector, Start);
+
+    /*** Interrupts Are Disabled For The Whole Handler ***/
+    if(cycles > profileDriver_disabledMaximum)
+        profileDriver_disabledMaximum = cycles;
+}
+
+/****************************************************************************************************
+ * FUNCT:   profileDriver_recordNestedInterrupt
+ * BRIEF:   Record Nested Interrupt
+ * RETURN:  void: Returns Nothing
+ * ARG:     Vector: Vector
+ * ARG:     Start: Profile Timer Count On Entry
+ * ARG:     DisabledStart: Profile Timer Count When Interrupts Were Disabled Again (nestDriver_exit())
+ * NOTE:    For Handlers That Re-Enable Interrupts (nest_driver.h): Execution Time Includes Handlers
+ *          That Preempted It, And Only The Exit Window Counts As Interrupts Disabled (nestDriver_enter()
+ *          Records The Entry Window)
+ ****************************************************************************************************/
+void profileDriver_recordNestedInterrupt(const profileDriver_vector_t Vector, const uint16_t Start, const uint16_t DisabledStart)
+{
+    /*** Error Check ***/
+    if(Vector >= PROFILE_DRIVER_VECTOR_COUNT)
+        return;
+
+    /*** Statistics ***/
+    (void)profileDriver_updateStatistics(Vector, Start);
+
+    /*** Exit Window ***/
+    profileDriver_recordCriticalSection(DisabledStart);
+}
+
+/****************************************************************************************************
+ * FUNCT:   profileDriver_reset
+ * BRIEF:   Reset
+ * RETURN:  void: Returns Nothing
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+void profileDriver_reset(void)
+{
+    uint8_t slot;
+    unsigned short interruptState;
+
+    /*** Reset ***/
+    interruptState = __get_interrupt_state();
+    __disable_interrupt();
+    (void)memset(profileDriver_statistics, 0, sizeof(profileDriver_statistics));
+    for(slot = 0; slot < PROFILE_DRIVER_SLOT_COUNT; slot++)
+        profileDriver_statistics[slot].minimum = UINT16_MAX;
+    profileDriver_disabledMaximum = 0;
+    __set_interrupt_state(interruptState);
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   profileDriver_getBin
+ * BRIEF:   Get Bin
+ * RETURN:  uint8_t: Histogram Bin (floor(log2(Cycles)); 0 For 0 And 1)
+ * ARG:     Cycles: Cycles
+ * NOTE:    Shift Loop; The MSP430 Has No Count Leading Zeros Instruction
+ ****************************************************************************************************/
+static uint8_t profileDriver_getBin(uint16_t Cycles)
+{
+    uint8_t bin;
+
+    /*** Get Bin ***/
+    for(bin = 0; Cycles > 1; bin++)
+        Cycles >>= 1;
+
+    return bin;
+}
+
+/****************************************************************************************************
+ * FUNCT:   profileDriver_updateStatistics
+ * BRIEF:   Update Statistics
+ * RETURN:  uint16_t: Execution Time (Cycles)
+ * ARG:     Vector: Vector (Checked By The Caller)
+ * ARG:     Start: Profile Timer Count On Entry
+ ****************************************************************************************************/
+static uint16_t profileDriver_updateStatistics(const profileDriver_vector_t Vector, const uint16_t Start)
+{
+    profileDriver_statistics_t *statistics;
+    uint16_t cycles;
+    uint8_t bin;
+
+    /*** Execution Time (Wraps Safely Below 65536 Cycles) ***/
+    cycles = (uint16_t)(HWREG16(DRIVER_CONFIG_PROFILE_TIMER + OFS_TBxR) - Start);
+
+    /*** Statistics ***/
+    statistics = &profileDriver_statistics[PROFILE_DRIVER_SLOT(Vector)];
+    statistics->count++;
+    if(cycles < statistics->minimum)
+        statistics->minimum = cycles;
+    if(cycles > statistics->maximum)
+        statistics->maximum = cycles;
+    bin = profileDriver_getBin(cycles);
+    if(statistics->histogram[bin] < UINT16_MAX)
+        statistics->histogram[bin]++;
+
+    return cycles;
+}
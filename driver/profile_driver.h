@@ -0,0 +1,86 @@
+/****************************************************************************************************
+ * FILE:    profile_driver.h
+ * BRIEF:   Profile Driver Header File
+ * NOTE:    Interrupt Handler Execution Time Per Vector (Count, Minimum, Maximum, Log2 Histogram) And
+ *          The Longest Interrupts Disabled Window, In Profile Timer Cycles; "system --irq" Reports
+ * NOTE:    A Nested Handler (nest_driver.h) Counts Only Its Entry And Exit Windows As Disabled
+ ****************************************************************************************************/
+
+#ifndef PROFILE_DRIVER_H
+#define PROFILE_DRIVER_H
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "driver_config.h"
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define PROFILE_DRIVER_HISTOGRAM_BIN_COUNT (16) // Bin n: 2^n To 2^(n + 1) - 1 Cycles (Bin 0 Also Holds 0)
+
+/*** Statistics Slots: One, Never Written, When DRIVER_CONFIG_PROFILE Is Off ("system --irq" Reports 0), Giving The RAM Back ***/
+#if DRIVER_CONFIG_PROFILE
+  #define PROFILE_DRIVER_SLOT(VECTOR) (VECTOR)
+  #define PROFILE_DRIVER_SLOT_COUNT   (PROFILE_DRIVER_VECTOR_COUNT)
+#else
+  #define PROFILE_DRIVER_SLOT(VECTOR) (0)
+  #define PROFILE_DRIVER_SLOT_COUNT   (1)
+#endif
+
+/*** Instrumentation (DRIVER_CONFIG_PROFILE): Expands To Nothing When Off; PROFILE_DRIVER_COUNT() Goes Last In The Declarations ***/
+#if DRIVER_CONFIG_PROFILE
+  #define PROFILE_DRIVER_COUNT(START)                                    uint16_t START
+  #define PROFILE_DRIVER_START(START)                                    (START) = profileDriver_getCount()
+  #define PROFILE_DRIVER_CRITICAL_SECTION(START)                         profileDriver_recordCriticalSection((START))
+  #define PROFILE_DRIVER_INTERRUPT(VECTOR, START)                        profileDriver_recordInterrupt((VECTOR), (START))
+  #define PROFILE_DRIVER_NESTED_INTERRUPT(VECTOR, START, DISABLED_START) profileDriver_recordNestedInterrupt((VECTOR), (START), (DISABLED_START))
+#else
+  #define PROFILE_DRIVER_COUNT(START)
+  #define PROFILE_DRIVER_START(START)
+  #define PROFILE_DRIVER_CRITICAL_SECTION(START)
+  #define PROFILE_DRIVER_INTERRUPT(VECTOR, START)
+  #define PROFILE_DRIVER_NESTED_INTERRUPT(VECTOR, START, DISABLED_START)
+#endif
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef enum profileDriver_vector_e
+{
+    PROFILE_DRIVER_VECTOR_PORT1,
+    PROFILE_DRIVER_VECTOR_PORT2,
+    PROFILE_DRIVER_VECTOR_PORT3,
+    PROFILE_DRIVER_VECTOR_PORT4,
+    PROFILE_DRIVER_VECTOR_TIMER0_A1,
+    PROFILE_DRIVER_VECTOR_TIMER0_B1,
+    PROFILE_DRIVER_VECTOR_USCI_A1,
+    PROFILE_DRIVER_VECTOR_COUNT
+} profileDriver_vector_t;
+
+typedef struct profileDriver_statistics_s
+{
+    uint32_t count;
+    uint16_t minimum;                                       // Cycles (0xFFFF Until The First Count)
+    uint16_t maximum;                                       // Cycles
+    uint16_t histogram[PROFILE_DRIVER_HISTOGRAM_BIN_COUNT]; // Saturates
+} profileDriver_statistics_t;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern uint16_t profileDriver_getCount(void);
+extern uint16_t profileDriver_getDisabledMaximum(void);
+extern void profileDriver_getStatistics(const profileDriver_vector_t Vector, profileDriver_statistics_t * const Statistics);
+extern void profileDriver_init(void);
+extern void profileDriver_recordCriticalSection(const uint16_t Start);
+extern void profileDriver_recordInterrupt(const profileDriver_vector_t Vector, const uint16_t Start);
+extern void profileDriver_recordNestedInterrupt(const profileDriver_vector_t Vector, const uint16_t Start, const uint16_t DisabledStart);
+extern void profileDriver_reset(void);
+
+#endif
@@ -0,0 +1,172 @@
+/****************************************************************************************************
+ * FILE:    trace_driver.c
+ * BRIEF:   Trace Driver Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "cs.h"
+#include "driver_config.h"
+#include "intrinsics.h"
+#include "msp430fr5xx_6xxgeneric.h"
+#include "msp430fr6989.h"
+#include "project.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "timer_b.h"
+#include "trace_driver.h"
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+PROJECT_STATIC volatile uint16_t traceDriver_dumpIndex; // traceDriver_index At The Last Dump
+PROJECT_STATIC volatile uint16_t traceDriver_index;     // Records Written (Wraps); Next Slot In Low Bits
+PROJECT_STATIC volatile uint16_t traceDriver_overflowCount;
+PROJECT_STATIC volatile bool traceDriver_paused;
+PROJECT_STATIC traceDriver_record_t traceDriver_records[TRACE_DRIVER_RING_COUNT];
+static uint32_t traceDriver_hertz;
+static traceDriver_writeCallback_t traceDriver_writeCallback;
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   traceDriver_dump
+ * BRIEF:   Dump
+ * RETURN:  void: Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Writes A traceDriver_dumpHeader_t And The Records Since The Last Dump (Oldest First,
+ *          Straight From The Ring, Native Little Endian Layout); Recording Pauses Meanwhile
+ ****************************************************************************************************/
+void traceDriver_dump(void)
+{
+    traceDriver_dumpHeader_t header;
+    uint16_t count, first, index;
+
+    /*** Error Check ***/
+    if(traceDriver_writeCallback == NULL)
+        return;
+
+    /*** Pause (Consistent Snapshot) ***/
+    traceDriver_paused = true;
+    index = traceDriver_index;
+    count = (uint16_t)(index - traceDriver_dumpIndex);
+
+    /*** Header ***/
+    header.magic = TRACE_DRIVER_DUMP_MAGIC;
+    header.hertz = traceDriver_hertz;
+    header.recordCount = (count > TRACE_DRIVER_RING_COUNT) ? TRACE_DRIVER_RING_COUNT : count;
+    header.lostCount = (uint16_t)(count - header.recordCount);
+    traceDriver_writeCallback((const uint8_t *)&header, sizeof(header));
+
+    /*** Records (At Most Two Contiguous Pieces) ***/
+    first = (uint16_t)(index - header.recordCount) & (TRACE_DRIVER_RING_COUNT - 1);
+    if((first + header.recordCount) > TRACE_DRIVER_RING_COUNT)
+    {
+        traceDriver_writeCallback((const uint8_t *)&traceDriver_records[first], (TRACE_DRIVER_RING_COUNT - first) * sizeof(traceDriver_record_t));
+        traceDriver_writeCallback((const uint8_t *)&traceDriver_records[0], (size_t)(first + header.recordCount - TRACE_DRIVER_RING_COUNT) * sizeof(traceDriver_record_t));
+    }
+    else if(header.recordCount > 0)
+    {
+        traceDriver_writeCallback((const uint8_t *)&traceDriver_records[first], header.recordCount * sizeof(traceDriver_record_t));
+    }
+
+    /*** Resume ***/
+    traceDriver_dumpIndex = index;
+    traceDriver_paused = false;
+}
+
+/****************************************************************************************************
+ * FUNCT:   traceDriver_init
+ * BRIEF:   Initialize
+ * RETURN:  void: Returns Nothing
+ * ARG:     WriteCallback: Write Callback (Sends The Dump)
+ * NOTE:    The Trace Timer Runs From SMCLK, Which Shares The DCO With MCLK: Cycle Resolution, And
+ *          Reads Of The Count Are Synchronous (No Majority Vote Needed)
+ ****************************************************************************************************/
+void traceDriver_init(const traceDriver_writeCallback_t WriteCallback)
+{
+    Timer_B_initContinuousModeParam initContinuousModeParam;
+
+    /*** Initialize ***/
+    /* Ring */
+    traceDriver_dumpIndex = 0;
+    traceDriver_index = 0;
+    traceDriver_overflowCount = 0;
+    traceDriver_paused = false;
+    traceDriver_writeCallback = WriteCallback;
+
+    /* Timer Frequency (Clocks Are Set Up First; Not Recomputed While Recording Is Paused) */
+    traceDriver_hertz = CS_getSMCLK();
+
+    /* Timer (Overflow Interrupt Extends The Count To 32 Bits) */
+    initContinuousModeParam.clockSource = TIMER_B_CLOCKSOURCE_SMCLK;
+    initContinuousModeParam.clockSourceDivider = TIMER_B_CLOCKSOURCE_DIVIDER_1;
+    initContinuousModeParam.timerInterruptEnable_TBIE = TIMER_B_TBIE_INTERRUPT_ENABLE;
+    initContinuousModeParam.timerClear = TIMER_B_DO_CLEAR;
+    initContinuousModeParam.startTimer = true;
+    Timer_B_initContinuousMode(DRIVER_CONFIG_TRACE_TIMER, &initContinuousModeParam);
+}
+
+/****************************************************************************************************
+ * FUNCT:   traceDriver_record
+ * BRIEF:   Record
+ * RETURN:  void: Returns Nothing
+ * ARG:     Event: Event (traceDriver_event_t, Optionally | TRACE_DRIVER_EVENT_END)
+ * ARG:     Payload: Payload
+ * NOTE:    Only Slot Reservation And The Timestamp Run With Interrupts Disabled, So Records Land In
+ *          Timestamp Order; The Record Is Filled Afterwards With Interrupts Restored
+ ****************************************************************************************************/
+void traceDriver_record(const uint16_t Event, const uint16_t Payload)
+{
+    traceDriver_record_t *record;
+    uint16_t high, low;
+    unsigned short interruptState;
+
+    /*** Reserve And Timestamp ***/
+    interruptState = __get_interrupt_state();
+    __disable_interrupt();
+    if(traceDriver_paused)
+    {
+        __set_interrupt_state(interruptState);
+        return;
+    }
+    record = &traceDriver_records[traceDriver_index & (TRACE_DRIVER_RING_COUNT - 1)];
+    traceDriver_index++;
+    low = HWREG16(DRIVER_CONFIG_TRACE_TIMER + OFS_TBxR);
+    high = traceDriver_overflowCount;
+    if(((HWREG16(DRIVER_CONFIG_TRACE_TIMER + OFS_TBxCTL) & TBIFG) == TBIFG) && (low < 0x8000))
+        high++; // Overflow Not Yet Counted By The Handler
+    __set_interrupt_state(interruptState);
+
+    /*** Fill ***/
+    record->timestamp = ((uint32_t)high << 16) | low;
+    record->event = Event;
+    record->payload = Payload;
+}
+
+/****************************************************************************************************
+ * FUNCT:   traceDriver_timerInterruptHandler
+ * BRIEF:   Timer Interrupt Handler
+ * RETURN:  Returns Nothing
+ * ARG:     InterruptFlag: Interrupt Flag
+ ****************************************************************************************************/
+void traceDriver_timerInterruptHandler(uint16_t InterruptFlag)
+{
+    /*** Handle Interrupt ***/
+    switch(InterruptFlag)
+    {
+        case TB0IV_TBIFG:
+            /*** Overflow ***/
+            traceDriver_overflowCount++;
+            break;
+        default:
+            /*** Do Nothing ***/
+            break;
+    }
+}
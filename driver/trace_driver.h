@@ -0,0 +1,90 @@
+/****************************************************************************************************
+ * FILE:    trace_driver.h
+ * BRIEF:   Trace Driver Header File
+ * NOTE:    Flight Recorder Of Interrupt Handlers And Main Loop Work: A RAM Ring Of Fixed 8-Byte
+ *          Records (Timestamp, Event, Payload), Oldest Overwritten; "system --trace" Dumps It In
+ *          Binary And project/unit_test/trace/trace_converter.c Turns The Dump Into Chrome Trace
+ *          JSON (chrome://tracing, ui.perfetto.dev)
+ ****************************************************************************************************/
+
+#ifndef TRACE_DRIVER_H
+#define TRACE_DRIVER_H
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "driver_config.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define TRACE_DRIVER_DUMP_MAGIC   (0x31435254u) // "TRC1" (Little Endian)
+#define TRACE_DRIVER_EVENT_END    (0x8000)      // Event Flag: End Of Span (Otherwise Begin)
+#define TRACE_DRIVER_RECORD_COUNT (16)          // Power Of 2; Also The Most Records A Dump Holds
+
+/*** Ring Slots: One When DRIVER_CONFIG_TRACE Is Off (Nothing Is Recorded, So Dumps Are Empty), Giving The RAM Back ***/
+#if DRIVER_CONFIG_TRACE
+  #define TRACE_DRIVER_RING_COUNT (TRACE_DRIVER_RECORD_COUNT)
+#else
+  #define TRACE_DRIVER_RING_COUNT (1)
+#endif
+
+/*** Span (Payload: e.g. Interrupt Vector Register Value; DRIVER_CONFIG_TRACE: Expands To Nothing When Off) ***/
+#if DRIVER_CONFIG_TRACE
+  #define TRACE_DRIVER_BEGIN(EVENT, PAYLOAD) traceDriver_record((uint16_t)(EVENT), (uint16_t)(PAYLOAD))
+  #define TRACE_DRIVER_END(EVENT, PAYLOAD)   traceDriver_record((uint16_t)((EVENT) | TRACE_DRIVER_EVENT_END), (uint16_t)(PAYLOAD))
+#else
+  #define TRACE_DRIVER_BEGIN(EVENT, PAYLOAD)
+  #define TRACE_DRIVER_END(EVENT, PAYLOAD)
+#endif
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef enum traceDriver_event_e
+{
+    TRACE_DRIVER_EVENT_NONE,
+    TRACE_DRIVER_EVENT_PORT1_VECTOR,
+    TRACE_DRIVER_EVENT_TIMER0_A1_VECTOR,
+    TRACE_DRIVER_EVENT_USCI_A1_VECTOR,
+    TRACE_DRIVER_EVENT_CLI_PROCESS_INPUT,
+    TRACE_DRIVER_EVENT_LOG_DRAIN,
+    TRACE_DRIVER_EVENT_PORT2_VECTOR, // Appended, So Existing Captures Still Convert
+    TRACE_DRIVER_EVENT_PORT3_VECTOR,
+    TRACE_DRIVER_EVENT_PORT4_VECTOR,
+    TRACE_DRIVER_EVENT_COUNT
+} traceDriver_event_t;
+
+typedef struct traceDriver_record_s
+{
+    uint32_t timestamp; // Trace Timer Ticks (SMCLK)
+    uint16_t event;     // traceDriver_event_t, Optionally | TRACE_DRIVER_EVENT_END
+    uint16_t payload;
+} traceDriver_record_t;
+
+typedef struct traceDriver_dumpHeader_s
+{
+    uint32_t magic;       // TRACE_DRIVER_DUMP_MAGIC
+    uint32_t hertz;       // Timestamp Clock
+    uint16_t recordCount; // Records Following The Header, Oldest First
+    uint16_t lostCount;   // Records Overwritten Since The Last Dump (Saturates)
+} traceDriver_dumpHeader_t;
+
+typedef void (*traceDriver_writeCallback_t)(const uint8_t * const Data, const size_t Length);
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern void traceDriver_dump(void);
+extern void traceDriver_init(const traceDriver_writeCallback_t WriteCallback);
+extern void traceDriver_record(const uint16_t Event, const uint16_t Payload);
+extern void traceDriver_timerInterruptHandler(uint16_t InterruptFlag);
+
+#endif
@@ -0,0 +1,134 @@
+/****************************************************************************************************
+ * FILE:    vector_driver.c
+ * BRIEF:   Vector Driver Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define VECTOR_DRIVER_ADDRESS(START, VECTOR) ((uint16_t)((START) + ((VECTOR) * sizeof(uint16_t))))
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "driver_config.h"
+#include "inc/hw_memmap.h"
+#include "msp430fr6989.h"
+#include "project.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "sysctl.h"
+#include "vector_driver.h"
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+#ifdef __UNIT_TEST__
+/*** Host: Pointers Don't Fit The 16-Bit Slots, Which Only Get Their Low 16 Bits ***/
+PROJECT_STATIC vectorDriver_handler_t vectorDriver_handlers[VECTOR_DRIVER_COUNT];
+#endif
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   vectorDriver_getHandler
+ * BRIEF:   Get Handler
+ * RETURN:  vectorDriver_handler_t: Handler The Vector Points At (Host: Installed Handler Or NULL)
+ * ARG:     Vector: Vector (xxx_VECTOR)
+ ****************************************************************************************************/
+vectorDriver_handler_t vectorDriver_getHandler(const uint8_t Vector)
+{
+    /*** Error Check ***/
+    if(Vector >= VECTOR_DRIVER_COUNT)
+        return NULL;
+
+    /*** Get Handler ***/
+#ifdef __UNIT_TEST__
+    return vectorDriver_handlers[Vector];
+#elif DRIVER_CONFIG_VECTOR_RAM
+    return (vectorDriver_handler_t)(uintptr_t)HWREG16(VECTOR_DRIVER_ADDRESS(VECTOR_DRIVER_RAM_START, Vector));
+#else
+    return (vectorDriver_handler_t)(uintptr_t)HWREG16(VECTOR_DRIVER_ADDRESS(VECTOR_DRIVER_FRAM_START, Vector));
+#endif
+}
+
+/****************************************************************************************************
+ * FUNCT:   vectorDriver_init
+ * BRIEF:   Initialize
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ * NOTE:    Call With Interrupts Disabled; Every Boot Starts From The Linked (FRAM) Handlers, So
+ *          Drivers Install Theirs Afterwards (Second Stage)
+ ****************************************************************************************************/
+void vectorDriver_init(void)
+{
+#if DRIVER_CONFIG_VECTOR_RAM
+    uint8_t vector;
+
+    /*** Copy The FRAM Table ***/
+    for(vector = 0; vector < VECTOR_DRIVER_COUNT; vector++)
+    {
+        HWREG16(VECTOR_DRIVER_ADDRESS(VECTOR_DRIVER_RAM_START, vector)) = HWREG16(VECTOR_DRIVER_ADDRESS(VECTOR_DRIVER_FRAM_START, vector));
+#ifdef __UNIT_TEST__
+        vectorDriver_handlers[vector] = NULL;
+#endif
+    }
+
+    /*** Fetch Vectors From RAM ***/
+    SysCtl_enableRAMBasedInterruptVectors();
+#else
+    /*** Fetch Vectors From FRAM ***/
+    SysCtl_disableRAMBasedInterruptVectors();
+#endif
+}
+
+/****************************************************************************************************
+ * FUNCT:   vectorDriver_install
+ * BRIEF:   Install
+ * RETURN:  bool: Success (true) Or Failure (false)
+ * ARG:     Vector: Vector (xxx_VECTOR, Not RESET_VECTOR)
+ * ARG:     Handler: Handler (__interrupt Function)
+ * NOTE:    One Word Write, So Interrupts Can Stay Enabled; Fails With DRIVER_CONFIG_VECTOR_RAM 0
+ ****************************************************************************************************/
+bool vectorDriver_install(const uint8_t Vector, const vectorDriver_handler_t Handler)
+{
+    /*** Error Check ***/
+    if(!DRIVER_CONFIG_VECTOR_RAM || (Vector >= RESET_VECTOR) || (Handler == NULL))
+        return false;
+
+    /*** Install ***/
+#ifdef __UNIT_TEST__
+    vectorDriver_handlers[Vector] = Handler;
+#endif
+    HWREG16(VECTOR_DRIVER_ADDRESS(VECTOR_DRIVER_RAM_START, Vector)) = (uint16_t)(uintptr_t)Handler;
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   vectorDriver_restore
+ * BRIEF:   Restore
+ * RETURN:  bool: Success (true) Or Failure (false)
+ * ARG:     Vector: Vector (xxx_VECTOR, Not RESET_VECTOR)
+ * NOTE:    Points The Vector Back At Its Linked (FRAM) Handler
+ ****************************************************************************************************/
+bool vectorDriver_restore(const uint8_t Vector)
+{
+    /*** Error Check ***/
+    if(!DRIVER_CONFIG_VECTOR_RAM || (Vector >= RESET_VECTOR))
+        return false;
+
+    /*** Restore ***/
+#ifdef __UNIT_TEST__
+    vectorDriver_handlers[Vector] = NULL;
+#endif
+    HWREG16(VECTOR_DRIVER_ADDRESS(VECTOR_DRIVER_RAM_START, Vector)) = HWREG16(VECTOR_DRIVER_ADDRESS(VECTOR_DRIVER_FRAM_START, Vector));
+
+    return true;
+}
@@ -0,0 +1,59 @@
+/****************************************************************************************************
+ * FILE:    vector_driver.h
+ * BRIEF:   Vector Driver Header File
+ * NOTE:    RAM-Based Interrupt Vectors (DRIVER_CONFIG_VECTOR_RAM): The FRAM Table Is Copied To The
+ *          Top Of RAM And SYSRIVECT Set, So Drivers Can Point A Vector Straight At A Specialized
+ *          Handler At Run Time Instead Of Dispatching Through A Switch
+ * NOTE:    Hot Interrupt Paths Are Marked VECTOR_DRIVER_RAMFUNC (.TI.ramfunc: Loaded In FRAM, Copied
+ *          To RAM Before main()), Which Keeps Them Off FRAM Wait States Once MCLK Runs Above 8 MHz;
+ *          The RAMFUNC Region In lnk_msp430fr6989.cmd Is The Budget, So Outgrowing It Fails The Link
+ * NOTE:    lnk_msp430fr6989.cmd Reserves RAMFUNC And RAMVECTORS Only With DRIVER_CONFIG_VECTOR_RAM
+ *          Defined For The Linker Too; Otherwise RAM Keeps All 2 KB, And memory_driver.c Fails The
+ *          Link (ram_ramfunc_start Unresolved) If The Compiler Side Asks For RAM Vectors Anyway
+ * NOTE:    The Reserved Regions Leave 1680 Bytes For .bss, .data And The Stack: Enough Without The
+ *          DRIVER_CONFIG_DEBUG Instrumentation, But Not With It (The RAM_USAGE Group Fails The Link)
+ ****************************************************************************************************/
+
+#ifndef VECTOR_DRIVER_H
+#define VECTOR_DRIVER_H
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "driver_config.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define VECTOR_DRIVER_COUNT          (56)     // INT00 (0xFF90) To RESET (0xFFFE); Index: xxx_VECTOR
+#define VECTOR_DRIVER_FRAM_START     (0xFF90)
+#define VECTOR_DRIVER_RAM_LENGTH     (VECTOR_DRIVER_COUNT * 2)
+#define VECTOR_DRIVER_RAM_START      (0x2390) // Same Layout, Ending At The Top Of RAM (lnk_msp430fr6989.cmd RAMVECTORS)
+#define VECTOR_DRIVER_RAMFUNC_BUDGET (0x0100) // Bytes (lnk_msp430fr6989.cmd RAMFUNC)
+
+#if DRIVER_CONFIG_VECTOR_RAM && defined(__TI_COMPILER_VERSION__)
+  #define VECTOR_DRIVER_RAMFUNC __attribute__((ramfunc))
+#else
+  #define VECTOR_DRIVER_RAMFUNC
+#endif
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef void (*vectorDriver_handler_t)(void); // __interrupt Function
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern vectorDriver_handler_t vectorDriver_getHandler(const uint8_t Vector);
+extern void vectorDriver_init(void);
+extern bool vectorDriver_install(const uint8_t Vector, const vectorDriver_handler_t Handler);
+extern bool vectorDriver_restore(const uint8_t Vector);
+
+#endif
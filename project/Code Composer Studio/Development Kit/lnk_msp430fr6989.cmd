@@ -47,6 +47,15 @@
 /* Version: 1.207                                                             */
 /*----------------------------------------------------------------------------*/
 
+/****************************************************************************/
+/* RAM vectors and RAM functions (vector_driver.h): must match the compiler  */
+/* side, so --define DRIVER_CONFIG_VECTOR_RAM=1 here as well to reserve them */
+/****************************************************************************/
+
+#ifndef DRIVER_CONFIG_VECTOR_RAM
+#define DRIVER_CONFIG_VECTOR_RAM 0
+#endif
+
 /****************************************************************************/
 /* Specify the system memory map                                            */
 /****************************************************************************/
@@ -56,7 +65,13 @@ MEMORY
     TINYRAM                 : origin = 0x0006, length = 0x001A
     PERIPHERALS_8BIT        : origin = 0x0020, length = 0x00E0
     PERIPHERALS_16BIT       : origin = 0x0100, length = 0x0100
+#if DRIVER_CONFIG_VECTOR_RAM
+    RAM                     : origin = 0x1C00, length = 0x0690
+    RAMFUNC                 : origin = 0x2290, length = 0x0100 /* VECTOR_DRIVER_RAMFUNC_BUDGET    */
+    RAMVECTORS              : origin = 0x2390, length = 0x0070 /* SYSRIVECT Table (vector_driver.h) */
+#else
     RAM                     : origin = 0x1C00, length = 0x0800
+#endif
     INFOA                   : origin = 0x1980, length = 0x0080
     INFOB                   : origin = 0x1900, length = 0x0080
     INFOC                   : origin = 0x1880, length = 0x0080
@@ -137,6 +152,7 @@ SECTIONS
            .TI.persistent : {}              /* For #pragma persistent            */
            .cio           : {}              /* C I/O Buffer                      */
            .sysmem        : {}              /* Dynamic memory allocation area    */
+           .checkpoint    : type = NOINIT{} /* Power-Fail Checkpoint Slots (checkpoint_driver.h) */
         } PALIGN(0x0400), RUN_START(fram_rw_start)
 
         GROUP(IPENCAPSULATED_MEMORY)
@@ -167,12 +183,12 @@ SECTIONS
 #else
     .text             : {} >> FRAM2 | FRAM  /* Code                              */
 #endif
-#ifdef __TI_COMPILER_VERSION__
+#if defined(__TI_COMPILER_VERSION__) && DRIVER_CONFIG_VECTOR_RAM
   #if __TI_COMPILER_VERSION__ >= 15009000
     #ifndef __LARGE_CODE_MODEL__
-    .TI.ramfunc : {} load=FRAM, run=RAM, table(BINIT)
+    .TI.ramfunc : {} load=FRAM, run=RAMFUNC, table(BINIT), RUN_START(ram_ramfunc_start), RUN_END(ram_ramfunc_end)
     #else
-    .TI.ramfunc : {} load=FRAM | FRAM2, run=RAM, table(BINIT)
+    .TI.ramfunc : {} load=FRAM | FRAM2, run=RAMFUNC, table(BINIT), RUN_START(ram_ramfunc_start), RUN_END(ram_ramfunc_end)
     #endif
   #endif
 #endif
@@ -186,17 +202,27 @@ SECTIONS
         .jtagpassword  : {}                 /* JTAG Password                     */
     } > IPESIGNATURE
 
-    .bss        : {} > RAM                  /* Global & static vars              */
-    .data       : {} > RAM                  /* Global & static vars              */
-    .TI.noinit  : {} > RAM                  /* For #pragma noinit                */
-    .stack      : {} > RAM (HIGH)           /* Software system stack             */
-    .tinyram    : {} > TINYRAM              /* Tiny RAM                          */
+    /* RAM Usage Check: One Allocation, So The Link Fails ("placement fails  */
+    /* for object RAM_USAGE", With Its Size) Unless .bss + .data + .TI.noinit */
+    /* + .stack (--stack_size) Fit In RAM, Which Shrinks By The RAM Vector   */
+    /* And Function Regions When DRIVER_CONFIG_VECTOR_RAM Is Set; The Stack  */
+    /* Goes Last, Growing Down Toward .TI.noinit, And Free RAM Stays Above   */
+    GROUP(RAM_USAGE)
+    {
+        .bss        : {} RUN_START(ram_bss_start), RUN_END(ram_bss_end)          /* Global & static vars              */
+        .data       : {} RUN_START(ram_data_start), RUN_END(ram_data_end)        /* Global & static vars              */
+        .TI.noinit  : {} RUN_START(ram_noinit_start), RUN_END(ram_noinit_end)    /* For #pragma noinit                */
+        .stack      : {} RUN_START(ram_stack_start), RUN_END(ram_stack_end)      /* Software system stack             */
+    } > RAM
+    .tinyram    : {} > TINYRAM              /* Tiny RAM: Checkpoint Resume Stack */
 
     .infoA (NOLOAD) : {} > INFOA              /* MSP430 INFO FRAM  Memory segments */
     .infoB (NOLOAD) : {} > INFOB
     .infoC (NOLOAD) : {} > INFOC
     .infoD (NOLOAD) : {} > INFOD
 
+    .logstr : {} run = 0x0000, type = COPY  /* Log Format Strings (log_driver.h): In The ELF File Only, Addresses Are IDs */
+
     /* MSP430 Interrupt vectors          */
     .int00       : {}               > INT00
     .int01       : {}               > INT01
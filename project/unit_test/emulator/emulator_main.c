@@ -0,0 +1,602 @@
+/****************************************************************************************************
+ * FILE:    emulator_main.c
+ * BRIEF:   Emulator Main Source File
+ * NOTE:    Runs The Linked Firmware Image On The MSP430X CPU Emulator With The CLI UART (USCI A1) And
+ *          DMA Modeled At MCLK Resolution, Then Reports Per-Function And Per-Vector Cycle Counts,
+ *          Interrupts Disabled Windows And Receive Overruns
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define EMULATOR_BITS_PER_CHARACTER   (10) // 8-N-1: Start Bit, 8 Data Bits, 1 Stop Bit
+#define EMULATOR_CYCLES_DEFAULT       (8000000ull)
+#define EMULATOR_DISABLED_MAXIMUM     (32) // Interrupts Disabled Windows: Functions Tracked
+#define EMULATOR_DMA_TRANSFER_CYCLES  (2) // CPU Held Per Byte Transfer
+#define EMULATOR_INPUT_LENGTH         (1024)
+#define EMULATOR_MCLK_DEFAULT         (8000000ul) // system.c: DCO 8 MHz
+#define EMULATOR_PROFILE_MAXIMUM      (40)
+#define EMULATOR_STARTUP_CYCLES       (80000000ull) // Reset To main() Limit
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "dma.h"
+#include "driver_config.h"
+#include "hw_memmap.h"
+#include "msp430fr5xx_6xxgeneric.h"
+#include "msp430x.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef struct emulator_disabled_s
+{
+    const msp430x_function_t *function; // Where The Window Starts (DINT, Or The Accepted Interrupt Handler)
+    bool entry;                         // Started By Accepting An Interrupt (At The Handler's First Instruction)
+    uint64_t count;
+    uint64_t maximumCycles;
+} emulator_disabled_t;
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static uint64_t emulator_characterCycles;
+static emulator_disabled_t emulator_disabled[EMULATOR_DISABLED_MAXIMUM];
+static size_t emulator_disabledCount;
+static bool emulator_disabledEntry;
+static const msp430x_function_t *emulator_disabledFunction;
+static uint64_t emulator_disabledStartCycles;
+static bool emulator_interruptsDisabled;
+static char emulator_input[EMULATOR_INPUT_LENGTH];
+static size_t emulator_inputIndex, emulator_inputLength;
+static uint8_t emulator_periodicVector;
+static uint32_t emulator_periodicRegister; // Vector Register Presented With Each Request (0: None)
+static bool emulator_periodicRegisterRead;
+static uint16_t emulator_periodicValue;
+static uint64_t emulator_receiveReadyCycles, emulator_transmitReadyCycles;
+static bool emulator_receiveRead;
+static uint64_t emulator_receiveCycles, emulator_receiveLatencyCycles; // Character Arrival, Longest Arrival To Receive Buffer Read
+static uint64_t emulator_receiveHandlerCycles;                         // Longest Handler Acceptance To Receive Buffer Read
+static size_t emulator_overrunCount;
+static bool emulator_receiveUnread;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void emulator_accessCallback(const uint32_t Address);
+static int emulator_compareDisabled(const void *First, const void *Second);
+static int emulator_compareFunctions(const void *First, const void *Second);
+static const msp430x_function_t *emulator_findFunction(const uint32_t Address);
+static void emulator_interruptCallback(const uint8_t Vector);
+static void emulator_printProfile(void);
+static void emulator_printUart(void);
+static void emulator_setInput(const char * const Input);
+static void emulator_stepDma(void);
+static void emulator_stepInterrupts(const uint64_t StepCycles);
+static void emulator_stepUart(void);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   main
+ * BRIEF:   Main Entry
+ * RETURN:  int: Exit Status
+ * ARG:     argc: Argument Count
+ * ARG:     argv: Arguments: -e ELF [-c CYCLES] [-m MCLK_HZ] [-b BAUD_RATE] [-i INPUT [-d DELAY_CYCLES]]
+ *          [-x VECTOR:PERIOD_CYCLES[:REGISTER:VALUE]] [-f FUNCTION [-n COUNT] [-r R12,R13,R14,R15]]
+ *          [-p] [-s SHARED_MEMORY]
+ * NOTE:    Run Mode: Executes CYCLES Cycles From Reset, Typing INPUT ("\n" And "\r" Escapes) On The
+ *          CLI From DELAY_CYCLES On (e.g. Once The Prompt Is Up); Function Mode: Runs From Reset To
+ *          main(), Then Calls FUNCTION COUNT Times
+ * NOTE:    REGISTER:VALUE: Vector Register Presented With Each Periodic Request Until The Handler
+ *          Reads It (e.g. 0x036E:2, TA0IV Capture/Compare Register 1)
+ * NOTE:    SHARED_MEMORY: Memory Map Shared With External Tools (hwMemmap_map())
+ ****************************************************************************************************/
+int main(int argc, char *argv[])
+{
+    unsigned long long maximumCycles = EMULATOR_CYCLES_DEFAULT;
+    unsigned long baudRate = 115200, count = 1, mclk = EMULATOR_MCLK_DEFAULT, period = 0;
+    const char *elfPath = NULL, *functionName = NULL, *sharedMemoryPath = NULL;
+    const msp430x_function_t *function, *mainFunction;
+    uint64_t cycles, maximum = 0, minimum = UINT64_MAX, nextPeriodicCycles = 0, stepCycles, total = 0;
+    uint16_t arguments[4];
+    uint8_t argumentCount = 0;
+    char *argument;
+    bool profile = false;
+    unsigned long i;
+    int option;
+
+    /*** Parse Arguments ***/
+    while((option = getopt(argc, argv, "b:c:d:e:f:i:m:n:pr:s:x:")) != -1)
+    {
+        switch(option)
+        {
+            case 'b':
+                baudRate = strtoul(optarg, NULL, 0);
+                break;
+            case 'c':
+                maximumCycles = strtoull(optarg, NULL, 0);
+                break;
+            case 'd':
+                emulator_receiveReadyCycles = strtoull(optarg, NULL, 0);
+                break;
+            case 'e':
+                elfPath = optarg;
+                break;
+            case 'f':
+                functionName = optarg;
+                break;
+            case 'i':
+                emulator_setInput(optarg);
+                break;
+            case 'm':
+                mclk = strtoul(optarg, NULL, 0);
+                break;
+            case 'n':
+                count = strtoul(optarg, NULL, 0);
+                break;
+            case 'p':
+                profile = true;
+                break;
+            case 'r':
+                for(argument = optarg; (argumentCount < 4) && (*argument != '\0'); argument += (*argument == ',') ? 1 : 0)
+                    arguments[argumentCount++] = (uint16_t)strtoul(argument, &argument, 0);
+                break;
+            case 's':
+                sharedMemoryPath = optarg;
+                break;
+            case 'x':
+                emulator_periodicVector = (uint8_t)strtoul(optarg, &argument, 0);
+                period = (*argument == ':') ? strtoul(argument + 1, &argument, 0) : 0;
+                emulator_periodicRegister = (*argument == ':') ? (uint32_t)strtoul(argument + 1, &argument, 0) : 0;
+                emulator_periodicValue = (*argument == ':') ? (uint16_t)strtoul(argument + 1, NULL, 0) : 0;
+                break;
+            default:
+                elfPath = NULL;
+                break;
+        }
+    }
+    if((elfPath == NULL) || (baudRate == 0) || (mclk == 0))
+    {
+        (void)fprintf(stderr, "Usage: %s -e ELF [-c CYCLES] [-m MCLK_HZ] [-b BAUD_RATE] [-i INPUT [-d DELAY_CYCLES]] [-x VECTOR:PERIOD_CYCLES[:REGISTER:VALUE]] [-f FUNCTION [-n COUNT] [-r R12,R13,R14,R15]] [-p] [-s SHARED_MEMORY]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    /*** Load And Reset ***/
+    if((sharedMemoryPath != NULL) && !hwMemmap_map(sharedMemoryPath))
+    {
+        (void)fprintf(stderr, "%s: Cannot Map\n", sharedMemoryPath);
+        return EXIT_FAILURE;
+    }
+    hwMemmap_init();
+    msp430x_init();
+    if(!msp430x_loadElf(elfPath))
+        return EXIT_FAILURE;
+    msp430x_reset();
+    (void)hwMemmap_registerAccessCallback(emulator_accessCallback);
+    msp430x_setInterruptCallback(emulator_interruptCallback);
+    emulator_characterCycles = ((uint64_t)mclk * EMULATOR_BITS_PER_CHARACTER) / baudRate;
+
+    /*** Function Mode ***/
+    if(functionName != NULL)
+    {
+        function = msp430x_findFunction(functionName);
+        mainFunction = msp430x_findFunction("main");
+        if((function == NULL) || (mainFunction == NULL))
+        {
+            (void)fprintf(stderr, "%s: %s Or main Not Found\n", elfPath, functionName);
+            return EXIT_FAILURE;
+        }
+        while((msp430x_getRegister(MSP430X_REGISTER_PC) != mainFunction->address) && (msp430x_getCycles() < EMULATOR_STARTUP_CYCLES))
+        {
+            if(!msp430x_step())
+                break;
+        }
+        if(msp430x_getRegister(MSP430X_REGISTER_PC) != mainFunction->address)
+        {
+            (void)fprintf(stderr, "0x%05lX: Startup Did Not Reach main\n", (unsigned long)msp430x_getRegister(MSP430X_REGISTER_PC));
+            return EXIT_FAILURE;
+        }
+        msp430x_resetProfile();
+        for(i = 0; i < count; i++)
+        {
+            if(!msp430x_call(function->address, arguments, argumentCount, maximumCycles, &cycles))
+            {
+                (void)fprintf(stderr, "%s: Call %lu Did Not Return Within %llu Cycles\n", functionName, i + 1, maximumCycles);
+                return EXIT_FAILURE;
+            }
+            total += cycles;
+            if(cycles < minimum)
+                minimum = cycles;
+            if(cycles > maximum)
+                maximum = cycles;
+        }
+        (void)printf("%s: %lu Calls, Cycles: Minimum %llu, Average %llu, Maximum %llu (%.3f us At %lu Hz)\n", functionName, count, (unsigned long long)minimum, (unsigned long long)(total / (count ? count : 1)), (unsigned long long)maximum, (1000000.0 * (double)maximum) / (double)mclk, mclk);
+        if(profile)
+            emulator_printProfile();
+        return EXIT_SUCCESS;
+    }
+
+    /*** Run Mode ***/
+    while(msp430x_getCycles() < maximumCycles)
+    {
+        stepCycles = msp430x_getCycles();
+        if(!msp430x_step())
+        {
+            (void)fprintf(stderr, "0x%05lX: Illegal Instruction\n", (unsigned long)msp430x_getRegister(MSP430X_REGISTER_PC));
+            return EXIT_FAILURE;
+        }
+        emulator_stepInterrupts(stepCycles);
+        emulator_stepDma();
+        emulator_stepUart();
+        if(emulator_periodicRegisterRead)
+        {
+            emulator_periodicRegisterRead = false;
+            HW_MEMMAP_REG16(emulator_periodicRegister) = 0; // xIV_NONE
+        }
+        if((period > 0) && (msp430x_getCycles() >= nextPeriodicCycles))
+        {
+            if(emulator_periodicRegister != 0)
+                HW_MEMMAP_REG16(emulator_periodicRegister) = emulator_periodicValue;
+            msp430x_setInterruptRequest(emulator_periodicVector, true);
+            nextPeriodicCycles = msp430x_getCycles() + period;
+        }
+    }
+    (void)fflush(stdout);
+    if(profile)
+        emulator_printProfile();
+    if(emulator_inputLength > 0)
+        emulator_printUart();
+
+    return EXIT_SUCCESS;
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   emulator_accessCallback
+ * BRIEF:   Access Callback
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Accessed Peripheral Address
+ * NOTE:    Reading The Receive Buffer Or Interrupt Vector Register Clears The Receive Interrupt; Only
+ *          Reading The Receive Buffer Frees It For The Next Character
+ ****************************************************************************************************/
+static void emulator_accessCallback(const uint32_t Address)
+{
+    /*** Receive Buffer Read ***/
+    if((Address == (DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxRXBUF)) && emulator_receiveUnread)
+    {
+        emulator_receiveUnread = false;
+        if((msp430x_getCycles() - emulator_receiveCycles) > emulator_receiveLatencyCycles)
+            emulator_receiveLatencyCycles = msp430x_getCycles() - emulator_receiveCycles;
+        if(emulator_interruptsDisabled && emulator_disabledEntry && ((msp430x_getCycles() - emulator_disabledStartCycles) > emulator_receiveHandlerCycles))
+            emulator_receiveHandlerCycles = msp430x_getCycles() - emulator_disabledStartCycles;
+    }
+
+    /*** Receive Buffer Or Interrupt Vector Read ***/
+    if((Address == (DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxRXBUF)) || (Address == (DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxIV)))
+        emulator_receiveRead = true;
+
+    /*** Periodic Vector Register Read ***/
+    if((emulator_periodicRegister != 0) && (Address == emulator_periodicRegister))
+        emulator_periodicRegisterRead = true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   emulator_compareDisabled
+ * BRIEF:   Compare Interrupts Disabled Windows (qsort)
+ * RETURN:  int: Order (Longest Window First)
+ * ARG:     First: First Window
+ * ARG:     Second: Second Window
+ ****************************************************************************************************/
+static int emulator_compareDisabled(const void *First, const void *Second)
+{
+    const emulator_disabled_t *first = (const emulator_disabled_t *)First, *second = (const emulator_disabled_t *)Second;
+
+    /*** Compare Windows ***/
+    if(first->maximumCycles == second->maximumCycles)
+        return (first->count < second->count) ? 1 : ((first->count > second->count) ? -1 : 0);
+
+    return (first->maximumCycles < second->maximumCycles) ? 1 : -1;
+}
+
+/****************************************************************************************************
+ * FUNCT:   emulator_compareFunctions
+ * BRIEF:   Compare Functions (qsort)
+ * RETURN:  int: Order (Most Inclusive Cycles First)
+ * ARG:     First: First Function
+ * ARG:     Second: Second Function
+ ****************************************************************************************************/
+static int emulator_compareFunctions(const void *First, const void *Second)
+{
+    const msp430x_function_t *first = *(const msp430x_function_t * const *)First, *second = *(const msp430x_function_t * const *)Second;
+
+    /*** Compare Functions ***/
+    if(first->inclusiveCycles == second->inclusiveCycles)
+        return strcmp(first->name, second->name);
+
+    return (first->inclusiveCycles < second->inclusiveCycles) ? 1 : -1;
+}
+
+/****************************************************************************************************
+ * FUNCT:   emulator_findFunction
+ * BRIEF:   Find Function
+ * RETURN:  const msp430x_function_t *: Function Containing Address Or NULL
+ * ARG:     Address: Address
+ ****************************************************************************************************/
+static const msp430x_function_t *emulator_findFunction(const uint32_t Address)
+{
+    const msp430x_function_t *function;
+    size_t i;
+
+    /*** Find Function ***/
+    for(i = 0; i < msp430x_getFunctionCount(); i++)
+    {
+        function = msp430x_getFunction(i);
+        if((Address >= function->address) && (Address < (function->address + function->size)))
+            return function;
+    }
+
+    return NULL;
+}
+
+/****************************************************************************************************
+ * FUNCT:   emulator_interruptCallback
+ * BRIEF:   Interrupt Callback
+ * RETURN:  Returns Nothing
+ * ARG:     Vector: Accepted Vector
+ * NOTE:    The Periodic Interrupt Request Is Cleared On Acceptance
+ ****************************************************************************************************/
+static void emulator_interruptCallback(const uint8_t Vector)
+{
+    /*** Periodic Interrupt ***/
+    if((Vector == emulator_periodicVector) && (Vector != USCI_A1_VECTOR))
+        msp430x_setInterruptRequest(Vector, false);
+}
+
+/****************************************************************************************************
+ * FUNCT:   emulator_printProfile
+ * BRIEF:   Print Profile
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+static void emulator_printProfile(void)
+{
+    const msp430x_function_t **functions;
+    const msp430x_vector_t *vector;
+    size_t count = 0, i;
+    uint8_t v;
+
+    /*** Functions (Most Inclusive Cycles First) ***/
+    functions = malloc(msp430x_getFunctionCount() * sizeof(*functions));
+    if(functions == NULL)
+        return;
+    for(i = 0; i < msp430x_getFunctionCount(); i++)
+    {
+        if(msp430x_getFunction(i)->calls > 0)
+            functions[count++] = msp430x_getFunction(i);
+    }
+    qsort(functions, count, sizeof(*functions), emulator_compareFunctions);
+    (void)printf("\n%-40s %10s %14s %14s %10s %10s\n", "Function", "Calls", "Inclusive", "Exclusive", "Minimum", "Maximum");
+    for(i = 0; (i < count) && (i < EMULATOR_PROFILE_MAXIMUM); i++)
+        (void)printf("%-40s %10llu %14llu %14llu %10llu %10llu\n", functions[i]->name, (unsigned long long)functions[i]->calls, (unsigned long long)functions[i]->inclusiveCycles, (unsigned long long)functions[i]->exclusiveCycles, (unsigned long long)functions[i]->minimumCycles, (unsigned long long)functions[i]->maximumCycles);
+    free(functions);
+
+    /*** Vectors ***/
+    (void)printf("\n%-8s %10s %14s %10s %10s %14s\n", "Vector", "Count", "Cycles", "Minimum", "Maximum", "Max Latency");
+    for(v = 0; v < MSP430X_VECTOR_COUNT; v++)
+    {
+        vector = msp430x_getVector(v);
+        if(vector->count > 0)
+            (void)printf("%-8u %10llu %14llu %10llu %10llu %14llu\n", v, (unsigned long long)vector->count, (unsigned long long)vector->cycles, (unsigned long long)((vector->minimumCycles == UINT64_MAX) ? 0 : vector->minimumCycles), (unsigned long long)vector->maximumCycles, (unsigned long long)vector->maximumLatencyCycles);
+    }
+
+    /*** Interrupts Disabled (Longest Window First; Run Mode Only) ***/
+    qsort(emulator_disabled, emulator_disabledCount, sizeof(emulator_disabled[0]), emulator_compareDisabled);
+    if(emulator_disabledCount > 0)
+        (void)printf("\n%-40s %-7s %10s %10s\n", "Interrupts Disabled In", "", "Count", "Maximum");
+    for(i = 0; i < emulator_disabledCount; i++)
+        (void)printf("%-40s %-7s %10llu %10llu\n", (emulator_disabled[i].function != NULL) ? emulator_disabled[i].function->name : "?", emulator_disabled[i].entry ? "(Entry)" : "", (unsigned long long)emulator_disabled[i].count, (unsigned long long)emulator_disabled[i].maximumCycles);
+}
+
+/****************************************************************************************************
+ * FUNCT:   emulator_printUart
+ * BRIEF:   Print CLI Universal Asynchronous Receiver/Transmitter (UART) Receive Statistics
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    A Character Is Lost (Overrun) If The Next One Arrives Before The Receive Buffer Is Read,
+ *          So The Read Latency Must Stay Below One Character Time; Of That, The Handler Takes From
+ *          Acceptance To The Read (Read In Its Entry Window)
+ ****************************************************************************************************/
+static void emulator_printUart(void)
+{
+    /*** Receive ***/
+    (void)printf("\nUART: %lu Of %lu Characters Received, %lu Overruns, Maximum Read Latency %llu Cycles (Handler %llu, Character Time %llu Cycles)\n", (unsigned long)emulator_inputIndex, (unsigned long)emulator_inputLength, (unsigned long)emulator_overrunCount, (unsigned long long)emulator_receiveLatencyCycles, (unsigned long long)emulator_receiveHandlerCycles, (unsigned long long)emulator_characterCycles);
+}
+
+/****************************************************************************************************
+ * FUNCT:   emulator_setInput
+ * BRIEF:   Set Input
+ * RETURN:  Returns Nothing
+ * ARG:     Input: CLI Input ("\n" And "\r" Escapes)
+ ****************************************************************************************************/
+static void emulator_setInput(const char * const Input)
+{
+    size_t i;
+
+    /*** Set Input ***/
+    emulator_inputLength = 0;
+    for(i = 0; (Input[i] != '\0') && (emulator_inputLength < sizeof(emulator_input)); i++)
+    {
+        if((Input[i] == '\\') && ((Input[i + 1] == 'n') || (Input[i + 1] == 'r')))
+            emulator_input[emulator_inputLength++] = (Input[++i] == 'n') ? '\n' : '\r';
+        else
+            emulator_input[emulator_inputLength++] = Input[i];
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   emulator_stepDma
+ * BRIEF:   Step Direct Memory Access (DMA) Model
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Requested Block Transfers Hold The CPU For Each Byte; Bytes Written To The CLI UART
+ *          Transmit Buffer Go To stdout And Keep The UART Busy For The Baud Clock Time
+ ****************************************************************************************************/
+static void emulator_stepDma(void)
+{
+    uint8_t byte, channel;
+    uint16_t control, count, i;
+    uint32_t destination, source;
+
+    for(channel = DMA_CHANNEL_0; channel <= DMA_CHANNEL_2; channel += DMA_CHANNEL_1)
+    {
+        /*** Transfer Requested? ***/
+        control = HW_MEMMAP_REG16(DMA_BASE + channel + OFS_DMA0CTL);
+        if((control & (DMAEN | DMAREQ)) != (DMAEN | DMAREQ))
+            continue;
+
+        /*** Transfer Block ***/
+        count = 0;
+        source = HW_MEMMAP_REG32(DMA_BASE + channel + OFS_DMA0SA) & 0xFFFFF;
+        destination = HW_MEMMAP_REG32(DMA_BASE + channel + OFS_DMA0DA) & 0xFFFFF;
+        for(i = 0; i < HW_MEMMAP_REG16(DMA_BASE + channel + OFS_DMA0SZ); i++)
+        {
+            byte = msp430x_readByte(source);
+            if(destination == (DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxTXBUF))
+            {
+                (void)putchar(byte);
+                count++;
+            }
+            else
+            {
+                msp430x_writeByte(destination, byte);
+            }
+            msp430x_stall(EMULATOR_DMA_TRANSFER_CYCLES);
+
+            /* Next Address */
+            if((control & DMASRCINCR_3) == DMASRCINCR_3)
+                source++;
+            else if((control & DMASRCINCR_3) == DMASRCINCR_2)
+                source--;
+            if((control & DMADSTINCR_3) == DMADSTINCR_3)
+                destination++;
+            else if((control & DMADSTINCR_3) == DMADSTINCR_2)
+                destination--;
+        }
+        HW_MEMMAP_REG16(DMA_BASE + channel + OFS_DMA0CTL) = (uint16_t)((control & ~(DMAEN | DMAREQ)) | DMAIFG); // Block Transfer Complete
+
+        /*** UART Busy For The Baud Clock Time ***/
+        if(count > 0)
+        {
+            HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxSTATW) |= UCBUSY;
+            emulator_transmitReadyCycles = msp430x_getCycles() + (count * emulator_characterCycles);
+        }
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   emulator_stepInterrupts
+ * BRIEF:   Step Interrupts Disabled Windows
+ * RETURN:  Returns Nothing
+ * ARG:     StepCycles: Cycles Before The Step
+ * NOTE:    A Window Runs From The Step That Clears GIE (DINT, Or Accepting An Interrupt) To The One
+ *          That Sets It (EINT, Or RETI), And Is Charged To The Function Where It Starts: The Handler
+ *          For An Accepted Interrupt, Listed Apart As Its Entry Window; Time In Low-Power Mode Doesn't
+ *          Count (GIE Stays Set)
+ ****************************************************************************************************/
+static void emulator_stepInterrupts(const uint64_t StepCycles)
+{
+    bool enabled;
+    size_t i;
+
+    /*** Transition? ***/
+    enabled = ((msp430x_getRegister(MSP430X_REGISTER_SR) & MSP430X_SR_GIE) == MSP430X_SR_GIE);
+    if(enabled != emulator_interruptsDisabled)
+        return;
+    emulator_interruptsDisabled = !enabled;
+
+    /*** Window Starts ***/
+    if(!enabled)
+    {
+        emulator_disabledStartCycles = StepCycles;
+        emulator_disabledFunction = emulator_findFunction(msp430x_getRegister(MSP430X_REGISTER_PC));
+        emulator_disabledEntry = (emulator_disabledFunction != NULL) && (emulator_disabledFunction->address == msp430x_getRegister(MSP430X_REGISTER_PC));
+        return;
+    }
+
+    /*** Window Ends ***/
+    for(i = 0; (i < emulator_disabledCount) && ((emulator_disabled[i].function != emulator_disabledFunction) || (emulator_disabled[i].entry != emulator_disabledEntry)); i++);
+    if(i < EMULATOR_DISABLED_MAXIMUM)
+    {
+        if(i == emulator_disabledCount)
+        {
+            emulator_disabled[i].function = emulator_disabledFunction;
+            emulator_disabled[i].entry = emulator_disabledEntry;
+            emulator_disabledCount++;
+        }
+        emulator_disabled[i].count++;
+        if((msp430x_getCycles() - emulator_disabledStartCycles) > emulator_disabled[i].maximumCycles)
+            emulator_disabled[i].maximumCycles = msp430x_getCycles() - emulator_disabledStartCycles;
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   emulator_stepUart
+ * BRIEF:   Step CLI Universal Asynchronous Receiver/Transmitter (UART) Model
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Input Characters Arrive One Character Time Apart Once The Receive Interrupt Is Enabled; One
+ *          Arriving Before The Previous One Was Read Overwrites It And Sets UCOE, Like The Hardware
+ ****************************************************************************************************/
+static void emulator_stepUart(void)
+{
+    /*** Transmit Complete ***/
+    if(((HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxSTATW) & UCBUSY) == UCBUSY) && (msp430x_getCycles() >= emulator_transmitReadyCycles))
+        HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxSTATW) &= (uint16_t)~UCBUSY;
+
+    /*** Receive Interrupt Serviced ***/
+    if(emulator_receiveRead)
+    {
+        emulator_receiveRead = false;
+        HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxIFG) &= (uint16_t)~UCRXIFG;
+        HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxIV) = USCI_NONE;
+        msp430x_setInterruptRequest(USCI_A1_VECTOR, false);
+        if(!emulator_receiveUnread)
+            HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxSTATW) &= (uint16_t)~UCOE; // Receive Buffer Read
+    }
+
+    /*** Receive ***/
+    if((emulator_inputIndex >= emulator_inputLength) || (msp430x_getCycles() < emulator_receiveReadyCycles))
+        return;
+    if(((HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxCTLW0) & UCSWRST) == UCSWRST) || ((HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxIE) & UCRXIE) != UCRXIE))
+        return;
+    if(emulator_receiveUnread)
+    {
+        emulator_overrunCount++;
+        HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxSTATW) |= UCOE;
+    }
+    emulator_receiveUnread = true;
+    emulator_receiveCycles = msp430x_getCycles();
+    HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxRXBUF) = (uint8_t)emulator_input[emulator_inputIndex++];
+    HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxIFG) |= UCRXIFG;
+    HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxIV) = USCI_UART_UCRXIFG;
+    msp430x_setInterruptRequest(USCI_A1_VECTOR, true);
+    emulator_receiveReadyCycles = msp430x_getCycles() + emulator_characterCycles;
+}
@@ -0,0 +1,1715 @@
+/****************************************************************************************************
+ * FILE:    msp430x.c
+ * BRIEF:   MSP430X CPU Emulator Source File
+ * NOTE:    Executes The Linked Firmware Image (ELF) Instruction By Instruction With The MSP430X CPU
+ *          (CPUXv2) Cycle Counts From The MSP430FR5xx/6xx Family User's Guide; The Lower 64 KB Of The
+ *          Address Space Is hwMemmap_memory, So Peripheral Accesses Go Through hwMemmap_access() And
+ *          Drive The Same Simulator Peripheral Models As The Host Unit Tests
+ * NOTE:    FRAM Reads Cost NWAITS (FRCTL0) Wait States On A Miss In The FRAM Controller's 2-Way Cache
+ * NOTE:    Interrupt Vectors Come From The Top Of RAM While SYSCTL SYSRIVECT Is Set
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define MSP430X_ELF_MACHINE_MSP430     (105)
+#define MSP430X_ELF_PROGRAM_LOAD       (1)
+#define MSP430X_ELF_SECTION_SYMBOLS    (2)
+#define MSP430X_ELF_SYMBOL_FUNCTION    (2)
+#define MSP430X_FRAM_CACHE_LINE_SHIFT  (3) // 64-Bit Lines
+#define MSP430X_FRAM_CACHE_SETS        (2)
+#define MSP430X_FRAM_CACHE_WAYS        (2)
+#define MSP430X_FUNCTION_NONE          (SIZE_MAX)
+#define MSP430X_MASK_ADDRESS           (0xFFFFFu)
+#define MSP430X_PERIPHERAL_MAXIMUM     (0x1000) // Peripheral Registers Go Through hwMemmap_access()
+#define MSP430X_VECTOR_NONE            (0xFF)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "hw_memmap.h"
+#include "msp430x.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef enum msp430x_class_e
+{
+    MSP430X_CLASS_REGISTER,  // Rn And Constant Generator
+    MSP430X_CLASS_INDIRECT,  // @Rn, @Rn+
+    MSP430X_CLASS_IMMEDIATE, // #N
+    MSP430X_CLASS_INDEXED    // x(Rn), EDE, &EDE
+} msp430x_class_t;
+
+typedef enum msp430x_size_e
+{
+    MSP430X_SIZE_BYTE,
+    MSP430X_SIZE_WORD,
+    MSP430X_SIZE_ADDRESS // 20 Bits
+} msp430x_size_t;
+
+typedef struct msp430x_frame_s
+{
+    uint64_t childCycles;
+    size_t function;
+    uint32_t stackPointer; // Points To The Return Address (Or Saved SR For Interrupts)
+    uint64_t startCycles;
+    uint8_t vector;
+} msp430x_frame_t;
+
+typedef struct msp430x_operand_s
+{
+    uint32_t address;
+    msp430x_class_t class;
+    bool memory;
+    uint8_t registerNumber;
+    uint32_t value; // Constant Or Immediate
+} msp430x_operand_t;
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static const uint8_t msp430x_formatICycles[4][3] = // [Source Class][Destination: Register, PC, Memory]
+{
+    {1, 3, 4},
+    {2, 4, 5},
+    {2, 3, 5},
+    {3, 5, 6}
+};
+static const uint8_t msp430x_formatIICycles[3][4] = // [RRC/RRA/SWPB/SXT, PUSH, CALL][Source Class]
+{
+    {1, 3, 3, 4},
+    {3, 3, 3, 4},
+    {4, 4, 4, 5}
+};
+
+static uint64_t msp430x_cycles;
+static uint32_t msp430x_framCacheTag[MSP430X_FRAM_CACHE_SETS][MSP430X_FRAM_CACHE_WAYS];
+static uint8_t msp430x_framCacheUsed[MSP430X_FRAM_CACHE_SETS]; // Most Recently Used Way
+static bool msp430x_framCacheValid[MSP430X_FRAM_CACHE_SETS][MSP430X_FRAM_CACHE_WAYS];
+static msp430x_frame_t msp430x_frames[MSP430X_CALL_DEPTH];
+static size_t msp430x_frameDepth;
+static size_t msp430x_functionCount;
+static size_t msp430x_functionOrder[MSP430X_FUNCTION_COUNT]; // Sorted By Address
+static msp430x_function_t msp430x_functions[MSP430X_FUNCTION_COUNT];
+static msp430x_interruptCallback_t msp430x_interruptCallback;
+static bool msp430x_interruptRequest[MSP430X_VECTOR_COUNT];
+static uint64_t msp430x_interruptRequestCycles[MSP430X_VECTOR_COUNT];
+static uint32_t msp430x_registers[MSP430X_REGISTER_COUNT];
+static uint8_t msp430x_upperMemory[MSP430X_MEMORY_SIZE - 0x10000];
+static msp430x_vector_t msp430x_vectors[MSP430X_VECTOR_COUNT];
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void msp430x_acceptInterrupt(const uint8_t Vector);
+static void msp430x_accessFram(const uint32_t Address);
+static uint32_t msp430x_add(const uint32_t Source, const uint32_t Destination, const uint32_t Carry, const msp430x_size_t Size);
+static uint32_t msp430x_decimalAdd(const uint32_t Source, const uint32_t Destination, const msp430x_size_t Size);
+static bool msp430x_execute(void);
+static bool msp430x_executeAddress(const uint16_t Opcode);
+static bool msp430x_executeFormatI(const uint16_t Opcode, const uint16_t Extension, const bool Extended);
+static bool msp430x_executeFormatII(const uint16_t Opcode, const uint16_t Extension, const bool Extended);
+static bool msp430x_executeJump(const uint16_t Opcode);
+static bool msp430x_executeMultiple(const uint16_t Opcode);
+static uint16_t msp430x_fetch(void);
+static size_t msp430x_getFunctionIndex(const uint32_t Address);
+static uint32_t msp430x_getIndexedAddress(const uint8_t Register, const uint32_t High, const bool Extended);
+static uint32_t msp430x_getMask(const msp430x_size_t Size);
+static uint8_t *msp430x_getMemory(const uint32_t Address, const uint8_t Size);
+static uint32_t msp430x_getMostSignificantBit(const msp430x_size_t Size);
+static void msp430x_getOperand(const uint8_t Mode, const uint8_t Register, const uint32_t High, const bool Extended, const msp430x_size_t Size, msp430x_operand_t * const Operand);
+static msp430x_size_t msp430x_getSize(const uint16_t Opcode, const uint16_t Extension, const bool Extended);
+static uint32_t msp430x_getUnsigned(const uint8_t * const Bytes, const uint8_t Length);
+static void msp430x_popFrames(const uint32_t StackPointer);
+static void msp430x_pushFrame(const uint32_t Address, const uint64_t StartCycles, const uint8_t Vector);
+static void msp430x_push(const uint32_t Value, const msp430x_size_t Size);
+static uint32_t msp430x_read(const uint32_t Address, const msp430x_size_t Size);
+static uint32_t msp430x_readOperand(const msp430x_operand_t * const Operand, const msp430x_size_t Size);
+static void msp430x_setFlags(const uint32_t Result, const msp430x_size_t Size, const bool Carry, const bool Overflow);
+static uint32_t msp430x_signExtend(const uint32_t Value, const uint32_t MostSignificantBit);
+static void msp430x_write(const uint32_t Address, const uint32_t Value, const msp430x_size_t Size);
+static void msp430x_writeOperand(const msp430x_operand_t * const Operand, const uint32_t Value, const msp430x_size_t Size);
+static void msp430x_writeRegister(const uint8_t Register, const uint32_t Value, const msp430x_size_t Size);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_addFunction
+ * BRIEF:   Add Function
+ * RETURN:  bool: Success (true) Or Failure (false) Because The Function Table Is Full
+ * ARG:     Name: Function Name
+ * ARG:     Address: Function Address
+ * ARG:     Size: Function Size (Bytes)
+ ****************************************************************************************************/
+bool msp430x_addFunction(const char * const Name, const uint32_t Address, const uint32_t Size)
+{
+    msp430x_function_t *function;
+    size_t i;
+
+    /*** Error Check ***/
+    if(msp430x_functionCount >= MSP430X_FUNCTION_COUNT)
+        return false;
+
+    /*** Add Function ***/
+    function = &msp430x_functions[msp430x_functionCount];
+    (void)memset(function, 0, sizeof(*function));
+    (void)snprintf(function->name, sizeof(function->name), "%s", Name);
+    function->address = Address & MSP430X_MASK_ADDRESS;
+    function->minimumCycles = UINT64_MAX;
+    function->size = Size;
+
+    /*** Keep Address Order ***/
+    for(i = msp430x_functionCount; (i > 0) && (msp430x_functions[msp430x_functionOrder[i - 1]].address > function->address); i--)
+        msp430x_functionOrder[i] = msp430x_functionOrder[i - 1];
+    msp430x_functionOrder[i] = msp430x_functionCount++;
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_call
+ * BRIEF:   Call
+ * RETURN:  bool: Success (true) Or Failure (false) Because Of An Illegal Instruction Or Timeout
+ * ARG:     Address: Function Address
+ * ARG:     Arguments: Arguments (R12 To R15; NULL: None)
+ * ARG:     ArgumentCount: Number Of Arguments (0 To 4)
+ * ARG:     MaximumCycles: Maximum Cycles
+ * ARG:     Cycles: Cycles From The First Instruction Through The Return
+ * NOTE:    The Return Address (MSP430X_RETURN_ADDRESS) Is Pushed Like CALLA, So Both RET And RETA
+ *          Return; PC And SP Are Restored Afterwards
+ ****************************************************************************************************/
+bool msp430x_call(const uint32_t Address, const uint16_t * const Arguments, const uint8_t ArgumentCount, const uint64_t MaximumCycles, uint64_t * const Cycles)
+{
+    uint32_t programCounter, stackPointer;
+    uint64_t startCycles;
+    bool success = true;
+    uint8_t i;
+
+    /*** Error Check ***/
+    if((ArgumentCount > 4) || ((ArgumentCount > 0) && (Arguments == NULL)))
+        return false;
+
+    /*** Set Up Call ***/
+    programCounter = msp430x_registers[MSP430X_REGISTER_PC];
+    stackPointer = msp430x_registers[MSP430X_REGISTER_SP];
+    for(i = 0; i < ArgumentCount; i++)
+        msp430x_registers[12 + i] = Arguments[i];
+    msp430x_registers[MSP430X_REGISTER_SP] = (stackPointer - 4) & MSP430X_MASK_ADDRESS;
+    msp430x_writeByte(msp430x_registers[MSP430X_REGISTER_SP], (uint8_t)MSP430X_RETURN_ADDRESS);
+    msp430x_writeByte(msp430x_registers[MSP430X_REGISTER_SP] + 1, (uint8_t)(MSP430X_RETURN_ADDRESS >> 8));
+    msp430x_writeByte(msp430x_registers[MSP430X_REGISTER_SP] + 2, (uint8_t)(MSP430X_RETURN_ADDRESS >> 16));
+    msp430x_writeByte(msp430x_registers[MSP430X_REGISTER_SP] + 3, 0);
+    msp430x_registers[MSP430X_REGISTER_PC] = Address & MSP430X_MASK_ADDRESS;
+
+    /*** Run Until Return ***/
+    startCycles = msp430x_cycles;
+    msp430x_pushFrame(Address, startCycles, MSP430X_VECTOR_NONE);
+    while(msp430x_registers[MSP430X_REGISTER_PC] != MSP430X_RETURN_ADDRESS)
+    {
+        if(((msp430x_cycles - startCycles) >= MaximumCycles) || !msp430x_step())
+        {
+            success = false;
+            msp430x_frameDepth = 0;
+            break;
+        }
+    }
+    if(Cycles != NULL)
+        *Cycles = msp430x_cycles - startCycles;
+
+    /*** Restore ***/
+    msp430x_registers[MSP430X_REGISTER_PC] = programCounter;
+    msp430x_registers[MSP430X_REGISTER_SP] = stackPointer;
+
+    return success;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_findFunction
+ * BRIEF:   Find Function
+ * RETURN:  const msp430x_function_t *: Function (NULL: Not Found)
+ * ARG:     Name: Function Name
+ ****************************************************************************************************/
+const msp430x_function_t *msp430x_findFunction(const char * const Name)
+{
+    size_t i;
+
+    /*** Find Function ***/
+    for(i = 0; i < msp430x_functionCount; i++)
+    {
+        if(strcmp(msp430x_functions[i].name, Name) == 0)
+            return &msp430x_functions[i];
+    }
+
+    return NULL;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_getCycles
+ * BRIEF:   Get Cycles
+ * RETURN:  uint64_t: CPU Cycles (MCLK) Since msp430x_init()
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+uint64_t msp430x_getCycles(void)
+{
+    /*** Get Cycles ***/
+    return msp430x_cycles;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_getFunction
+ * BRIEF:   Get Function
+ * RETURN:  const msp430x_function_t *: Function (NULL: Index Out Of Range)
+ * ARG:     Index: Index (0 To msp430x_getFunctionCount() - 1, Address Order)
+ ****************************************************************************************************/
+const msp430x_function_t *msp430x_getFunction(const size_t Index)
+{
+    /*** Get Function ***/
+    if(Index >= msp430x_functionCount)
+        return NULL;
+    return &msp430x_functions[msp430x_functionOrder[Index]];
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_getFunctionCount
+ * BRIEF:   Get Function Count
+ * RETURN:  size_t: Number Of Functions
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+size_t msp430x_getFunctionCount(void)
+{
+    /*** Get Function Count ***/
+    return msp430x_functionCount;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_getRegister
+ * BRIEF:   Get Register
+ * RETURN:  uint32_t: Register Value (0: Register Out Of Range)
+ * ARG:     Register: Register (0 To 15)
+ ****************************************************************************************************/
+uint32_t msp430x_getRegister(const uint8_t Register)
+{
+    /*** Get Register ***/
+    if(Register >= MSP430X_REGISTER_COUNT)
+        return 0;
+    return msp430x_registers[Register];
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_getVector
+ * BRIEF:   Get Vector
+ * RETURN:  const msp430x_vector_t *: Interrupt Vector Statistics (NULL: Vector Out Of Range)
+ * ARG:     Vector: Vector
+ ****************************************************************************************************/
+const msp430x_vector_t *msp430x_getVector(const uint8_t Vector)
+{
+    /*** Get Vector ***/
+    if(Vector >= MSP430X_VECTOR_COUNT)
+        return NULL;
+    return &msp430x_vectors[Vector];
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_init
+ * BRIEF:   Initialize
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Clears Memory Above 64 KB, Registers, Functions And Profile; Call hwMemmap_init() For The
+ *          Lower 64 KB
+ ****************************************************************************************************/
+void msp430x_init(void)
+{
+    /*** Initialize ***/
+    (void)memset(msp430x_upperMemory, 0, sizeof(msp430x_upperMemory));
+    (void)memset(msp430x_registers, 0, sizeof(msp430x_registers));
+    (void)memset(msp430x_interruptRequest, 0, sizeof(msp430x_interruptRequest));
+    (void)memset(msp430x_framCacheValid, 0, sizeof(msp430x_framCacheValid));
+    msp430x_cycles = 0;
+    msp430x_functionCount = 0;
+    msp430x_interruptCallback = NULL;
+    msp430x_resetProfile();
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_loadElf
+ * BRIEF:   Load Executable And Linkable Format (ELF) Image
+ * RETURN:  bool: Success (true) Or Failure (false)
+ * ARG:     Path: ELF Path (Linked With lnk_msp430fr6989.cmd)
+ * NOTE:    Loadable Segments Are Copied To Their Load (Physical) Addresses; Function Symbols Are Added
+ *          For Profiling
+ ****************************************************************************************************/
+bool msp430x_loadElf(const char * const Path)
+{
+    uint32_t address, fileSize, memorySize, offset, programHeaderOffset, sectionHeaderOffset, stringOffset, stringSize, symbolOffset, symbolSize;
+    uint8_t *image, *programHeader, *sectionHeader, *symbol;
+    uint16_t programHeaderCount, programHeaderSize, sectionHeaderCount, sectionHeaderSize;
+    FILE *file;
+    long length;
+    uint32_t i, j, k;
+    bool success = false;
+
+    /*** Read Image ***/
+    file = fopen(Path, "rb");
+    if(file == NULL)
+    {
+        perror(Path);
+        return false;
+    }
+    image = NULL;
+    if((fseek(file, 0, SEEK_END) == 0) && ((length = ftell(file)) > 52) && (fseek(file, 0, SEEK_SET) == 0))
+    {
+        image = malloc((size_t)length);
+        if((image != NULL) && (fread(image, 1, (size_t)length, file) != (size_t)length))
+        {
+            free(image);
+            image = NULL;
+        }
+    }
+    else
+    {
+        length = 0;
+    }
+    (void)fclose(file);
+    if(image == NULL)
+    {
+        (void)fprintf(stderr, "%s: Read Failed\n", Path);
+        return false;
+    }
+
+    /*** Check Header (32-Bit, Little Endian, MSP430) ***/
+    if((memcmp(image, "\177ELF", 4) != 0) || (image[4] != 1) || (image[5] != 1) || (msp430x_getUnsigned(&image[18], 2) != MSP430X_ELF_MACHINE_MSP430))
+    {
+        (void)fprintf(stderr, "%s: Not An MSP430 ELF Image\n", Path);
+        free(image);
+        return false;
+    }
+    programHeaderOffset = msp430x_getUnsigned(&image[28], 4);
+    sectionHeaderOffset = msp430x_getUnsigned(&image[32], 4);
+    programHeaderSize = (uint16_t)msp430x_getUnsigned(&image[42], 2);
+    programHeaderCount = (uint16_t)msp430x_getUnsigned(&image[44], 2);
+    sectionHeaderSize = (uint16_t)msp430x_getUnsigned(&image[46], 2);
+    sectionHeaderCount = (uint16_t)msp430x_getUnsigned(&image[48], 2);
+    if(((programHeaderOffset + ((uint32_t)programHeaderSize * programHeaderCount)) > (uint32_t)length) || ((sectionHeaderOffset + ((uint32_t)sectionHeaderSize * sectionHeaderCount)) > (uint32_t)length))
+        goto loadElfEnd;
+
+    /*** Load Segments ***/
+    for(i = 0; i < programHeaderCount; i++)
+    {
+        programHeader = &image[programHeaderOffset + (i * programHeaderSize)];
+        if(msp430x_getUnsigned(&programHeader[0], 4) != MSP430X_ELF_PROGRAM_LOAD)
+            continue;
+        offset = msp430x_getUnsigned(&programHeader[4], 4);
+        address = msp430x_getUnsigned(&programHeader[12], 4);
+        fileSize = msp430x_getUnsigned(&programHeader[16], 4);
+        memorySize = msp430x_getUnsigned(&programHeader[20], 4);
+        if(((offset + fileSize) > (uint32_t)length) || ((address + memorySize) > MSP430X_MEMORY_SIZE) || (fileSize > memorySize))
+            goto loadElfEnd;
+        for(j = 0; j < memorySize; j++)
+            msp430x_writeByte(address + j, (j < fileSize) ? image[offset + j] : 0);
+    }
+
+    /*** Add Function Symbols ***/
+    for(i = 0; i < sectionHeaderCount; i++)
+    {
+        sectionHeader = &image[sectionHeaderOffset + (i * sectionHeaderSize)];
+        if(msp430x_getUnsigned(&sectionHeader[4], 4) != MSP430X_ELF_SECTION_SYMBOLS)
+            continue;
+        symbolOffset = msp430x_getUnsigned(&sectionHeader[16], 4);
+        symbolSize = msp430x_getUnsigned(&sectionHeader[20], 4);
+        k = msp430x_getUnsigned(&sectionHeader[24], 4); // Linked String Table
+        if((k >= sectionHeaderCount) || ((symbolOffset + symbolSize) > (uint32_t)length))
+            goto loadElfEnd;
+        stringOffset = msp430x_getUnsigned(&image[sectionHeaderOffset + (k * sectionHeaderSize) + 16], 4);
+        stringSize = msp430x_getUnsigned(&image[sectionHeaderOffset + (k * sectionHeaderSize) + 20], 4);
+        if((stringOffset + stringSize) > (uint32_t)length)
+            goto loadElfEnd;
+        for(j = 0; (j + 16) <= symbolSize; j += 16)
+        {
+            symbol = &image[symbolOffset + j];
+            if(((symbol[12] & 0x0F) != MSP430X_ELF_SYMBOL_FUNCTION) || (msp430x_getUnsigned(&symbol[14], 2) == 0) || (msp430x_getUnsigned(&symbol[0], 4) >= stringSize))
+                continue;
+            if(memchr(&image[stringOffset + msp430x_getUnsigned(&symbol[0], 4)], '\0', stringSize - msp430x_getUnsigned(&symbol[0], 4)) == NULL)
+                continue;
+            (void)msp430x_addFunction((const char *)&image[stringOffset + msp430x_getUnsigned(&symbol[0], 4)], msp430x_getUnsigned(&symbol[4], 4), msp430x_getUnsigned(&symbol[8], 4));
+        }
+    }
+    success = true;
+
+loadElfEnd:
+    if(!success)
+        (void)fprintf(stderr, "%s: Malformed ELF Image\n", Path);
+    free(image);
+
+    return success;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_readByte
+ * BRIEF:   Read Byte
+ * RETURN:  uint8_t: Byte
+ * ARG:     Address: Address
+ * NOTE:    Debugger Access: No Cycles, No Peripheral Access Callbacks
+ ****************************************************************************************************/
+uint8_t msp430x_readByte(const uint32_t Address)
+{
+    /*** Read Byte ***/
+    return *msp430x_getMemory(Address, 0);
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_reset
+ * BRIEF:   Reset
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Brown Out Reset (BOR): Registers Cleared, PC Loaded From The Reset Vector
+ ****************************************************************************************************/
+void msp430x_reset(void)
+{
+    /*** Reset ***/
+    (void)memset(msp430x_registers, 0, sizeof(msp430x_registers));
+    (void)memset(msp430x_interruptRequest, 0, sizeof(msp430x_interruptRequest));
+    (void)memset(msp430x_framCacheValid, 0, sizeof(msp430x_framCacheValid));
+    msp430x_registers[MSP430X_REGISTER_PC] = (uint32_t)msp430x_readByte(MSP430X_VECTOR_ADDRESS(MSP430X_VECTOR_COUNT - 1)) | ((uint32_t)msp430x_readByte(MSP430X_VECTOR_ADDRESS(MSP430X_VECTOR_COUNT - 1) + 1) << 8);
+    msp430x_frameDepth = 0;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_resetProfile
+ * BRIEF:   Reset Profile
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Clears Function And Vector Statistics, Not The Functions
+ ****************************************************************************************************/
+void msp430x_resetProfile(void)
+{
+    size_t i;
+
+    /*** Reset Profile ***/
+    for(i = 0; i < msp430x_functionCount; i++)
+    {
+        msp430x_functions[i].calls = 0;
+        msp430x_functions[i].exclusiveCycles = 0;
+        msp430x_functions[i].inclusiveCycles = 0;
+        msp430x_functions[i].maximumCycles = 0;
+        msp430x_functions[i].minimumCycles = UINT64_MAX;
+    }
+    (void)memset(msp430x_vectors, 0, sizeof(msp430x_vectors));
+    for(i = 0; i < MSP430X_VECTOR_COUNT; i++)
+        msp430x_vectors[i].minimumCycles = UINT64_MAX;
+    msp430x_frameDepth = 0;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_setInterruptCallback
+ * BRIEF:   Set Interrupt Callback
+ * RETURN:  Returns Nothing
+ * ARG:     Callback: Called When An Interrupt Is Accepted (NULL: None)
+ ****************************************************************************************************/
+void msp430x_setInterruptCallback(const msp430x_interruptCallback_t Callback)
+{
+    /*** Set Interrupt Callback ***/
+    msp430x_interruptCallback = Callback;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_setInterruptRequest
+ * BRIEF:   Set Interrupt Request
+ * RETURN:  Returns Nothing
+ * ARG:     Vector: Vector (Numbered As In msp430fr6989.h, e.g. USCI_A1_VECTOR)
+ * ARG:     Request: Request (true) Or No Request (false)
+ * NOTE:    Requests Are Level Sensitive Like The Interrupt Flags Behind Them: The Peripheral Model
+ *          Clears The Request When The Interrupt Service Routine Clears The Flag
+ ****************************************************************************************************/
+void msp430x_setInterruptRequest(const uint8_t Vector, const bool Request)
+{
+    /*** Error Check ***/
+    if(Vector >= MSP430X_VECTOR_COUNT)
+        return;
+
+    /*** Set Interrupt Request ***/
+    if(Request && !msp430x_interruptRequest[Vector])
+        msp430x_interruptRequestCycles[Vector] = msp430x_cycles;
+    msp430x_interruptRequest[Vector] = Request;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_setRegister
+ * BRIEF:   Set Register
+ * RETURN:  Returns Nothing
+ * ARG:     Register: Register (0 To 15)
+ * ARG:     Value: Value (20 Bits)
+ ****************************************************************************************************/
+void msp430x_setRegister(const uint8_t Register, const uint32_t Value)
+{
+    /*** Set Register ***/
+    if(Register < MSP430X_REGISTER_COUNT)
+        msp430x_registers[Register] = Value & MSP430X_MASK_ADDRESS;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_stall
+ * BRIEF:   Stall
+ * RETURN:  Returns Nothing
+ * ARG:     Cycles: Cycles The CPU Is Held (e.g. 2 Per DMA Transfer)
+ ****************************************************************************************************/
+void msp430x_stall(const uint32_t Cycles)
+{
+    /*** Stall ***/
+    msp430x_cycles += Cycles;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_step
+ * BRIEF:   Step
+ * RETURN:  bool: Success (true) Or Failure (false) Because Of An Illegal Instruction
+ * ARG:     void: No Arguments
+ * NOTE:    Accepts The Highest Priority Pending Interrupt Or Executes One Instruction; With CPUOFF
+ *          Set (Low-Power Mode) And No Interrupt, One Idle Cycle Passes
+ ****************************************************************************************************/
+bool msp430x_step(void)
+{
+    uint8_t vector;
+    uint32_t stackPointer;
+    uint64_t startCycles;
+    uint16_t opcode;
+    bool call, returns, success;
+
+    /*** Accept Interrupt (Highest Vector Has Highest Priority) ***/
+    for(vector = MSP430X_VECTOR_COUNT; vector-- > 0;)
+    {
+        if(msp430x_interruptRequest[vector] && ((vector >= MSP430X_VECTOR_NMI_MINIMUM) || ((msp430x_registers[MSP430X_REGISTER_SR] & MSP430X_SR_GIE) == MSP430X_SR_GIE)))
+        {
+            msp430x_acceptInterrupt(vector);
+            return true;
+        }
+    }
+
+    /*** Low-Power Mode ***/
+    if((msp430x_registers[MSP430X_REGISTER_SR] & MSP430X_SR_CPUOFF) == MSP430X_SR_CPUOFF)
+    {
+        msp430x_cycles++;
+        return true;
+    }
+
+    /*** Classify Instruction (Without Bus Access) For The Profiler ***/
+    opcode = (uint16_t)(msp430x_readByte(msp430x_registers[MSP430X_REGISTER_PC]) | (msp430x_readByte(msp430x_registers[MSP430X_REGISTER_PC] + 1) << 8));
+    call = ((opcode & 0xFFC0) == 0x1280) || ((opcode >= 0x1340) && (opcode < 0x1400)); // CALL, CALLA
+    returns = (opcode == 0x4130) || (opcode == 0x0110) || (opcode == 0x1300); // RET, RETA, RETI
+    stackPointer = msp430x_registers[MSP430X_REGISTER_SP];
+    startCycles = msp430x_cycles;
+
+    /*** Execute ***/
+    success = msp430x_execute();
+
+    /*** Profile ***/
+    if(success && call)
+        msp430x_pushFrame(msp430x_registers[MSP430X_REGISTER_PC], startCycles, MSP430X_VECTOR_NONE);
+    else if(success && returns)
+        msp430x_popFrames(stackPointer);
+
+    return success;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_writeByte
+ * BRIEF:   Write Byte
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Address
+ * ARG:     Byte: Byte
+ * NOTE:    Debugger Access: No Cycles, No Peripheral Access Callbacks
+ ****************************************************************************************************/
+void msp430x_writeByte(const uint32_t Address, const uint8_t Byte)
+{
+    /*** Write Byte ***/
+    *msp430x_getMemory(Address, 0) = Byte;
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_acceptInterrupt
+ * BRIEF:   Accept Interrupt
+ * RETURN:  Returns Nothing
+ * ARG:     Vector: Vector
+ * NOTE:    PC And SR Are Pushed (PC Bits 19:16 In Bits 15:12 Of The SR Word), SR Is Cleared Except
+ *          SCG0 And PC Is Loaded From The Vector (RAM Copy With SYSRIVECT): 6 Cycles
+ ****************************************************************************************************/
+static void msp430x_acceptInterrupt(const uint8_t Vector)
+{
+    uint32_t programCounter;
+    uint64_t latency, startCycles;
+
+    /*** Vector Statistics ***/
+    startCycles = msp430x_cycles;
+    latency = startCycles - msp430x_interruptRequestCycles[Vector];
+    msp430x_vectors[Vector].count++;
+    msp430x_vectors[Vector].latencyCycles += latency;
+    if(latency > msp430x_vectors[Vector].maximumLatencyCycles)
+        msp430x_vectors[Vector].maximumLatencyCycles = latency;
+
+    /*** Accept Interrupt ***/
+    programCounter = msp430x_registers[MSP430X_REGISTER_PC];
+    msp430x_push(programCounter & 0xFFFF, MSP430X_SIZE_WORD);
+    msp430x_push(((programCounter >> 4) & 0xF000) | (msp430x_registers[MSP430X_REGISTER_SR] & 0x0FFF), MSP430X_SIZE_WORD);
+    msp430x_registers[MSP430X_REGISTER_SR] &= MSP430X_SR_SCG0;
+    if((HW_MEMMAP_REG16(SYS_BASE + OFS_SYSCTL) & SYSRIVECT) == SYSRIVECT)
+        msp430x_registers[MSP430X_REGISTER_PC] = msp430x_read(MSP430X_VECTOR_RAM(Vector), MSP430X_SIZE_WORD);
+    else
+        msp430x_registers[MSP430X_REGISTER_PC] = msp430x_read(MSP430X_VECTOR_ADDRESS(Vector), MSP430X_SIZE_WORD);
+    msp430x_cycles += 6;
+
+    /*** Profile ***/
+    msp430x_pushFrame(msp430x_registers[MSP430X_REGISTER_PC], startCycles, Vector);
+    if(msp430x_interruptCallback != NULL)
+        msp430x_interruptCallback(Vector);
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_accessFram
+ * BRIEF:   Access FRAM
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Address Read
+ * NOTE:    A Read That Misses The Cache Costs NWAITS Wait States; Non-FRAM Addresses Cost Nothing
+ ****************************************************************************************************/
+static void msp430x_accessFram(const uint32_t Address)
+{
+    uint32_t line, waitStates;
+    uint8_t set, way;
+
+    /*** FRAM And Wait States? ***/
+    if(!(((Address >= 0x1800) && (Address < 0x1A00)) || ((Address >= 0x4400) && (Address < 0x24400))))
+        return;
+    waitStates = ((uint32_t)HW_MEMMAP_REG16(FRAM_BASE + OFS_FRCTL0) & NWAITS_7) >> 4;
+    if(waitStates == 0)
+        return;
+
+    /*** Cache Lookup ***/
+    line = Address >> MSP430X_FRAM_CACHE_LINE_SHIFT;
+    set = (uint8_t)(line % MSP430X_FRAM_CACHE_SETS);
+    for(way = 0; way < MSP430X_FRAM_CACHE_WAYS; way++)
+    {
+        if(msp430x_framCacheValid[set][way] && (msp430x_framCacheTag[set][way] == line))
+        {
+            msp430x_framCacheUsed[set] = way;
+            return;
+        }
+    }
+
+    /*** Miss: Wait States, Replace Least Recently Used Way ***/
+    msp430x_cycles += waitStates;
+    way = (uint8_t)((msp430x_framCacheUsed[set] + 1) % MSP430X_FRAM_CACHE_WAYS);
+    msp430x_framCacheTag[set][way] = line;
+    msp430x_framCacheValid[set][way] = true;
+    msp430x_framCacheUsed[set] = way;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_add
+ * BRIEF:   Add
+ * RETURN:  uint32_t: Result
+ * ARG:     Source: Source (Complemented By The Caller For Subtraction)
+ * ARG:     Destination: Destination
+ * ARG:     Carry: Carry In (0 Or 1)
+ * ARG:     Size: Size
+ ****************************************************************************************************/
+static uint32_t msp430x_add(const uint32_t Source, const uint32_t Destination, const uint32_t Carry, const msp430x_size_t Size)
+{
+    uint32_t result, sum;
+
+    /*** Add ***/
+    sum = (Source & msp430x_getMask(Size)) + (Destination & msp430x_getMask(Size)) + Carry;
+    result = sum & msp430x_getMask(Size);
+    msp430x_setFlags(result, Size, sum > msp430x_getMask(Size), ((Source ^ result) & (Destination ^ result) & msp430x_getMostSignificantBit(Size)) != 0);
+
+    return result;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_decimalAdd
+ * BRIEF:   Decimal Add (DADD)
+ * RETURN:  uint32_t: Result
+ * ARG:     Source: Source (BCD)
+ * ARG:     Destination: Destination (BCD)
+ * ARG:     Size: Size
+ * NOTE:    V Is Undefined And Left Unchanged
+ ****************************************************************************************************/
+static uint32_t msp430x_decimalAdd(const uint32_t Source, const uint32_t Destination, const msp430x_size_t Size)
+{
+    uint32_t carry, digit, overflow, result = 0;
+    uint8_t digits, i;
+
+    /*** Decimal Add ***/
+    carry = ((msp430x_registers[MSP430X_REGISTER_SR] & MSP430X_SR_C) == MSP430X_SR_C) ? 1 : 0;
+    digits = (Size == MSP430X_SIZE_BYTE) ? 2 : ((Size == MSP430X_SIZE_WORD) ? 4 : 5);
+    for(i = 0; i < digits; i++)
+    {
+        digit = ((Source >> (4 * i)) & 0xF) + ((Destination >> (4 * i)) & 0xF) + carry;
+        carry = (digit > 9) ? 1 : 0;
+        if(carry == 1)
+            digit -= 10;
+        result |= (digit & 0xF) << (4 * i);
+    }
+    overflow = msp430x_registers[MSP430X_REGISTER_SR] & MSP430X_SR_V;
+    msp430x_setFlags(result, Size, carry == 1, overflow != 0);
+
+    return result;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_execute
+ * BRIEF:   Execute
+ * RETURN:  bool: Success (true) Or Failure (false) Because Of An Illegal Instruction
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+static bool msp430x_execute(void)
+{
+    uint16_t extension = 0, opcode;
+    bool extended = false;
+
+    /*** Fetch (Extension Word Prefixes An Extended Instruction) ***/
+    opcode = msp430x_fetch();
+    if((opcode & 0xF800) == 0x1800)
+    {
+        extension = opcode;
+        extended = true;
+        opcode = msp430x_fetch();
+    }
+
+    /*** Execute ***/
+    if(opcode < 0x1000)
+        return !extended && msp430x_executeAddress(opcode);
+    else if(opcode < 0x1400)
+        return msp430x_executeFormatII(opcode, extension, extended);
+    else if(opcode < 0x1800)
+        return !extended && msp430x_executeMultiple(opcode);
+    else if(opcode < 0x2000)
+        return false; // Extension Word Following Extension Word
+    else if(opcode < 0x4000)
+        return !extended && msp430x_executeJump(opcode);
+    else
+        return msp430x_executeFormatI(opcode, extension, extended);
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_executeAddress
+ * BRIEF:   Execute Address Instruction (MOVA, CMPA, ADDA, SUBA, RRCM, RRAM, RLAM, RRUM)
+ * RETURN:  bool: Success (true) Or Failure (false) Because Of An Illegal Instruction
+ * ARG:     Opcode: Opcode
+ ****************************************************************************************************/
+static bool msp430x_executeAddress(const uint16_t Opcode)
+{
+    uint32_t address, carry, mask, msb, value;
+    uint8_t count, destination, i, source;
+    msp430x_size_t size;
+
+    /*** Decode ***/
+    source = (uint8_t)((Opcode >> 8) & 0xF);
+    destination = (uint8_t)(Opcode & 0xF);
+
+    /*** Execute ***/
+    switch((Opcode >> 4) & 0xF)
+    {
+        case 0x0: // MOVA @Rsrc,Rdst
+        case 0x1: // MOVA @Rsrc+,Rdst (RETA: MOVA @SP+,PC)
+            address = msp430x_registers[source];
+            if(((Opcode >> 4) & 0xF) == 0x1)
+                msp430x_registers[source] = (msp430x_registers[source] + 4) & MSP430X_MASK_ADDRESS;
+            msp430x_writeRegister(destination, msp430x_read(address, MSP430X_SIZE_ADDRESS), MSP430X_SIZE_ADDRESS);
+            msp430x_cycles += (destination == MSP430X_REGISTER_PC) ? 4 : 3;
+            break;
+        case 0x2: // MOVA &abs20,Rdst
+            address = ((uint32_t)source << 16) | msp430x_fetch();
+            msp430x_writeRegister(destination, msp430x_read(address, MSP430X_SIZE_ADDRESS), MSP430X_SIZE_ADDRESS);
+            msp430x_cycles += (destination == MSP430X_REGISTER_PC) ? 5 : 4;
+            break;
+        case 0x3: // MOVA x(Rsrc),Rdst
+            address = msp430x_registers[source];
+            address = (address + msp430x_signExtend(msp430x_fetch(), 0x8000)) & MSP430X_MASK_ADDRESS;
+            msp430x_writeRegister(destination, msp430x_read(address, MSP430X_SIZE_ADDRESS), MSP430X_SIZE_ADDRESS);
+            msp430x_cycles += (destination == MSP430X_REGISTER_PC) ? 5 : 4;
+            break;
+        case 0x4: // RRCM.A, RRAM.A, RLAM.A, RRUM.A
+        case 0x5: // RRCM.W, RRAM.W, RLAM.W, RRUM.W
+            if((Opcode & 0x0020) == 0)
+                return false;
+            count = (uint8_t)(((Opcode >> 10) & 0x3) + 1);
+            size = ((Opcode & 0x0010) == 0x0010) ? MSP430X_SIZE_WORD : MSP430X_SIZE_ADDRESS;
+            mask = msp430x_getMask(size);
+            msb = msp430x_getMostSignificantBit(size);
+            value = msp430x_registers[destination] & mask;
+            carry = msp430x_registers[MSP430X_REGISTER_SR] & MSP430X_SR_C;
+            for(i = 0; i < count; i++)
+            {
+                switch((Opcode >> 8) & 0x3)
+                {
+                    case 0x0: // RRCM
+                        value = (value >> 1) | ((carry != 0) ? msb : 0) | ((value & 1) << 31);
+                        break;
+                    case 0x1: // RRAM
+                        value = (value >> 1) | (value & msb) | ((value & 1) << 31);
+                        break;
+                    case 0x2: // RLAM
+                        value = ((value << 1) & mask) | (((value & msb) != 0) ? 0x80000000u : 0);
+                        break;
+                    default: // RRUM
+                        value = (value >> 1) | ((value & 1) << 31);
+                        break;
+                }
+                carry = value & 0x80000000u;
+                value &= mask;
+            }
+            msp430x_setFlags(value, size, carry != 0, false);
+            msp430x_writeRegister(destination, value, size);
+            msp430x_cycles += count;
+            break;
+        case 0x6: // MOVA Rsrc,&abs20
+            address = ((uint32_t)destination << 16) | msp430x_fetch();
+            msp430x_write(address, msp430x_registers[source], MSP430X_SIZE_ADDRESS);
+            msp430x_cycles += 4;
+            break;
+        case 0x7: // MOVA Rsrc,x(Rdst)
+            address = (msp430x_registers[destination] + msp430x_signExtend(msp430x_fetch(), 0x8000)) & MSP430X_MASK_ADDRESS;
+            msp430x_write(address, msp430x_registers[source], MSP430X_SIZE_ADDRESS);
+            msp430x_cycles += 4;
+            break;
+        case 0x8: // MOVA #imm20,Rdst
+            msp430x_writeRegister(destination, ((uint32_t)source << 16) | msp430x_fetch(), MSP430X_SIZE_ADDRESS);
+            msp430x_cycles += (destination == MSP430X_REGISTER_PC) ? 3 : 2;
+            break;
+        case 0x9: // CMPA #imm20,Rdst
+        case 0xA: // ADDA #imm20,Rdst
+        case 0xB: // SUBA #imm20,Rdst
+        case 0xD: // CMPA Rsrc,Rdst
+        case 0xE: // ADDA Rsrc,Rdst
+        case 0xF: // SUBA Rsrc,Rdst
+            value = ((Opcode & 0x0040) == 0x0040) ? msp430x_registers[source] : (((uint32_t)source << 16) | msp430x_fetch());
+            if(((Opcode >> 4) & 0x3) == 0x2) // ADDA
+                value = msp430x_add(value, msp430x_registers[destination], 0, MSP430X_SIZE_ADDRESS);
+            else
+                value = msp430x_add(~value, msp430x_registers[destination], 1, MSP430X_SIZE_ADDRESS);
+            if(((Opcode >> 4) & 0x3) != 0x1) // Not CMPA
+                msp430x_writeRegister(destination, value, MSP430X_SIZE_ADDRESS);
+            msp430x_cycles += ((Opcode & 0x0040) == 0x0040) ? 1 : 3;
+            break;
+        default: // 0xC: MOVA Rsrc,Rdst
+            msp430x_writeRegister(destination, msp430x_registers[source], MSP430X_SIZE_ADDRESS);
+            msp430x_cycles += (destination == MSP430X_REGISTER_PC) ? 3 : 1;
+            break;
+    }
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_executeFormatI
+ * BRIEF:   Execute Format I (Double Operand) Instruction
+ * RETURN:  bool: Success (true) Or Failure (false) Because Of An Illegal Instruction
+ * ARG:     Opcode: Opcode
+ * ARG:     Extension: Extension Word
+ * ARG:     Extended: Extension Word Present
+ * NOTE:    An Extension Word In Register Mode Can Repeat The Instruction (RPT) And Zero The Carry (ZC)
+ ****************************************************************************************************/
+static bool msp430x_executeFormatI(const uint16_t Opcode, const uint16_t Extension, const bool Extended)
+{
+    msp430x_operand_t destination, source;
+    uint32_t carry, destinationValue, result, sourceValue;
+    uint8_t cycles, destinationClass, operation, repeat = 1;
+    msp430x_size_t size;
+    bool registerMode, zeroCarry = false;
+
+    /*** Decode ***/
+    operation = (uint8_t)(Opcode >> 12);
+    size = msp430x_getSize(Opcode, Extension, Extended);
+    registerMode = ((Opcode & 0x00B0) == 0); // Ad = 0, As = 0
+    if(Extended && registerMode)
+    {
+        repeat = (uint8_t)((((Extension & 0x0080) == 0x0080) ? (msp430x_registers[Extension & 0xF] & 0xF) : (Extension & 0xF)) + 1);
+        zeroCarry = ((Extension & 0x0100) == 0x0100);
+    }
+    msp430x_getOperand((uint8_t)((Opcode >> 4) & 0x3), (uint8_t)((Opcode >> 8) & 0xF), (uint32_t)(Extension >> 7) & 0xF, Extended && !registerMode, size, &source);
+    msp430x_getOperand((uint8_t)(((Opcode >> 7) & 0x1) == 0 ? 0 : 1), (uint8_t)(Opcode & 0xF), (uint32_t)Extension & 0xF, Extended && !registerMode, size, &destination);
+
+    /*** Cycles ***/
+    destinationClass = destination.memory ? 2 : ((destination.registerNumber == MSP430X_REGISTER_PC) ? 1 : 0);
+    cycles = msp430x_formatICycles[source.class][destinationClass];
+    if(destination.memory && ((operation == 0x4) || (operation == 0x9) || (operation == 0xB))) // MOV, CMP, BIT
+        cycles--;
+    if(size == MSP430X_SIZE_ADDRESS)
+        cycles = (uint8_t)(cycles + (source.memory ? 1 : 0) + (destination.memory ? 1 : 0));
+    msp430x_cycles += (uint64_t)cycles * repeat;
+
+    /*** Execute ***/
+    while(repeat-- > 0)
+    {
+        if(zeroCarry)
+            msp430x_registers[MSP430X_REGISTER_SR] &= ~(uint32_t)MSP430X_SR_C;
+        carry = ((msp430x_registers[MSP430X_REGISTER_SR] & MSP430X_SR_C) == MSP430X_SR_C) ? 1 : 0;
+        sourceValue = msp430x_readOperand(&source, size);
+        destinationValue = (operation == 0x4) ? 0 : msp430x_readOperand(&destination, size);
+        switch(operation)
+        {
+            case 0x4: // MOV
+                result = sourceValue;
+                break;
+            case 0x5: // ADD
+                result = msp430x_add(sourceValue, destinationValue, 0, size);
+                break;
+            case 0x6: // ADDC
+                result = msp430x_add(sourceValue, destinationValue, carry, size);
+                break;
+            case 0x7: // SUBC
+                result = msp430x_add(~sourceValue, destinationValue, carry, size);
+                break;
+            case 0x8: // SUB
+            case 0x9: // CMP
+                result = msp430x_add(~sourceValue, destinationValue, 1, size);
+                break;
+            case 0xA: // DADD
+                result = msp430x_decimalAdd(sourceValue, destinationValue, size);
+                break;
+            case 0xC: // BIC
+                result = destinationValue & ~sourceValue;
+                break;
+            case 0xD: // BIS
+                result = destinationValue | sourceValue;
+                break;
+            case 0xE: // XOR
+                result = sourceValue ^ destinationValue;
+                msp430x_setFlags(result, size, result != 0, ((sourceValue & destinationValue & msp430x_getMostSignificantBit(size)) != 0));
+                break;
+            default: // 0xB: BIT, 0xF: AND
+                result = sourceValue & destinationValue;
+                msp430x_setFlags(result, size, result != 0, false);
+                break;
+        }
+        if((operation != 0x9) && (operation != 0xB)) // Not CMP, BIT
+            msp430x_writeOperand(&destination, result, size);
+    }
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_executeFormatII
+ * BRIEF:   Execute Format II (Single Operand) Instruction (RRC, SWPB, RRA, SXT, PUSH, CALL, RETI, CALLA)
+ * RETURN:  bool: Success (true) Or Failure (false) Because Of An Illegal Instruction
+ * ARG:     Opcode: Opcode
+ * ARG:     Extension: Extension Word
+ * ARG:     Extended: Extension Word Present
+ ****************************************************************************************************/
+static bool msp430x_executeFormatII(const uint16_t Opcode, const uint16_t Extension, const bool Extended)
+{
+    msp430x_operand_t operand;
+    uint32_t address, carry, msb, value;
+    uint8_t cycles, mode, operation, registerNumber, repeat = 1;
+    msp430x_size_t size;
+    bool registerMode, zeroCarry = false;
+
+    /*** Decode ***/
+    operation = (uint8_t)((Opcode >> 7) & 0x7);
+    mode = (uint8_t)((Opcode >> 4) & 0x3);
+    registerNumber = (uint8_t)(Opcode & 0xF);
+
+    /*** RETI ***/
+    if(Opcode == 0x1300)
+    {
+        if(Extended)
+            return false;
+        value = msp430x_read(msp430x_registers[MSP430X_REGISTER_SP], MSP430X_SIZE_WORD);
+        address = msp430x_read(msp430x_registers[MSP430X_REGISTER_SP] + 2, MSP430X_SIZE_WORD);
+        msp430x_registers[MSP430X_REGISTER_SP] = (msp430x_registers[MSP430X_REGISTER_SP] + 4) & MSP430X_MASK_ADDRESS;
+        msp430x_registers[MSP430X_REGISTER_SR] = value & 0x0FFF;
+        msp430x_registers[MSP430X_REGISTER_PC] = ((value & 0xF000) << 4) | address;
+        msp430x_cycles += 5;
+        return true;
+    }
+
+    /*** CALLA ***/
+    if(Opcode >= 0x1340)
+    {
+        if(Extended)
+            return false;
+        if(Opcode < 0x1380)
+        {
+            /* Rdst, x(Rdst), @Rdst, @Rdst+ */
+            msp430x_getOperand(mode, registerNumber, 0, false, MSP430X_SIZE_ADDRESS, &operand);
+            value = msp430x_readOperand(&operand, MSP430X_SIZE_ADDRESS);
+            cycles = (mode == 1) ? 6 : 5;
+        }
+        else if((Opcode & 0xFFF0) == 0x1380)
+        {
+            /* &abs20 */
+            address = ((uint32_t)registerNumber << 16) | msp430x_fetch();
+            value = msp430x_read(address, MSP430X_SIZE_ADDRESS);
+            cycles = 6;
+        }
+        else if((Opcode & 0xFFF0) == 0x1390)
+        {
+            /* EDE (x(PC)) */
+            address = msp430x_registers[MSP430X_REGISTER_PC];
+            address = (address + msp430x_signExtend(((uint32_t)registerNumber << 16) | msp430x_fetch(), 0x80000)) & MSP430X_MASK_ADDRESS;
+            value = msp430x_read(address, MSP430X_SIZE_ADDRESS);
+            cycles = 6;
+        }
+        else if((Opcode & 0xFFF0) == 0x13B0)
+        {
+            /* #imm20 */
+            value = ((uint32_t)registerNumber << 16) | msp430x_fetch();
+            cycles = 5;
+        }
+        else
+        {
+            return false;
+        }
+        msp430x_push(msp430x_registers[MSP430X_REGISTER_PC], MSP430X_SIZE_ADDRESS);
+        msp430x_registers[MSP430X_REGISTER_PC] = value & MSP430X_MASK_ADDRESS;
+        msp430x_cycles += cycles;
+        return true;
+    }
+
+    /*** Operand ***/
+    if((operation == 0x6) || (operation == 0x7) || ((Opcode & 0x0040) && ((operation == 0x1) || (operation == 0x3) || (operation == 0x5))))
+        return false; // Reserved, SWPB.B, SXT.B, CALL.B
+    size = msp430x_getSize(Opcode, Extension, Extended);
+    registerMode = (mode == 0);
+    if(Extended && registerMode)
+    {
+        repeat = (uint8_t)((((Extension & 0x0080) == 0x0080) ? (msp430x_registers[Extension & 0xF] & 0xF) : (Extension & 0xF)) + 1);
+        zeroCarry = ((Extension & 0x0100) == 0x0100);
+    }
+    msp430x_getOperand(mode, registerNumber, (uint32_t)Extension & 0xF, Extended && !registerMode, size, &operand);
+
+    /*** Cycles ***/
+    cycles = msp430x_formatIICycles[(operation < 0x4) ? 0 : (operation - 0x3)][operand.class];
+    if((operation == 0x5) && operand.memory && (mode == 1) && (registerNumber == MSP430X_REGISTER_SR)) // CALL &EDE
+        cycles++;
+    if((size == MSP430X_SIZE_ADDRESS) && operand.memory)
+        cycles++;
+    msp430x_cycles += (uint64_t)cycles * repeat;
+
+    /*** Execute ***/
+    msb = msp430x_getMostSignificantBit(size);
+    while(repeat-- > 0)
+    {
+        if(zeroCarry)
+            msp430x_registers[MSP430X_REGISTER_SR] &= ~(uint32_t)MSP430X_SR_C;
+        carry = msp430x_registers[MSP430X_REGISTER_SR] & MSP430X_SR_C;
+        value = msp430x_readOperand(&operand, (operation == 0x5) ? MSP430X_SIZE_WORD : size);
+        switch(operation)
+        {
+            case 0x0: // RRC
+                msp430x_setFlags((value >> 1) | ((carry != 0) ? msb : 0), size, (value & 1) != 0, false);
+                msp430x_writeOperand(&operand, (value >> 1) | ((carry != 0) ? msb : 0), size);
+                break;
+            case 0x1: // SWPB
+                value = (value & 0xF0000) | ((value << 8) & 0xFF00) | ((value >> 8) & 0x00FF);
+                msp430x_writeOperand(&operand, value, size);
+                break;
+            case 0x2: // RRA
+                msp430x_setFlags((value >> 1) | (value & msb), size, (value & 1) != 0, false);
+                msp430x_writeOperand(&operand, (value >> 1) | (value & msb), size);
+                break;
+            case 0x3: // SXT (Register: Bit 7 Extends Through Bit 19)
+                value = msp430x_signExtend(value & 0xFF, 0x80);
+                msp430x_setFlags(value & msp430x_getMask(size), size, (value & msp430x_getMask(size)) != 0, false);
+                if(!operand.memory && !Extended)
+                    msp430x_writeOperand(&operand, value, MSP430X_SIZE_ADDRESS);
+                else
+                    msp430x_writeOperand(&operand, value, size);
+                break;
+            case 0x4: // PUSH
+                msp430x_push(value, size);
+                break;
+            default: // 0x5: CALL
+                msp430x_push(msp430x_registers[MSP430X_REGISTER_PC] & 0xFFFF, MSP430X_SIZE_WORD);
+                msp430x_registers[MSP430X_REGISTER_PC] = value & 0xFFFE;
+                break;
+        }
+    }
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_executeJump
+ * BRIEF:   Execute Jump Instruction
+ * RETURN:  bool: Success (true)
+ * ARG:     Opcode: Opcode
+ ****************************************************************************************************/
+static bool msp430x_executeJump(const uint16_t Opcode)
+{
+    uint32_t sr;
+    bool negative, overflow, taken;
+
+    /*** Condition ***/
+    sr = msp430x_registers[MSP430X_REGISTER_SR];
+    negative = ((sr & MSP430X_SR_N) == MSP430X_SR_N);
+    overflow = ((sr & MSP430X_SR_V) == MSP430X_SR_V);
+    switch((Opcode >> 10) & 0x7)
+    {
+        case 0x0: // JNE
+            taken = ((sr & MSP430X_SR_Z) == 0);
+            break;
+        case 0x1: // JEQ
+            taken = ((sr & MSP430X_SR_Z) == MSP430X_SR_Z);
+            break;
+        case 0x2: // JNC
+            taken = ((sr & MSP430X_SR_C) == 0);
+            break;
+        case 0x3: // JC
+            taken = ((sr & MSP430X_SR_C) == MSP430X_SR_C);
+            break;
+        case 0x4: // JN
+            taken = negative;
+            break;
+        case 0x5: // JGE
+            taken = (negative == overflow);
+            break;
+        case 0x6: // JL
+            taken = (negative != overflow);
+            break;
+        default: // JMP
+            taken = true;
+            break;
+    }
+
+    /*** Jump (Taken Or Not, 2 Cycles) ***/
+    if(taken)
+        msp430x_registers[MSP430X_REGISTER_PC] = (msp430x_registers[MSP430X_REGISTER_PC] + (2 * msp430x_signExtend(Opcode & 0x3FF, 0x200))) & MSP430X_MASK_ADDRESS;
+    msp430x_cycles += 2;
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_executeMultiple
+ * BRIEF:   Execute Multiple Register Instruction (PUSHM, POPM)
+ * RETURN:  bool: Success (true)
+ * ARG:     Opcode: Opcode
+ * NOTE:    PUSHM Pushes Rn Down To Rn-Count+1; POPM Encodes Rdst-Count+1 And Pops Upwards From It
+ ****************************************************************************************************/
+static bool msp430x_executeMultiple(const uint16_t Opcode)
+{
+    uint8_t count, i, registerNumber;
+    msp430x_size_t size;
+
+    /*** Decode ***/
+    count = (uint8_t)(((Opcode >> 4) & 0xF) + 1);
+    registerNumber = (uint8_t)(Opcode & 0xF);
+    size = ((Opcode & 0x0100) == 0x0100) ? MSP430X_SIZE_WORD : MSP430X_SIZE_ADDRESS;
+
+    /*** Execute ***/
+    for(i = 0; i < count; i++)
+    {
+        if(Opcode < 0x1600)
+        {
+            /* PUSHM */
+            msp430x_push(msp430x_registers[(registerNumber - i) & 0xF], size);
+        }
+        else
+        {
+            /* POPM */
+            msp430x_writeRegister((uint8_t)((registerNumber + i) & 0xF), msp430x_read(msp430x_registers[MSP430X_REGISTER_SP], size), size);
+            msp430x_registers[MSP430X_REGISTER_SP] = (msp430x_registers[MSP430X_REGISTER_SP] + ((size == MSP430X_SIZE_ADDRESS) ? 4 : 2)) & MSP430X_MASK_ADDRESS;
+        }
+    }
+    msp430x_cycles += 2u + ((size == MSP430X_SIZE_ADDRESS) ? (2u * count) : count);
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_fetch
+ * BRIEF:   Fetch
+ * RETURN:  uint16_t: Instruction Word At PC (PC Is Incremented)
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+static uint16_t msp430x_fetch(void)
+{
+    uint16_t word;
+
+    /*** Fetch ***/
+    word = (uint16_t)msp430x_read(msp430x_registers[MSP430X_REGISTER_PC], MSP430X_SIZE_WORD);
+    msp430x_registers[MSP430X_REGISTER_PC] = (msp430x_registers[MSP430X_REGISTER_PC] + 2) & MSP430X_MASK_ADDRESS;
+
+    return word;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_getFunctionIndex
+ * BRIEF:   Get Function Index
+ * RETURN:  size_t: Function Index (MSP430X_FUNCTION_NONE: Table Full)
+ * ARG:     Address: Address Within The Function
+ * NOTE:    Addresses Outside Every Known Function Are Added As Functions Named By Their Address
+ ****************************************************************************************************/
+static size_t msp430x_getFunctionIndex(const uint32_t Address)
+{
+    const msp430x_function_t *function;
+    size_t high, low, middle;
+    char name[MSP430X_FUNCTION_NAME_LENGTH];
+
+    /*** Binary Search (Last Function Starting At Or Below Address) ***/
+    low = 0;
+    high = msp430x_functionCount;
+    while(low < high)
+    {
+        middle = (low + high) / 2;
+        if(msp430x_functions[msp430x_functionOrder[middle]].address <= Address)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    if(low > 0)
+    {
+        function = &msp430x_functions[msp430x_functionOrder[low - 1]];
+        if((function->address == Address) || ((Address - function->address) < function->size))
+            return msp430x_functionOrder[low - 1];
+    }
+
+    /*** Unknown Function ***/
+    (void)snprintf(name, sizeof(name), "0x%05lX", (unsigned long)Address);
+    if(!msp430x_addFunction(name, Address, 0))
+        return MSP430X_FUNCTION_NONE;
+
+    return msp430x_functionCount - 1;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_getIndexedAddress
+ * BRIEF:   Get Indexed Address (x(Rn), Symbolic x(PC), Absolute &x)
+ * RETURN:  uint32_t: Address
+ * ARG:     Register: Register (PC: Symbolic, SR: Absolute)
+ * ARG:     High: Extension Word Index Bits 19:16
+ * ARG:     Extended: Extension Word Present (20-Bit Index)
+ * NOTE:    Without An Extension Word, The Address Wraps At 64 KB When The Base Is Below 64 KB
+ ****************************************************************************************************/
+static uint32_t msp430x_getIndexedAddress(const uint8_t Register, const uint32_t High, const bool Extended)
+{
+    uint32_t base, index;
+
+    /*** Get Indexed Address ***/
+    base = msp430x_registers[Register]; // PC: Address Of The Index Word
+    index = msp430x_fetch();
+    if(Register == MSP430X_REGISTER_SR)
+        return Extended ? ((High << 16) | index) : index;
+    if(Extended)
+        return (base + msp430x_signExtend((High << 16) | index, 0x80000)) & MSP430X_MASK_ADDRESS;
+    if(base < 0x10000)
+        return (base + index) & 0xFFFF;
+
+    return (base + msp430x_signExtend(index, 0x8000)) & MSP430X_MASK_ADDRESS;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_getMask
+ * BRIEF:   Get Mask
+ * RETURN:  uint32_t: Mask
+ * ARG:     Size: Size
+ ****************************************************************************************************/
+static uint32_t msp430x_getMask(const msp430x_size_t Size)
+{
+    /*** Get Mask ***/
+    return (Size == MSP430X_SIZE_BYTE) ? 0xFFu : ((Size == MSP430X_SIZE_WORD) ? 0xFFFFu : MSP430X_MASK_ADDRESS);
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_getMemory
+ * BRIEF:   Get Memory
+ * RETURN:  uint8_t *: Memory
+ * ARG:     Address: Address (20 Bits)
+ * ARG:     Size: CPU Bus Access Size In Bytes (Peripheral Access Callbacks And Models Are Called) Or 0
+ *          For Debugger Access
+ ****************************************************************************************************/
+static uint8_t *msp430x_getMemory(const uint32_t Address, const uint8_t Size)
+{
+    uint32_t address;
+
+    /*** Get Memory ***/
+    address = Address & MSP430X_MASK_ADDRESS;
+    if(address >= 0x10000)
+        return &msp430x_upperMemory[address - 0x10000];
+    if((Size != 0) && (address < MSP430X_PERIPHERAL_MAXIMUM))
+        return hwMemmap_access(address, Size);
+
+    return &hwMemmap_memory[address];
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_getMostSignificantBit
+ * BRIEF:   Get Most Significant Bit
+ * RETURN:  uint32_t: Most Significant Bit
+ * ARG:     Size: Size
+ ****************************************************************************************************/
+static uint32_t msp430x_getMostSignificantBit(const msp430x_size_t Size)
+{
+    /*** Get Most Significant Bit ***/
+    return (Size == MSP430X_SIZE_BYTE) ? 0x80u : ((Size == MSP430X_SIZE_WORD) ? 0x8000u : 0x80000u);
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_getOperand
+ * BRIEF:   Get Operand
+ * RETURN:  Returns Nothing
+ * ARG:     Mode: Addressing Mode (As; Ad Is 0 Or 1)
+ * ARG:     Register: Register
+ * ARG:     High: Extension Word Bits 19:16 For Index, Absolute Address Or Immediate
+ * ARG:     Extended: Extension Word Present (Non-Register Mode)
+ * ARG:     Size: Size
+ * ARG:     Operand: Operand
+ * NOTE:    R2 And R3 Generate The Constants 0, 1, 2, 4, 8 And -1; Index Words Are Fetched Here
+ ****************************************************************************************************/
+static void msp430x_getOperand(const uint8_t Mode, const uint8_t Register, const uint32_t High, const bool Extended, const msp430x_size_t Size, msp430x_operand_t * const Operand)
+{
+    static const uint32_t constants[2][4] = {{0, 0, 4, 8}, {0, 1, 2, 0xFFFFFFFFu}}; // [R2, R3][As]
+
+    /*** Defaults ***/
+    (void)memset(Operand, 0, sizeof(*Operand));
+    Operand->registerNumber = Register;
+    Operand->class = MSP430X_CLASS_REGISTER;
+
+    /*** Constant Generator ***/
+    if(((Register == 3) && (Mode != 0)) || ((Register == MSP430X_REGISTER_SR) && (Mode >= 2)))
+    {
+        Operand->value = constants[Register - 2][Mode];
+        Operand->registerNumber = 3; // Read-Only
+        return;
+    }
+
+    /*** Addressing Mode ***/
+    switch(Mode)
+    {
+        case 0: // Rn
+            break;
+        case 1: // x(Rn), EDE, &EDE
+            Operand->address = msp430x_getIndexedAddress(Register, High, Extended);
+            Operand->class = MSP430X_CLASS_INDEXED;
+            Operand->memory = true;
+            break;
+        case 2: // @Rn
+            Operand->address = msp430x_registers[Register];
+            Operand->class = MSP430X_CLASS_INDIRECT;
+            Operand->memory = true;
+            break;
+        default: // @Rn+, #N
+            if(Register == MSP430X_REGISTER_PC)
+            {
+                Operand->value = msp430x_fetch() | (Extended ? (High << 16) : 0);
+                Operand->class = MSP430X_CLASS_IMMEDIATE;
+                Operand->registerNumber = 3; // Read-Only
+            }
+            else
+            {
+                Operand->address = msp430x_registers[Register];
+                Operand->class = MSP430X_CLASS_INDIRECT;
+                Operand->memory = true;
+                msp430x_registers[Register] = (msp430x_registers[Register] + ((Size == MSP430X_SIZE_ADDRESS) ? 4u : (((Size == MSP430X_SIZE_WORD) || (Register == MSP430X_REGISTER_SP)) ? 2u : 1u))) & MSP430X_MASK_ADDRESS;
+            }
+            break;
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_getSize
+ * BRIEF:   Get Size
+ * RETURN:  msp430x_size_t: Size
+ * ARG:     Opcode: Opcode (B/W Bit 6)
+ * ARG:     Extension: Extension Word (A/L Bit 6)
+ * ARG:     Extended: Extension Word Present
+ ****************************************************************************************************/
+static msp430x_size_t msp430x_getSize(const uint16_t Opcode, const uint16_t Extension, const bool Extended)
+{
+    /*** Get Size ***/
+    if((Opcode & 0x0040) == 0x0040)
+        return (Extended && ((Extension & 0x0040) == 0)) ? MSP430X_SIZE_ADDRESS : MSP430X_SIZE_BYTE;
+
+    return MSP430X_SIZE_WORD;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_getUnsigned
+ * BRIEF:   Get Unsigned
+ * RETURN:  uint32_t: Little Endian Value
+ * ARG:     Bytes: Bytes
+ * ARG:     Length: Number Of Bytes (1 To 4)
+ ****************************************************************************************************/
+static uint32_t msp430x_getUnsigned(const uint8_t * const Bytes, const uint8_t Length)
+{
+    uint32_t value = 0;
+    uint8_t i;
+
+    /*** Get Unsigned ***/
+    for(i = Length; i > 0; i--)
+        value = (value << 8) | Bytes[i - 1];
+
+    return value;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_popFrames
+ * BRIEF:   Pop Frames
+ * RETURN:  Returns Nothing
+ * ARG:     StackPointer: Stack Pointer Before The Return Instruction
+ * NOTE:    Every Frame At Or Below The Stack Pointer Returns, So Tail Calls And longjmp() Unwind
+ ****************************************************************************************************/
+static void msp430x_popFrames(const uint32_t StackPointer)
+{
+    msp430x_function_t *function;
+    msp430x_frame_t *frame;
+    msp430x_vector_t *vector;
+    uint64_t cycles;
+
+    /*** Pop Frames ***/
+    while((msp430x_frameDepth > 0) && (msp430x_frames[msp430x_frameDepth - 1].stackPointer <= StackPointer))
+    {
+        frame = &msp430x_frames[--msp430x_frameDepth];
+        cycles = msp430x_cycles - frame->startCycles;
+
+        /* Function */
+        if(frame->function != MSP430X_FUNCTION_NONE)
+        {
+            function = &msp430x_functions[frame->function];
+            function->calls++;
+            function->inclusiveCycles += cycles;
+            function->exclusiveCycles += cycles - frame->childCycles;
+            if(cycles > function->maximumCycles)
+                function->maximumCycles = cycles;
+            if(cycles < function->minimumCycles)
+                function->minimumCycles = cycles;
+        }
+
+        /* Vector */
+        if(frame->vector != MSP430X_VECTOR_NONE)
+        {
+            vector = &msp430x_vectors[frame->vector];
+            vector->cycles += cycles;
+            if(cycles > vector->maximumCycles)
+                vector->maximumCycles = cycles;
+            if(cycles < vector->minimumCycles)
+                vector->minimumCycles = cycles;
+        }
+
+        /* Caller */
+        if(msp430x_frameDepth > 0)
+            msp430x_frames[msp430x_frameDepth - 1].childCycles += cycles;
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_push
+ * BRIEF:   Push
+ * RETURN:  Returns Nothing
+ * ARG:     Value: Value
+ * ARG:     Size: Size (Address: Two Words, Bits 19:16 At The Higher Address)
+ ****************************************************************************************************/
+static void msp430x_push(const uint32_t Value, const msp430x_size_t Size)
+{
+    /*** Push ***/
+    msp430x_registers[MSP430X_REGISTER_SP] = (msp430x_registers[MSP430X_REGISTER_SP] - ((Size == MSP430X_SIZE_ADDRESS) ? 4u : 2u)) & MSP430X_MASK_ADDRESS;
+    msp430x_write(msp430x_registers[MSP430X_REGISTER_SP], Value, Size);
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_pushFrame
+ * BRIEF:   Push Frame
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Called Address
+ * ARG:     StartCycles: Cycles Before The Call Or Interrupt Acceptance
+ * ARG:     Vector: Interrupt Vector (MSP430X_VECTOR_NONE: Call)
+ ****************************************************************************************************/
+static void msp430x_pushFrame(const uint32_t Address, const uint64_t StartCycles, const uint8_t Vector)
+{
+    msp430x_frame_t *frame;
+
+    /*** Error Check ***/
+    if(msp430x_frameDepth >= MSP430X_CALL_DEPTH)
+        return;
+
+    /*** Push Frame ***/
+    frame = &msp430x_frames[msp430x_frameDepth++];
+    frame->childCycles = 0;
+    frame->function = msp430x_getFunctionIndex(Address);
+    frame->stackPointer = msp430x_registers[MSP430X_REGISTER_SP];
+    frame->startCycles = StartCycles;
+    frame->vector = Vector;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_read
+ * BRIEF:   Read
+ * RETURN:  uint32_t: Value
+ * ARG:     Address: Address (Words Are Aligned)
+ * ARG:     Size: Size
+ ****************************************************************************************************/
+static uint32_t msp430x_read(const uint32_t Address, const msp430x_size_t Size)
+{
+    uint8_t *memory;
+    uint32_t address, value;
+
+    /*** Byte ***/
+    msp430x_accessFram(Address & MSP430X_MASK_ADDRESS);
+    if(Size == MSP430X_SIZE_BYTE)
+        return *msp430x_getMemory(Address, 1);
+
+    /*** Word ***/
+    address = Address & (MSP430X_MASK_ADDRESS - 1);
+    memory = msp430x_getMemory(address, 2);
+    value = (uint32_t)memory[0] | ((uint32_t)memory[1] << 8);
+
+    /*** Address (Second Word Holds Bits 19:16) ***/
+    if(Size == MSP430X_SIZE_ADDRESS)
+    {
+        msp430x_accessFram(address + 2);
+        memory = msp430x_getMemory(address + 2, 2);
+        value |= ((uint32_t)memory[0] & 0xF) << 16;
+    }
+
+    return value;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_readOperand
+ * BRIEF:   Read Operand
+ * RETURN:  uint32_t: Value
+ * ARG:     Operand: Operand
+ * ARG:     Size: Size
+ ****************************************************************************************************/
+static uint32_t msp430x_readOperand(const msp430x_operand_t * const Operand, const msp430x_size_t Size)
+{
+    /*** Read Operand ***/
+    if(Operand->memory)
+        return msp430x_read(Operand->address, Size);
+    if(Operand->registerNumber == 3)
+        return Operand->value & msp430x_getMask(Size);
+
+    return msp430x_registers[Operand->registerNumber] & msp430x_getMask(Size);
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_setFlags
+ * BRIEF:   Set Flags (N, Z, C, V)
+ * RETURN:  Returns Nothing
+ * ARG:     Result: Result
+ * ARG:     Size: Size
+ * ARG:     Carry: Carry
+ * ARG:     Overflow: Overflow
+ ****************************************************************************************************/
+static void msp430x_setFlags(const uint32_t Result, const msp430x_size_t Size, const bool Carry, const bool Overflow)
+{
+    uint32_t sr;
+
+    /*** Set Flags ***/
+    sr = msp430x_registers[MSP430X_REGISTER_SR] & ~(uint32_t)(MSP430X_SR_C | MSP430X_SR_Z | MSP430X_SR_N | MSP430X_SR_V);
+    if(Carry)
+        sr |= MSP430X_SR_C;
+    if((Result & msp430x_getMask(Size)) == 0)
+        sr |= MSP430X_SR_Z;
+    if((Result & msp430x_getMostSignificantBit(Size)) != 0)
+        sr |= MSP430X_SR_N;
+    if(Overflow)
+        sr |= MSP430X_SR_V;
+    msp430x_registers[MSP430X_REGISTER_SR] = sr;
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_signExtend
+ * BRIEF:   Sign Extend
+ * RETURN:  uint32_t: Sign Extended Value (Two's Complement, 32 Bits)
+ * ARG:     Value: Value
+ * ARG:     MostSignificantBit: Sign Bit
+ ****************************************************************************************************/
+static uint32_t msp430x_signExtend(const uint32_t Value, const uint32_t MostSignificantBit)
+{
+    /*** Sign Extend ***/
+    return ((Value & MostSignificantBit) != 0) ? (Value | ~((MostSignificantBit << 1) - 1)) : (Value & ((MostSignificantBit << 1) - 1));
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_write
+ * BRIEF:   Write
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Address (Words Are Aligned)
+ * ARG:     Value: Value
+ * ARG:     Size: Size
+ ****************************************************************************************************/
+static void msp430x_write(const uint32_t Address, const uint32_t Value, const msp430x_size_t Size)
+{
+    uint8_t *memory;
+    uint32_t address;
+
+    /*** Byte ***/
+    if(Size == MSP430X_SIZE_BYTE)
+    {
+        *msp430x_getMemory(Address, 1) = (uint8_t)Value;
+        return;
+    }
+
+    /*** Word ***/
+    address = Address & (MSP430X_MASK_ADDRESS - 1);
+    memory = msp430x_getMemory(address, 2);
+    memory[0] = (uint8_t)Value;
+    memory[1] = (uint8_t)(Value >> 8);
+
+    /*** Address (Second Word Holds Bits 19:16) ***/
+    if(Size == MSP430X_SIZE_ADDRESS)
+    {
+        memory = msp430x_getMemory(address + 2, 2);
+        memory[0] = (uint8_t)((Value >> 16) & 0xF);
+        memory[1] = 0;
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_writeOperand
+ * BRIEF:   Write Operand
+ * RETURN:  Returns Nothing
+ * ARG:     Operand: Operand
+ * ARG:     Value: Value
+ * ARG:     Size: Size
+ ****************************************************************************************************/
+static void msp430x_writeOperand(const msp430x_operand_t * const Operand, const uint32_t Value, const msp430x_size_t Size)
+{
+    /*** Write Operand ***/
+    if(Operand->memory)
+        msp430x_write(Operand->address, Value, Size);
+    else
+        msp430x_writeRegister(Operand->registerNumber, Value, Size);
+}
+
+/****************************************************************************************************
+ * FUNCT:   msp430x_writeRegister
+ * BRIEF:   Write Register
+ * RETURN:  Returns Nothing
+ * ARG:     Register: Register (R3 Is Read-Only)
+ * ARG:     Value: Value
+ * ARG:     Size: Size (Byte And Word Writes Clear The Upper Register Bits)
+ ****************************************************************************************************/
+static void msp430x_writeRegister(const uint8_t Register, const uint32_t Value, const msp430x_size_t Size)
+{
+    uint32_t value;
+
+    /*** Write Register ***/
+    if(Register == 3)
+        return;
+    value = Value & msp430x_getMask(Size);
+    if(Register == MSP430X_REGISTER_SR)
+        value &= 0x0FFF;
+    else if((Register == MSP430X_REGISTER_PC) || (Register == MSP430X_REGISTER_SP))
+        value &= ~1u;
+    msp430x_registers[Register] = value;
+}
@@ -0,0 +1,94 @@
+/****************************************************************************************************
+ * FILE:    msp430x.h
+ * BRIEF:   MSP430X CPU Emulator Header File
+ ****************************************************************************************************/
+
+#ifndef MSP430X_H
+#define MSP430X_H
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define MSP430X_CALL_DEPTH           (256)
+#define MSP430X_FUNCTION_COUNT       (2048)
+#define MSP430X_FUNCTION_NAME_LENGTH (64)
+#define MSP430X_MEMORY_SIZE          (0x100000) // 20-Bit Address Space
+#define MSP430X_REGISTER_COUNT       (16)
+#define MSP430X_REGISTER_PC          (0)
+#define MSP430X_REGISTER_SP          (1)
+#define MSP430X_REGISTER_SR          (2)
+#define MSP430X_RETURN_ADDRESS       (0x00004) // msp430x_call() Return Address (Never Executed, Peripheral Space)
+#define MSP430X_SR_C                 (0x0001)
+#define MSP430X_SR_Z                 (0x0002)
+#define MSP430X_SR_N                 (0x0004)
+#define MSP430X_SR_GIE               (0x0008)
+#define MSP430X_SR_CPUOFF            (0x0010)
+#define MSP430X_SR_SCG0              (0x0040)
+#define MSP430X_SR_V                 (0x0100)
+#define MSP430X_VECTOR_ADDRESS(v)    (0xFF90u + (2u * (v))) // Vector Numbers As In msp430fr6989.h (e.g. USCI_A1_VECTOR)
+#define MSP430X_VECTOR_RAM(v)        (0x2390u + (2u * (v))) // SYSRIVECT: Same Layout, Ending At The Top Of RAM
+#define MSP430X_VECTOR_COUNT         (56)
+#define MSP430X_VECTOR_NMI_MINIMUM   (53) // UNMI_VECTOR, SYSNMI_VECTOR (Not Masked By GIE)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef struct msp430x_function_s
+{
+    uint32_t address;
+    uint64_t calls;
+    uint64_t exclusiveCycles; // Excludes Called Functions And Interrupts
+    uint64_t inclusiveCycles; // Includes Called Functions And Interrupts
+    uint64_t maximumCycles;   // Inclusive, Per Call
+    uint64_t minimumCycles;   // Inclusive, Per Call
+    char name[MSP430X_FUNCTION_NAME_LENGTH];
+    uint32_t size;
+} msp430x_function_t;
+
+typedef struct msp430x_vector_s
+{
+    uint64_t count;
+    uint64_t cycles;           // Acceptance Through RETI, Including Nested Interrupts
+    uint64_t latencyCycles;    // Request To Acceptance
+    uint64_t maximumCycles;
+    uint64_t maximumLatencyCycles;
+    uint64_t minimumCycles;
+} msp430x_vector_t;
+
+typedef void (*msp430x_interruptCallback_t)(const uint8_t Vector);
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern bool msp430x_addFunction(const char * const Name, const uint32_t Address, const uint32_t Size);
+extern bool msp430x_call(const uint32_t Address, const uint16_t * const Arguments, const uint8_t ArgumentCount, const uint64_t MaximumCycles, uint64_t * const Cycles);
+extern const msp430x_function_t *msp430x_findFunction(const char * const Name);
+extern uint64_t msp430x_getCycles(void);
+extern const msp430x_function_t *msp430x_getFunction(const size_t Index);
+extern size_t msp430x_getFunctionCount(void);
+extern uint32_t msp430x_getRegister(const uint8_t Register);
+extern const msp430x_vector_t *msp430x_getVector(const uint8_t Vector);
+extern void msp430x_init(void);
+extern bool msp430x_loadElf(const char * const Path);
+extern uint8_t msp430x_readByte(const uint32_t Address);
+extern void msp430x_reset(void);
+extern void msp430x_resetProfile(void);
+extern void msp430x_setInterruptCallback(const msp430x_interruptCallback_t Callback);
+extern void msp430x_setInterruptRequest(const uint8_t Vector, const bool Request);
+extern void msp430x_setRegister(const uint8_t Register, const uint32_t Value);
+extern void msp430x_stall(const uint32_t Cycles);
+extern bool msp430x_step(void);
+extern void msp430x_writeByte(const uint32_t Address, const uint8_t Byte);
+
+#endif
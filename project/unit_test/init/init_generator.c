@@ -0,0 +1,406 @@
+/****************************************************************************************************
+ * FILE:    init_generator.c
+ * BRIEF:   Init Generator Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define INIT_GENERATOR_NAME_LENGTH (32)
+#define INIT_GENERATOR_RUN_COUNT   (2) // Fills: 0x00, 0xFF
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "button_driver.h"
+#include "cli_callback.h"
+#include "inc/hw_memmap.h"
+#include "init_driver.h"
+#include "init_generator.h"
+#include "lcd_driver.h"
+#include "led_driver.h"
+#include "system.h"
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef struct initGenerator_access_s
+{
+    uint16_t address; // Word Aligned
+    uint16_t before;
+    uint16_t after;   // At The Next Access (Or The End Of The Script)
+} initGenerator_access_t;
+
+typedef struct initGenerator_run_s
+{
+    initGenerator_access_t access[INIT_GENERATOR_ACCESS_MAXIMUM];
+    uint16_t count;
+    bool overflow;
+    bool stray;          // Access Outside Peripheral Space
+    uint32_t strayAddress;
+} initGenerator_run_t;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void initGenerator_accessCallback(const uint32_t Address);
+static void initGenerator_printLine(FILE * const File, const char * const Format, ...);
+static void initGenerator_record(const initGenerator_script_t * const Script, const uint8_t Fill, initGenerator_run_t * const Run);
+static void initGenerator_upper(const char * const Name, char * const Upper);
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+const initGenerator_script_t initGenerator_script[INIT_GENERATOR_SCRIPT_COUNT] =
+{
+    {"button", buttonDriver_configure},
+    {"cli",    cliCallback_configure},
+    {"lcd",    lcdDriver_configure},
+    {"led",    ledDriver_configure},
+    {"lfxt",   system_configureLFXT}
+};
+
+static initGenerator_run_t *initGenerator_recording = NULL;
+static initGenerator_run_t initGenerator_run[INIT_GENERATOR_RUN_COUNT];
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   initGenerator_fill
+ * BRIEF:   Fill
+ * RETURN:  Returns Nothing
+ * ARG:     Value: Value Of Every Peripheral Space Byte
+ * NOTE:    Resets The Simulator First (hwMemmap_init())
+ ****************************************************************************************************/
+void initGenerator_fill(const uint8_t Value)
+{
+    /*** Fill ***/
+    hwMemmap_init();
+    (void)memset(&hwMemmap_memory[INIT_GENERATOR_PERIPHERAL_START], Value, INIT_GENERATOR_PERIPHERAL_END - INIT_GENERATOR_PERIPHERAL_START);
+}
+
+/****************************************************************************************************
+ * FUNCT:   initGenerator_generate
+ * BRIEF:   Generate
+ * RETURN:  bool: Generated (true) Or Not (false, Reason On stderr)
+ * ARG:     Script: Script
+ * ARG:     Table: Table (INIT_GENERATOR_ENTRY_MAXIMUM Entries)
+ * ARG:     Length: Number Of Entries
+ * NOTE:    One Entry Per Access That Changed Its Register, In driverlib Order; Entries Aren't Merged,
+ *          So Strobes (TACLR) And Reset Sequencing (UCSWRST) Keep Their Meaning On The Target
+ * NOTE:    Entries Are Word Wide (Byte Registers Are Word Accessible In Pairs, e.g. PADIR)
+ ****************************************************************************************************/
+bool initGenerator_generate(const initGenerator_script_t * const Script, initDriver_entry_t * const Table, uint16_t * const Length)
+{
+    uint16_t changed, determined, i;
+    const initGenerator_access_t *access[INIT_GENERATOR_RUN_COUNT];
+
+    /*** Record ***/
+    initGenerator_record(Script, 0x00, &initGenerator_run[0]);
+    initGenerator_record(Script, 0xFF, &initGenerator_run[1]);
+    for(i = 0; i < INIT_GENERATOR_RUN_COUNT; i++)
+    {
+        if(initGenerator_run[i].overflow)
+        {
+            (void)fprintf(stderr, "%s: More Than %u Accesses\n", Script->name, INIT_GENERATOR_ACCESS_MAXIMUM);
+            return false;
+        }
+        if(initGenerator_run[i].stray)
+        {
+            (void)fprintf(stderr, "%s: Access Outside Peripheral Space (0x%05X)\n", Script->name, (unsigned int)initGenerator_run[i].strayAddress);
+            return false;
+        }
+    }
+    if(initGenerator_run[0].count != initGenerator_run[1].count)
+    {
+        (void)fprintf(stderr, "%s: %u Or %u Accesses (Control Flow Depends On Register Contents)\n", Script->name, initGenerator_run[0].count, initGenerator_run[1].count);
+        return false;
+    }
+
+    /*** Entries ***/
+    *Length = 0;
+    for(i = 0; i < initGenerator_run[0].count; i++)
+    {
+        access[0] = &initGenerator_run[0].access[i];
+        access[1] = &initGenerator_run[1].access[i];
+        if(access[0]->address != access[1]->address)
+        {
+            (void)fprintf(stderr, "%s: Access %u Is 0x%04X Or 0x%04X (Control Flow Depends On Register Contents)\n", Script->name, i, access[0]->address, access[1]->address);
+            return false;
+        }
+
+        /* Bits Changed In Either Run Must End Up Equal In Both (Written, Not Toggled) */
+        changed = (uint16_t)((access[0]->before ^ access[0]->after) | (access[1]->before ^ access[1]->after));
+        if(changed == 0)
+            continue;
+        determined = (uint16_t)~(access[0]->after ^ access[1]->after);
+        if((changed & (uint16_t)~determined) != 0)
+        {
+            (void)fprintf(stderr, "%s: Access %u (0x%04X) Depends On Register Contents (Bits 0x%04X)\n", Script->name, i, access[0]->address, changed & (uint16_t)~determined);
+            return false;
+        }
+        if(*Length >= INIT_GENERATOR_ENTRY_MAXIMUM)
+        {
+            (void)fprintf(stderr, "%s: More Than %u Entries\n", Script->name, INIT_GENERATOR_ENTRY_MAXIMUM);
+            return false;
+        }
+        Table[*Length].address = access[0]->address;
+        Table[*Length].andMask = (uint16_t)~determined;
+        Table[*Length].orValue = access[0]->after & determined;
+        (*Length)++;
+    }
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   initGenerator_write
+ * BRIEF:   Write
+ * RETURN:  bool: Written (true) Or Not (false, Reason On stderr)
+ * ARG:     SourcePath: Source File (init_driver_table.c)
+ * ARG:     HeaderPath: Header File (init_driver_table.h)
+ * NOTE:    Every Script Is Generated Before Anything Is Written; CRLF Line Endings, Like The Tree
+ ****************************************************************************************************/
+bool initGenerator_write(const char * const SourcePath, const char * const HeaderPath)
+{
+    char upper[INIT_GENERATOR_NAME_LENGTH];
+    static initDriver_entry_t table[INIT_GENERATOR_SCRIPT_COUNT][INIT_GENERATOR_ENTRY_MAXIMUM];
+    uint16_t i, j, length[INIT_GENERATOR_SCRIPT_COUNT];
+    size_t width;
+    FILE *header, *source;
+
+    /*** Generate ***/
+    for(i = 0; i < INIT_GENERATOR_SCRIPT_COUNT; i++)
+    {
+        if(!initGenerator_generate(&initGenerator_script[i], table[i], &length[i]))
+            return false;
+        if(length[i] == 0)
+        {
+            (void)fprintf(stderr, "%s: No Entries\n", initGenerator_script[i].name);
+            return false;
+        }
+    }
+
+    /*** Column Width (Longest Name) ***/
+    width = 0;
+    for(i = 0; i < INIT_GENERATOR_SCRIPT_COUNT; i++)
+    {
+        if(strlen(initGenerator_script[i].name) > width)
+            width = strlen(initGenerator_script[i].name);
+    }
+
+    /*** Open ***/
+    header = fopen(HeaderPath, "wb");
+    if(header == NULL)
+    {
+        perror(HeaderPath);
+        return false;
+    }
+    source = fopen(SourcePath, "wb");
+    if(source == NULL)
+    {
+        perror(SourcePath);
+        (void)fclose(header);
+        return false;
+    }
+
+    /*** Header ***/
+    initGenerator_printLine(header, "/****************************************************************************************************");
+    initGenerator_printLine(header, " * FILE:    init_driver_table.h");
+    initGenerator_printLine(header, " * BRIEF:   Init Driver Table Header File");
+    initGenerator_printLine(header, " * NOTE:    Generated By init_generator (\"make init_table\" In project/unit_test); Do Not Edit");
+    initGenerator_printLine(header, " ****************************************************************************************************/");
+    initGenerator_printLine(header, "");
+    initGenerator_printLine(header, "#ifndef INIT_DRIVER_TABLE_H");
+    initGenerator_printLine(header, "#define INIT_DRIVER_TABLE_H");
+    initGenerator_printLine(header, "");
+    initGenerator_printLine(header, "/****************************************************************************************************");
+    initGenerator_printLine(header, " * Defines");
+    initGenerator_printLine(header, " ****************************************************************************************************/");
+    initGenerator_printLine(header, "");
+    for(i = 0; i < INIT_GENERATOR_SCRIPT_COUNT; i++)
+    {
+        initGenerator_upper(initGenerator_script[i].name, upper);
+        initGenerator_printLine(header, "#define INIT_DRIVER_TABLE_%s_LENGTH%*s (%u)", upper, (int)(width - strlen(upper)), "", length[i]);
+    }
+    initGenerator_printLine(header, "");
+    initGenerator_printLine(header, "/****************************************************************************************************");
+    initGenerator_printLine(header, " * Includes");
+    initGenerator_printLine(header, " ****************************************************************************************************/");
+    initGenerator_printLine(header, "");
+    initGenerator_printLine(header, "#include \"init_driver.h\"");
+    initGenerator_printLine(header, "");
+    initGenerator_printLine(header, "/****************************************************************************************************");
+    initGenerator_printLine(header, " * Constants And Variables");
+    initGenerator_printLine(header, " ****************************************************************************************************/");
+    initGenerator_printLine(header, "");
+    for(i = 0; i < INIT_GENERATOR_SCRIPT_COUNT; i++)
+    {
+        initGenerator_upper(initGenerator_script[i].name, upper);
+        initGenerator_printLine(header, "extern const initDriver_entry_t initDriverTable_%s[INIT_DRIVER_TABLE_%s_LENGTH];", initGenerator_script[i].name, upper);
+    }
+    initGenerator_printLine(header, "");
+    initGenerator_printLine(header, "#endif");
+
+    /*** Source ***/
+    initGenerator_printLine(source, "/****************************************************************************************************");
+    initGenerator_printLine(source, " * FILE:    init_driver_table.c");
+    initGenerator_printLine(source, " * BRIEF:   Init Driver Table Source File");
+    initGenerator_printLine(source, " * NOTE:    Generated By init_generator (\"make init_table\" In project/unit_test); Do Not Edit");
+    initGenerator_printLine(source, " * NOTE:    Entries: {Address, AND Mask, OR Value} (init_driver.h); Constant, So They Stay In FRAM");
+    initGenerator_printLine(source, " ****************************************************************************************************/");
+    initGenerator_printLine(source, "");
+    initGenerator_printLine(source, "/****************************************************************************************************");
+    initGenerator_printLine(source, " * Includes");
+    initGenerator_printLine(source, " ****************************************************************************************************/");
+    initGenerator_printLine(source, "");
+    initGenerator_printLine(source, "#include \"init_driver.h\"");
+    initGenerator_printLine(source, "#include \"init_driver_table.h\"");
+    initGenerator_printLine(source, "");
+    initGenerator_printLine(source, "/****************************************************************************************************");
+    initGenerator_printLine(source, " * Constants And Variables");
+    initGenerator_printLine(source, " ****************************************************************************************************/");
+    for(i = 0; i < INIT_GENERATOR_SCRIPT_COUNT; i++)
+    {
+        initGenerator_upper(initGenerator_script[i].name, upper);
+        initGenerator_printLine(source, "");
+        initGenerator_printLine(source, "const initDriver_entry_t initDriverTable_%s[INIT_DRIVER_TABLE_%s_LENGTH] =", initGenerator_script[i].name, upper);
+        initGenerator_printLine(source, "{");
+        for(j = 0; j < length[i]; j++)
+            initGenerator_printLine(source, "    {0x%04X, 0x%04X, 0x%04X}%s", table[i][j].address, table[i][j].andMask, table[i][j].orValue, ((j + 1) < length[i]) ? "," : "");
+        initGenerator_printLine(source, "};");
+    }
+
+    /*** Close ***/
+    if((fclose(source) != 0) | (fclose(header) != 0))
+    {
+        (void)fprintf(stderr, "%s, %s: Write Failed\n", SourcePath, HeaderPath);
+        return false;
+    }
+
+    return true;
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   initGenerator_accessCallback
+ * BRIEF:   Access Callback
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Address (About To Be Accessed)
+ * NOTE:    The Previous Access Has Completed (Models Included), So Its Register Is Read Back Here
+ ****************************************************************************************************/
+static void initGenerator_accessCallback(const uint32_t Address)
+{
+    initGenerator_access_t *access;
+    initGenerator_run_t * const run = initGenerator_recording;
+
+    /*** Previous Access ***/
+    if(run->count > 0)
+    {
+        access = &run->access[run->count - 1];
+        access->after = HW_MEMMAP_REG16(access->address);
+    }
+
+    /*** This Access ***/
+    if((Address < INIT_GENERATOR_PERIPHERAL_START) || (Address >= INIT_GENERATOR_PERIPHERAL_END))
+    {
+        if(!run->stray)
+        {
+            run->stray = true;
+            run->strayAddress = Address;
+        }
+    }
+    else if(run->count >= INIT_GENERATOR_ACCESS_MAXIMUM)
+    {
+        run->overflow = true;
+    }
+    else
+    {
+        access = &run->access[run->count++];
+        access->address = (uint16_t)(Address & ~1u);
+        access->before = HW_MEMMAP_REG16(access->address);
+        access->after = access->before;
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   initGenerator_printLine
+ * BRIEF:   Print Line
+ * RETURN:  Returns Nothing
+ * ARG:     File: File
+ * ARG:     Format: Format String (No Line Ending)
+ * ARG:     ...: Optional Arguments
+ ****************************************************************************************************/
+static void initGenerator_printLine(FILE * const File, const char * const Format, ...)
+{
+    va_list arguments;
+
+    /*** Print ***/
+    va_start(arguments, Format);
+    (void)vfprintf(File, Format, arguments);
+    va_end(arguments);
+    (void)fputs("\r\n", File);
+}
+
+/****************************************************************************************************
+ * FUNCT:   initGenerator_record
+ * BRIEF:   Record
+ * RETURN:  Returns Nothing
+ * ARG:     Script: Script
+ * ARG:     Fill: Value Of Every Peripheral Space Byte Beforehand
+ * ARG:     Run: Recorded Accesses
+ ****************************************************************************************************/
+static void initGenerator_record(const initGenerator_script_t * const Script, const uint8_t Fill, initGenerator_run_t * const Run)
+{
+    /*** Reset ***/
+    initGenerator_fill(Fill);
+    Run->count = 0;
+    Run->overflow = false;
+    Run->stray = false;
+    Run->strayAddress = 0;
+
+    /*** Record ***/
+    initGenerator_recording = Run;
+    (void)hwMemmap_registerAccessCallback(initGenerator_accessCallback);
+    Script->configure();
+    hwMemmap_update();
+    hwMemmap_unregisterAccessCallback(initGenerator_accessCallback);
+    initGenerator_recording = NULL;
+
+    /*** Last Access ***/
+    if(Run->count > 0)
+        Run->access[Run->count - 1].after = HW_MEMMAP_REG16(Run->access[Run->count - 1].address);
+}
+
+/****************************************************************************************************
+ * FUNCT:   initGenerator_upper
+ * BRIEF:   Upper Case
+ * RETURN:  Returns Nothing
+ * ARG:     Name: Script Name
+ * ARG:     Upper: Upper Case Name (INIT_GENERATOR_NAME_LENGTH Characters)
+ ****************************************************************************************************/
+static void initGenerator_upper(const char * const Name, char * const Upper)
+{
+    size_t i;
+
+    /*** Upper Case ***/
+    for(i = 0; (Name[i] != '\0') && (i < (INIT_GENERATOR_NAME_LENGTH - 1)); i++)
+        Upper[i] = (char)toupper((unsigned char)Name[i]);
+    Upper[i] = '\0';
+}
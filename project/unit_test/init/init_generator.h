@@ -0,0 +1,57 @@
+/****************************************************************************************************
+ * FILE:    init_generator.h
+ * BRIEF:   Init Generator Header File
+ * NOTE:    Builds The Register Init Tables (init_driver.h) From Each Module's driverlib Path: A Script
+ *          (*_configure()) Runs On The Simulator Twice, With Peripheral Space Filled With 0x00 And
+ *          Then 0xFF; Per Access, Bits That End Up Equal In Both Runs Were Written (OR Value), Bits
+ *          That Kept The Fill Were Left Alone (AND Mask)
+ * NOTE:    Both Runs Must Make The Same Accesses In The Same Order (Control Flow Can't Depend On
+ *          Register Contents) And Every Changed Bit Must Be Written, Not Toggled
+ ****************************************************************************************************/
+
+#ifndef INIT_GENERATOR_H
+#define INIT_GENERATOR_H
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define INIT_GENERATOR_ACCESS_MAXIMUM   (4096)
+#define INIT_GENERATOR_ENTRY_MAXIMUM    (256)
+#define INIT_GENERATOR_PERIPHERAL_END   (0x1000) // Peripheral Space (Exclusive)
+#define INIT_GENERATOR_PERIPHERAL_START (0x0100)
+#define INIT_GENERATOR_SCRIPT_COUNT     (5)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "init_driver.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef struct initGenerator_script_s
+{
+    const char *name;       // Table initDriverTable_<name>, Length INIT_DRIVER_TABLE_<NAME>_LENGTH
+    void (*configure)(void);
+} initGenerator_script_t;
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+extern const initGenerator_script_t initGenerator_script[INIT_GENERATOR_SCRIPT_COUNT];
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern void initGenerator_fill(const uint8_t Value);
+extern bool initGenerator_generate(const initGenerator_script_t * const Script, initDriver_entry_t * const Table, uint16_t * const Length);
+extern bool initGenerator_write(const char * const SourcePath, const char * const HeaderPath);
+
+#endif
@@ -0,0 +1,55 @@
+/****************************************************************************************************
+ * FILE:    init_generator_main.c
+ * BRIEF:   Init Generator Main Source File
+ * NOTE:    Regenerates The Register Init Tables After A Change To Any *_configure() Or driver_config.h
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "cli_callback_test.h"
+#include "init_generator.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   main
+ * BRIEF:   Main Entry
+ * RETURN:  int: Exit Status
+ * ARG:     argc: Argument Count
+ * ARG:     argv: Arguments: SOURCE HEADER
+ ****************************************************************************************************/
+int main(int argc, char *argv[])
+{
+    /*** Parse Arguments ***/
+    if(argc != 3)
+    {
+        (void)fprintf(stderr, "Usage: %s SOURCE HEADER\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    /*** Write ***/
+    if(!initGenerator_write(argv[1], argv[2]))
+        return EXIT_FAILURE;
+    (void)printf("Wrote: %s, %s\n", argv[1], argv[2]);
+
+    return EXIT_SUCCESS;
+}
+
+/****************************************************************************************************
+ * FUNCT:   cliCallbackTest_copyPrintfOutput
+ * BRIEF:   Copy Printf Output
+ * RETURN:  Returns Nothing
+ * ARG:     Output: Output Flushed To The CLI UART
+ * NOTE:    Scripts Don't Print; Only Here Because Host Builds Of cli_callback.c Call It
+ ****************************************************************************************************/
+void cliCallbackTest_copyPrintfOutput(const char * const Output)
+{
+    /*** Discard ***/
+    (void)Output;
+}
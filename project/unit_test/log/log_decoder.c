@@ -0,0 +1,294 @@
+/****************************************************************************************************
+ * FILE:    log_decoder.c
+ * BRIEF:   Log Decoder Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define LOG_DECODER_ELF_CLASS_64 (2)
+#define LOG_DECODER_SPEC_LENGTH  (32)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "log_decoder.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static uint64_t logDecoder_read(const uint8_t * const Data, const size_t Size);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   logDecoder_close
+ * BRIEF:   Close
+ * RETURN:  Returns Nothing
+ * ARG:     Decoder: Decoder
+ ****************************************************************************************************/
+void logDecoder_close(logDecoder_t * const Decoder)
+{
+    /*** Close ***/
+    free(Decoder->strings);
+    (void)memset(Decoder, 0, sizeof(*Decoder));
+}
+
+/****************************************************************************************************
+ * FUNCT:   logDecoder_decode
+ * BRIEF:   Decode
+ * RETURN:  Returns Nothing
+ * ARG:     Decoder: Decoder
+ * ARG:     Data: Received Bytes (Any Split; Partial Records Carry Over To The Next Call)
+ * ARG:     Length: Length (Bytes)
+ * ARG:     Output: Output (Text Passes Through, Records Become "[Seconds] Message" Lines)
+ * NOTE:    Timestamps Are Unwrapped Assuming Records Are Less Than One Timer Period (2 s) Apart
+ ****************************************************************************************************/
+void logDecoder_decode(logDecoder_t * const Decoder, const uint8_t * const Data, const size_t Length, FILE * const Output)
+{
+    char string[LOG_DECODER_STRING_LENGTH];
+    uint32_t arguments[LOG_DECODER_ARGUMENT_MAXIMUM];
+    uint16_t id, timestamp;
+    uint8_t count, i;
+    size_t j;
+
+    for(j = 0; j < Length; j++)
+    {
+        /*** Text Or Start Of Record ***/
+        if(Decoder->recordLength == 0)
+        {
+            if(((Data[j] & LOG_DECODER_SYNC) != LOG_DECODER_SYNC) || ((Data[j] & ~LOG_DECODER_SYNC) > LOG_DECODER_ARGUMENT_MAXIMUM))
+            {
+                (void)fputc(Data[j], Output);
+                continue;
+            }
+        }
+
+        /*** Collect Record ***/
+        Decoder->record[Decoder->recordLength++] = Data[j];
+        count = Decoder->record[0] & (uint8_t)~LOG_DECODER_SYNC;
+        if(Decoder->recordLength < (LOG_DECODER_HEADER_LENGTH + (count * sizeof(uint32_t))))
+            continue;
+        Decoder->recordLength = 0;
+
+        /*** Unwrap Timestamp ***/
+        id = (uint16_t)logDecoder_read(&Decoder->record[1], sizeof(uint16_t));
+        timestamp = (uint16_t)logDecoder_read(&Decoder->record[3], sizeof(uint16_t));
+        if(Decoder->ticksValid && (timestamp < (uint16_t)Decoder->ticks))
+            Decoder->ticks += 0x10000;
+        Decoder->ticks = (Decoder->ticks & ~(uint64_t)0xFFFF) | timestamp;
+        Decoder->ticksValid = true;
+
+        /*** Format ***/
+        for(i = 0; i < count; i++)
+            arguments[i] = (uint32_t)logDecoder_read(&Decoder->record[LOG_DECODER_HEADER_LENGTH + (i * sizeof(uint32_t))], sizeof(uint32_t));
+        if(!logDecoder_format(Decoder, id, arguments, count, string, sizeof(string)))
+            (void)snprintf(string, sizeof(string), "<Unknown Log ID 0x%04X>", id);
+        (void)fprintf(Output, "[%11.6f] %s\n", (double)Decoder->ticks / LOG_DECODER_TIMESTAMP_HERTZ, string);
+    }
+    (void)fflush(Output);
+}
+
+/****************************************************************************************************
+ * FUNCT:   logDecoder_format
+ * BRIEF:   Format
+ * RETURN:  bool: Success (true) Or Failure (false: Unknown ID)
+ * ARG:     Decoder: Decoder
+ * ARG:     Id: Format String ID
+ * ARG:     Arguments: Arguments
+ * ARG:     Count: Number Of Arguments
+ * ARG:     String: Formatted String
+ * ARG:     Size: Size Of String (Bytes)
+ * NOTE:    Length Modifiers Are Ignored: Integer Conversions Take A 32-Bit Argument (Signed For d And
+ *          i); %s Has No String On The Wire And Prints The Target Address Instead
+ ****************************************************************************************************/
+bool logDecoder_format(const logDecoder_t * const Decoder, const uint16_t Id, const uint32_t * const Arguments, const uint8_t Count, char * const String, const size_t Size)
+{
+    char spec[LOG_DECODER_SPEC_LENGTH];
+    const char *format;
+    size_t index, length;
+    uint8_t argument;
+    uint32_t value;
+
+    /*** Error Check ***/
+    if((Size == 0) || (Id >= Decoder->stringsLength) || (memchr(&Decoder->strings[Id], '\0', Decoder->stringsLength - Id) == NULL))
+        return false;
+
+    /*** Format ***/
+    index = 0;
+    argument = 0;
+    String[0] = '\0';
+    for(format = &Decoder->strings[Id]; (*format != '\0') && (index < (Size - 1)); format++)
+    {
+        /* Literal */
+        if((*format != '%') || (format[1] == '%'))
+        {
+            String[index++] = *format;
+            String[index] = '\0';
+            if(*format == '%')
+                format++;
+            continue;
+        }
+
+        /* Flags, Width And Precision */
+        length = strspn(&format[1], "-+ #0123456789.");
+        if((length + 3) > sizeof(spec))
+            return false;
+        spec[0] = '%';
+        (void)memcpy(&spec[1], &format[1], length);
+        format += length + 1;
+
+        /* Length Modifiers (Every Argument Is 32 Bits On The Wire) */
+        while((*format == 'h') || (*format == 'l') || (*format == 'j') || (*format == 'z') || (*format == 't'))
+            format++;
+        if(*format == '\0')
+            break;
+
+        /* Conversion */
+        value = (argument < Count) ? Arguments[argument] : 0;
+        argument++;
+        switch(*format)
+        {
+            case 'd':
+            case 'i':
+                (void)memcpy(&spec[length + 1], "ld", 3);
+                (void)snprintf(&String[index], Size - index, spec, (long)(int32_t)value);
+                break;
+            case 'o':
+            case 'u':
+            case 'x':
+            case 'X':
+                spec[length + 1] = 'l';
+                spec[length + 2] = *format;
+                spec[length + 3] = '\0';
+                (void)snprintf(&String[index], Size - index, spec, (unsigned long)value);
+                break;
+            case 'c':
+                (void)memcpy(&spec[length + 1], "c", 2);
+                (void)snprintf(&String[index], Size - index, spec, (int)(value & 0xFF));
+                break;
+            default:
+                (void)snprintf(&String[index], Size - index, "<0x%08lX>", (unsigned long)value);
+                break;
+        }
+        index += strlen(&String[index]);
+    }
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   logDecoder_open
+ * BRIEF:   Open
+ * RETURN:  bool: Success (true) Or Failure (false)
+ * ARG:     Decoder: Decoder
+ * ARG:     Path: Firmware ELF File Path (32-Bit Or 64-Bit, Little Endian)
+ ****************************************************************************************************/
+bool logDecoder_open(logDecoder_t * const Decoder, const char * const Path)
+{
+    uint8_t *elf, *header;
+    uint64_t nameOffset, sectionOffset, sectionSize, headerOffset;
+    size_t elfLength, headerSize, i, sectionCount, namesIndex;
+    bool is64;
+    FILE *file;
+    long fileLength;
+
+    /*** Read File ***/
+    (void)memset(Decoder, 0, sizeof(*Decoder));
+    file = fopen(Path, "rb");
+    if(file == NULL)
+        return false;
+    elf = NULL;
+    elfLength = 0;
+    if((fseek(file, 0, SEEK_END) == 0) && ((fileLength = ftell(file)) > 0) && (fseek(file, 0, SEEK_SET) == 0))
+    {
+        elfLength = (size_t)fileLength;
+        elf = malloc(elfLength);
+        if((elf != NULL) && (fread(elf, 1, elfLength, file) != elfLength))
+        {
+            free(elf);
+            elf = NULL;
+        }
+    }
+    (void)fclose(file);
+    if((elf == NULL) || (elfLength < 64) || (memcmp(elf, "\177ELF", 4) != 0) || (elf[5] != 1)) // Little Endian
+    {
+        free(elf);
+        return false;
+    }
+
+    /*** Section Header Table ***/
+    is64 = (elf[4] == LOG_DECODER_ELF_CLASS_64);
+    headerOffset = is64 ? logDecoder_read(&elf[0x28], 8) : logDecoder_read(&elf[0x20], 4);
+    headerSize = (size_t)logDecoder_read(&elf[is64 ? 0x3A : 0x2E], 2);
+    sectionCount = (size_t)logDecoder_read(&elf[is64 ? 0x3C : 0x30], 2);
+    namesIndex = (size_t)logDecoder_read(&elf[is64 ? 0x3E : 0x32], 2);
+    if((headerSize < (is64 ? 64u : 40u)) || (namesIndex >= sectionCount) || (headerOffset > elfLength) || ((sectionCount * headerSize) > (elfLength - headerOffset)))
+    {
+        free(elf);
+        return false;
+    }
+    header = &elf[headerOffset + (namesIndex * headerSize)];
+    nameOffset = is64 ? logDecoder_read(&header[0x18], 8) : logDecoder_read(&header[0x10], 4);
+
+    /*** Find Log Section ***/
+    for(i = 0; i < sectionCount; i++)
+    {
+        header = &elf[headerOffset + (i * headerSize)];
+        sectionOffset = nameOffset + logDecoder_read(header, 4);
+        if((sectionOffset >= elfLength) || (memchr(&elf[sectionOffset], '\0', elfLength - sectionOffset) == NULL))
+            continue;
+        if((strcmp((const char *)&elf[sectionOffset], ".logstr") != 0) && (strcmp((const char *)&elf[sectionOffset], "logstr") != 0))
+            continue;
+
+        /* Copy Contents */
+        sectionOffset = is64 ? logDecoder_read(&header[0x18], 8) : logDecoder_read(&header[0x10], 4);
+        sectionSize = is64 ? logDecoder_read(&header[0x20], 8) : logDecoder_read(&header[0x14], 4);
+        if((sectionOffset > elfLength) || (sectionSize > (elfLength - sectionOffset)) || (sectionSize == 0))
+            break;
+        Decoder->strings = malloc((size_t)sectionSize);
+        if(Decoder->strings == NULL)
+            break;
+        (void)memcpy(Decoder->strings, &elf[sectionOffset], (size_t)sectionSize);
+        Decoder->stringsLength = (size_t)sectionSize;
+        break;
+    }
+    free(elf);
+
+    return (Decoder->strings != NULL);
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   logDecoder_read
+ * BRIEF:   Read (Little Endian)
+ * RETURN:  uint64_t: Value
+ * ARG:     Data: Data
+ * ARG:     Size: Size (Bytes)
+ ****************************************************************************************************/
+static uint64_t logDecoder_read(const uint8_t * const Data, const size_t Size)
+{
+    uint64_t value;
+    size_t i;
+
+    /*** Read ***/
+    value = 0;
+    for(i = Size; i > 0; i--)
+        value = (value << 8) | Data[i - 1];
+
+    return value;
+}
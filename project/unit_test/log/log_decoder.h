@@ -0,0 +1,54 @@
+/****************************************************************************************************
+ * FILE:    log_decoder.h
+ * BRIEF:   Log Decoder Header File
+ * NOTE:    Host Side Of The Tokenized Log (log_driver.h): Format Strings Come From The Log Section Of
+ *          The Firmware ELF File (".logstr" On The Target, "logstr" In Host Builds); An ID Is The
+ *          Offset Of Its Format String In That Section (The Target Links It At Address 0)
+ ****************************************************************************************************/
+
+#ifndef LOG_DECODER_H
+#define LOG_DECODER_H
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define LOG_DECODER_ARGUMENT_MAXIMUM  (4)      // LOG_DRIVER_ARGUMENT_MAXIMUM
+#define LOG_DECODER_HEADER_LENGTH     (5)      // LOG_DRIVER_RECORD_HEADER_LENGTH
+#define LOG_DECODER_STRING_LENGTH     (256)
+#define LOG_DECODER_SYNC              (0xF0)   // LOG_DRIVER_RECORD_SYNC
+#define LOG_DECODER_TIMESTAMP_HERTZ   (32768u) // Log Timer Clock (ACLK)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef struct logDecoder_s
+{
+    char *strings;       // Log Section Contents
+    size_t stringsLength;
+    uint8_t record[LOG_DECODER_HEADER_LENGTH + (LOG_DECODER_ARGUMENT_MAXIMUM * sizeof(uint32_t))];
+    size_t recordLength; // Bytes Of A Partial Record (0: Passing Text Through)
+    uint64_t ticks;      // Unwrapped Timestamp Of The Last Record
+    bool ticksValid;
+} logDecoder_t;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern void logDecoder_close(logDecoder_t * const Decoder);
+extern void logDecoder_decode(logDecoder_t * const Decoder, const uint8_t * const Data, const size_t Length, FILE * const Output);
+extern bool logDecoder_format(const logDecoder_t * const Decoder, const uint16_t Id, const uint32_t * const Arguments, const uint8_t Count, char * const String, const size_t Size);
+extern bool logDecoder_open(logDecoder_t * const Decoder, const char * const Path);
+
+#endif
@@ -0,0 +1,92 @@
+/****************************************************************************************************
+ * FILE:    log_decoder_main.c
+ * BRIEF:   Log Decoder Main Source File
+ * NOTE:    Reads The CLI Wire (A Serial Device, A Virtual Device Pseudo-Terminal Or A Capture File)
+ *          And Prints It With Log Records Expanded From The Firmware ELF File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define LOG_DECODER_MAIN_BUFFER_LENGTH (256)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "log_decoder.h"
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   main
+ * BRIEF:   Main Entry
+ * RETURN:  int: Exit Status
+ * ARG:     argc: Argument Count
+ * ARG:     argv: Arguments: -e ELF [-i INPUT]
+ * NOTE:    INPUT Defaults To stdin; A Serial Device Must Already Be Raw At The Right Baud Rate
+ *          (e.g. stty -F /dev/ttyACM0 115200 raw), Then Turn Records On With "system -lON"
+ ****************************************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint8_t buffer[LOG_DECODER_MAIN_BUFFER_LENGTH];
+    const char *elfPath = NULL, *inputPath = NULL;
+    int input, option;
+    ssize_t length;
+    logDecoder_t decoder;
+
+    /*** Parse Arguments ***/
+    while((option = getopt(argc, argv, "e:i:")) != -1)
+    {
+        switch(option)
+        {
+            case 'e':
+                elfPath = optarg;
+                break;
+            case 'i':
+                inputPath = optarg;
+                break;
+            default:
+                elfPath = NULL;
+                break;
+        }
+    }
+    if(elfPath == NULL)
+    {
+        (void)fprintf(stderr, "Usage: %s -e ELF [-i INPUT]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    /*** Open ***/
+    if(!logDecoder_open(&decoder, elfPath))
+    {
+        (void)fprintf(stderr, "%s: No Log Section (.logstr)\n", elfPath);
+        return EXIT_FAILURE;
+    }
+    input = (inputPath == NULL) ? STDIN_FILENO : open(inputPath, O_RDONLY | O_NOCTTY);
+    if(input < 0)
+    {
+        perror(inputPath);
+        logDecoder_close(&decoder);
+        return EXIT_FAILURE;
+    }
+
+    /*** Decode Until End Of Input ***/
+    while((length = read(input, buffer, sizeof(buffer))) > 0)
+        logDecoder_decode(&decoder, buffer, (size_t)length, stdout);
+
+    /*** Close ***/
+    if(input != STDIN_FILENO)
+        (void)close(input);
+    logDecoder_close(&decoder);
+
+    return EXIT_SUCCESS;
+}
@@ -48,9 +48,25 @@ static void main_runTestGroups(void)
 {
     /*** Run Test Groups ***/
     RUN_TEST_GROUP(button_driver_test)
+    RUN_TEST_GROUP(checkpoint_driver_test)
     RUN_TEST_GROUP(cli_callback_test)
     RUN_TEST_GROUP(cli_command_handler_callback_test)
+    RUN_TEST_GROUP(drbg_driver_test)
+    RUN_TEST_GROUP(entropy_driver_test)
+    RUN_TEST_GROUP(init_driver_test)
+    RUN_TEST_GROUP(interrupt_handler_test)
     RUN_TEST_GROUP(lcd_driver_test)
     RUN_TEST_GROUP(led_driver_test)
+    RUN_TEST_GROUP(log_driver_test)
+    RUN_TEST_GROUP(memory_driver_test)
+    RUN_TEST_GROUP(nest_driver_test)
+    RUN_TEST_GROUP(msp430x_test)
+    RUN_TEST_GROUP(port_driver_test)
+    RUN_TEST_GROUP(power_driver_test)
+    RUN_TEST_GROUP(profile_driver_test)
+    RUN_TEST_GROUP(random_callback_test)
+    RUN_TEST_GROUP(sim_model_test)
     RUN_TEST_GROUP(system_test)
+    RUN_TEST_GROUP(trace_driver_test)
+    RUN_TEST_GROUP(vector_driver_test)
 }
@@ -0,0 +1,295 @@
+/****************************************************************************************************
+ * FILE:    session_recorder.c
+ * BRIEF:   Session Recorder Source File
+ * NOTE:    Host Serial Tool That Relays A CLI Session Between The Terminal (Or A Script On stdin) And
+ *          A Serial Device (The Board Or A Virtual Device Pseudo-Terminal) And Records Every Byte
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define _GNU_SOURCE
+
+#define SESSION_RECORDER_BUFFER_LENGTH             (256)
+#define SESSION_RECORDER_EXIT_CHARACTER            (0x1D) // Ctrl-]
+#define SESSION_RECORDER_IDLE_MILLISECONDS_DEFAULT (250)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <fcntl.h>
+#include <poll.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static FILE *sessionRecorder_session;
+static uint64_t sessionRecorder_startTime;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static uint64_t sessionRecorder_getTime(void);
+static bool sessionRecorder_openDevice(const char * const Path, const unsigned long BaudRate, int * const Device);
+static void sessionRecorder_record(const char Direction, const uint8_t * const Bytes, const size_t Length);
+static speed_t sessionRecorder_toSpeed(const unsigned long BaudRate);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   main
+ * BRIEF:   Main Entry
+ * RETURN:  int: Exit Status
+ * ARG:     argc: Argument Count
+ * ARG:     argv: Arguments: -d DEVICE -o SESSION [-b BAUD_RATE] [-i IDLE_MILLISECONDS]
+ * NOTE:    Interactive (Terminal On stdin): Exit With Ctrl-]; Scripted (stdin Redirected): Each Line
+ *          Is Sent Once The Device Has Been Idle For IDLE_MILLISECONDS, Exits After The Last Response
+ * NOTE:    Session Format: One Line Per Chunk: "<Microseconds> <R|T> <Hex Bytes>"; R: Received By
+ *          The Device (Host To Device), T: Transmitted By The Device (Device To Host)
+ ****************************************************************************************************/
+int main(int argc, char *argv[])
+{
+    unsigned long baudRate = 115200, idleMilliseconds = SESSION_RECORDER_IDLE_MILLISECONDS_DEFAULT;
+    uint8_t buffer[SESSION_RECORDER_BUFFER_LENGTH];
+    const char *devicePath = NULL, *sessionPath = NULL;
+    int device, option, timeout;
+    bool interactive, inputEnded = false;
+    struct termios terminal, terminalSaved;
+    struct pollfd descriptors[2];
+    ssize_t i, length;
+
+    /*** Parse Arguments ***/
+    while((option = getopt(argc, argv, "b:d:i:o:")) != -1)
+    {
+        switch(option)
+        {
+            case 'b':
+                baudRate = strtoul(optarg, NULL, 0);
+                break;
+            case 'd':
+                devicePath = optarg;
+                break;
+            case 'i':
+                idleMilliseconds = strtoul(optarg, NULL, 0);
+                break;
+            case 'o':
+                sessionPath = optarg;
+                break;
+            default:
+                devicePath = NULL;
+                break;
+        }
+    }
+    if((devicePath == NULL) || (sessionPath == NULL))
+    {
+        (void)fprintf(stderr, "Usage: %s -d DEVICE -o SESSION [-b BAUD_RATE] [-i IDLE_MILLISECONDS]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    /*** Open ***/
+    if(!sessionRecorder_openDevice(devicePath, baudRate, &device))
+        return EXIT_FAILURE;
+    sessionRecorder_session = fopen(sessionPath, "w");
+    if(sessionRecorder_session == NULL)
+    {
+        perror(sessionPath);
+        return EXIT_FAILURE;
+    }
+    (void)fprintf(sessionRecorder_session, "# Session: %s\n", devicePath);
+    sessionRecorder_startTime = sessionRecorder_getTime();
+
+    /*** Terminal (Raw, So Every Keystroke Is Sent As Typed) ***/
+    interactive = (isatty(STDIN_FILENO) == 1);
+    if(interactive)
+    {
+        (void)tcgetattr(STDIN_FILENO, &terminalSaved);
+        terminal = terminalSaved;
+        cfmakeraw(&terminal);
+        (void)tcsetattr(STDIN_FILENO, TCSANOW, &terminal);
+        (void)fprintf(stderr, "Recording %s To %s (Exit: Ctrl-])\r\n", devicePath, sessionPath);
+    }
+
+    /*** Relay And Record ***/
+    descriptors[0].fd = device;
+    descriptors[0].events = POLLIN;
+    descriptors[1].fd = STDIN_FILENO;
+    descriptors[1].events = POLLIN;
+    descriptors[1].revents = 0;
+    while(true)
+    {
+        /* Scripted Input Waits For The Device To Go Idle Before Each Line */
+        timeout = interactive ? -1 : (int)idleMilliseconds;
+        if(poll(descriptors, interactive ? 2 : 1, timeout) < 0)
+            break;
+
+        /* Device To Host */
+        if((descriptors[0].revents & POLLIN) == POLLIN)
+        {
+            length = read(device, buffer, sizeof(buffer));
+            if(length <= 0)
+                break;
+            sessionRecorder_record('T', buffer, (size_t)length);
+            (void)write(STDOUT_FILENO, buffer, (size_t)length);
+            continue;
+        }
+
+        /* Host To Device */
+        if(interactive && ((descriptors[1].revents & POLLIN) == POLLIN))
+        {
+            length = read(STDIN_FILENO, buffer, sizeof(buffer));
+            if(length <= 0)
+                break;
+            if(memchr(buffer, SESSION_RECORDER_EXIT_CHARACTER, (size_t)length) != NULL)
+                break;
+            sessionRecorder_record('R', buffer, (size_t)length);
+            (void)write(device, buffer, (size_t)length);
+        }
+        else if(!interactive && ((descriptors[0].revents & POLLIN) != POLLIN))
+        {
+            /* Device Idle: Send Next Line, Or Finish */
+            if(inputEnded)
+                break;
+            for(i = 0; i < (ssize_t)sizeof(buffer); i++)
+            {
+                if(read(STDIN_FILENO, &buffer[i], 1) != 1)
+                {
+                    inputEnded = true;
+                    break;
+                }
+                if(buffer[i] == '\n')
+                {
+                    i++;
+                    break;
+                }
+            }
+            if(i > 0)
+            {
+                sessionRecorder_record('R', buffer, (size_t)i);
+                (void)write(device, buffer, (size_t)i);
+            }
+        }
+    }
+
+    /*** Close ***/
+    if(interactive)
+        (void)tcsetattr(STDIN_FILENO, TCSANOW, &terminalSaved);
+    (void)fclose(sessionRecorder_session);
+    (void)close(device);
+
+    return EXIT_SUCCESS;
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   sessionRecorder_getTime
+ * BRIEF:   Get Time
+ * RETURN:  uint64_t: Monotonic Time (Microseconds)
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+static uint64_t sessionRecorder_getTime(void)
+{
+    struct timespec time;
+
+    /*** Get Time ***/
+    (void)clock_gettime(CLOCK_MONOTONIC, &time);
+    return ((uint64_t)time.tv_sec * 1000000u) + ((uint64_t)time.tv_nsec / 1000u);
+}
+
+/****************************************************************************************************
+ * FUNCT:   sessionRecorder_openDevice
+ * BRIEF:   Open Device
+ * RETURN:  bool: Success (true) Or Failure (false)
+ * ARG:     Path: Serial Device Path
+ * ARG:     BaudRate: Baud Rate (8-N-1, Like The Board's CLI UART)
+ * ARG:     Device: Opened File Descriptor
+ ****************************************************************************************************/
+static bool sessionRecorder_openDevice(const char * const Path, const unsigned long BaudRate, int * const Device)
+{
+    struct termios attributes;
+
+    /*** Open Device ***/
+    *Device = open(Path, O_RDWR | O_NOCTTY);
+    if((*Device < 0) || (tcgetattr(*Device, &attributes) != 0))
+    {
+        perror(Path);
+        return false;
+    }
+
+    /*** Raw 8-N-1 ***/
+    cfmakeraw(&attributes);
+    attributes.c_cflag |= (CLOCAL | CREAD);
+    attributes.c_cflag &= (tcflag_t)~(CSTOPB | PARENB | CRTSCTS);
+    (void)cfsetispeed(&attributes, sessionRecorder_toSpeed(BaudRate));
+    (void)cfsetospeed(&attributes, sessionRecorder_toSpeed(BaudRate));
+    (void)tcsetattr(*Device, TCSANOW, &attributes);
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   sessionRecorder_record
+ * BRIEF:   Record
+ * RETURN:  Returns Nothing
+ * ARG:     Direction: 'R' (Received By Device) Or 'T' (Transmitted By Device)
+ * ARG:     Bytes: Bytes
+ * ARG:     Length: Number Of Bytes
+ ****************************************************************************************************/
+static void sessionRecorder_record(const char Direction, const uint8_t * const Bytes, const size_t Length)
+{
+    size_t i;
+
+    /*** Record ***/
+    (void)fprintf(sessionRecorder_session, "%llu %c ", (unsigned long long)(sessionRecorder_getTime() - sessionRecorder_startTime), Direction);
+    for(i = 0; i < Length; i++)
+        (void)fprintf(sessionRecorder_session, "%02x", Bytes[i]);
+    (void)fprintf(sessionRecorder_session, "\n");
+    (void)fflush(sessionRecorder_session);
+}
+
+/****************************************************************************************************
+ * FUNCT:   sessionRecorder_toSpeed
+ * BRIEF:   To Speed
+ * RETURN:  speed_t: Terminal Speed
+ * ARG:     BaudRate: Baud Rate
+ ****************************************************************************************************/
+static speed_t sessionRecorder_toSpeed(const unsigned long BaudRate)
+{
+    /*** To Speed ***/
+    switch(BaudRate)
+    {
+        case 9600:
+            return B9600;
+        case 19200:
+            return B19200;
+        case 38400:
+            return B38400;
+        case 57600:
+            return B57600;
+        case 230400:
+            return B230400;
+        case 460800:
+            return B460800;
+        case 921600:
+            return B921600;
+        case 115200:
+        default:
+            return B115200;
+    }
+}
@@ -0,0 +1,477 @@
+/****************************************************************************************************
+ * FILE:    session_replay.c
+ * BRIEF:   Session Replay Source File
+ * NOTE:    Replays The Received Bytes Of A Recorded CLI Session Into The Simulated Firmware And Reports
+ *          Per-Command Response Latency And Bytes Out Against A Stored Baseline; Latency Is Measured In
+ *          Register Accesses (Deterministic), With Host Time Reported For Information
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define _GNU_SOURCE
+
+#define SESSION_REPLAY_BASELINE_EXTENSION         (".baseline")
+#define SESSION_REPLAY_COMMAND_COUNT              (1024)
+#define SESSION_REPLAY_COMMAND_LENGTH             (128)
+#define SESSION_REPLAY_LINE_LENGTH                (8192)
+#define SESSION_REPLAY_TOLERANCE_PERCENT_DEFAULT  (5)
+#define SESSION_REPLAY_UNKNOWN                    (UINT64_MAX)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "button_driver.h"
+#include "cli_callback.h"
+#include "driver_config.h"
+#include "hw_memmap.h"
+#include "msp430fr5xx_6xxgeneric.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "system.h"
+#include <time.h>
+#include <unistd.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef struct sessionReplay_command_s
+{
+    uint64_t baselineBytesOut;
+    uint64_t baselineLatency;
+    uint8_t bytes[SESSION_REPLAY_COMMAND_LENGTH];
+    uint64_t bytesOut;
+    uint64_t latency; // Register Accesses
+    size_t length;
+    uint64_t nanoseconds;
+    uint64_t recordedBytesOut;
+    uint64_t recordedEndTime;
+    uint64_t recordedLatency; // Microseconds
+} sessionReplay_command_t;
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static uint64_t sessionReplay_accessCount;
+static uint64_t sessionReplay_bytesOut;
+static size_t sessionReplay_commandCount;
+static sessionReplay_command_t sessionReplay_commands[SESSION_REPLAY_COMMAND_COUNT];
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void sessionReplay_accessCallback(const uint32_t Address);
+static int sessionReplay_compare(const void *A, const void *B);
+static uint64_t sessionReplay_getPercentile(const unsigned int Percentile);
+static uint64_t sessionReplay_getTime(void);
+static bool sessionReplay_loadSession(const char * const Path);
+static void sessionReplay_printCommand(FILE * const File, const sessionReplay_command_t * const Command);
+static uint64_t sessionReplay_readBaseline(const char * const Path);
+static void sessionReplay_replay(void);
+static bool sessionReplay_writeBaseline(const char * const Path);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   main
+ * BRIEF:   Main Entry
+ * RETURN:  int: Exit Status (Failure If Any Session's p99 Latency Regressed Or Has No Baseline)
+ * ARG:     argc: Argument Count
+ * ARG:     argv: Arguments: [-u] [-t TOLERANCE_PERCENT] SESSION...
+ * NOTE:    The Baseline Of SESSION Is SESSION.baseline, Committed With The Session; Only -u Writes It
+ *          (make replay_update), So A Missing Baseline Fails Instead Of Passing Unchecked
+ ****************************************************************************************************/
+int main(int argc, char *argv[])
+{
+    char baselinePath[4096];
+    const char *result;
+    int option;
+    bool failed = false, update = false;
+    unsigned long tolerance = SESSION_REPLAY_TOLERANCE_PERCENT_DEFAULT;
+    uint64_t baselineP99, p50, p99;
+    size_t i;
+
+    /*** Parse Arguments ***/
+    while((option = getopt(argc, argv, "t:u")) != -1)
+    {
+        switch(option)
+        {
+            case 't':
+                tolerance = strtoul(optarg, NULL, 0);
+                break;
+            case 'u':
+                update = true;
+                break;
+            default:
+                (void)fprintf(stderr, "Usage: %s [-u] [-t TOLERANCE_PERCENT] SESSION...\n", argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+    if(optind >= argc)
+    {
+        (void)fprintf(stderr, "Usage: %s [-u] [-t TOLERANCE_PERCENT] SESSION...\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    /*** Replay Sessions ***/
+    (void)hwMemmap_registerAccessCallback(sessionReplay_accessCallback);
+    for(; optind < argc; optind++)
+    {
+        /* Load And Replay */
+        if(!sessionReplay_loadSession(argv[optind]))
+            return EXIT_FAILURE;
+        (void)snprintf(baselinePath, sizeof(baselinePath), "%s%s", argv[optind], SESSION_REPLAY_BASELINE_EXTENSION);
+        baselineP99 = sessionReplay_readBaseline(baselinePath); // Shown Next To The Update With -u
+        sessionReplay_replay();
+        p50 = sessionReplay_getPercentile(50);
+        p99 = sessionReplay_getPercentile(99);
+
+        /* Report */
+        (void)printf("Session: %s (%zu Commands)\n", argv[optind], sessionReplay_commandCount);
+        (void)printf("  %5s %9s %9s %9s %9s %9s %9s %11s  %s\n", "#", "Latency", "Baseline", "Time (ns)", "Bytes Out", "Baseline", "Recorded", "Recorded us", "Command");
+        for(i = 0; i < sessionReplay_commandCount; i++)
+            sessionReplay_printCommand(stdout, &sessionReplay_commands[i]);
+
+        /* Compare p99 Latency With Baseline */
+        if(update)
+        {
+            result = "Baseline Written";
+            if(!sessionReplay_writeBaseline(baselinePath))
+            {
+                result = "FAIL: Baseline NOT Written";
+                failed = true;
+            }
+        }
+        else if(baselineP99 == SESSION_REPLAY_UNKNOWN)
+        {
+            result = "FAIL: No Baseline (make replay_update)";
+            failed = true;
+        }
+        else if((p99 * 100) > (baselineP99 * (100 + tolerance)))
+        {
+            result = "FAIL: p99 Latency Regressed";
+            failed = true;
+        }
+        else
+        {
+            result = "PASS";
+        }
+        (void)printf("  p50: %llu, p99: %llu (Baseline p99: ", (unsigned long long)p50, (unsigned long long)p99);
+        if(baselineP99 == SESSION_REPLAY_UNKNOWN)
+            (void)printf("None");
+        else
+            (void)printf("%llu, Tolerance: %lu%%", (unsigned long long)baselineP99, tolerance);
+        (void)printf(") Register Accesses: %s\n", result);
+    }
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/****************************************************************************************************
+ * FUNCT:   cliCallbackTest_copyPrintfOutput
+ * BRIEF:   Copy Printf Output
+ * RETURN:  Returns Nothing
+ * ARG:     Output: Output Flushed To The CLI UART
+ ****************************************************************************************************/
+void cliCallbackTest_copyPrintfOutput(const char * const Output)
+{
+    /*** Count Bytes Out ***/
+    sessionReplay_bytesOut += strlen(Output);
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   sessionReplay_accessCallback
+ * BRIEF:   Access Callback
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Accessed Address (Unused)
+ ****************************************************************************************************/
+static void sessionReplay_accessCallback(const uint32_t Address)
+{
+    (void)Address;
+
+    /*** Count Register Accesses ***/
+    sessionReplay_accessCount++;
+}
+
+/****************************************************************************************************
+ * FUNCT:   sessionReplay_compare
+ * BRIEF:   Compare
+ * RETURN:  int: Less Than (< 0), Equal To (0) Or Greater Than (> 0)
+ * ARG:     A: Latency A
+ * ARG:     B: Latency B
+ ****************************************************************************************************/
+static int sessionReplay_compare(const void *A, const void *B)
+{
+    /*** Compare ***/
+    return (*(const uint64_t *)A > *(const uint64_t *)B) - (*(const uint64_t *)A < *(const uint64_t *)B);
+}
+
+/****************************************************************************************************
+ * FUNCT:   sessionReplay_getPercentile
+ * BRIEF:   Get Percentile
+ * RETURN:  uint64_t: Latency Percentile (Nearest Rank)
+ * ARG:     Percentile: Percentile (1 To 100)
+ ****************************************************************************************************/
+static uint64_t sessionReplay_getPercentile(const unsigned int Percentile)
+{
+    uint64_t latencies[SESSION_REPLAY_COMMAND_COUNT];
+    size_t i, rank;
+
+    /*** Error Check ***/
+    if(sessionReplay_commandCount == 0)
+        return 0;
+
+    /*** Get Percentile ***/
+    for(i = 0; i < sessionReplay_commandCount; i++)
+        latencies[i] = sessionReplay_commands[i].latency;
+    qsort(latencies, sessionReplay_commandCount, sizeof(latencies[0]), sessionReplay_compare);
+    rank = ((Percentile * sessionReplay_commandCount) + 99) / 100;
+
+    return latencies[(rank > 0) ? (rank - 1) : 0];
+}
+
+/****************************************************************************************************
+ * FUNCT:   sessionReplay_getTime
+ * BRIEF:   Get Time
+ * RETURN:  uint64_t: Monotonic Time (Nanoseconds)
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+static uint64_t sessionReplay_getTime(void)
+{
+    struct timespec time;
+
+    /*** Get Time ***/
+    (void)clock_gettime(CLOCK_MONOTONIC, &time);
+    return ((uint64_t)time.tv_sec * 1000000000u) + (uint64_t)time.tv_nsec;
+}
+
+/****************************************************************************************************
+ * FUNCT:   sessionReplay_loadSession
+ * BRIEF:   Load Session
+ * RETURN:  bool: Success (true) Or Failure (false)
+ * ARG:     Path: Session Path (session_recorder Format)
+ * NOTE:    Received Bytes Are Split Into Commands At Line Endings; Transmitted Bytes Up To The Next
+ *          Command Are The Recorded Response
+ ****************************************************************************************************/
+static bool sessionReplay_loadSession(const char * const Path)
+{
+    char direction, hex[SESSION_REPLAY_LINE_LENGTH], line[SESSION_REPLAY_LINE_LENGTH];
+    sessionReplay_command_t *command = NULL;
+    FILE *file;
+    unsigned int byte;
+    unsigned long long time;
+    size_t i;
+
+    /*** Open ***/
+    file = fopen(Path, "r");
+    if(file == NULL)
+    {
+        perror(Path);
+        return false;
+    }
+
+    /*** Load Session ***/
+    (void)memset(sessionReplay_commands, 0, sizeof(sessionReplay_commands));
+    sessionReplay_commandCount = 0;
+    while(fgets(line, sizeof(line), file) != NULL)
+    {
+        /* Parse Chunk */
+        if((line[0] == '#') || (sscanf(line, "%llu %c %8191s", &time, &direction, hex) != 3))
+            continue;
+
+        for(i = 0; (hex[i] != '\0') && (hex[i + 1] != '\0') && (sscanf(&hex[i], "%2x", &byte) == 1); i += 2)
+        {
+            if(direction == 'R')
+            {
+                /* Received Byte: Start Next Command, If Necessary */
+                if((command == NULL) || (command->recordedEndTime != SESSION_REPLAY_UNKNOWN))
+                {
+                    if(sessionReplay_commandCount >= SESSION_REPLAY_COMMAND_COUNT)
+                        break;
+                    command = &sessionReplay_commands[sessionReplay_commandCount++];
+                    command->recordedEndTime = SESSION_REPLAY_UNKNOWN;
+                    command->recordedLatency = SESSION_REPLAY_UNKNOWN;
+                }
+                if(command->length < SESSION_REPLAY_COMMAND_LENGTH)
+                    command->bytes[command->length++] = (uint8_t)byte;
+                if((byte == '\n') || (byte == '\r'))
+                    command->recordedEndTime = time;
+            }
+            else if((direction == 'T') && (command != NULL) && (command->recordedEndTime != SESSION_REPLAY_UNKNOWN))
+            {
+                /* Transmitted Byte: Response To The Last Complete Command */
+                if(command->recordedLatency == SESSION_REPLAY_UNKNOWN)
+                    command->recordedLatency = time - command->recordedEndTime;
+                command->recordedBytesOut++;
+            }
+        }
+    }
+    (void)fclose(file);
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   sessionReplay_printCommand
+ * BRIEF:   Print Command
+ * RETURN:  Returns Nothing
+ * ARG:     File: File
+ * ARG:     Command: Command
+ ****************************************************************************************************/
+static void sessionReplay_printCommand(FILE * const File, const sessionReplay_command_t * const Command)
+{
+    char number[3][24];
+    size_t i;
+
+    /*** Print Command ***/
+    (void)snprintf(number[0], sizeof(number[0]), (Command->baselineLatency == SESSION_REPLAY_UNKNOWN) ? "-" : "%llu", (unsigned long long)Command->baselineLatency);
+    (void)snprintf(number[1], sizeof(number[1]), (Command->baselineBytesOut == SESSION_REPLAY_UNKNOWN) ? "-" : "%llu", (unsigned long long)Command->baselineBytesOut);
+    (void)snprintf(number[2], sizeof(number[2]), (Command->recordedLatency == SESSION_REPLAY_UNKNOWN) ? "-" : "%llu", (unsigned long long)Command->recordedLatency);
+    (void)fprintf(File, "  %5zu %9llu %9s %9llu %9llu %9s %9llu %11s  ", (size_t)(Command - sessionReplay_commands), (unsigned long long)Command->latency, number[0], (unsigned long long)Command->nanoseconds, (unsigned long long)Command->bytesOut, number[1], (unsigned long long)Command->recordedBytesOut, number[2]);
+    for(i = 0; i < Command->length; i++)
+    {
+        if((Command->bytes[i] >= ' ') && (Command->bytes[i] <= '~'))
+            (void)fputc(Command->bytes[i], File);
+    }
+    (void)fputc('\n', File);
+}
+
+/****************************************************************************************************
+ * FUNCT:   sessionReplay_readBaseline
+ * BRIEF:   Read Baseline
+ * RETURN:  uint64_t: Baseline p99 Latency (SESSION_REPLAY_UNKNOWN: No Baseline)
+ * ARG:     Path: Baseline Path
+ * NOTE:    Format: "<#> <Latency> <Bytes Out> <Command>" Per Command, Then "p99 <Latency>"
+ ****************************************************************************************************/
+static uint64_t sessionReplay_readBaseline(const char * const Path)
+{
+    char line[SESSION_REPLAY_LINE_LENGTH];
+    FILE *file;
+    unsigned long long bytesOut, latency, p99 = SESSION_REPLAY_UNKNOWN;
+    size_t i;
+
+    /*** Defaults ***/
+    for(i = 0; i < SESSION_REPLAY_COMMAND_COUNT; i++)
+    {
+        sessionReplay_commands[i].baselineBytesOut = SESSION_REPLAY_UNKNOWN;
+        sessionReplay_commands[i].baselineLatency = SESSION_REPLAY_UNKNOWN;
+    }
+
+    /*** Read Baseline ***/
+    file = fopen(Path, "r");
+    if(file == NULL)
+        return SESSION_REPLAY_UNKNOWN;
+    while(fgets(line, sizeof(line), file) != NULL)
+    {
+        if(sscanf(line, "p99 %llu", &latency) == 1)
+        {
+            p99 = latency;
+        }
+        else if((sscanf(line, "%zu %llu %llu", &i, &latency, &bytesOut) == 3) && (i < SESSION_REPLAY_COMMAND_COUNT))
+        {
+            sessionReplay_commands[i].baselineLatency = latency;
+            sessionReplay_commands[i].baselineBytesOut = bytesOut;
+        }
+    }
+    (void)fclose(file);
+
+    return p99;
+}
+
+/****************************************************************************************************
+ * FUNCT:   sessionReplay_replay
+ * BRIEF:   Replay
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Each Received Byte Is Fed Through cliCallback_usciInterruptHandler(), Followed By One Main
+ *          Loop Iteration; A Command's Latency Runs From Its Final Byte To The End Of The Main Loop
+ *          Iteration That Processes It (The CLI Processes Complete Input Within One Tick)
+ ****************************************************************************************************/
+static void sessionReplay_replay(void)
+{
+    sessionReplay_command_t *command;
+    uint64_t startAccessCount = 0, startTime = 0;
+    size_t i, j;
+
+    /*** Reset ***/
+    hwMemmap_init();
+    system_init();
+
+    /*** Replay ***/
+    for(i = 0; i < sessionReplay_commandCount; i++)
+    {
+        command = &sessionReplay_commands[i];
+        sessionReplay_bytesOut = 0;
+        for(j = 0; j < command->length; j++)
+        {
+            /* Start Latency At Final Byte */
+            if(j == (command->length - 1))
+            {
+                startAccessCount = sessionReplay_accessCount;
+                startTime = sessionReplay_getTime();
+            }
+
+            /* Receive Interrupt */
+            HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxRXBUF) = command->bytes[j];
+            cliCallback_usciInterruptHandler(USCI_UART_UCRXIFG);
+
+            /* Main Loop Iteration */
+            buttonDriver_tick();
+            cliCallback_tick();
+        }
+        command->latency = sessionReplay_accessCount - startAccessCount;
+        command->nanoseconds = sessionReplay_getTime() - startTime;
+        command->bytesOut = sessionReplay_bytesOut;
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   sessionReplay_writeBaseline
+ * BRIEF:   Write Baseline
+ * RETURN:  bool: Success (true) Or Failure (false)
+ * ARG:     Path: Baseline Path
+ ****************************************************************************************************/
+static bool sessionReplay_writeBaseline(const char * const Path)
+{
+    FILE *file;
+    size_t i, j;
+
+    /*** Open ***/
+    file = fopen(Path, "w");
+    if(file == NULL)
+    {
+        perror(Path);
+        return false;
+    }
+
+    /*** Write Baseline ***/
+    (void)fprintf(file, "# <#> <Latency (Register Accesses)> <Bytes Out> <Command>\n");
+    for(i = 0; i < sessionReplay_commandCount; i++)
+    {
+        (void)fprintf(file, "%zu %llu %llu ", i, (unsigned long long)sessionReplay_commands[i].latency, (unsigned long long)sessionReplay_commands[i].bytesOut);
+        for(j = 0; j < sessionReplay_commands[i].length; j++)
+        {
+            if((sessionReplay_commands[i].bytes[j] >= ' ') && (sessionReplay_commands[i].bytes[j] <= '~'))
+                (void)fputc(sessionReplay_commands[i].bytes[j], file);
+        }
+        (void)fputc('\n', file);
+    }
+    (void)fprintf(file, "p50 %llu\np99 %llu\n", (unsigned long long)sessionReplay_getPercentile(50), (unsigned long long)sessionReplay_getPercentile(99));
+    (void)fclose(file);
+
+    return true;
+}
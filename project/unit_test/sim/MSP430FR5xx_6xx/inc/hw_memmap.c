@@ -3,30 +3,385 @@
  * BRIEF:   Hardware Memory Map Source File
  ****************************************************************************************************/
 
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define HW_MEMMAP_CSCTL1_RESET      (0x000C) // DCOFSEL_6: 8 MHz
+#define HW_MEMMAP_CSCTL2_RESET      (0x0033) // SELS, SELM: DCOCLK
+#define HW_MEMMAP_CSCTL3_RESET      (0x0033) // DIVS, DIVM: / 8
+#define HW_MEMMAP_CSCTL4_RESET      (0xCDC9) // LFXTOFF, HFXTOFF
+#define HW_MEMMAP_CSCTL5_RESET      (0x00C1) // LFXTOFFG
+#define HW_MEMMAP_PERIPHERAL_LENGTH (0x1000) // Peripheral Registers: 0x0000 To 0x0FFF
+
 /****************************************************************************************************
  * Includes
  ****************************************************************************************************/
 
+#include "adc12_model.h"
+#include "aes256_model.h"
+#include "crc_model.h"
+#include "gpio_model.h"
+#include "hw_memmap.h"
+#include "hw_memmap_layout.h"
+#include "mpy32_model.h"
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef struct hwMemmap_model_s
+{
+    uint32_t baseAddress;
+    uint32_t length;
+    bool (*access)(const uint32_t Address, const uint8_t Size); // Before The Access; true: Complete After It
+    void (*complete)(const uint32_t Address, const uint8_t Size); // After The Access (Next Access Or hwMemmap_update()); NULL If access Never Asks
+    void (*reset)(void);
+} hwMemmap_model_t;
+
+typedef struct hwMemmap_region_s
+{
+    const char *name;
+    uint32_t baseAddress;
+    uint32_t length;
+} hwMemmap_region_t;
 
 /****************************************************************************************************
  * Constants and Variables
  ****************************************************************************************************/
 
-uint8_t hwMemmap_memory[65536];
+static const hwMemmap_model_t hwMemmap_models[] =
+{
+    {ADC12_B_BASE, ADC12_MODEL_LENGTH, adc12Model_access, adc12Model_complete, adc12Model_reset},
+    {AES256_BASE, AES256_MODEL_LENGTH, aes256Model_access, aes256Model_complete, aes256Model_reset},
+    {CRC_BASE, CRC_MODEL_CRC16_LENGTH, crcModel_accessCrc16, crcModel_completeCrc16, crcModel_resetCrc16},
+    {CRC32_BASE, CRC_MODEL_CRC32_LENGTH, crcModel_accessCrc32, crcModel_completeCrc32, crcModel_resetCrc32},
+    {PA_BASE, GPIO_MODEL_LENGTH, gpioModel_access, NULL, gpioModel_reset},
+    {MPY32_BASE, MPY32_MODEL_LENGTH, mpy32Model_access, mpy32Model_complete, mpy32Model_reset}
+};
+
+static const hwMemmap_region_t hwMemmap_regions[] =
+{
+    {"SFR", SFR_BASE, 0x0020},
+    {"PMM", PMM_BASE, 0x0020},
+    {"FRCTL", FRAM_BASE, 0x0010},
+    {"CRC", CRC_BASE, CRC_MODEL_CRC16_LENGTH},
+    {"RAMCTL", RAM_BASE, 0x0004},
+    {"WDT_A", WDT_A_BASE, 0x0004},
+    {"CS", CS_BASE, 0x0020},
+    {"SYS", SYS_BASE, 0x0020},
+    {"REF_A", REF_A_BASE, 0x0010},
+    {"PA", PA_BASE, 0x0020},
+    {"PB", PB_BASE, 0x0020},
+    {"PC", PC_BASE, 0x0020},
+    {"PD", PD_BASE, 0x0020},
+    {"PE", PE_BASE, 0x0020},
+    {"PJ", PJ_BASE, 0x0020},
+    {"TIMER_A0", TIMER_A0_BASE, 0x0040},
+    {"TIMER_A1", TIMER_A1_BASE, 0x0040},
+    {"TIMER_B0", TIMER_B0_BASE, 0x0040},
+    {"TIMER_A2", TIMER_A2_BASE, 0x0030},
+    {"CAP_TOUCH_0", CAP_TOUCH_0_BASE, 0x0010},
+    {"TIMER_A3", TIMER_A3_BASE, 0x0030},
+    {"CAP_TOUCH_1", CAP_TOUCH_1_BASE, 0x0010},
+    {"RTC_C", RTC_C_BASE, 0x0020},
+    {"MPY32", MPY32_BASE, MPY32_MODEL_LENGTH},
+    {"DMA", DMA_BASE, 0x0040},
+    {"MPU", MPU_BASE, 0x0010},
+    {"EUSCI_A0", EUSCI_A0_BASE, 0x0020},
+    {"EUSCI_A1", EUSCI_A1_BASE, 0x0020},
+    {"EUSCI_B0", EUSCI_B0_BASE, 0x0030},
+    {"EUSCI_B1", EUSCI_B1_BASE, 0x0030},
+    {"ADC12_B", ADC12_B_BASE, ADC12_MODEL_LENGTH},
+    {"COMP_E", COMP_E_BASE, 0x0010},
+    {"CRC32", CRC32_BASE, CRC_MODEL_CRC32_LENGTH},
+    {"AES256", AES256_BASE, AES256_MODEL_LENGTH},
+    {"LCD_C", LCD_C_BASE, 0x0060}, // LCDM1 At Offset 0x20, LCDBM1 At Offset 0x40
+    {"TLV", 0x1A00, 0x0100},
+    {"SRAM", 0x1C00, 0x0800},
+    {"FRAM", 0x4400, 0xBC00}
+};
+
+/*** Register Spaces A Power-Up Clear (PUC) Leaves Alone: Reset Only By A Brownout ***/
+static const hwMemmap_region_t hwMemmap_brownoutRegions[] =
+{
+    {"RTC_C", RTC_C_BASE, 0x0020},
+    {"LCD_C", LCD_C_BASE, 0x0060}
+};
+
+static hwMemmap_accessCallback_t hwMemmap_accessCallback[HW_MEMMAP_ACCESS_CALLBACK_COUNT];
+static uint8_t *hwMemmap_mapping;
+static const hwMemmap_model_t *hwMemmap_pendingModel;
+static uint32_t hwMemmap_pendingAddress;
+static uint8_t hwMemmap_pendingSize;
+static uint8_t hwMemmap_privateMemory[HW_MEMMAP_LENGTH];
+uint8_t *hwMemmap_memory = hwMemmap_privateMemory;
 
 /****************************************************************************************************
  * Function Definitions (Public)
  ****************************************************************************************************/
 
+/****************************************************************************************************
+ * FUNCT:   hwMemmap_access
+ * BRIEF:   Access
+ * RETURN:  uint8_t *: Pointer To Accessed Memory
+ * ARG:     Address: Address
+ * ARG:     Size: Access Size (Bytes: 1, 2 Or 4)
+ * NOTE:    Every HWREGx Access Is A Yield Point; Registered Access Callbacks Are Called Before The
+ *          Access Happens So They Can Update Peripheral Models Or Inject Interrupts
+ * NOTE:    Callbacks Must Use HW_MEMMAP_REGx (Not HWREGx) For Their Own Accesses
+ * NOTE:    Peripheral Models See Every Access To Their Registers Before It Happens And, When They Ask,
+ *          Again After It (At The Next Access), So A Write To A Data Input Register Is Processed
+ *          Before Anything Else Can Observe The Result; Reads Of Such Registers Count As Writes
+ ****************************************************************************************************/
+uint8_t *hwMemmap_access(const uint32_t Address, const uint8_t Size)
+{
+    size_t i;
+
+    /*** Complete Previous Model Access ***/
+    hwMemmap_update();
+
+    /*** Call Access Callbacks ***/
+    for(i = 0; i < HW_MEMMAP_ACCESS_CALLBACK_COUNT; i++)
+    {
+        if(hwMemmap_accessCallback[i] != NULL)
+            hwMemmap_accessCallback[i](Address);
+    }
+
+    /*** Peripheral Model ***/
+    for(i = 0; i < (sizeof(hwMemmap_models) / sizeof(hwMemmap_models[0])); i++)
+    {
+        if((Address >= hwMemmap_models[i].baseAddress) && (Address < (hwMemmap_models[i].baseAddress + hwMemmap_models[i].length)))
+        {
+            if(hwMemmap_models[i].access(Address, Size))
+            {
+                hwMemmap_pendingModel = &hwMemmap_models[i];
+                hwMemmap_pendingAddress = Address;
+                hwMemmap_pendingSize = Size;
+            }
+            break;
+        }
+    }
+
+    /*** Access ***/
+    return &hwMemmap_memory[Address];
+}
+
 /****************************************************************************************************
  * FUNCT:   hwMemmap_init
  * BRIEF:   Initialize
  * RETURN:  Returns Nothing
  * ARG:     No Arguments
+ * NOTE:    Clears Memory And Resets Peripheral Models; Access Callbacks Are Not Cleared, Whoever
+ *          Registers A Callback Unregisters It
  ****************************************************************************************************/
 void hwMemmap_init(void)
 {
-    memset(hwMemmap_memory, 0, sizeof(hwMemmap_memory));
+    size_t i;
+
+    /*** Initialize ***/
+    hwMemmap_pendingModel = NULL;
+    memset(hwMemmap_memory, 0, HW_MEMMAP_LENGTH);
+    for(i = 0; i < (sizeof(hwMemmap_models) / sizeof(hwMemmap_models[0])); i++)
+        hwMemmap_models[i].reset();
+}
+
+/****************************************************************************************************
+ * FUNCT:   hwMemmap_map
+ * BRIEF:   Map Memory To A Shared File Or Shared Memory Object
+ * RETURN:  bool: Success (true) Or Failure (false)
+ * ARG:     Path: Shared Memory Object Name ("/name": No Other '/') Or File Path (Anything Else)
+ * NOTE:    The Mapping Starts With A hwMemmapLayout_header_t (hw_memmap_layout.h) Naming Each
+ *          Peripheral's Register Space, Followed By The Address Space; Current Memory Contents Carry
+ *          Over, So It Can Be Called Before Or After hwMemmap_init()
+ * NOTE:    External Tools Map The Same Object And Read Registers (e.g. LCDMx, TA0R, P1OUT) In Place,
+ *          With No Copies Or Hooks In The Access Path
+ ****************************************************************************************************/
+bool hwMemmap_map(const char * const Path)
+{
+    hwMemmapLayout_header_t *header;
+    uint8_t *mapping, *previous;
+    size_t i;
+    int descriptor;
+
+    /*** Error Check ***/
+    if((Path == NULL) || (Path[0] == '\0'))
+        return false;
+
+    /*** Open ***/
+    if((Path[0] == '/') && (strchr(&Path[1], '/') == NULL))
+        descriptor = shm_open(Path, O_RDWR | O_CREAT, 0644);
+    else
+        descriptor = open(Path, O_RDWR | O_CREAT, 0644);
+    if(descriptor < 0)
+        return false;
+
+    /*** Map (The Descriptor Is Not Needed Once Mapped) ***/
+    if(ftruncate(descriptor, HW_MEMMAP_LAYOUT_LENGTH) != 0)
+    {
+        (void)close(descriptor);
+        return false;
+    }
+    mapping = mmap(NULL, HW_MEMMAP_LAYOUT_LENGTH, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+    (void)close(descriptor);
+    if(mapping == MAP_FAILED)
+        return false;
+
+    /*** Layout (Magic Last, So Readers Never See A Partial Header) ***/
+    header = (hwMemmapLayout_header_t *)mapping;
+    memset(header, 0, sizeof(*header));
+    header->version = HW_MEMMAP_LAYOUT_VERSION;
+    header->memoryOffset = HW_MEMMAP_LAYOUT_MEMORY_OFFSET;
+    header->memoryLength = HW_MEMMAP_LAYOUT_MEMORY_LENGTH;
+    for(i = 0; (i < (sizeof(hwMemmap_regions) / sizeof(hwMemmap_regions[0]))) && (i < HW_MEMMAP_LAYOUT_ENTRY_MAXIMUM); i++)
+    {
+        strncpy(header->entries[i].name, hwMemmap_regions[i].name, HW_MEMMAP_LAYOUT_NAME_LENGTH - 1);
+        header->entries[i].baseAddress = hwMemmap_regions[i].baseAddress;
+        header->entries[i].length = hwMemmap_regions[i].length;
+    }
+    header->entryCount = (uint16_t)i;
+    header->magic = HW_MEMMAP_LAYOUT_MAGIC;
+
+    /*** Switch Memory (Contents Carry Over) ***/
+    memcpy(&mapping[HW_MEMMAP_LAYOUT_MEMORY_OFFSET], hwMemmap_memory, HW_MEMMAP_LENGTH);
+    previous = hwMemmap_mapping;
+    hwMemmap_mapping = mapping;
+    hwMemmap_memory = &mapping[HW_MEMMAP_LAYOUT_MEMORY_OFFSET];
+    if(previous != NULL)
+        (void)munmap(previous, HW_MEMMAP_LAYOUT_LENGTH);
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   hwMemmap_powerUpClear
+ * BRIEF:   Power-Up Clear (PUC)
+ * RETURN:  Returns Nothing
+ * ARG:     Cause: SYSRSTIV Of The PUC (e.g. SYSRSTIV_WDTKEY: system_reset())
+ * NOTE:    Clears The Peripheral Registers, Except Those Only A Brownout Resets (LCD_C, RTC_C), Loads
+ *          The Clock System Reset Values, Resets Peripheral Models And Latches Cause In SYSRSTIV;
+ *          Memory (RAM, FRAM, TLV) Is Kept (hwMemmap_init() Is The Brownout)
+ ****************************************************************************************************/
+void hwMemmap_powerUpClear(const uint16_t Cause)
+{
+    uint8_t registers[HW_MEMMAP_PERIPHERAL_LENGTH];
+    size_t i;
+
+    /*** Peripheral Registers ***/
+    hwMemmap_pendingModel = NULL;
+    memcpy(registers, hwMemmap_memory, HW_MEMMAP_PERIPHERAL_LENGTH);
+    memset(hwMemmap_memory, 0, HW_MEMMAP_PERIPHERAL_LENGTH);
+    for(i = 0; i < (sizeof(hwMemmap_brownoutRegions) / sizeof(hwMemmap_brownoutRegions[0])); i++)
+        memcpy(&hwMemmap_memory[hwMemmap_brownoutRegions[i].baseAddress], &registers[hwMemmap_brownoutRegions[i].baseAddress], hwMemmap_brownoutRegions[i].length);
+    for(i = 0; i < (sizeof(hwMemmap_models) / sizeof(hwMemmap_models[0])); i++)
+        hwMemmap_models[i].reset();
+
+    /*** Clock System: DCO 8 MHz, MCLK And SMCLK / 8, LFXT Off With Its Fault Flag Set ***/
+    HW_MEMMAP_REG16(CS_BASE + OFS_CSCTL1) = HW_MEMMAP_CSCTL1_RESET;
+    HW_MEMMAP_REG16(CS_BASE + OFS_CSCTL2) = HW_MEMMAP_CSCTL2_RESET;
+    HW_MEMMAP_REG16(CS_BASE + OFS_CSCTL3) = HW_MEMMAP_CSCTL3_RESET;
+    HW_MEMMAP_REG16(CS_BASE + OFS_CSCTL4) = HW_MEMMAP_CSCTL4_RESET;
+    HW_MEMMAP_REG16(CS_BASE + OFS_CSCTL5) = HW_MEMMAP_CSCTL5_RESET;
+
+    /*** Reset Cause ***/
+    HW_MEMMAP_REG16(SYS_BASE + OFS_SYSRSTIV) = Cause;
+}
+
+/****************************************************************************************************
+ * FUNCT:   hwMemmap_registerAccessCallback
+ * BRIEF:   Register Access Callback
+ * RETURN:  bool: Success (true) Or Failure (false)
+ * ARG:     Callback: Access Callback
+ ****************************************************************************************************/
+bool hwMemmap_registerAccessCallback(const hwMemmap_accessCallback_t Callback)
+{
+    size_t i;
+
+    /*** Error Check ***/
+    if(Callback == NULL)
+        return false;
+
+    /*** Register Access Callback (Once) ***/
+    for(i = 0; i < HW_MEMMAP_ACCESS_CALLBACK_COUNT; i++)
+    {
+        if(hwMemmap_accessCallback[i] == Callback)
+            return true;
+    }
+    for(i = 0; i < HW_MEMMAP_ACCESS_CALLBACK_COUNT; i++)
+    {
+        if(hwMemmap_accessCallback[i] == NULL)
+        {
+            hwMemmap_accessCallback[i] = Callback;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/****************************************************************************************************
+ * FUNCT:   hwMemmap_unmap
+ * BRIEF:   Unmap Memory
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Memory Contents Carry Back To Private Memory; The File Or Shared Memory Object Is Left In
+ *          Place (Last State) For Post-Mortem Inspection, Whoever Named It Removes It
+ ****************************************************************************************************/
+void hwMemmap_unmap(void)
+{
+    /*** Error Check ***/
+    if(hwMemmap_mapping == NULL)
+        return;
+
+    /*** Switch Memory (Contents Carry Back) ***/
+    memcpy(hwMemmap_privateMemory, hwMemmap_memory, HW_MEMMAP_LENGTH);
+    hwMemmap_memory = hwMemmap_privateMemory;
+    (void)munmap(hwMemmap_mapping, HW_MEMMAP_LAYOUT_LENGTH);
+    hwMemmap_mapping = NULL;
+}
+
+/****************************************************************************************************
+ * FUNCT:   hwMemmap_unregisterAccessCallback
+ * BRIEF:   Unregister Access Callback
+ * RETURN:  Returns Nothing
+ * ARG:     Callback: Access Callback
+ ****************************************************************************************************/
+void hwMemmap_unregisterAccessCallback(const hwMemmap_accessCallback_t Callback)
+{
+    size_t i;
+
+    /*** Unregister Access Callback ***/
+    for(i = 0; i < HW_MEMMAP_ACCESS_CALLBACK_COUNT; i++)
+    {
+        if(hwMemmap_accessCallback[i] == Callback)
+            hwMemmap_accessCallback[i] = NULL;
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   hwMemmap_update
+ * BRIEF:   Update
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Completes The Last Peripheral Model Access (e.g. Computes A CRC After A Data Input Write);
+ *          Call Before Inspecting Model Registers With HW_MEMMAP_REGx
+ ****************************************************************************************************/
+void hwMemmap_update(void)
+{
+    const hwMemmap_model_t *model;
+
+    /*** Complete Pending Model Access ***/
+    if(hwMemmap_pendingModel != NULL)
+    {
+        model = hwMemmap_pendingModel;
+        hwMemmap_pendingModel = NULL;
+        model->complete(hwMemmap_pendingAddress, hwMemmap_pendingSize);
+    }
 }
@@ -37,12 +37,28 @@
 //
 //*****************************************************************************
 
-extern uint8_t hwMemmap_memory[65536];
+#define HW_MEMMAP_ACCESS_CALLBACK_COUNT (8)
+#define HW_MEMMAP_LENGTH (0x10000)
 
-#define HWREG8(x) (*((uint8_t *)(&hwMemmap_memory[x])))
-#define HWREG16(x) (*((uint16_t *)(&hwMemmap_memory[x])))
-#define HWREG32(x) (*((uint32_t *)(&hwMemmap_memory[x])))
+typedef void (*hwMemmap_accessCallback_t)(const uint32_t Address);
 
+extern uint8_t *hwMemmap_memory; // Private Array, Or A Shared Mapping (hwMemmap_map())
+
+#define HWREG8(x) (*((uint8_t *)hwMemmap_access((x), 1)))
+#define HWREG16(x) (*((uint16_t *)hwMemmap_access((x), 2)))
+#define HWREG32(x) (*((uint32_t *)hwMemmap_access((x), 4)))
+
+#define HW_MEMMAP_REG8(x) (*((uint8_t *)(&hwMemmap_memory[x])))
+#define HW_MEMMAP_REG16(x) (*((uint16_t *)(&hwMemmap_memory[x])))
+#define HW_MEMMAP_REG32(x) (*((uint32_t *)(&hwMemmap_memory[x])))
+
+extern uint8_t *hwMemmap_access(const uint32_t Address, const uint8_t Size);
 extern void hwMemmap_init(void);
+extern bool hwMemmap_map(const char * const Path);
+extern void hwMemmap_powerUpClear(const uint16_t Cause);
+extern bool hwMemmap_registerAccessCallback(const hwMemmap_accessCallback_t Callback);
+extern void hwMemmap_unmap(void);
+extern void hwMemmap_unregisterAccessCallback(const hwMemmap_accessCallback_t Callback);
+extern void hwMemmap_update(void);
 
 #endif // #ifndef __HW_MEMMAP__
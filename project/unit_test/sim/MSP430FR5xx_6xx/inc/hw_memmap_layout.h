@@ -0,0 +1,52 @@
+/****************************************************************************************************
+ * FILE:    hw_memmap_layout.h
+ * BRIEF:   Hardware Memory Map Shared Layout Header File
+ * NOTE:    Layout Of A Memory Map Shared With hwMemmap_map(): A Header Listing Peripheral Names And
+ *          Register Space, Then The 64 KB Address Space At HW_MEMMAP_LAYOUT_MEMORY_OFFSET; External
+ *          Tools Map The Same File Or Shared Memory Object Read-Only And Watch Registers In Place
+ * NOTE:    Standalone (No Simulator Headers), So Tools Can Include It On Their Own
+ ****************************************************************************************************/
+
+#ifndef HW_MEMMAP_LAYOUT_H
+#define HW_MEMMAP_LAYOUT_H
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define HW_MEMMAP_LAYOUT_ENTRY_MAXIMUM (48)
+#define HW_MEMMAP_LAYOUT_LENGTH        (HW_MEMMAP_LAYOUT_MEMORY_OFFSET + HW_MEMMAP_LAYOUT_MEMORY_LENGTH)
+#define HW_MEMMAP_LAYOUT_MAGIC         (0x504D4D48u) // "HMMP"
+#define HW_MEMMAP_LAYOUT_MEMORY_LENGTH (0x10000u)
+#define HW_MEMMAP_LAYOUT_MEMORY_OFFSET (0x1000u)    // Page Aligned
+#define HW_MEMMAP_LAYOUT_NAME_LENGTH   (16)
+#define HW_MEMMAP_LAYOUT_VERSION       (1)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef struct hwMemmapLayout_entry_s
+{
+    char name[HW_MEMMAP_LAYOUT_NAME_LENGTH]; // NUL Terminated (e.g. "LCD_C", "TIMER_A0", "PA")
+    uint32_t baseAddress;
+    uint32_t length;                         // Bytes
+} hwMemmapLayout_entry_t;
+
+typedef struct hwMemmapLayout_header_s
+{
+    uint32_t magic;        // HW_MEMMAP_LAYOUT_MAGIC Once The Header Is Complete
+    uint16_t version;      // HW_MEMMAP_LAYOUT_VERSION
+    uint16_t entryCount;
+    uint32_t memoryOffset; // Address 0 (From The Start Of The Mapping)
+    uint32_t memoryLength;
+    hwMemmapLayout_entry_t entries[HW_MEMMAP_LAYOUT_ENTRY_MAXIMUM];
+} hwMemmapLayout_header_t;
+
+#endif
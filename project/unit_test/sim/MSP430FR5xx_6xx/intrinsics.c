@@ -3,10 +3,19 @@
  * BRIEF:   Intrinsics Source File
  ****************************************************************************************************/
 
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define INTRINSICS_SP_RESET          (0x2290) // Stack Pointer: __STACK_END (Below RAMFUNC And The RAM Vectors)
+#define INTRINSICS_SR_GIE            (0x0008) // Status Register: General Interrupt Enable
+#define INTRINSICS_SR_LOW_POWER_MODE (0x00F0) // Status Register: CPUOFF, OSCOFF, SCG0 And SCG1
+
 /****************************************************************************************************
  * Includes
  ****************************************************************************************************/
 
+#include "inc/hw_memmap.h"
 #include "intrinsics.h"
 #include <stdbool.h>
 
@@ -15,11 +24,98 @@
  ****************************************************************************************************/
 
 static bool intrinsics_interruptsEnabled;
+static unsigned short intrinsics_lowPowerMode;
+static intrinsics_lowPowerModeHandler_t intrinsics_lowPowerModeHandler;
+static unsigned short intrinsics_stackPointer = INTRINSICS_SP_RESET;
+static unsigned short intrinsics_statusRegisterAddress; // Stacked Status Register Of The Running Interrupt Handler (0: None)
 
 /****************************************************************************************************
  * Function Definitions (Mock)
  ****************************************************************************************************/
 
+/****************************************************************************************************
+ * FUNCT:   __bic_SR_register
+ * BRIEF:   Clear Status Register Bits
+ * RETURN:  unsigned short: Status Register Before The Bits Were Cleared
+ * ARG:     mask: Bits To Clear (Only GIE And The Low Power Mode Bits Are Modeled)
+ ****************************************************************************************************/
+unsigned short __bic_SR_register(unsigned short mask)
+{
+    unsigned short statusRegister;
+
+    statusRegister = __get_SR_register();
+    if((mask & INTRINSICS_SR_GIE) != 0)
+        intrinsics_interruptsEnabled = false;
+    intrinsics_lowPowerMode &= (unsigned short)~mask;
+
+    return statusRegister;
+}
+
+/****************************************************************************************************
+ * FUNCT:   __bic_SR_register_on_exit
+ * BRIEF:   Clear Status Register Bits On Exit
+ * RETURN:  unsigned short: Stacked Status Register Before The Bits Were Cleared
+ * ARG:     mask: Bits To Clear In The Status Register Restored On Return (RETI)
+ * NOTE:    Only Meaningful Inside An Interrupt Handler; e.g. LPM3_EXIT Keeps The CPU Awake On Return
+ ****************************************************************************************************/
+unsigned short __bic_SR_register_on_exit(unsigned short mask)
+{
+    unsigned short statusRegister;
+
+    if(intrinsics_statusRegisterAddress == 0)
+        return 0;
+    statusRegister = HW_MEMMAP_REG16(intrinsics_statusRegisterAddress);
+    HW_MEMMAP_REG16(intrinsics_statusRegisterAddress) = (unsigned short)(statusRegister & ~mask);
+
+    return statusRegister;
+}
+
+/****************************************************************************************************
+ * FUNCT:   __bis_SR_register
+ * BRIEF:   Set Status Register Bits
+ * RETURN:  unsigned short: Status Register Before The Bits Were Set
+ * ARG:     mask: Bits To Set (Only GIE And The Low Power Mode Bits Are Modeled)
+ * NOTE:    Setting Low Power Mode Bits Sleeps: The Low Power Mode Handler Is Called Until One Of The
+ *          Interrupts It Delivers Clears Them On Exit; Without A Handler, Or Once It Has Nothing Left
+ *          To Deliver, The CPU Wakes Anyway So The Host Doesn't Hang
+ ****************************************************************************************************/
+unsigned short __bis_SR_register(unsigned short mask)
+{
+    unsigned short statusRegister;
+
+    statusRegister = __get_SR_register();
+    if((mask & INTRINSICS_SR_GIE) != 0)
+        intrinsics_interruptsEnabled = true;
+    intrinsics_lowPowerMode |= (unsigned short)(mask & INTRINSICS_SR_LOW_POWER_MODE);
+
+    /*** Sleep ***/
+    while(intrinsics_lowPowerMode != 0)
+    {
+        if((intrinsics_lowPowerModeHandler == 0) || !intrinsics_lowPowerModeHandler())
+            intrinsics_lowPowerMode = 0;
+    }
+
+    return statusRegister;
+}
+
+/****************************************************************************************************
+ * FUNCT:   __bis_SR_register_on_exit
+ * BRIEF:   Set Status Register Bits On Exit
+ * RETURN:  unsigned short: Stacked Status Register Before The Bits Were Set
+ * ARG:     mask: Bits To Set In The Status Register Restored On Return (RETI)
+ ****************************************************************************************************/
+unsigned short __bis_SR_register_on_exit(unsigned short mask)
+{
+    unsigned short statusRegister;
+
+    if(intrinsics_statusRegisterAddress == 0)
+        return 0;
+    statusRegister = HW_MEMMAP_REG16(intrinsics_statusRegisterAddress);
+    HW_MEMMAP_REG16(intrinsics_statusRegisterAddress) = (unsigned short)(statusRegister | mask);
+
+    return statusRegister;
+}
+
 /****************************************************************************************************
  * FUNCT:   __delay_cycles
  * BRIEF:   Delay Cycles
@@ -30,6 +126,18 @@ void __delay_cycles(unsigned long cycles)
 {
 }
 
+/****************************************************************************************************
+ * FUNCT:   __even_in_range
+ * BRIEF:   Even In Range
+ * RETURN:  unsigned int: Value
+ * ARG:     val: Value
+ * ARG:     range: Range (Hint For Compiler Only)
+ ****************************************************************************************************/
+unsigned int __even_in_range(unsigned int val, unsigned int range)
+{
+    return val;
+}
+
 /****************************************************************************************************
  * FUNCT:   __disable_interrupt
  * BRIEF:   Disable Interrupts
@@ -52,10 +160,107 @@ void __enable_interrupt(void)
     intrinsics_interruptsEnabled = true;
 }
 
+/****************************************************************************************************
+ * FUNCT:   __get_SP_register
+ * BRIEF:   Get Stack Pointer
+ * RETURN:  unsigned short: Simulated Stack Pointer (Address In Simulated RAM)
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+unsigned short __get_SP_register(void)
+{
+    return intrinsics_stackPointer;
+}
+
+/****************************************************************************************************
+ * FUNCT:   __get_SR_register
+ * BRIEF:   Get Status Register
+ * RETURN:  unsigned short: Status Register (Only GIE And The Low Power Mode Bits Are Modeled)
+ * ARG:     void: No Arguments
+ * NOTE:    Also __get_interrupt_state()
+ ****************************************************************************************************/
+unsigned short __get_SR_register(void)
+{
+    return (unsigned short)((intrinsics_interruptsEnabled ? INTRINSICS_SR_GIE : 0) | intrinsics_lowPowerMode);
+}
+
+/****************************************************************************************************
+ * FUNCT:   __no_operation
+ * BRIEF:   No Operation
+ * RETURN:  void: Returns Nothing
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+void __no_operation(void)
+{
+}
+
+/****************************************************************************************************
+ * FUNCT:   __set_SP_register
+ * BRIEF:   Set Stack Pointer
+ * RETURN:  void: Returns Nothing
+ * ARG:     value: Simulated Stack Pointer (Address In Simulated RAM)
+ * NOTE:    Host Code Runs On The Host Stack; Only Interrupt Entry Pushes Onto The Simulated Stack
+ ****************************************************************************************************/
+void __set_SP_register(unsigned short value)
+{
+    intrinsics_stackPointer = value;
+}
+
+/****************************************************************************************************
+ * FUNCT:   __set_interrupt_state
+ * BRIEF:   Set Interrupt State
+ * RETURN:  void: Returns Nothing
+ * ARG:     state: Interrupt State (From __get_interrupt_state())
+ ****************************************************************************************************/
+void __set_interrupt_state(unsigned short state)
+{
+    intrinsics_interruptsEnabled = ((state & INTRINSICS_SR_GIE) != 0);
+}
+
 /****************************************************************************************************
  * Function Definitions (Simulation)
  ****************************************************************************************************/
 
+/****************************************************************************************************
+ * FUNCT:   intrinsics_callInterruptHandler
+ * BRIEF:   Call Interrupt Handler
+ * RETURN:  bool: Called (true) Or Not Called Because Interrupts Are Disabled (false)
+ * ARG:     InterruptHandler: Interrupt Handler (Vector)
+ * NOTE:    Like The CPU, Pushes The Program Counter And Status Register Onto The Simulated Stack And
+ *          Clears The General Interrupt Enable (GIE) And Low Power Mode Bits While The Interrupt
+ *          Handler Runs; Both Are Restored From The Stacked Status Register On Return (RETI), So
+ *          __bic_SR_register_on_exit() Can Keep The CPU Awake
+ ****************************************************************************************************/
+bool intrinsics_callInterruptHandler(const intrinsics_interruptHandler_t InterruptHandler)
+{
+    unsigned short stackPointer, statusRegisterAddress;
+
+    /*** Error Check ***/
+    if(!intrinsics_interruptsEnabled || (InterruptHandler == 0))
+        return false;
+
+    /*** Push Program Counter And Status Register ***/
+    stackPointer = intrinsics_stackPointer;
+    intrinsics_stackPointer = (unsigned short)(intrinsics_stackPointer - 2);
+    HW_MEMMAP_REG16(intrinsics_stackPointer) = 0; // Program Counter (Not Modeled)
+    intrinsics_stackPointer = (unsigned short)(intrinsics_stackPointer - 2);
+    HW_MEMMAP_REG16(intrinsics_stackPointer) = (unsigned short)(INTRINSICS_SR_GIE | intrinsics_lowPowerMode);
+    statusRegisterAddress = intrinsics_statusRegisterAddress;
+    intrinsics_statusRegisterAddress = intrinsics_stackPointer;
+
+    /*** Call Interrupt Handler ***/
+    intrinsics_interruptsEnabled = false;
+    intrinsics_lowPowerMode = 0;
+    InterruptHandler();
+
+    /*** Pop ***/
+    intrinsics_interruptsEnabled = ((HW_MEMMAP_REG16(intrinsics_statusRegisterAddress) & INTRINSICS_SR_GIE) != 0);
+    intrinsics_lowPowerMode = HW_MEMMAP_REG16(intrinsics_statusRegisterAddress) & INTRINSICS_SR_LOW_POWER_MODE;
+    intrinsics_statusRegisterAddress = statusRegisterAddress;
+    intrinsics_stackPointer = stackPointer;
+
+    return true;
+}
+
 /****************************************************************************************************
  * FUNCT:   intrinsics_getInterruptsEnabled
  * BRIEF:   Get Interrupts Enabled
@@ -66,3 +271,42 @@ bool intrinsics_getInterruptsEnabled(void)
 {
     return intrinsics_interruptsEnabled;
 }
+
+/****************************************************************************************************
+ * FUNCT:   intrinsics_getLowPowerMode
+ * BRIEF:   Get Low Power Mode
+ * RETURN:  unsigned short: Low Power Mode Status Register Bits (e.g. LPM3_bits), 0 While Active
+ * ARG:     void: No Arguments
+ * NOTE:    Read From A Low Power Mode Handler To See Which Mode The CPU Sleeps In
+ ****************************************************************************************************/
+unsigned short intrinsics_getLowPowerMode(void)
+{
+    return intrinsics_lowPowerMode;
+}
+
+/****************************************************************************************************
+ * FUNCT:   intrinsics_reset
+ * BRIEF:   Reset
+ * RETURN:  void: Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Like A Brownout Reset: Interrupts Disabled, Active Mode, Stack Pointer At The End Of RAM
+ *          And No Interrupt Handler Running (e.g. After A Test longjmp()s Out Of One)
+ ****************************************************************************************************/
+void intrinsics_reset(void)
+{
+    intrinsics_interruptsEnabled = false;
+    intrinsics_lowPowerMode = 0;
+    intrinsics_stackPointer = INTRINSICS_SP_RESET;
+    intrinsics_statusRegisterAddress = 0;
+}
+
+/****************************************************************************************************
+ * FUNCT:   intrinsics_setLowPowerModeHandler
+ * BRIEF:   Set Low Power Mode Handler
+ * RETURN:  void: Returns Nothing
+ * ARG:     Handler: Called Repeatedly While The CPU Sleeps To Deliver Wake-Up Interrupts (NULL: None)
+ ****************************************************************************************************/
+void intrinsics_setLowPowerModeHandler(const intrinsics_lowPowerModeHandler_t Handler)
+{
+    intrinsics_lowPowerModeHandler = Handler;
+}
@@ -107,7 +107,8 @@ unsigned short   __swap_bytes(unsigned short a);
 /*---------------------------------------------------------------------------*/
 /* MSP430X Intrinsics                                                        */
 /*---------------------------------------------------------------------------*/
-#define __data16_write_addr(PERIPHERAL_ADDRESS, SOURCE_ADDRESS) (HWREG16((PERIPHERAL_ADDRESS)) = (SOURCE_ADDRESS)) 
+/* Simulation: 20-Bit Address Registers Are Written As 32 Bits So Host Addresses Keep Their Lower 32 Bits */
+#define __data16_write_addr(PERIPHERAL_ADDRESS, SOURCE_ADDRESS) (HWREG32((PERIPHERAL_ADDRESS)) = (SOURCE_ADDRESS)) 
 unsigned long  __data16_read_addr(unsigned short);
 void           __data20_write_char(unsigned long, unsigned char);
 void           __data20_write_short(unsigned long, unsigned short);
@@ -168,6 +169,13 @@ unsigned long  __data20_read_long(unsigned long);
 
 #include <stdbool.h>
 
+typedef void (*intrinsics_interruptHandler_t)(void);
+typedef bool (*intrinsics_lowPowerModeHandler_t)(void); // Returns false Once Nothing Is Left To Wake The CPU
+
+extern bool intrinsics_callInterruptHandler(const intrinsics_interruptHandler_t InterruptHandler);
 extern bool intrinsics_getInterruptsEnabled(void);
+extern unsigned short intrinsics_getLowPowerMode(void);
+extern void intrinsics_reset(void);
+extern void intrinsics_setLowPowerModeHandler(const intrinsics_lowPowerModeHandler_t Handler);
 
 #endif /* _INTRINSICS_H_ */
@@ -0,0 +1,919 @@
+/****************************************************************************************************
+ * FILE:    adc12_model.c
+ * BRIEF:   ADC12_B Analog-To-Digital Converter Peripheral Model Source File
+ * NOTE:    Inputs Are Driven By Generators (Constant, Sine, Noise, Chirp) Or Streamed Field Data (CSV
+ *          Or 16-Bit PCM WAV Files); Conversions Take ADC12SHTx Plus The ADC12RES Conversion Cycles
+ *          Of ADC12CLK (ADC12SSEL Source Set By adc12Model_setClock(), ADC12PDIV And ADC12DIV
+ *          Applied) And Honor ADC12CONSEQ, ADC12CSTARTADD, ADC12EOS, ADC12MSC And ADC12DF
+ * NOTE:    ADC12SC Starts A Conversion When ADC12SHS Selects It; Other ADC12SHS Sources (Timers, Not
+ *          Modeled) Fire At The Rate Set By adc12Model_setTriggerRate()
+ * NOTE:    Each Result Sets ADC12IFGx (ADC12OVIFG If Still Set), Runs The Window Comparator When
+ *          ADC12WINC Is Set And Triggers DMA Channels Whose DMAxTSEL Selects ADC12IFG; Pending
+ *          Enabled Flags Are Dispatched To The Registered Vector Handler While Interrupts Are Enabled
+ * NOTE:    Differential Mode (ADC12DIF), Extended Sample Mode (ADC12SHP = 0: Timed As Pulse Mode),
+ *          Reference Buffer Ready (ADC12RDYIFG) And DMA Interrupts Are Not Modeled
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define ADC12_MODEL_CSV_LINE_LENGTH  (1024)
+#define ADC12_MODEL_DMA_CHANNEL_SIZE (0x0010) // DMA Channel Register Space
+#define ADC12_MODEL_DMA_COUNT        (3)
+#define ADC12_MODEL_DMA_TSEL_MASK    (0x001F)
+#define ADC12_MODEL_FLAGS            (ADC12OVIFG | ADC12TOVIFG | ADC12HIIFG | ADC12LOIFG | ADC12INIFG) // ADC12IFGR2 Flags Modeled
+#define ADC12_MODEL_MEMORY_COUNT     (32)
+#define ADC12_MODEL_NANOSECONDS      (1000000000ull)
+#define ADC12_MODEL_PI               (3.14159265358979323846)
+#define ADC12_MODEL_SERVICE_MAXIMUM  (64) // Dispatches Per Service (Handlers That Never Clear Their Flag)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "adc12_model.h"
+#include "inc/hw_memmap.h"
+#include "intrinsics.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef struct adc12Model_dma_s
+{
+    bool armed; // Transfer Addresses And Count Loaded
+    uint32_t source;
+    uint32_t destination;
+    uint16_t count;
+} adc12Model_dma_t;
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static const uint16_t adc12Model_flagPriority[] = {ADC12OVIFG, ADC12TOVIFG, ADC12HIIFG, ADC12LOIFG, ADC12INIFG};
+static const uint16_t adc12Model_sampleCycles[16] = {4, 8, 16, 32, 64, 96, 128, 192, 256, 384, 512, 512, 512, 512, 512, 512};
+
+static uint8_t adc12Model_address;
+static bool adc12Model_busy, adc12Model_converting;
+static uint32_t adc12Model_clock;
+static uint64_t adc12Model_conversionEnd;
+static FILE *adc12Model_csvFile;
+static uint8_t adc12Model_csvFirstInput, adc12Model_csvValueCount;
+static uint64_t adc12Model_csvTime;
+static bool adc12Model_csvRowValid;
+static double adc12Model_csvValues[ADC12_MODEL_INPUT_COUNT];
+static adc12Model_dma_t adc12Model_dma[ADC12_MODEL_DMA_COUNT];
+static adc12Model_generator_t adc12Model_generators[ADC12_MODEL_INPUT_COUNT];
+static intrinsics_interruptHandler_t adc12Model_handler;
+static bool adc12Model_inputFromFile[ADC12_MODEL_INPUT_COUNT];
+static double adc12Model_inputVolts[ADC12_MODEL_INPUT_COUNT];
+static uint16_t adc12Model_presentedVector;
+static double adc12Model_reference;
+static adc12Model_statistics_t adc12Model_statistics;
+static uint64_t adc12Model_time, adc12Model_triggerPeriod, adc12Model_triggerTime;
+static uint32_t adc12Model_wavFrames, adc12Model_wavRate;
+static FILE *adc12Model_wavFile;
+static uint16_t adc12Model_wavFrameSize;
+static uint64_t adc12Model_wavIndex;
+static uint8_t adc12Model_wavInput;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void adc12Model_closeFiles(void);
+static void adc12Model_completeConversion(void);
+static uint64_t adc12Model_getConversionTime(const uint8_t Address);
+static double adc12Model_getInput(const uint8_t Input);
+static bool adc12Model_readCsvRow(void);
+static uint32_t adc12Model_readLittleEndian(const uint8_t Length);
+static void adc12Model_startConversion(void);
+static void adc12Model_trigger(void);
+static void adc12Model_triggerDma(void);
+static void adc12Model_updateFiles(void);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_access
+ * BRIEF:   Access
+ * RETURN:  bool: Complete After The Access (true) Or Not (false)
+ * ARG:     Address: Address
+ * ARG:     Size: Access Size (Bytes)
+ * NOTE:    An ADC12MEMx Access Clears ADC12IFGx; An ADC12IV Access Presents The Highest Priority
+ *          Pending Enabled Flag, Clearing It Unless It Is An ADC12IFGx (Cleared By Its ADC12MEMx)
+ ****************************************************************************************************/
+bool adc12Model_access(const uint32_t Address, const uint8_t Size)
+{
+    uint32_t offset, pending;
+    uint8_t bit;
+
+    (void)Size;
+
+    /*** Control 0 (ADC12SC, ADC12ENC, ADC12ON) ***/
+    offset = (Address - ADC12_B_BASE) & ~1u;
+    if(offset == OFS_ADC12CTL0)
+        return true;
+
+    /*** Conversion Memory ***/
+    if(offset >= OFS_ADC12MEM0)
+    {
+        bit = (uint8_t)((offset - OFS_ADC12MEM0) / 2);
+        HW_MEMMAP_REG32(ADC12_B_BASE + OFS_ADC12IFGR0) &= ~(1u << bit);
+        return false;
+    }
+
+    /*** Interrupt Vector ***/
+    if(offset != OFS_ADC12IV)
+        return false;
+    pending = HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12IFGR2) & HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12IER2) & ADC12_MODEL_FLAGS;
+    if(pending != 0)
+    {
+        /* Overflow, Conversion Time Overflow, Window Comparator (ADC12IV_ADC12OVIFG Onwards) */
+        for(bit = 0; (pending & adc12Model_flagPriority[bit]) == 0; bit++)
+            ;
+        HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12IFGR2) &= (uint16_t)~adc12Model_flagPriority[bit];
+        adc12Model_presentedVector = (uint16_t)(ADC12IV_ADC12OVIFG + (2 * bit));
+        HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12IV) = adc12Model_presentedVector;
+    }
+    else if((pending = HW_MEMMAP_REG32(ADC12_B_BASE + OFS_ADC12IFGR0) & HW_MEMMAP_REG32(ADC12_B_BASE + OFS_ADC12IER0)) != 0)
+    {
+        /* Conversion Memory */
+        for(bit = 0; (pending & (1u << bit)) == 0; bit++)
+            ;
+        adc12Model_presentedVector = (uint16_t)(ADC12IV_ADC12IFG0 + (2 * bit));
+        HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12IV) = adc12Model_presentedVector;
+    }
+    else if((adc12Model_presentedVector != ADC12IV_NONE) && (HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12IV) == adc12Model_presentedVector))
+    {
+        adc12Model_presentedVector = ADC12IV_NONE;
+        HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12IV) = ADC12IV_NONE;
+    }
+
+    return false;
+}
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_advance
+ * BRIEF:   Advance Time
+ * RETURN:  Returns Nothing
+ * ARG:     Microseconds: Time To Advance
+ * NOTE:    Completes Every Conversion And Fires Every Trigger Due By Then, In Order, Dispatching
+ *          Interrupts After Each
+ ****************************************************************************************************/
+void adc12Model_advance(const uint32_t Microseconds)
+{
+    uint64_t target;
+    bool triggered;
+
+    /*** Advance ***/
+    hwMemmap_update();
+    target = adc12Model_time + ((uint64_t)Microseconds * 1000u);
+    for(;;)
+    {
+        /* Next Event */
+        triggered = (adc12Model_triggerPeriod != 0) && (!adc12Model_converting || (adc12Model_triggerTime < adc12Model_conversionEnd));
+        if(triggered && (adc12Model_triggerTime <= target))
+        {
+            adc12Model_time = adc12Model_triggerTime;
+            adc12Model_triggerTime += adc12Model_triggerPeriod;
+            if((HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12CTL1) & ADC12SHS_7) != ADC12SHS_0)
+                adc12Model_trigger();
+        }
+        else if(adc12Model_converting && (adc12Model_conversionEnd <= target))
+        {
+            adc12Model_time = adc12Model_conversionEnd;
+            adc12Model_completeConversion();
+        }
+        else
+        {
+            break;
+        }
+
+        /* Dispatch */
+        adc12Model_service();
+    }
+    adc12Model_time = target;
+}
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_complete
+ * BRIEF:   Complete Access
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Address
+ * ARG:     Size: Access Size (Bytes)
+ * NOTE:    Clearing ADC12ON Aborts Any Conversion; Setting ADC12SC Starts One When ADC12SHS Selects It
+ *          (ADC12SC Then Reads Clear, As In Pulse Sample Mode)
+ ****************************************************************************************************/
+void adc12Model_complete(const uint32_t Address, const uint8_t Size)
+{
+    uint16_t control;
+
+    (void)Address;
+    (void)Size;
+
+    /*** Off ***/
+    control = HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12CTL0);
+    if((control & ADC12ON) == 0)
+    {
+        adc12Model_busy = false;
+        adc12Model_converting = false;
+        HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12CTL1) &= (uint16_t)~ADC12BUSY;
+    }
+
+    /*** Start Conversion ***/
+    if((control & ADC12SC) != 0)
+    {
+        HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12CTL0) = (uint16_t)(control & ~ADC12SC);
+        if((HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12CTL1) & ADC12SHS_7) == ADC12SHS_0)
+            adc12Model_trigger();
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_getStatistics
+ * BRIEF:   Get Statistics
+ * RETURN:  Returns Nothing
+ * ARG:     Statistics: Statistics (Since Reset)
+ ****************************************************************************************************/
+void adc12Model_getStatistics(adc12Model_statistics_t * const Statistics)
+{
+    /*** Get Statistics ***/
+    if(Statistics != NULL)
+        *Statistics = adc12Model_statistics;
+}
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_getTime
+ * BRIEF:   Get Time
+ * RETURN:  uint64_t: Model Time (Nanoseconds)
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+uint64_t adc12Model_getTime(void)
+{
+    return adc12Model_time;
+}
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_loadCsvFile
+ * BRIEF:   Load CSV File
+ * RETURN:  bool: Success (true) Or Failure (false)
+ * ARG:     Path: CSV File: One "TIME_US,VOLTS[,VOLTS...]" Row Per Line In Time Order, Lines That Do
+ *          Not Start With A Number (Headers, Comments) Are Skipped
+ * ARG:     FirstInput: Input Driven By The First VOLTS Column (Further Columns Drive The Next Inputs)
+ * NOTE:    The File Is Streamed, So Traces Of Any Length Run In Constant Memory; Each Row Holds Until
+ *          The Next (Inputs Read 0 V Before The First)
+ ****************************************************************************************************/
+bool adc12Model_loadCsvFile(const char * const Path, const uint8_t FirstInput)
+{
+    FILE *file;
+    uint8_t i;
+
+    /*** Error Check ***/
+    if(FirstInput >= ADC12_MODEL_INPUT_COUNT)
+        return false;
+
+    /*** Open ***/
+    file = fopen(Path, "r");
+    if(file == NULL)
+        return false;
+
+    /*** Load ***/
+    if(adc12Model_csvFile != NULL)
+        (void)fclose(adc12Model_csvFile);
+    adc12Model_csvFile = file;
+    adc12Model_csvFirstInput = FirstInput;
+    if(!adc12Model_readCsvRow())
+    {
+        (void)fclose(adc12Model_csvFile);
+        adc12Model_csvFile = NULL;
+        return false;
+    }
+    for(i = 0; i < adc12Model_csvValueCount; i++)
+    {
+        adc12Model_inputFromFile[FirstInput + i] = true;
+        adc12Model_inputVolts[FirstInput + i] = 0.0;
+    }
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_loadWavFile
+ * BRIEF:   Load WAV File
+ * RETURN:  bool: Success (true) Or Failure (false)
+ * ARG:     Path: WAV File: 16-Bit PCM, Any Sample Rate (The First Channel Is Used)
+ * ARG:     Input: Input Driven By The File
+ * NOTE:    The File Is Streamed; Full-Scale Samples Span 0 V To The Reference (-32768: 0 V), Each
+ *          Holding For One Sample Period
+ ****************************************************************************************************/
+bool adc12Model_loadWavFile(const char * const Path, const uint8_t Input)
+{
+    uint32_t chunkId, chunkLength;
+    uint16_t bits, channels, format;
+    FILE *file;
+
+    /*** Error Check ***/
+    if(Input >= ADC12_MODEL_INPUT_COUNT)
+        return false;
+
+    /*** Open ***/
+    file = fopen(Path, "rb");
+    if(file == NULL)
+        return false;
+    if(adc12Model_wavFile != NULL)
+        (void)fclose(adc12Model_wavFile);
+    adc12Model_wavFile = file;
+
+    /*** RIFF Header ***/
+    format = 0;
+    channels = 0;
+    bits = 0;
+    adc12Model_wavRate = 0;
+    chunkId = adc12Model_readLittleEndian(4);
+    (void)adc12Model_readLittleEndian(4); // Length
+    if((chunkId != 0x46464952u) || (adc12Model_readLittleEndian(4) != 0x45564157u)) // "RIFF", "WAVE"
+        chunkId = 0;
+
+    /*** Chunks ***/
+    while(chunkId != 0)
+    {
+        chunkId = adc12Model_readLittleEndian(4);
+        chunkLength = adc12Model_readLittleEndian(4);
+        if(feof(adc12Model_wavFile))
+        {
+            chunkId = 0;
+        }
+        else if(chunkId == 0x20746D66u) // "fmt "
+        {
+            format = (uint16_t)adc12Model_readLittleEndian(2);
+            channels = (uint16_t)adc12Model_readLittleEndian(2);
+            adc12Model_wavRate = adc12Model_readLittleEndian(4);
+            (void)adc12Model_readLittleEndian(4); // Byte Rate
+            (void)adc12Model_readLittleEndian(2); // Block Align
+            bits = (uint16_t)adc12Model_readLittleEndian(2);
+            if((chunkLength < 16) || (fseek(adc12Model_wavFile, (long)((chunkLength - 16) + (chunkLength & 1)), SEEK_CUR) != 0))
+                chunkId = 0;
+        }
+        else if(chunkId == 0x61746164u) // "data"
+        {
+            break;
+        }
+        else if(fseek(adc12Model_wavFile, (long)(chunkLength + (chunkLength & 1)), SEEK_CUR) != 0)
+        {
+            chunkId = 0;
+        }
+    }
+    if((chunkId == 0) || (format != 1) || (bits != 16) || (channels == 0) || (adc12Model_wavRate == 0))
+    {
+        (void)fclose(adc12Model_wavFile);
+        adc12Model_wavFile = NULL;
+        return false;
+    }
+
+    /*** Load ***/
+    adc12Model_wavFrameSize = (uint16_t)(channels * 2);
+    adc12Model_wavFrames = chunkLength / adc12Model_wavFrameSize;
+    adc12Model_wavIndex = 0;
+    adc12Model_wavInput = Input;
+    adc12Model_inputFromFile[Input] = true;
+    adc12Model_inputVolts[Input] = 0.0;
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_reset
+ * BRIEF:   Reset
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Clears Inputs (0 V Constants), Files, Time, Trigger Rate, Statistics And The Vector
+ *          Handler; Restores The Default Clock And Reference (Registers Are Cleared With Memory)
+ ****************************************************************************************************/
+void adc12Model_reset(void)
+{
+    /*** Reset ***/
+    adc12Model_closeFiles();
+    (void)memset(adc12Model_generators, 0, sizeof(adc12Model_generators));
+    (void)memset(adc12Model_inputFromFile, 0, sizeof(adc12Model_inputFromFile));
+    (void)memset(adc12Model_inputVolts, 0, sizeof(adc12Model_inputVolts));
+    (void)memset(adc12Model_dma, 0, sizeof(adc12Model_dma));
+    (void)memset(&adc12Model_statistics, 0, sizeof(adc12Model_statistics));
+    adc12Model_address = 0;
+    adc12Model_busy = false;
+    adc12Model_converting = false;
+    adc12Model_clock = ADC12_MODEL_CLOCK_DEFAULT;
+    adc12Model_handler = NULL;
+    adc12Model_presentedVector = ADC12IV_NONE;
+    adc12Model_reference = ADC12_MODEL_REFERENCE_DEFAULT;
+    adc12Model_time = 0;
+    adc12Model_triggerPeriod = 0;
+    adc12Model_triggerTime = 0;
+}
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_service
+ * BRIEF:   Service Interrupts
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Dispatches Pending Enabled Flags To The Vector Handler Until None Are Pending Or Interrupts
+ *          Are Disabled
+ ****************************************************************************************************/
+void adc12Model_service(void)
+{
+    uint8_t i;
+
+    /*** Service ***/
+    for(i = 0; (i < ADC12_MODEL_SERVICE_MAXIMUM) && (adc12Model_handler != NULL); i++)
+    {
+        if(((HW_MEMMAP_REG32(ADC12_B_BASE + OFS_ADC12IFGR0) & HW_MEMMAP_REG32(ADC12_B_BASE + OFS_ADC12IER0)) == 0) &&
+           ((HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12IFGR2) & HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12IER2) & ADC12_MODEL_FLAGS) == 0))
+            break;
+        if(!intrinsics_callInterruptHandler(adc12Model_handler))
+            break;
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_setClock
+ * BRIEF:   Set Clock
+ * RETURN:  Returns Nothing
+ * ARG:     Hertz: ADC12SSEL Source Frequency (Before ADC12PDIV And ADC12DIV; 0: Default)
+ ****************************************************************************************************/
+void adc12Model_setClock(const uint32_t Hertz)
+{
+    adc12Model_clock = (Hertz != 0) ? Hertz : ADC12_MODEL_CLOCK_DEFAULT;
+}
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_setGenerator
+ * BRIEF:   Set Generator
+ * RETURN:  bool: Success (true) Or Failure (false)
+ * ARG:     Input: Input (ADC12INCH_x)
+ * ARG:     Generator: Generator (Copied; Replaces Any File Driving The Input)
+ ****************************************************************************************************/
+bool adc12Model_setGenerator(const uint8_t Input, const adc12Model_generator_t * const Generator)
+{
+    /*** Error Check ***/
+    if((Input >= ADC12_MODEL_INPUT_COUNT) || (Generator == NULL) || ((Generator->waveform == ADC12_MODEL_WAVEFORM_NOISE) && (Generator->seed == 0)) ||
+       ((Generator->waveform == ADC12_MODEL_WAVEFORM_CHIRP) && (Generator->period == 0)))
+        return false;
+
+    /*** Set Generator ***/
+    adc12Model_generators[Input] = *Generator;
+    adc12Model_inputFromFile[Input] = false;
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_setReference
+ * BRIEF:   Set Reference
+ * RETURN:  Returns Nothing
+ * ARG:     Volts: Full-Scale Voltage (VR+ - VR-)
+ ****************************************************************************************************/
+void adc12Model_setReference(const double Volts)
+{
+    adc12Model_reference = (Volts > 0.0) ? Volts : ADC12_MODEL_REFERENCE_DEFAULT;
+}
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_setTriggerRate
+ * BRIEF:   Set Trigger Rate
+ * RETURN:  Returns Nothing
+ * ARG:     Hertz: Sample-And-Hold Trigger Rate Of The Non-ADC12SC ADC12SHS Sources (0: None)
+ * NOTE:    The First Trigger Fires One Period From Now
+ ****************************************************************************************************/
+void adc12Model_setTriggerRate(const uint32_t Hertz)
+{
+    /*** Set Trigger Rate ***/
+    adc12Model_triggerPeriod = (Hertz != 0) ? ((ADC12_MODEL_NANOSECONDS + (Hertz / 2)) / Hertz) : 0;
+    adc12Model_triggerTime = adc12Model_time + adc12Model_triggerPeriod;
+}
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_setVectorHandler
+ * BRIEF:   Set Vector Handler
+ * RETURN:  Returns Nothing
+ * ARG:     Handler: ADC12 Vector Interrupt Handler (NULL: Flags Stay Pending)
+ ****************************************************************************************************/
+void adc12Model_setVectorHandler(const intrinsics_interruptHandler_t Handler)
+{
+    adc12Model_handler = Handler;
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_closeFiles
+ * BRIEF:   Close Files
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+static void adc12Model_closeFiles(void)
+{
+    /*** Close Files ***/
+    if(adc12Model_csvFile != NULL)
+    {
+        (void)fclose(adc12Model_csvFile);
+        adc12Model_csvFile = NULL;
+    }
+    if(adc12Model_wavFile != NULL)
+    {
+        (void)fclose(adc12Model_wavFile);
+        adc12Model_wavFile = NULL;
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_completeConversion
+ * BRIEF:   Complete Conversion
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Stores The Result, Sets Flags, Triggers DMA And Moves The Sequence On
+ ****************************************************************************************************/
+static void adc12Model_completeConversion(void)
+{
+    uint16_t control0, control1, control2, memoryControl, resolution;
+    uint32_t code, maximum;
+    int32_t high, low, result;
+    double fraction;
+
+    /*** Convert ***/
+    control0 = HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12CTL0);
+    control1 = HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12CTL1);
+    control2 = HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12CTL2);
+    memoryControl = HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12MCTL0 + (2u * adc12Model_address));
+    resolution = ((control2 & ADC12RES_3) == ADC12RES__8BIT) ? 8 : ((control2 & ADC12RES_3) == ADC12RES__10BIT) ? 10 : 12;
+    maximum = (1u << resolution) - 1;
+    fraction = adc12Model_getInput((uint8_t)(memoryControl & ADC12INCH_31)) / adc12Model_reference;
+    code = (fraction <= 0.0) ? 0 : (fraction >= 1.0) ? maximum : (uint32_t)((fraction * (double)maximum) + 0.5);
+    if((control2 & ADC12DF) != 0)
+        result = ((int32_t)code - (int32_t)(1u << (resolution - 1))) * (int32_t)(1u << (16 - resolution)); // Signed, Left-Aligned
+    else
+        result = (int32_t)code;
+
+    /*** Store (Overflow If The Previous Result Was Not Read) ***/
+    adc12Model_converting = false;
+    adc12Model_statistics.conversions++;
+    if((HW_MEMMAP_REG32(ADC12_B_BASE + OFS_ADC12IFGR0) & (1u << adc12Model_address)) != 0)
+    {
+        HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12IFGR2) |= ADC12OVIFG;
+        adc12Model_statistics.overflows++;
+    }
+    HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12MEM0 + (2u * adc12Model_address)) = (uint16_t)result;
+    HW_MEMMAP_REG32(ADC12_B_BASE + OFS_ADC12IFGR0) |= 1u << adc12Model_address;
+
+    /*** Window Comparator ***/
+    if((memoryControl & ADC12WINC) != 0)
+    {
+        high = ((control2 & ADC12DF) != 0) ? (int16_t)HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12HI) : (int32_t)HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12HI);
+        low = ((control2 & ADC12DF) != 0) ? (int16_t)HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12LO) : (int32_t)HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12LO);
+        if(result > high)
+            HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12IFGR2) |= ADC12HIIFG;
+        else if(result < low)
+            HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12IFGR2) |= ADC12LOIFG;
+        else
+            HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12IFGR2) |= ADC12INIFG;
+    }
+
+    /*** DMA ***/
+    adc12Model_triggerDma();
+
+    /*** Sequence ***/
+    switch(control1 & ADC12CONSEQ_3)
+    {
+        case ADC12CONSEQ_0:
+            adc12Model_busy = false;
+            break;
+        case ADC12CONSEQ_1:
+            if((memoryControl & ADC12EOS) != 0)
+                adc12Model_busy = false;
+            else
+                adc12Model_address = (uint8_t)((adc12Model_address + 1) % ADC12_MODEL_MEMORY_COUNT);
+            break;
+        case ADC12CONSEQ_2:
+            adc12Model_busy = (control0 & ADC12ENC) != 0;
+            break;
+        default:
+            if((memoryControl & ADC12EOS) != 0)
+            {
+                adc12Model_address = (uint8_t)(HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12CTL3) & ADC12CSTARTADD_31);
+                adc12Model_busy = (control0 & ADC12ENC) != 0;
+            }
+            else
+            {
+                adc12Model_address = (uint8_t)((adc12Model_address + 1) % ADC12_MODEL_MEMORY_COUNT);
+            }
+            break;
+    }
+
+    /*** Next Conversion (Multiple Sample And Conversion: Immediately; Otherwise On The Next Trigger) ***/
+    if(!adc12Model_busy)
+        HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12CTL1) &= (uint16_t)~ADC12BUSY;
+    else if((control0 & ADC12MSC) != 0)
+        adc12Model_startConversion();
+}
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_getConversionTime
+ * BRIEF:   Get Conversion Time
+ * RETURN:  uint64_t: Sample-And-Hold Plus Conversion Time (Nanoseconds)
+ * ARG:     Address: Conversion Memory Address
+ ****************************************************************************************************/
+static uint64_t adc12Model_getConversionTime(const uint8_t Address)
+{
+    static const uint8_t preDivider[4] = {1, 4, 32, 64};
+    uint16_t control0, control1, control2;
+    uint32_t clock, cycles;
+
+    /*** Clock ***/
+    control0 = HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12CTL0);
+    control1 = HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12CTL1);
+    control2 = HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12CTL2);
+    clock = adc12Model_clock / (preDivider[(control1 & ADC12PDIV_3) / ADC12PDIV_1] * (((control1 & ADC12DIV_7) / ADC12DIV_1) + 1u));
+
+    /*** Cycles (ADC12SHT1 For ADC12MEM8 To ADC12MEM23) ***/
+    if((Address >= 8) && (Address < 24))
+        cycles = adc12Model_sampleCycles[(control0 & ADC12SHT1_15) / ADC12SHT1_1];
+    else
+        cycles = adc12Model_sampleCycles[(control0 & ADC12SHT0_15) / ADC12SHT0_1];
+    cycles += ((control2 & ADC12RES_3) == ADC12RES__8BIT) ? 10u : ((control2 & ADC12RES_3) == ADC12RES__10BIT) ? 12u : 14u;
+
+    return (((uint64_t)cycles * ADC12_MODEL_NANOSECONDS) + (clock - 1)) / (clock ? clock : 1);
+}
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_getInput
+ * BRIEF:   Get Input
+ * RETURN:  double: Input Voltage At The Model Time
+ * ARG:     Input: Input (ADC12INCH_x)
+ ****************************************************************************************************/
+static double adc12Model_getInput(const uint8_t Input)
+{
+    adc12Model_generator_t *generator;
+    double seconds, sweep, value;
+
+    /*** File ***/
+    adc12Model_updateFiles();
+    if(adc12Model_inputFromFile[Input])
+        return adc12Model_inputVolts[Input];
+
+    /*** Generator ***/
+    generator = &adc12Model_generators[Input];
+    seconds = (double)adc12Model_time / (double)ADC12_MODEL_NANOSECONDS;
+    switch(generator->waveform)
+    {
+        case ADC12_MODEL_WAVEFORM_SINE:
+            value = sin(2.0 * ADC12_MODEL_PI * generator->frequency * seconds);
+            break;
+        case ADC12_MODEL_WAVEFORM_NOISE:
+            generator->seed ^= generator->seed << 13;
+            generator->seed ^= generator->seed >> 17;
+            generator->seed ^= generator->seed << 5;
+            value = (2.0 * ((double)generator->seed / 4294967295.0)) - 1.0;
+            break;
+        case ADC12_MODEL_WAVEFORM_CHIRP:
+            sweep = (double)generator->period / 1000000.0;
+            seconds = fmod(seconds, sweep);
+            value = sin(2.0 * ADC12_MODEL_PI * ((generator->frequency * seconds) + (((generator->frequencyEnd - generator->frequency) * seconds * seconds) / (2.0 * sweep))));
+            break;
+        default:
+            value = 0.0;
+            break;
+    }
+
+    return generator->offset + (generator->amplitude * value);
+}
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_readCsvRow
+ * BRIEF:   Read CSV Row
+ * RETURN:  bool: Row Read (true) Or End Of File (false)
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+static bool adc12Model_readCsvRow(void)
+{
+    char line[ADC12_MODEL_CSV_LINE_LENGTH];
+    char *end, *field;
+    unsigned long long time;
+
+    /*** Read Row ***/
+    adc12Model_csvRowValid = false;
+    while(fgets(line, sizeof(line), adc12Model_csvFile) != NULL)
+    {
+        time = strtoull(line, &end, 10);
+        if(end == line)
+            continue;
+        adc12Model_csvValueCount = 0;
+        while((*end == ',') && ((adc12Model_csvFirstInput + adc12Model_csvValueCount) < ADC12_MODEL_INPUT_COUNT))
+        {
+            field = end + 1;
+            adc12Model_csvValues[adc12Model_csvValueCount] = strtod(field, &end);
+            if(end == field)
+                break;
+            adc12Model_csvValueCount++;
+        }
+        if(adc12Model_csvValueCount == 0)
+            continue;
+        adc12Model_csvTime = (uint64_t)time * 1000u;
+        adc12Model_csvRowValid = true;
+        return true;
+    }
+
+    return false;
+}
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_readLittleEndian
+ * BRIEF:   Read Little-Endian Value From WAV File
+ * RETURN:  uint32_t: Value (0 At End Of File)
+ * ARG:     Length: Length (Bytes: 1 To 4)
+ ****************************************************************************************************/
+static uint32_t adc12Model_readLittleEndian(const uint8_t Length)
+{
+    uint8_t bytes[4] = {0};
+    uint32_t value;
+    uint8_t i;
+
+    /*** Read ***/
+    if(fread(bytes, 1, Length, adc12Model_wavFile) != Length)
+        return 0;
+    value = 0;
+    for(i = Length; i > 0; i--)
+        value = (value << 8) | bytes[i - 1];
+
+    return value;
+}
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_startConversion
+ * BRIEF:   Start Conversion
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+static void adc12Model_startConversion(void)
+{
+    /*** Start Conversion ***/
+    adc12Model_converting = true;
+    adc12Model_conversionEnd = adc12Model_time + adc12Model_getConversionTime(adc12Model_address);
+}
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_trigger
+ * BRIEF:   Sample-And-Hold Trigger
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Starts A Sequence At ADC12CSTARTADD Or Its Next Conversion; A Trigger While Converting Sets
+ *          ADC12TOVIFG
+ ****************************************************************************************************/
+static void adc12Model_trigger(void)
+{
+    /*** Enabled? ***/
+    if((HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12CTL0) & (ADC12ON | ADC12ENC)) != (ADC12ON | ADC12ENC))
+        return;
+
+    /*** Conversion Time Overflow ***/
+    if(adc12Model_converting)
+    {
+        HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12IFGR2) |= ADC12TOVIFG;
+        adc12Model_statistics.timeOverflows++;
+        return;
+    }
+
+    /*** Start ***/
+    if(!adc12Model_busy)
+    {
+        adc12Model_address = (uint8_t)(HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12CTL3) & ADC12CSTARTADD_31);
+        adc12Model_busy = true;
+        HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12CTL1) |= ADC12BUSY;
+    }
+    adc12Model_startConversion();
+}
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_triggerDma
+ * BRIEF:   Trigger DMA Channels
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Enabled Channels Selecting ADC12IFG Move One Unit (Single Transfer Modes) Or The Rest Of
+ *          The Block (Block Modes) From Working Copies Of DMAxSA, DMAxDA And DMAxSZ, Loaded On The
+ *          First Trigger; Reading An ADC12MEMx Clears ADC12IFGx As A CPU Read Would
+ ****************************************************************************************************/
+static void adc12Model_triggerDma(void)
+{
+    adc12Model_dma_t *dma;
+    uint16_t control, selects, transferMode, value;
+    uint32_t address;
+    uint8_t channel;
+
+    for(channel = 0; channel < ADC12_MODEL_DMA_COUNT; channel++)
+    {
+        /*** Triggered? ***/
+        dma = &adc12Model_dma[channel];
+        address = (uint32_t)(DMA_BASE + OFS_DMA0CTL + (channel * ADC12_MODEL_DMA_CHANNEL_SIZE));
+        control = HW_MEMMAP_REG16(address);
+        selects = (channel < 2) ? (uint16_t)(HW_MEMMAP_REG16(DMA_BASE + OFS_DMACTL0) >> (8 * channel)) : HW_MEMMAP_REG16(DMA_BASE + OFS_DMACTL1);
+        if((control & DMAEN) == 0)
+            dma->armed = false;
+        if(((control & DMAEN) == 0) || ((selects & ADC12_MODEL_DMA_TSEL_MASK) != DMA0TSEL__ADC12IFG))
+            continue;
+        if(!dma->armed)
+        {
+            dma->source = HW_MEMMAP_REG32(address + (OFS_DMA0SA - OFS_DMA0CTL));
+            dma->destination = HW_MEMMAP_REG32(address + (OFS_DMA0DA - OFS_DMA0CTL));
+            dma->count = HW_MEMMAP_REG16(address + (OFS_DMA0SZ - OFS_DMA0CTL));
+            dma->armed = dma->count != 0;
+        }
+
+        /*** Transfer ***/
+        transferMode = control & DMADT_7;
+        while(dma->armed)
+        {
+            /* Read */
+            if((control & DMASRCBYTE) != 0)
+                value = HW_MEMMAP_REG8((uint16_t)dma->source);
+            else
+                value = HW_MEMMAP_REG16((uint16_t)dma->source);
+            if(((uint16_t)dma->source >= (ADC12_B_BASE + OFS_ADC12MEM0)) && ((uint16_t)dma->source < (ADC12_B_BASE + ADC12_MODEL_LENGTH)))
+                HW_MEMMAP_REG32(ADC12_B_BASE + OFS_ADC12IFGR0) &= ~(1u << ((((uint16_t)dma->source - ADC12_B_BASE) - OFS_ADC12MEM0) / 2));
+
+            /* Write */
+            if((control & DMADSTBYTE) != 0)
+                HW_MEMMAP_REG8((uint16_t)dma->destination) = (uint8_t)value;
+            else
+                HW_MEMMAP_REG16((uint16_t)dma->destination) = value;
+            adc12Model_statistics.dmaTransfers++;
+
+            /* Next Address */
+            if((control & DMASRCINCR_3) == DMASRCINCR_3)
+                dma->source += ((control & DMASRCBYTE) != 0) ? 1u : 2u;
+            else if((control & DMASRCINCR_3) == DMASRCINCR_2)
+                dma->source -= ((control & DMASRCBYTE) != 0) ? 1u : 2u;
+            if((control & DMADSTINCR_3) == DMADSTINCR_3)
+                dma->destination += ((control & DMADSTBYTE) != 0) ? 1u : 2u;
+            else if((control & DMADSTINCR_3) == DMADSTINCR_2)
+                dma->destination -= ((control & DMADSTBYTE) != 0) ? 1u : 2u;
+
+            /* Count (Repeated Modes Keep DMAEN And Reload On The Next Trigger) */
+            if(--dma->count == 0)
+            {
+                dma->armed = false;
+                control |= DMAIFG;
+                if(transferMode < DMADT_4)
+                    control &= (uint16_t)~DMAEN;
+                HW_MEMMAP_REG16(address) = control;
+            }
+            if((transferMode == DMADT_0) || (transferMode == DMADT_4))
+                break;
+        }
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   adc12Model_updateFiles
+ * BRIEF:   Update File-Driven Inputs
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Applies Every CSV Row And WAV Sample Due By The Model Time
+ ****************************************************************************************************/
+static void adc12Model_updateFiles(void)
+{
+    uint64_t index;
+    uint8_t i;
+    int16_t sample;
+
+    /*** CSV ***/
+    while((adc12Model_csvFile != NULL) && adc12Model_csvRowValid && (adc12Model_csvTime <= adc12Model_time))
+    {
+        for(i = 0; i < adc12Model_csvValueCount; i++)
+            adc12Model_inputVolts[adc12Model_csvFirstInput + i] = adc12Model_csvValues[i];
+        (void)adc12Model_readCsvRow();
+    }
+
+    /*** WAV (Frame 0 At Time 0) ***/
+    if(adc12Model_wavFile != NULL)
+    {
+        index = (adc12Model_time * adc12Model_wavRate) / ADC12_MODEL_NANOSECONDS;
+        while((adc12Model_wavIndex <= index) && (adc12Model_wavIndex < adc12Model_wavFrames))
+        {
+            sample = (int16_t)adc12Model_readLittleEndian(2);
+            if((adc12Model_wavFrameSize > 2) && (fseek(adc12Model_wavFile, adc12Model_wavFrameSize - 2, SEEK_CUR) != 0))
+                adc12Model_wavFrames = 0;
+            adc12Model_inputVolts[adc12Model_wavInput] = (((double)sample + 32768.0) / 65535.0) * adc12Model_reference;
+            adc12Model_wavIndex++;
+        }
+    }
+}
@@ -0,0 +1,76 @@
+/****************************************************************************************************
+ * FILE:    adc12_model.h
+ * BRIEF:   ADC12_B Analog-To-Digital Converter Peripheral Model Header File
+ ****************************************************************************************************/
+
+#ifndef ADC12_MODEL_H
+#define ADC12_MODEL_H
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define ADC12_MODEL_CLOCK_DEFAULT     (4800000u) // MODOSC (Hertz)
+#define ADC12_MODEL_INPUT_COUNT       (32)       // ADC12INCH_0 To ADC12INCH_31
+#define ADC12_MODEL_LENGTH            (0x00A0)   // ADC12_B Module Register Space (ADC12_B_BASE)
+#define ADC12_MODEL_REFERENCE_DEFAULT (3.3)      // AVCC (Volts)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "intrinsics.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef enum adc12Model_waveform_e
+{
+    ADC12_MODEL_WAVEFORM_CONSTANT,
+    ADC12_MODEL_WAVEFORM_SINE,
+    ADC12_MODEL_WAVEFORM_NOISE, // Uniform
+    ADC12_MODEL_WAVEFORM_CHIRP  // Linear, Repeating
+} adc12Model_waveform_t;
+
+typedef struct adc12Model_generator_s
+{
+    adc12Model_waveform_t waveform;
+    double offset;       // Volts
+    double amplitude;    // Volts (Peak)
+    double frequency;    // Hertz (Chirp: Start)
+    double frequencyEnd; // Hertz (Chirp Only)
+    uint32_t period;     // Microseconds (Chirp Only: Sweep Time)
+    uint32_t seed;       // xorshift32 State (Noise Only; Nonzero)
+} adc12Model_generator_t;
+
+typedef struct adc12Model_statistics_s
+{
+    uint32_t conversions;
+    uint32_t overflows;     // ADC12OVIFG: Result Overwritten Before It Was Read
+    uint32_t timeOverflows; // ADC12TOVIFG: Trigger While Converting
+    uint32_t dmaTransfers;
+} adc12Model_statistics_t;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern bool adc12Model_access(const uint32_t Address, const uint8_t Size);
+extern void adc12Model_advance(const uint32_t Microseconds);
+extern void adc12Model_complete(const uint32_t Address, const uint8_t Size);
+extern void adc12Model_getStatistics(adc12Model_statistics_t * const Statistics);
+extern uint64_t adc12Model_getTime(void);
+extern bool adc12Model_loadCsvFile(const char * const Path, const uint8_t FirstInput);
+extern bool adc12Model_loadWavFile(const char * const Path, const uint8_t Input);
+extern void adc12Model_reset(void);
+extern void adc12Model_service(void);
+extern void adc12Model_setClock(const uint32_t Hertz);
+extern bool adc12Model_setGenerator(const uint8_t Input, const adc12Model_generator_t * const Generator);
+extern void adc12Model_setReference(const double Volts);
+extern void adc12Model_setTriggerRate(const uint32_t Hertz);
+extern void adc12Model_setVectorHandler(const intrinsics_interruptHandler_t Handler);
+
+#endif
@@ -0,0 +1,386 @@
+/****************************************************************************************************
+ * FILE:    aes256_model.c
+ * BRIEF:   AES256 Accelerator Peripheral Model Source File
+ * NOTE:    Bit-Exact Model Of The AES Accelerator (FIPS-197 AES-128/192/256): The Key Is Expanded Once
+ *          All AESAKEY Bytes Are Written; A Block Is Encrypted Or Decrypted (AESOPx) Once All 16
+ *          AESADIN Or AESAXDIN Bytes Are Written, Completing Immediately (AESBUSY Never Reads Set)
+ * NOTE:    AESAXDIN And AESAXIN Bytes Are XORed With The Previous Output Block (Software CBC); DMA
+ *          Cipher Modes (AESCMEN) Are Not Modeled
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define AES256_MODEL_BLOCK_LENGTH   (16)
+#define AES256_MODEL_KEY_MAXIMUM    (32)
+#define AES256_MODEL_ROUNDS_MAXIMUM (14)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "aes256_model.h"
+#include "inc/hw_memmap.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static uint8_t aes256Model_dataInCount, aes256Model_dataOutCount, aes256Model_keyCount;
+static uint8_t aes256Model_input[AES256_MODEL_BLOCK_LENGTH], aes256Model_output[AES256_MODEL_BLOCK_LENGTH];
+static uint8_t aes256Model_inverseSubstitution[256], aes256Model_substitution[256];
+static uint8_t aes256Model_key[AES256_MODEL_KEY_MAXIMUM];
+static bool aes256Model_keyReady, aes256Model_tablesReady;
+static uint8_t aes256Model_rounds;
+static uint8_t aes256Model_roundKeys[(AES256_MODEL_ROUNDS_MAXIMUM + 1) * AES256_MODEL_BLOCK_LENGTH];
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void aes256Model_addRoundKey(uint8_t * const State, const uint8_t Round);
+static void aes256Model_decrypt(const uint8_t * const Input, uint8_t * const Output);
+static void aes256Model_encrypt(const uint8_t * const Input, uint8_t * const Output);
+static void aes256Model_expandKey(const uint8_t KeyLength);
+static void aes256Model_initTables(void);
+static uint8_t aes256Model_multiply(uint8_t A, uint8_t B);
+static void aes256Model_updateStatus(void);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   aes256Model_access
+ * BRIEF:   Access
+ * RETURN:  bool: Complete After The Access (true) Or Not (false)
+ * ARG:     Address: Address
+ * ARG:     Size: Access Size (Bytes)
+ * NOTE:    AESADOUT Reads Are Served Here, Before The Read, One Output Byte Per Byte Read
+ ****************************************************************************************************/
+bool aes256Model_access(const uint32_t Address, const uint8_t Size)
+{
+    uint8_t i;
+
+    /*** Data Out Read ***/
+    if((Address & ~1u) == (AES256_BASE + OFS_AESADOUT))
+    {
+        for(i = 0; (i < Size) && ((Address + i) < (AES256_BASE + OFS_AESADOUT + 2)); i++)
+        {
+            HW_MEMMAP_REG8(Address + i) = aes256Model_output[aes256Model_dataOutCount];
+            aes256Model_dataOutCount = (uint8_t)((aes256Model_dataOutCount + 1) % AES256_MODEL_BLOCK_LENGTH);
+            if(aes256Model_dataOutCount == 0)
+                HW_MEMMAP_REG16(AES256_BASE + OFS_AESASTAT) |= AESDOUTRD;
+        }
+        aes256Model_updateStatus();
+        return false;
+    }
+
+    /*** Control, Status, Key And Data In Writes ***/
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   aes256Model_complete
+ * BRIEF:   Complete Access
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Address
+ * ARG:     Size: Access Size (Bytes)
+ ****************************************************************************************************/
+void aes256Model_complete(const uint32_t Address, const uint8_t Size)
+{
+    static const uint8_t keyLengths[4] = {16, 24, 32, 32}; // AESKL
+    uint32_t address, offset;
+    uint16_t control;
+    uint8_t byte;
+
+    /*** Software Reset ***/
+    control = HW_MEMMAP_REG16(AES256_BASE + OFS_AESACTL0);
+    if((control & AESSWRST) == AESSWRST)
+    {
+        aes256Model_reset();
+        HW_MEMMAP_REG16(AES256_BASE + OFS_AESACTL0) = (uint16_t)(control & ~AESSWRST);
+        HW_MEMMAP_REG16(AES256_BASE + OFS_AESASTAT) = 0;
+        return;
+    }
+
+    /*** Written Bytes ***/
+    for(address = Address; address < (Address + Size); address++)
+    {
+        offset = address - AES256_BASE;
+        byte = HW_MEMMAP_REG8(address);
+        if((offset == OFS_AESAKEY) || (offset == OFS_AESAKEY_H))
+        {
+            /* Key (A New Key Invalidates The Old One) */
+            if(aes256Model_keyCount == 0)
+                HW_MEMMAP_REG16(AES256_BASE + OFS_AESASTAT) &= (uint16_t)~AESKEYWR;
+            aes256Model_key[aes256Model_keyCount++] = byte;
+            if(aes256Model_keyCount >= keyLengths[(control & (AESKL0 | AESKL1)) >> 2])
+            {
+                aes256Model_expandKey(aes256Model_keyCount);
+                aes256Model_keyCount = 0;
+                HW_MEMMAP_REG16(AES256_BASE + OFS_AESASTAT) |= AESKEYWR;
+                if((control & AESOP_3) == AESOP_2) // First Round Key Generated
+                    HW_MEMMAP_REG16(AES256_BASE + OFS_AESACTL0) |= AESRDYIFG;
+            }
+        }
+        else if(((offset >= OFS_AESADIN) && (offset < OFS_AESADOUT)) || (offset >= OFS_AESAXDIN))
+        {
+            /* Data In (XOR With Previous Output For AESAXDIN, AESAXIN) */
+            if(aes256Model_dataInCount == 0)
+                HW_MEMMAP_REG16(AES256_BASE + OFS_AESASTAT) &= (uint16_t)~AESDINWR;
+            aes256Model_input[aes256Model_dataInCount] = (offset < OFS_AESADOUT) ? byte : (uint8_t)(byte ^ aes256Model_output[aes256Model_dataInCount]);
+            if(++aes256Model_dataInCount < AES256_MODEL_BLOCK_LENGTH)
+                continue;
+            aes256Model_dataInCount = 0;
+            HW_MEMMAP_REG16(AES256_BASE + OFS_AESASTAT) |= AESDINWR;
+            if(offset >= OFS_AESAXIN)
+                continue; // No Trigger
+
+            /* Operation */
+            if(!aes256Model_keyReady)
+            {
+                HW_MEMMAP_REG16(AES256_BASE + OFS_AESACTL0) |= AESERRFG;
+                continue;
+            }
+            if((control & AESOP0) == AESOP0)
+                aes256Model_decrypt(aes256Model_input, aes256Model_output);
+            else
+                aes256Model_encrypt(aes256Model_input, aes256Model_output);
+            aes256Model_dataOutCount = 0;
+            HW_MEMMAP_REG16(AES256_BASE + OFS_AESASTAT) &= (uint16_t)~AESDOUTRD;
+            HW_MEMMAP_REG16(AES256_BASE + OFS_AESACTL0) |= AESRDYIFG;
+        }
+    }
+    aes256Model_updateStatus();
+}
+
+/****************************************************************************************************
+ * FUNCT:   aes256Model_reset
+ * BRIEF:   Reset
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+void aes256Model_reset(void)
+{
+    /*** Reset ***/
+    aes256Model_initTables();
+    aes256Model_dataInCount = 0;
+    aes256Model_dataOutCount = 0;
+    aes256Model_keyCount = 0;
+    aes256Model_keyReady = false;
+    (void)memset(aes256Model_input, 0, sizeof(aes256Model_input));
+    (void)memset(aes256Model_output, 0, sizeof(aes256Model_output));
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   aes256Model_addRoundKey
+ * BRIEF:   Add Round Key
+ * RETURN:  Returns Nothing
+ * ARG:     State: State
+ * ARG:     Round: Round
+ ****************************************************************************************************/
+static void aes256Model_addRoundKey(uint8_t * const State, const uint8_t Round)
+{
+    uint8_t i;
+
+    /*** Add Round Key ***/
+    for(i = 0; i < AES256_MODEL_BLOCK_LENGTH; i++)
+        State[i] ^= aes256Model_roundKeys[(Round * AES256_MODEL_BLOCK_LENGTH) + i];
+}
+
+/****************************************************************************************************
+ * FUNCT:   aes256Model_decrypt
+ * BRIEF:   Decrypt (Inverse Cipher)
+ * RETURN:  Returns Nothing
+ * ARG:     Input: Cipher Text Block
+ * ARG:     Output: Plain Text Block
+ ****************************************************************************************************/
+static void aes256Model_decrypt(const uint8_t * const Input, uint8_t * const Output)
+{
+    uint8_t column, i, round, state[AES256_MODEL_BLOCK_LENGTH], temporary[AES256_MODEL_BLOCK_LENGTH];
+
+    /*** Decrypt ***/
+    (void)memcpy(state, Input, sizeof(state));
+    aes256Model_addRoundKey(state, aes256Model_rounds);
+    for(round = aes256Model_rounds; round-- > 0;)
+    {
+        /* Inverse Shift Rows And Inverse Substitute Bytes */
+        for(i = 0; i < AES256_MODEL_BLOCK_LENGTH; i++)
+            temporary[(i + (4 * (i % 4))) % AES256_MODEL_BLOCK_LENGTH] = aes256Model_inverseSubstitution[state[i]];
+        (void)memcpy(state, temporary, sizeof(state));
+        aes256Model_addRoundKey(state, round);
+        if(round == 0)
+            break;
+
+        /* Inverse Mix Columns */
+        for(column = 0; column < 4; column++)
+        {
+            for(i = 0; i < 4; i++)
+                temporary[i] = state[(4 * column) + i];
+            for(i = 0; i < 4; i++)
+                state[(4 * column) + i] = (uint8_t)(aes256Model_multiply(temporary[i], 14) ^ aes256Model_multiply(temporary[(i + 1) % 4], 11) ^ aes256Model_multiply(temporary[(i + 2) % 4], 13) ^ aes256Model_multiply(temporary[(i + 3) % 4], 9));
+        }
+    }
+    (void)memcpy(Output, state, sizeof(state));
+}
+
+/****************************************************************************************************
+ * FUNCT:   aes256Model_encrypt
+ * BRIEF:   Encrypt (Cipher)
+ * RETURN:  Returns Nothing
+ * ARG:     Input: Plain Text Block
+ * ARG:     Output: Cipher Text Block
+ ****************************************************************************************************/
+static void aes256Model_encrypt(const uint8_t * const Input, uint8_t * const Output)
+{
+    uint8_t column, i, round, state[AES256_MODEL_BLOCK_LENGTH], temporary[AES256_MODEL_BLOCK_LENGTH];
+
+    /*** Encrypt ***/
+    (void)memcpy(state, Input, sizeof(state));
+    aes256Model_addRoundKey(state, 0);
+    for(round = 1; round <= aes256Model_rounds; round++)
+    {
+        /* Substitute Bytes And Shift Rows */
+        for(i = 0; i < AES256_MODEL_BLOCK_LENGTH; i++)
+            temporary[i] = aes256Model_substitution[state[(i + (4 * (i % 4))) % AES256_MODEL_BLOCK_LENGTH]];
+        (void)memcpy(state, temporary, sizeof(state));
+
+        /* Mix Columns (Not In The Last Round) */
+        if(round < aes256Model_rounds)
+        {
+            for(column = 0; column < 4; column++)
+            {
+                for(i = 0; i < 4; i++)
+                    temporary[i] = state[(4 * column) + i];
+                for(i = 0; i < 4; i++)
+                    state[(4 * column) + i] = (uint8_t)(aes256Model_multiply(temporary[i], 2) ^ aes256Model_multiply(temporary[(i + 1) % 4], 3) ^ temporary[(i + 2) % 4] ^ temporary[(i + 3) % 4]);
+            }
+        }
+        aes256Model_addRoundKey(state, round);
+    }
+    (void)memcpy(Output, state, sizeof(state));
+}
+
+/****************************************************************************************************
+ * FUNCT:   aes256Model_expandKey
+ * BRIEF:   Expand Key
+ * RETURN:  Returns Nothing
+ * ARG:     KeyLength: Key Length (Bytes: 16, 24 Or 32)
+ ****************************************************************************************************/
+static void aes256Model_expandKey(const uint8_t KeyLength)
+{
+    uint8_t i, roundConstant = 1, temporary[4], words;
+    uint16_t word;
+
+    /*** Expand Key ***/
+    words = (uint8_t)(KeyLength / 4);
+    aes256Model_rounds = (uint8_t)(words + 6);
+    (void)memcpy(aes256Model_roundKeys, aes256Model_key, KeyLength);
+    for(word = words; word < (4u * (aes256Model_rounds + 1u)); word++)
+    {
+        (void)memcpy(temporary, &aes256Model_roundKeys[4 * (word - 1)], sizeof(temporary));
+        if((word % words) == 0)
+        {
+            /* Rotate, Substitute, Round Constant */
+            i = temporary[0];
+            temporary[0] = (uint8_t)(aes256Model_substitution[temporary[1]] ^ roundConstant);
+            temporary[1] = aes256Model_substitution[temporary[2]];
+            temporary[2] = aes256Model_substitution[temporary[3]];
+            temporary[3] = aes256Model_substitution[i];
+            roundConstant = aes256Model_multiply(roundConstant, 2);
+        }
+        else if((words > 6) && ((word % words) == 4))
+        {
+            /* Substitute (AES-256) */
+            for(i = 0; i < 4; i++)
+                temporary[i] = aes256Model_substitution[temporary[i]];
+        }
+        for(i = 0; i < 4; i++)
+            aes256Model_roundKeys[(4 * word) + i] = (uint8_t)(aes256Model_roundKeys[(4 * (word - words)) + i] ^ temporary[i]);
+    }
+    aes256Model_keyReady = true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   aes256Model_initTables
+ * BRIEF:   Initialize Tables
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Substitution Box From The Multiplicative Inverse In GF(2^8) And The Affine Transform
+ ****************************************************************************************************/
+static void aes256Model_initTables(void)
+{
+    uint8_t inverse = 1, value = 1, substitution;
+
+    /*** Once ***/
+    if(aes256Model_tablesReady)
+        return;
+
+    /*** Walk The Generator (3) And Its Inverse Together ***/
+    do
+    {
+        value = (uint8_t)(value ^ (value << 1) ^ (((value & 0x80) != 0) ? 0x1B : 0));
+        inverse ^= (uint8_t)(inverse << 1);
+        inverse ^= (uint8_t)(inverse << 2);
+        inverse ^= (uint8_t)(inverse << 4);
+        if((inverse & 0x80) != 0)
+            inverse ^= 0x09;
+        substitution = (uint8_t)(inverse ^ ((inverse << 1) | (inverse >> 7)) ^ ((inverse << 2) | (inverse >> 6)) ^ ((inverse << 3) | (inverse >> 5)) ^ ((inverse << 4) | (inverse >> 4)) ^ 0x63);
+        aes256Model_substitution[value] = substitution;
+        aes256Model_inverseSubstitution[substitution] = value;
+    } while(value != 1);
+    aes256Model_substitution[0] = 0x63;
+    aes256Model_inverseSubstitution[0x63] = 0;
+    aes256Model_tablesReady = true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   aes256Model_multiply
+ * BRIEF:   Multiply In GF(2^8)
+ * RETURN:  uint8_t: Product
+ * ARG:     A: Multiplicand
+ * ARG:     B: Multiplier
+ ****************************************************************************************************/
+static uint8_t aes256Model_multiply(uint8_t A, uint8_t B)
+{
+    uint8_t product = 0;
+
+    /*** Multiply ***/
+    while(B != 0)
+    {
+        if((B & 1) != 0)
+            product ^= A;
+        A = (uint8_t)((A << 1) ^ (((A & 0x80) != 0) ? 0x1B : 0));
+        B >>= 1;
+    }
+
+    return product;
+}
+
+/****************************************************************************************************
+ * FUNCT:   aes256Model_updateStatus
+ * BRIEF:   Update Status
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    AESASTAT Byte Counters; AESBUSY Is Clear Because Operations Complete Immediately
+ ****************************************************************************************************/
+static void aes256Model_updateStatus(void)
+{
+    uint16_t status;
+
+    /*** Update Status ***/
+    status = HW_MEMMAP_REG16(AES256_BASE + OFS_AESASTAT) & (AESKEYWR | AESDINWR | AESDOUTRD);
+    status |= (uint16_t)((aes256Model_keyCount & 0xF) << 4);
+    status |= (uint16_t)((aes256Model_dataInCount & 0xF) << 8);
+    status |= (uint16_t)((aes256Model_dataOutCount & 0xF) << 12);
+    HW_MEMMAP_REG16(AES256_BASE + OFS_AESASTAT) = status;
+}
@@ -0,0 +1,30 @@
+/****************************************************************************************************
+ * FILE:    aes256_model.h
+ * BRIEF:   AES256 Accelerator Peripheral Model Header File
+ ****************************************************************************************************/
+
+#ifndef AES256_MODEL_H
+#define AES256_MODEL_H
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define AES256_MODEL_LENGTH (0x0010) // AES256 Module Register Space (AES256_BASE)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern bool aes256Model_access(const uint32_t Address, const uint8_t Size);
+extern void aes256Model_complete(const uint32_t Address, const uint8_t Size);
+extern void aes256Model_reset(void);
+
+#endif
@@ -0,0 +1,268 @@
+/****************************************************************************************************
+ * FILE:    crc_model.c
+ * BRIEF:   CRC And CRC32 Peripheral Model Source File
+ * NOTE:    Bit-Exact Models Of The CRC Module (CRC-CCITT) And The CRC32 Module (CRC-CCITT And
+ *          CRC32-ISO3309); Both Hold The Signature In A Left-Shifting Register: Bytes Written To A
+ *          Data In Register Are Fed LSB First, Bytes Written To A Data In Reverse Register MSB First;
+ *          Result Reverse Registers Hold The Bit-Reversed Signature
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define CRC_MODEL_CRC16_POLYNOMIAL (0x1021u)     // CRC-CCITT
+#define CRC_MODEL_CRC32_POLYNOMIAL (0x04C11DB7u) // CRC32-ISO3309
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "crc_model.h"
+#include "inc/hw_memmap.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static uint8_t crcModel_reverseTable[256];
+static uint16_t crcModel_crc16Table[256];
+static uint32_t crcModel_crc32Table[256];
+static bool crcModel_tablesReady;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void crcModel_initTables(void);
+static uint16_t crcModel_reverse16(const uint16_t Value);
+static uint32_t crcModel_reverse32(const uint32_t Value);
+static uint16_t crcModel_updateCrc16(const uint16_t Crc, const uint8_t Byte, const bool MsbFirst);
+static uint32_t crcModel_updateCrc32(const uint32_t Crc, const uint8_t Byte, const bool MsbFirst);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   crcModel_accessCrc16
+ * BRIEF:   Access CRC Module
+ * RETURN:  bool: Complete After The Access (true) Or Not (false)
+ * ARG:     Address: Address
+ * ARG:     Size: Access Size (Bytes)
+ * NOTE:    Data In, Data In Reverse And Initialization Writes Update The Signature
+ ****************************************************************************************************/
+bool crcModel_accessCrc16(const uint32_t Address, const uint8_t Size)
+{
+    (void)Size;
+
+    /*** CRCDI, CRCDIRB, CRCINIRES ***/
+    return ((Address - CRC_BASE) < OFS_CRCRESR);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcModel_accessCrc32
+ * BRIEF:   Access CRC32 Module
+ * RETURN:  bool: Complete After The Access (true) Or Not (false)
+ * ARG:     Address: Address
+ * ARG:     Size: Access Size (Bytes)
+ ****************************************************************************************************/
+bool crcModel_accessCrc32(const uint32_t Address, const uint8_t Size)
+{
+    uint32_t offset;
+
+    (void)Size;
+
+    /*** Data In, Data In Reverse, Initialization (CRC32 And CRC16) ***/
+    offset = Address - CRC32_BASE;
+    return (offset < OFS_CRC32RESRW1) || ((offset >= OFS_CRC16DIW0) && (offset < OFS_CRC16RESRW1));
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcModel_completeCrc16
+ * BRIEF:   Complete CRC Module Access
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Address
+ * ARG:     Size: Access Size (Bytes)
+ ****************************************************************************************************/
+void crcModel_completeCrc16(const uint32_t Address, const uint8_t Size)
+{
+    uint32_t address, offset;
+    uint16_t crc;
+
+    /*** Feed Written Bytes In Address Order ***/
+    crc = HW_MEMMAP_REG16(CRC_BASE + OFS_CRCINIRES);
+    for(address = Address; address < (Address + Size); address++)
+    {
+        offset = address - CRC_BASE;
+        if(offset < OFS_CRCDIRB)
+            crc = crcModel_updateCrc16(crc, HW_MEMMAP_REG8(address), false);
+        else if(offset < OFS_CRCINIRES)
+            crc = crcModel_updateCrc16(crc, HW_MEMMAP_REG8(address), true);
+        else
+            break;
+    }
+
+    /*** Result ***/
+    HW_MEMMAP_REG16(CRC_BASE + OFS_CRCINIRES) = crc;
+    HW_MEMMAP_REG16(CRC_BASE + OFS_CRCRESR) = crcModel_reverse16(crc);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcModel_completeCrc32
+ * BRIEF:   Complete CRC32 Module Access
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Address
+ * ARG:     Size: Access Size (Bytes)
+ ****************************************************************************************************/
+void crcModel_completeCrc32(const uint32_t Address, const uint8_t Size)
+{
+    uint32_t address, crc32, offset;
+    uint16_t crc16;
+
+    /*** Feed Written Bytes In Address Order ***/
+    crc32 = HW_MEMMAP_REG32(CRC32_BASE + OFS_CRC32INIRESW0);
+    crc16 = HW_MEMMAP_REG16(CRC32_BASE + OFS_CRC16INIRESW0);
+    for(address = Address; address < (Address + Size); address++)
+    {
+        offset = address - CRC32_BASE;
+        if(offset < OFS_CRC32DIRBW1)
+            crc32 = crcModel_updateCrc32(crc32, HW_MEMMAP_REG8(address), false);
+        else if(offset < OFS_CRC32INIRESW0)
+            crc32 = crcModel_updateCrc32(crc32, HW_MEMMAP_REG8(address), true);
+        else if((offset >= OFS_CRC16DIW0) && (offset < OFS_CRC16DIRBW1))
+            crc16 = crcModel_updateCrc16(crc16, HW_MEMMAP_REG8(address), false);
+        else if((offset >= OFS_CRC16DIRBW1) && (offset < OFS_CRC16INIRESW0))
+            crc16 = crcModel_updateCrc16(crc16, HW_MEMMAP_REG8(address), true);
+    }
+
+    /*** Results ***/
+    HW_MEMMAP_REG32(CRC32_BASE + OFS_CRC32INIRESW0) = crc32;
+    HW_MEMMAP_REG32(CRC32_BASE + OFS_CRC32RESRW1) = crcModel_reverse32(crc32); // RESRW1: Bits 15:0, RESRW0: Bits 31:16
+    HW_MEMMAP_REG16(CRC32_BASE + OFS_CRC16INIRESW0) = crc16;
+    HW_MEMMAP_REG16(CRC32_BASE + OFS_CRC16RESRW0) = crcModel_reverse16(crc16);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcModel_resetCrc16
+ * BRIEF:   Reset CRC Module
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+void crcModel_resetCrc16(void)
+{
+    /*** Reset (Registers Cleared With Memory) ***/
+    crcModel_initTables();
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcModel_resetCrc32
+ * BRIEF:   Reset CRC32 Module
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+void crcModel_resetCrc32(void)
+{
+    /*** Reset (Registers Cleared With Memory) ***/
+    crcModel_initTables();
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   crcModel_initTables
+ * BRIEF:   Initialize Tables
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Byte-At-A-Time Tables, So Megabyte Test Vectors Cost One Lookup Per Byte
+ ****************************************************************************************************/
+static void crcModel_initTables(void)
+{
+    uint32_t crc32, i;
+    uint16_t crc16;
+    uint8_t bit, reverse;
+
+    /*** Once ***/
+    if(crcModel_tablesReady)
+        return;
+
+    /*** Tables ***/
+    for(i = 0; i < 256; i++)
+    {
+        crc16 = (uint16_t)(i << 8);
+        crc32 = i << 24;
+        reverse = 0;
+        for(bit = 0; bit < 8; bit++)
+        {
+            crc16 = (uint16_t)(((crc16 & 0x8000) != 0) ? ((crc16 << 1) ^ CRC_MODEL_CRC16_POLYNOMIAL) : (uint32_t)(crc16 << 1));
+            crc32 = ((crc32 & 0x80000000u) != 0) ? ((crc32 << 1) ^ CRC_MODEL_CRC32_POLYNOMIAL) : (crc32 << 1);
+            reverse = (uint8_t)((reverse << 1) | ((i >> bit) & 1));
+        }
+        crcModel_crc16Table[i] = crc16;
+        crcModel_crc32Table[i] = crc32;
+        crcModel_reverseTable[i] = reverse;
+    }
+    crcModel_tablesReady = true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcModel_reverse16
+ * BRIEF:   Reverse 16 Bits
+ * RETURN:  uint16_t: Bit-Reversed Value (Bit 15 <-> Bit 0)
+ * ARG:     Value: Value
+ ****************************************************************************************************/
+static uint16_t crcModel_reverse16(const uint16_t Value)
+{
+    /*** Reverse 16 Bits ***/
+    return (uint16_t)((crcModel_reverseTable[Value & 0xFF] << 8) | crcModel_reverseTable[Value >> 8]);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcModel_reverse32
+ * BRIEF:   Reverse 32 Bits
+ * RETURN:  uint32_t: Bit-Reversed Value (Bit 31 <-> Bit 0)
+ * ARG:     Value: Value
+ ****************************************************************************************************/
+static uint32_t crcModel_reverse32(const uint32_t Value)
+{
+    /*** Reverse 32 Bits ***/
+    return ((uint32_t)crcModel_reverse16((uint16_t)Value) << 16) | crcModel_reverse16((uint16_t)(Value >> 16));
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcModel_updateCrc16
+ * BRIEF:   Update CRC-CCITT Signature
+ * RETURN:  uint16_t: Signature
+ * ARG:     Crc: Signature
+ * ARG:     Byte: Data Byte
+ * ARG:     MsbFirst: Feed Bit 7 First (true) Or Bit 0 First (false)
+ ****************************************************************************************************/
+static uint16_t crcModel_updateCrc16(const uint16_t Crc, const uint8_t Byte, const bool MsbFirst)
+{
+    uint8_t byte;
+
+    /*** Update ***/
+    byte = MsbFirst ? Byte : crcModel_reverseTable[Byte];
+    return (uint16_t)((Crc << 8) ^ crcModel_crc16Table[((Crc >> 8) ^ byte) & 0xFF]);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcModel_updateCrc32
+ * BRIEF:   Update CRC32-ISO3309 Signature
+ * RETURN:  uint32_t: Signature
+ * ARG:     Crc: Signature
+ * ARG:     Byte: Data Byte
+ * ARG:     MsbFirst: Feed Bit 7 First (true) Or Bit 0 First (false)
+ ****************************************************************************************************/
+static uint32_t crcModel_updateCrc32(const uint32_t Crc, const uint8_t Byte, const bool MsbFirst)
+{
+    uint8_t byte;
+
+    /*** Update ***/
+    byte = MsbFirst ? Byte : crcModel_reverseTable[Byte];
+    return (Crc << 8) ^ crcModel_crc32Table[((Crc >> 24) ^ byte) & 0xFF];
+}
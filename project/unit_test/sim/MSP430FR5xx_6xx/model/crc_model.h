@@ -0,0 +1,34 @@
+/****************************************************************************************************
+ * FILE:    crc_model.h
+ * BRIEF:   CRC And CRC32 Peripheral Model Header File
+ ****************************************************************************************************/
+
+#ifndef CRC_MODEL_H
+#define CRC_MODEL_H
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define CRC_MODEL_CRC16_LENGTH (0x0008) // CRC Module Register Space (CRC_BASE)
+#define CRC_MODEL_CRC32_LENGTH (0x0020) // CRC32 Module Register Space (CRC32_BASE)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern bool crcModel_accessCrc16(const uint32_t Address, const uint8_t Size);
+extern bool crcModel_accessCrc32(const uint32_t Address, const uint8_t Size);
+extern void crcModel_completeCrc16(const uint32_t Address, const uint8_t Size);
+extern void crcModel_completeCrc32(const uint32_t Address, const uint8_t Size);
+extern void crcModel_resetCrc16(void);
+extern void crcModel_resetCrc32(void);
+
+#endif
@@ -0,0 +1,386 @@
+/****************************************************************************************************
+ * FILE:    gpio_model.c
+ * BRIEF:   GPIO And Port Interrupt Peripheral Model Source File
+ * NOTE:    Pins Of P1 To P4 Are Driven By Tests Or Stimulus (Timed Edge Lists Or Files, Optionally With
+ *          Generated Contact Bounce); An Edge Matching PxIES Sets PxIFG, PxIV Encodes The Lowest
+ *          Pending Enabled Flag (Any Access Clears It) And Pending Enabled Flags Are Dispatched To The
+ *          Registered Port Vector Handlers, Port 1 First, While Interrupts Are Enabled
+ * NOTE:    Pending Flags Are Dispatched When Pins Change Or On gpioModel_service(), Not The Moment
+ *          Firmware Sets PxIE Or GIE; Changing PxIES Does Not Set PxIFG
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define GPIO_MODEL_LINE_LENGTH       (128)
+#define GPIO_MODEL_PORT_LENGTH       (0x0020) // Register Space Of A Port Pair
+#define GPIO_MODEL_SERVICE_MAXIMUM   (64)     // Dispatches Per Service (Handlers That Never Clear Their Flag)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "gpio.h"
+#include "gpio_model.h"
+#include "inc/hw_memmap.h"
+#include "intrinsics.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static intrinsics_interruptHandler_t gpioModel_handlers[GPIO_MODEL_PORT_COUNT];
+static uint16_t gpioModel_presentedVector[GPIO_MODEL_PORT_COUNT];
+static const gpioModel_edge_t *gpioModel_stimulus;
+static size_t gpioModel_stimulusCount, gpioModel_stimulusIndex;
+static FILE *gpioModel_stimulusFile;
+static gpioModel_edge_t gpioModel_stimulusFileEdge;
+static bool gpioModel_stimulusFileEdgeValid;
+static uint32_t gpioModel_time;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static uint16_t gpioModel_getAddress(const uint8_t Port, const uint16_t Offset);
+static const gpioModel_edge_t *gpioModel_peekEdge(void);
+static bool gpioModel_readStimulusFileEdge(void);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   gpioModel_access
+ * BRIEF:   Access
+ * RETURN:  bool: Complete After The Access (true) Or Not (false)
+ * ARG:     Address: Address
+ * ARG:     Size: Access Size (Bytes)
+ * NOTE:    A PxIV Access Presents The Lowest Pending Enabled Flag And Clears It; With None Pending A
+ *          Vector The Model Presented Reads PxIV_NONE, A Vector Written By A Test Is Left Alone
+ ****************************************************************************************************/
+bool gpioModel_access(const uint32_t Address, const uint8_t Size)
+{
+    uint16_t address, offset;
+    uint8_t bit, pending, port;
+
+    (void)Size;
+
+    /*** Interrupt Vector Registers Only ***/
+    offset = (uint16_t)((Address - PA_BASE) % GPIO_MODEL_PORT_LENGTH) & (uint16_t)~1u;
+    if(offset == OFS_P1IV)
+        port = (uint8_t)((((Address - PA_BASE) / GPIO_MODEL_PORT_LENGTH) * 2) + GPIO_PORT_P1);
+    else if(offset == OFS_P2IV)
+        port = (uint8_t)((((Address - PA_BASE) / GPIO_MODEL_PORT_LENGTH) * 2) + GPIO_PORT_P2);
+    else
+        return false;
+
+    /*** Present Vector ***/
+    address = (uint16_t)((Address & ~1u));
+    pending = (uint8_t)(HW_MEMMAP_REG8(gpioModel_getAddress(port, OFS_PAIFG)) & HW_MEMMAP_REG8(gpioModel_getAddress(port, OFS_PAIE)));
+    if(pending != 0)
+    {
+        for(bit = 0; (pending & (1u << bit)) == 0; bit++)
+            ;
+        HW_MEMMAP_REG8(gpioModel_getAddress(port, OFS_PAIFG)) &= (uint8_t)~(1u << bit);
+        gpioModel_presentedVector[port - GPIO_PORT_P1] = (uint16_t)(2 * (bit + 1));
+        HW_MEMMAP_REG16(address) = gpioModel_presentedVector[port - GPIO_PORT_P1];
+    }
+    else if((gpioModel_presentedVector[port - GPIO_PORT_P1] != P1IV_NONE) && (HW_MEMMAP_REG16(address) == gpioModel_presentedVector[port - GPIO_PORT_P1]))
+    {
+        gpioModel_presentedVector[port - GPIO_PORT_P1] = P1IV_NONE;
+        HW_MEMMAP_REG16(address) = P1IV_NONE;
+    }
+
+    return false;
+}
+
+/****************************************************************************************************
+ * FUNCT:   gpioModel_advance
+ * BRIEF:   Advance Time
+ * RETURN:  Returns Nothing
+ * ARG:     Microseconds: Time To Advance
+ * NOTE:    Applies Every Stimulus Edge Due By Then, In Order, Dispatching Interrupts After Each
+ ****************************************************************************************************/
+void gpioModel_advance(const uint32_t Microseconds)
+{
+    const gpioModel_edge_t *edge;
+    uint32_t target;
+
+    /*** Advance ***/
+    target = gpioModel_time + Microseconds;
+    while(((edge = gpioModel_peekEdge()) != NULL) && (edge->time <= target))
+    {
+        if(edge->time > gpioModel_time)
+            gpioModel_time = edge->time;
+        gpioModel_setPins(edge->port, edge->pins, edge->high);
+
+        /* Consume */
+        if(gpioModel_stimulusFile != NULL)
+            gpioModel_stimulusFileEdgeValid = false;
+        else
+            gpioModel_stimulusIndex++;
+    }
+    gpioModel_time = target;
+}
+
+/****************************************************************************************************
+ * FUNCT:   gpioModel_generateBounce
+ * BRIEF:   Generate Contact Bounce
+ * RETURN:  size_t: Number Of Edges Written
+ * ARG:     Edges: Edges Buffer
+ * ARG:     Length: Edges Buffer Length
+ * ARG:     Edge: Clean Edge (Where The Bounce Starts And The Level It Settles At)
+ * ARG:     Bounces: Number Of Bounces (Level Reversals) Before The Contact Settles
+ * ARG:     MaximumInterval: Maximum Time Between Bounce Edges (Microseconds)
+ * ARG:     Seed: xorshift32 State (Nonzero; Updated, So Consecutive Calls Continue The Sequence)
+ * NOTE:    Writes 2 * Bounces + 1 Edges Alternating From Edge->high, Each 1 To MaximumInterval
+ *          Microseconds After The Last
+ ****************************************************************************************************/
+size_t gpioModel_generateBounce(gpioModel_edge_t * const Edges, const size_t Length, const gpioModel_edge_t * const Edge, const uint8_t Bounces, const uint32_t MaximumInterval, uint32_t * const Seed)
+{
+    uint32_t time;
+    size_t i;
+
+    /*** Error Check ***/
+    if((Edges == NULL) || (Edge == NULL) || (Seed == NULL) || (*Seed == 0) || (MaximumInterval == 0))
+        return 0;
+
+    /*** Generate ***/
+    time = Edge->time;
+    for(i = 0; (i < ((2u * Bounces) + 1)) && (i < Length); i++)
+    {
+        Edges[i] = *Edge;
+        Edges[i].time = time;
+        Edges[i].high = ((i % 2) == 0) ? Edge->high : !Edge->high;
+        *Seed ^= *Seed << 13;
+        *Seed ^= *Seed >> 17;
+        *Seed ^= *Seed << 5;
+        time += 1 + (*Seed % MaximumInterval);
+    }
+
+    return i;
+}
+
+/****************************************************************************************************
+ * FUNCT:   gpioModel_getTime
+ * BRIEF:   Get Time
+ * RETURN:  uint32_t: Stimulus Time (Microseconds)
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+uint32_t gpioModel_getTime(void)
+{
+    return gpioModel_time;
+}
+
+/****************************************************************************************************
+ * FUNCT:   gpioModel_loadStimulus
+ * BRIEF:   Load Stimulus
+ * RETURN:  bool: Success (true) Or Failure (false)
+ * ARG:     Edges: Edges, In Time Order (Not Copied; Must Outlive The Stimulus)
+ * ARG:     Count: Number Of Edges
+ ****************************************************************************************************/
+bool gpioModel_loadStimulus(const gpioModel_edge_t * const Edges, const size_t Count)
+{
+    /*** Error Check ***/
+    if((Edges == NULL) && (Count != 0))
+        return false;
+
+    /*** Load Stimulus ***/
+    if(gpioModel_stimulusFile != NULL)
+    {
+        (void)fclose(gpioModel_stimulusFile);
+        gpioModel_stimulusFile = NULL;
+    }
+    gpioModel_stimulus = Edges;
+    gpioModel_stimulusCount = Count;
+    gpioModel_stimulusIndex = 0;
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   gpioModel_loadStimulusFile
+ * BRIEF:   Load Stimulus File
+ * RETURN:  bool: Success (true) Or Failure (false)
+ * ARG:     Path: Stimulus File: One "TIME_US PORT PIN LEVEL" Edge Per Line In Time Order (PIN: 0 To 7,
+ *          LEVEL: 0 Or 1), Lines Starting With '#' Are Comments
+ * NOTE:    The File Is Streamed, So Traces Of Any Length Run In Constant Memory
+ ****************************************************************************************************/
+bool gpioModel_loadStimulusFile(const char * const Path)
+{
+    FILE *file;
+
+    /*** Open ***/
+    file = fopen(Path, "r");
+    if(file == NULL)
+        return false;
+
+    /*** Load Stimulus ***/
+    (void)gpioModel_loadStimulus(NULL, 0);
+    gpioModel_stimulusFile = file;
+    gpioModel_stimulusFileEdgeValid = false;
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   gpioModel_reset
+ * BRIEF:   Reset
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Clears Stimulus, Time And Vector Handlers (Registers Are Cleared With Memory)
+ ****************************************************************************************************/
+void gpioModel_reset(void)
+{
+    uint8_t i;
+
+    /*** Reset ***/
+    (void)gpioModel_loadStimulus(NULL, 0);
+    gpioModel_time = 0;
+    for(i = 0; i < GPIO_MODEL_PORT_COUNT; i++)
+    {
+        gpioModel_handlers[i] = NULL;
+        gpioModel_presentedVector[i] = P1IV_NONE;
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   gpioModel_service
+ * BRIEF:   Service Interrupts
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Dispatches Pending Enabled Flags To Their Vector Handlers, Highest Priority Port First
+ *          (Port 1), Until None Are Pending Or Interrupts Are Disabled
+ ****************************************************************************************************/
+void gpioModel_service(void)
+{
+    uint8_t i, port;
+
+    /*** Service ***/
+    for(i = 0; i < GPIO_MODEL_SERVICE_MAXIMUM; i++)
+    {
+        for(port = GPIO_PORT_P1; port <= GPIO_PORT_P4; port++)
+        {
+            if((gpioModel_handlers[port - GPIO_PORT_P1] != NULL) && ((HW_MEMMAP_REG8(gpioModel_getAddress(port, OFS_PAIFG)) & HW_MEMMAP_REG8(gpioModel_getAddress(port, OFS_PAIE))) != 0))
+                break;
+        }
+        if((port > GPIO_PORT_P4) || !intrinsics_callInterruptHandler(gpioModel_handlers[port - GPIO_PORT_P1]))
+            break;
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   gpioModel_setPins
+ * BRIEF:   Set Pins
+ * RETURN:  Returns Nothing
+ * ARG:     Port: GPIO_PORT_P1 To GPIO_PORT_P4
+ * ARG:     Pins: GPIO_PINx
+ * ARG:     High: Level
+ * NOTE:    Pins That Change Set PxIFG When The Edge Matches PxIES (1: High To Low), Whatever PxIE
+ ****************************************************************************************************/
+void gpioModel_setPins(const uint8_t Port, const uint8_t Pins, const bool High)
+{
+    uint8_t changed, edgeSelect, input;
+
+    /*** Error Check ***/
+    if((Port < GPIO_PORT_P1) || (Port > GPIO_PORT_P4))
+        return;
+
+    /*** Set Pins ***/
+    input = HW_MEMMAP_REG8(gpioModel_getAddress(Port, OFS_PAIN));
+    changed = (uint8_t)(Pins & (High ? ~input : input));
+    HW_MEMMAP_REG8(gpioModel_getAddress(Port, OFS_PAIN)) = (uint8_t)(High ? (input | Pins) : (input & ~Pins));
+
+    /*** Edge Detection ***/
+    edgeSelect = HW_MEMMAP_REG8(gpioModel_getAddress(Port, OFS_PAIES));
+    HW_MEMMAP_REG8(gpioModel_getAddress(Port, OFS_PAIFG)) |= (uint8_t)(changed & (High ? ~edgeSelect : edgeSelect));
+
+    /*** Dispatch ***/
+    gpioModel_service();
+}
+
+/****************************************************************************************************
+ * FUNCT:   gpioModel_setVectorHandler
+ * BRIEF:   Set Vector Handler
+ * RETURN:  bool: Success (true) Or Failure (false)
+ * ARG:     Port: GPIO_PORT_P1 To GPIO_PORT_P4
+ * ARG:     Handler: Port Vector Interrupt Handler (NULL: Flags Stay Pending)
+ ****************************************************************************************************/
+bool gpioModel_setVectorHandler(const uint8_t Port, const intrinsics_interruptHandler_t Handler)
+{
+    /*** Error Check ***/
+    if((Port < GPIO_PORT_P1) || (Port > GPIO_PORT_P4))
+        return false;
+
+    /*** Set Vector Handler ***/
+    gpioModel_handlers[Port - GPIO_PORT_P1] = Handler;
+
+    return true;
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   gpioModel_getAddress
+ * BRIEF:   Get Register Address
+ * RETURN:  uint16_t: Register Address
+ * ARG:     Port: GPIO_PORT_P1 To GPIO_PORT_P4
+ * ARG:     Offset: Port Pair Register Offset (OFS_PAx); Odd Ports Use The Low Byte, Even The High Byte
+ ****************************************************************************************************/
+static uint16_t gpioModel_getAddress(const uint8_t Port, const uint16_t Offset)
+{
+    /*** Get Address ***/
+    return (uint16_t)(PA_BASE + (((Port - GPIO_PORT_P1) / 2) * GPIO_MODEL_PORT_LENGTH) + Offset + ((Port - GPIO_PORT_P1) % 2));
+}
+
+/****************************************************************************************************
+ * FUNCT:   gpioModel_peekEdge
+ * BRIEF:   Peek Next Stimulus Edge
+ * RETURN:  const gpioModel_edge_t *: Next Edge Or NULL (None)
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+static const gpioModel_edge_t *gpioModel_peekEdge(void)
+{
+    /*** File ***/
+    if(gpioModel_stimulusFile != NULL)
+        return (gpioModel_stimulusFileEdgeValid || gpioModel_readStimulusFileEdge()) ? &gpioModel_stimulusFileEdge : NULL;
+
+    /*** Edges ***/
+    return (gpioModel_stimulusIndex < gpioModel_stimulusCount) ? &gpioModel_stimulus[gpioModel_stimulusIndex] : NULL;
+}
+
+/****************************************************************************************************
+ * FUNCT:   gpioModel_readStimulusFileEdge
+ * BRIEF:   Read Stimulus File Edge
+ * RETURN:  bool: Edge Read (true) Or End Of File (false)
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+static bool gpioModel_readStimulusFileEdge(void)
+{
+    char line[GPIO_MODEL_LINE_LENGTH];
+    unsigned long time;
+    unsigned int level, pin, port;
+
+    /*** Read Edge ***/
+    while(fgets(line, sizeof(line), gpioModel_stimulusFile) != NULL)
+    {
+        if((line[0] == '#') || (sscanf(line, "%lu %u %u %u", &time, &port, &pin, &level) != 4) || (pin > 7))
+            continue;
+        gpioModel_stimulusFileEdge.time = (uint32_t)time;
+        gpioModel_stimulusFileEdge.port = (uint8_t)port;
+        gpioModel_stimulusFileEdge.pins = (uint8_t)(1u << pin);
+        gpioModel_stimulusFileEdge.high = level != 0;
+        gpioModel_stimulusFileEdgeValid = true;
+        return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,52 @@
+/****************************************************************************************************
+ * FILE:    gpio_model.h
+ * BRIEF:   GPIO And Port Interrupt Peripheral Model Header File
+ ****************************************************************************************************/
+
+#ifndef GPIO_MODEL_H
+#define GPIO_MODEL_H
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define GPIO_MODEL_LENGTH     (0x0040) // Port A And Port B Register Space (PA_BASE)
+#define GPIO_MODEL_PORT_COUNT (4)      // P1 To P4 (Ports With Interrupts)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "intrinsics.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef struct gpioModel_edge_s
+{
+    uint32_t time; // Microseconds
+    uint8_t port;  // GPIO_PORT_P1 To GPIO_PORT_P4
+    uint8_t pins;  // GPIO_PINx
+    bool high;
+} gpioModel_edge_t;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern bool gpioModel_access(const uint32_t Address, const uint8_t Size);
+extern void gpioModel_advance(const uint32_t Microseconds);
+extern size_t gpioModel_generateBounce(gpioModel_edge_t * const Edges, const size_t Length, const gpioModel_edge_t * const Edge, const uint8_t Bounces, const uint32_t MaximumInterval, uint32_t * const Seed);
+extern uint32_t gpioModel_getTime(void);
+extern bool gpioModel_loadStimulus(const gpioModel_edge_t * const Edges, const size_t Count);
+extern bool gpioModel_loadStimulusFile(const char * const Path);
+extern void gpioModel_reset(void);
+extern void gpioModel_service(void);
+extern void gpioModel_setPins(const uint8_t Port, const uint8_t Pins, const bool High);
+extern bool gpioModel_setVectorHandler(const uint8_t Port, const intrinsics_interruptHandler_t Handler);
+
+#endif
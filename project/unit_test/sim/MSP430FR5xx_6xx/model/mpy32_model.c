@@ -0,0 +1,359 @@
+/****************************************************************************************************
+ * FILE:    mpy32_model.c
+ * BRIEF:   MPY32 Hardware Multiplier Peripheral Model Source File
+ * NOTE:    Bit-Exact Model Of The 32-Bit Hardware Multiplier: The Operation Selected By The Operand 1
+ *          Register (MPY, MPYS, MAC, MACS And Their 32-Bit Forms) Runs When OP2 Or OP2H Is Written
+ *          (OP2L Only Latches The Low Word) And Completes Immediately
+ * NOTE:    As In Hardware, RESx Hold The Raw Result And MPYFRAC/MPYSAT Only Adjust What Is Read; Byte
+ *          Writes To Operands Are Sign-Extended In Signed Modes
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define MPY32_MODEL_RESULT_LENGTH (8) // RES0 To RES3
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "inc/hw_memmap.h"
+#include "mpy32_model.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static uint32_t mpy32Model_operandOne, mpy32Model_operandTwo;
+static uint8_t mpy32Model_presented[MPY32_MODEL_RESULT_LENGTH];
+static uint64_t mpy32Model_result;
+static bool mpy32Model_wide;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static uint16_t mpy32Model_extend(const uint16_t Value, const bool Byte, const bool Signed);
+static int8_t mpy32Model_getResultIndex(const uint32_t Offset);
+static void mpy32Model_multiply(void);
+static void mpy32Model_presentResult(void);
+static void mpy32Model_setControl(const uint16_t Set, const uint16_t Clear);
+static void mpy32Model_writeRegister(const uint32_t Offset, const uint16_t Value, const bool Byte);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   mpy32Model_access
+ * BRIEF:   Access
+ * RETURN:  bool: Complete After The Access (true) Or Not (false)
+ * ARG:     Address: Address
+ * ARG:     Size: Access Size (Bytes)
+ * NOTE:    Result Registers Are Refreshed Before The Access With The MPYFRAC/MPYSAT Adjusted Result
+ ****************************************************************************************************/
+bool mpy32Model_access(const uint32_t Address, const uint8_t Size)
+{
+    uint32_t offset;
+
+    (void)Size;
+
+    /*** Result Read ***/
+    offset = Address - MPY32_BASE;
+    if(mpy32Model_getResultIndex(offset) >= 0)
+        mpy32Model_presentResult();
+
+    /*** Operand And Result Writes (SUMEXT Is Read Only, MPY32CTL0 Is Read When Used) ***/
+    return ((offset & ~1u) != OFS_SUMEXT) && ((offset & ~1u) != OFS_MPY32CTL0);
+}
+
+/****************************************************************************************************
+ * FUNCT:   mpy32Model_complete
+ * BRIEF:   Complete Access
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Address
+ * ARG:     Size: Access Size (Bytes)
+ * NOTE:    A Result Byte Is Taken As Written (Preloaded) Only If It Differs From What Was Presented
+ ****************************************************************************************************/
+void mpy32Model_complete(const uint32_t Address, const uint8_t Size)
+{
+    uint32_t address, offset;
+    bool preloaded = false;
+    int8_t index;
+
+    /*** Result Registers ***/
+    for(address = Address; address < (Address + Size); address++)
+    {
+        index = mpy32Model_getResultIndex(address - MPY32_BASE);
+        if((index >= 0) && (HW_MEMMAP_REG8(address) != mpy32Model_presented[index]))
+        {
+            mpy32Model_result &= ~((uint64_t)0xFF << (8 * index));
+            mpy32Model_result |= (uint64_t)HW_MEMMAP_REG8(address) << (8 * index);
+            preloaded = true;
+        }
+    }
+    if(preloaded)
+    {
+        mpy32Model_presentResult();
+        return;
+    }
+
+    /*** Operand Registers (Word By Word In Address Order) ***/
+    for(address = Address & ~1u; address < (Address + Size); address += 2)
+    {
+        offset = address - MPY32_BASE;
+        if(mpy32Model_getResultIndex(offset) < 0)
+            mpy32Model_writeRegister(offset, HW_MEMMAP_REG16(address), Size == 1);
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   mpy32Model_reset
+ * BRIEF:   Reset
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+void mpy32Model_reset(void)
+{
+    uint8_t i;
+
+    /*** Reset (Registers Cleared With Memory) ***/
+    mpy32Model_operandOne = 0;
+    mpy32Model_operandTwo = 0;
+    mpy32Model_result = 0;
+    mpy32Model_wide = false;
+    for(i = 0; i < MPY32_MODEL_RESULT_LENGTH; i++)
+        mpy32Model_presented[i] = 0;
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   mpy32Model_extend
+ * BRIEF:   Extend Byte Operand
+ * RETURN:  uint16_t: Operand Word
+ * ARG:     Value: Written Word
+ * ARG:     Byte: Byte Write
+ * ARG:     Signed: Signed Mode (Sign-Extend) Or Not (Zero-Extend)
+ ****************************************************************************************************/
+static uint16_t mpy32Model_extend(const uint16_t Value, const bool Byte, const bool Signed)
+{
+    /*** Extend ***/
+    if(!Byte)
+        return Value;
+    if(Signed && ((Value & 0x80) != 0))
+        return (uint16_t)(Value | 0xFF00);
+
+    return (uint16_t)(Value & 0x00FF);
+}
+
+/****************************************************************************************************
+ * FUNCT:   mpy32Model_getResultIndex
+ * BRIEF:   Get Result Byte Index
+ * RETURN:  int8_t: Result Byte Index (0: Least Significant) Or -1 (Not A Result Register)
+ * ARG:     Offset: Register Offset
+ * NOTE:    RESLO/RESHI Are RES0/RES1
+ ****************************************************************************************************/
+static int8_t mpy32Model_getResultIndex(const uint32_t Offset)
+{
+    /*** Get Result Index ***/
+    if((Offset >= OFS_RESLO) && (Offset < OFS_SUMEXT))
+        return (int8_t)(Offset - OFS_RESLO);
+    if((Offset >= OFS_RES0) && (Offset < OFS_MPY32CTL0))
+        return (int8_t)(Offset - OFS_RES0);
+
+    return -1;
+}
+
+/****************************************************************************************************
+ * FUNCT:   mpy32Model_multiply
+ * BRIEF:   Multiply
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    16 x 16 Results Are 32 Bits (RES3/RES2 Hold Their Extension), Otherwise 64 Bits; SUMEXT And
+ *          MPYC Hold The Sign (MPYS, MACS) Or The Accumulate Carry (MAC) Of The Exact Result
+ ****************************************************************************************************/
+static void mpy32Model_multiply(void)
+{
+    uint64_t accumulator, product, sum;
+    bool accumulate, negative, operandOne32, operandTwo32, sign;
+    int64_t exact;
+    uint16_t control, sumExtension;
+
+    /*** Mode ***/
+    control = HW_MEMMAP_REG16(MPY32_BASE + OFS_MPY32CTL0);
+    sign = (control & MPYM0) == MPYM0;
+    accumulate = (control & MPYM1) == MPYM1;
+    operandOne32 = (control & OP1_32) == OP1_32;
+    operandTwo32 = (control & OP2_32) == OP2_32;
+    mpy32Model_wide = operandOne32 || operandTwo32;
+
+    /*** Product ***/
+    if(sign)
+        product = (uint64_t)((operandOne32 ? (int64_t)(int32_t)mpy32Model_operandOne : (int64_t)(int16_t)mpy32Model_operandOne) * (operandTwo32 ? (int64_t)(int32_t)mpy32Model_operandTwo : (int64_t)(int16_t)mpy32Model_operandTwo));
+    else
+        product = (uint64_t)(operandOne32 ? mpy32Model_operandOne : (mpy32Model_operandOne & 0xFFFF)) * (operandTwo32 ? mpy32Model_operandTwo : (mpy32Model_operandTwo & 0xFFFF));
+
+    /*** Accumulate ***/
+    if(!mpy32Model_wide)
+    {
+        /* 32-Bit Result */
+        accumulator = accumulate ? (mpy32Model_result & 0xFFFFFFFF) : 0;
+        if(sign)
+        {
+            exact = (int64_t)(int32_t)accumulator + (int64_t)product;
+            negative = exact < 0;
+            sumExtension = negative ? 0xFFFF : 0x0000;
+            mpy32Model_result = (negative ? 0xFFFFFFFF00000000 : 0) | ((uint64_t)exact & 0xFFFFFFFF);
+        }
+        else
+        {
+            sum = accumulator + product;
+            sumExtension = (uint16_t)(sum >> 32);
+            mpy32Model_result = sum & 0xFFFFFFFF;
+        }
+    }
+    else
+    {
+        /* 64-Bit Result (Signed Overflow: Same Sign Operands, Different Sign Sum) */
+        accumulator = accumulate ? mpy32Model_result : 0;
+        sum = accumulator + product;
+        if(sign)
+        {
+            if((((accumulator ^ product) >> 63) == 0) && (((sum ^ accumulator) >> 63) != 0))
+                negative = (accumulator >> 63) != 0;
+            else
+                negative = (sum >> 63) != 0;
+            sumExtension = negative ? 0xFFFF : 0x0000;
+        }
+        else
+        {
+            sumExtension = (sum < accumulator) ? 1 : 0;
+        }
+        mpy32Model_result = sum;
+    }
+
+    /*** Status ***/
+    HW_MEMMAP_REG16(MPY32_BASE + OFS_SUMEXT) = sumExtension;
+    if(sumExtension != 0)
+        mpy32Model_setControl(MPYC, 0);
+    else
+        mpy32Model_setControl(0, MPYC);
+    mpy32Model_presentResult();
+}
+
+/****************************************************************************************************
+ * FUNCT:   mpy32Model_presentResult
+ * BRIEF:   Present Result
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    MPYFRAC Shifts The Result Left One Bit; MPYSAT (Signed Modes) Clamps It When Its Sign Does
+ *          Not Match The Exact Sign In SUMEXT
+ ****************************************************************************************************/
+static void mpy32Model_presentResult(void)
+{
+    uint64_t mask, msb, result;
+    bool negative, overflow;
+    uint16_t control;
+    uint8_t i;
+
+    /*** Width ***/
+    control = HW_MEMMAP_REG16(MPY32_BASE + OFS_MPY32CTL0);
+    mask = mpy32Model_wide ? 0xFFFFFFFFFFFFFFFF : 0xFFFFFFFF;
+    msb = mpy32Model_wide ? 0x8000000000000000 : 0x80000000;
+    result = mpy32Model_result & mask;
+    negative = HW_MEMMAP_REG16(MPY32_BASE + OFS_SUMEXT) != 0;
+    overflow = ((result & msb) != 0) != negative;
+
+    /*** Fractional ***/
+    if((control & MPYFRAC) == MPYFRAC)
+    {
+        result = (result << 1) & mask;
+        overflow = overflow || (((result & msb) != 0) != negative);
+    }
+
+    /*** Saturation ***/
+    if(((control & MPYSAT) == MPYSAT) && ((control & MPYM0) == MPYM0) && overflow)
+        result = negative ? msb : (msb - 1);
+
+    /*** Present (RES3/RES2 Keep The Extension Of A 32-Bit Result) ***/
+    if(!mpy32Model_wide)
+        result |= mpy32Model_result & ~mask;
+    for(i = 0; i < MPY32_MODEL_RESULT_LENGTH; i++)
+    {
+        mpy32Model_presented[i] = (uint8_t)(result >> (8 * i));
+        HW_MEMMAP_REG8(MPY32_BASE + OFS_RES0 + i) = mpy32Model_presented[i];
+        if(i < 4)
+            HW_MEMMAP_REG8(MPY32_BASE + OFS_RESLO + i) = mpy32Model_presented[i];
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   mpy32Model_setControl
+ * BRIEF:   Set Control Bits
+ * RETURN:  Returns Nothing
+ * ARG:     Set: Bits To Set
+ * ARG:     Clear: Bits To Clear
+ ****************************************************************************************************/
+static void mpy32Model_setControl(const uint16_t Set, const uint16_t Clear)
+{
+    /*** Set Control ***/
+    HW_MEMMAP_REG16(MPY32_BASE + OFS_MPY32CTL0) = (uint16_t)((HW_MEMMAP_REG16(MPY32_BASE + OFS_MPY32CTL0) & ~Clear) | Set);
+}
+
+/****************************************************************************************************
+ * FUNCT:   mpy32Model_writeRegister
+ * BRIEF:   Write Operand Register
+ * RETURN:  Returns Nothing
+ * ARG:     Offset: Register Offset (Word Aligned)
+ * ARG:     Value: Written Word
+ * ARG:     Byte: Byte Write (Low Byte)
+ ****************************************************************************************************/
+static void mpy32Model_writeRegister(const uint32_t Offset, const uint16_t Value, const bool Byte)
+{
+    uint16_t mode;
+
+    /*** 16-Bit Operand 1 (MPY, MPYS, MAC, MACS) ***/
+    if(Offset < OFS_OP2)
+    {
+        mode = (uint16_t)(Offset >> 1);
+        mpy32Model_operandOne = mpy32Model_extend(Value, Byte, (mode & 1) != 0);
+        mpy32Model_setControl((uint16_t)(mode << 4), MPYM0 | MPYM1 | OP1_32);
+    }
+
+    /*** 16-Bit Operand 2 (Starts The Operation) ***/
+    else if(Offset == OFS_OP2)
+    {
+        mpy32Model_operandTwo = mpy32Model_extend(Value, Byte, (HW_MEMMAP_REG16(MPY32_BASE + OFS_MPY32CTL0) & MPYM0) == MPYM0);
+        mpy32Model_setControl(0, OP2_32);
+        mpy32Model_multiply();
+    }
+
+    /*** 32-Bit Operand 1 (MPY32, MPYS32, MAC32, MACS32; Low Word First) ***/
+    else if((Offset >= OFS_MPY32L) && (Offset < OFS_OP2L))
+    {
+        mode = (uint16_t)((Offset - OFS_MPY32L) >> 2);
+        if((Offset & 2) == 0)
+            mpy32Model_operandOne = Value;
+        else
+            mpy32Model_operandOne = (mpy32Model_operandOne & 0xFFFF) | ((uint32_t)mpy32Model_extend(Value, Byte, (mode & 1) != 0) << 16);
+        mpy32Model_setControl((uint16_t)((mode << 4) | OP1_32), MPYM0 | MPYM1);
+    }
+
+    /*** 32-Bit Operand 2 (OP2H Starts The Operation) ***/
+    else if(Offset == OFS_OP2L)
+    {
+        mpy32Model_operandTwo = Value;
+    }
+    else if(Offset == OFS_OP2H)
+    {
+        mpy32Model_operandTwo = (mpy32Model_operandTwo & 0xFFFF) | ((uint32_t)mpy32Model_extend(Value, Byte, (HW_MEMMAP_REG16(MPY32_BASE + OFS_MPY32CTL0) & MPYM0) == MPYM0) << 16);
+        mpy32Model_setControl(OP2_32, 0);
+        mpy32Model_multiply();
+    }
+}
@@ -0,0 +1,30 @@
+/****************************************************************************************************
+ * FILE:    mpy32_model.h
+ * BRIEF:   MPY32 Hardware Multiplier Peripheral Model Header File
+ ****************************************************************************************************/
+
+#ifndef MPY32_MODEL_H
+#define MPY32_MODEL_H
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define MPY32_MODEL_LENGTH (0x002E) // MPY32 Module Register Space (MPY32_BASE)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern bool mpy32Model_access(const uint32_t Address, const uint8_t Size);
+extern void mpy32Model_complete(const uint32_t Address, const uint8_t Size);
+extern void mpy32Model_reset(void);
+
+#endif
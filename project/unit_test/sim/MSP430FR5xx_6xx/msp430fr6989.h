@@ -6382,4 +6382,22 @@ SFR_8BIT(WDTCTL_H);                           /* Watchdog Timer Control */
 }
 #endif /* extern "C" */
 
+/************************************************************
+* Simulation: Interrupt Keyword And Interrupt Vector (And Flag) Registers Mapped Into Simulated Memory
+************************************************************/
+
+#include "inc/hw_memmap.h"
+
+#define __interrupt
+
+#define CEIV                   HWREG16(0x08CE) /* Comparator E Interrupt Vector Word */
+#define P1IV                   HWREG16(0x020E) /* Port 1 Interrupt Vector Word */
+#define P2IV                   HWREG16(0x021E) /* Port 2 Interrupt Vector Word */
+#define P3IV                   HWREG16(0x022E) /* Port 3 Interrupt Vector Word */
+#define P4IV                   HWREG16(0x023E) /* Port 4 Interrupt Vector Word */
+#define TA0IV                  HWREG16(0x036E) /* Timer0_A3 Interrupt Vector Word */
+#define TB0IV                  HWREG16(0x03EE) /* Timer0_B7 Interrupt Vector Word */
+#define UCA1IFG                HWREG16(0x05FC) /* USCI A1 Interrupt Flags Register */
+#define UCA1IV                 HWREG16(0x05FE) /* USCI A1 Interrupt Vector Register */
+
 #endif /* #ifndef __MSP430FR6989 */
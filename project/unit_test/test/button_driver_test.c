@@ -11,8 +11,11 @@
 #include "button_driver_test.h"
 #include "driver_config.h"
 #include "gpio.h"
+#include "gpio_model.h"
 #include "hw_memmap.h"
+#include "interrupt_handler.h"
 #include "led_driver_test.h"
+#include "port_driver.h"
 #include <stdint.h>
 #include "system.h"
 #include "unity_fixture.h"
@@ -117,10 +120,73 @@ TEST(button_driver_test, portInterruptHandler)
 		}
 
 		/* Interrupt */
-		buttonDriver_portInterruptHandler(P1IV_P1IFG1);
+		portDriver_interruptHandler(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT, P1IV_P1IFG1);
 	}
 }
 
+TEST(button_driver_test, portInterruptStimulus)
+{
+    gpioModel_edge_t edges[2 * (1 + (2 * 8))], edge;
+    uint32_t seed = 0x12345678;
+    size_t count;
+    uint16_t i;
+    uint8_t bounces;
+
+    /********************************************************************************
+     * Test 1: Clean Press And Release
+     ********************************************************************************/
+
+    /* Set Up */
+    TEST_ASSERT_TRUE(gpioModel_setVectorHandler(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT, interruptHandler_port1Vector));
+    gpioModel_setPins(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT, DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PIN | DRIVER_CONFIG_BUTTON_GPIO_BUTTON_2_PIN, true); // Pulled Up
+    TEST_ASSERT_EQUAL_HEX8(0x00, buttonDriver_state);
+
+    /* Press (Active Low) */
+    gpioModel_setPins(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT, DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PIN, false);
+    TEST_ASSERT_EQUAL_HEX8(BUTTON_DRIVER_BUTTON_1, buttonDriver_state);
+    TEST_ASSERT_EQUAL_HEX16(P1IV_NONE, P1IV);
+
+    /* Release */
+    gpioModel_setPins(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT, DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PIN, true);
+    TEST_ASSERT_EQUAL_HEX8(0x00, buttonDriver_state);
+
+    /* Both Buttons Pressed Together (P1IV Priority: P1.1 Then P1.2) */
+    gpioModel_setPins(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT, DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PIN | DRIVER_CONFIG_BUTTON_GPIO_BUTTON_2_PIN, false);
+    TEST_ASSERT_EQUAL_HEX8(BUTTON_DRIVER_BUTTON_1 | BUTTON_DRIVER_BUTTON_2, buttonDriver_state);
+    gpioModel_setPins(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT, DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PIN | DRIVER_CONFIG_BUTTON_GPIO_BUTTON_2_PIN, true);
+    TEST_ASSERT_EQUAL_HEX8(0x00, buttonDriver_state);
+
+    /********************************************************************************
+     * Test 2: Bouncing Press And Release (State Follows The Settled Level)
+     ********************************************************************************/
+
+    for(i = 0; i < 1000; i++)
+    {
+        /* Stimulus */
+        bounces = (uint8_t)(seed % 9);
+        edge.time = gpioModel_getTime() + 1000;
+        edge.port = DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT;
+        edge.pins = DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PIN;
+        edge.high = false;
+        count = gpioModel_generateBounce(edges, sizeof(edges) / sizeof(edges[0]), &edge, bounces, 200, &seed);
+        edge.time += 20000;
+        edge.high = true;
+        count += gpioModel_generateBounce(&edges[count], (sizeof(edges) / sizeof(edges[0])) - count, &edge, bounces, 200, &seed);
+        TEST_ASSERT_TRUE(gpioModel_loadStimulus(edges, count));
+
+        /* Pressed */
+        gpioModel_advance(11000);
+        TEST_ASSERT_EQUAL_HEX8(BUTTON_DRIVER_BUTTON_1, buttonDriver_state);
+
+        /* Released */
+        gpioModel_advance(20000);
+        TEST_ASSERT_EQUAL_HEX8(0x00, buttonDriver_state);
+    }
+
+    /* Clean Up */
+    TEST_ASSERT_TRUE(gpioModel_loadStimulus(NULL, 0));
+}
+
 TEST(button_driver_test, tick)
 {
 	uint8_t i;
@@ -184,5 +250,6 @@ TEST_GROUP_RUNNER(button_driver_test)
 {
     RUN_TEST_CASE(button_driver_test, init)
 	RUN_TEST_CASE(button_driver_test, portInterruptHandler)
+	RUN_TEST_CASE(button_driver_test, portInterruptStimulus)
 	RUN_TEST_CASE(button_driver_test, tick)
 }
@@ -0,0 +1,472 @@
+/****************************************************************************************************
+ * FILE:    checkpoint_driver_test.c
+ * BRIEF:   Checkpoint Driver Test Source File
+ * NOTE:    Firmware Globals Live In Host Memory, So The Simulated RAM Image Is Filled With Random
+ *          Words And The Checkpoint Engine Is Checked On Those; Power Cuts longjmp() Out Of An
+ *          Access Callback, So The Cut Access (And Everything After It) Never Happens
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define CHECKPOINT_DRIVER_TEST_PERIPHERAL_END   (0x1000) // Peripheral Register Space: Reset By A Brownout
+#define CHECKPOINT_DRIVER_TEST_PERIPHERAL_START (0x0100)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "checkpoint_driver.h"
+#include "checkpoint_driver_test.h"
+#include "driver_config.h"
+#include "hw_memmap.h"
+#include "interrupt_handler.h"
+#include "intrinsics.h"
+#include "memory_driver.h"
+#include "memory_driver_test.h"
+#include "msp430fr5xx_6xxgeneric.h"
+#include "msp430fr6989.h"
+#include <setjmp.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "system.h"
+#include "unity_fixture.h"
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static uint32_t checkpointDriverTest_accessCount, checkpointDriverTest_cutAccess; // Cut Before Access Number (0: Never)
+static jmp_buf checkpointDriverTest_powerCut;
+static uint32_t checkpointDriverTest_seed, checkpointDriverTest_state;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void checkpointDriverTest_accessCallback(const uint32_t Address);
+static bool checkpointDriverTest_checkpoint(const uint32_t CutAccess);
+static void checkpointDriverTest_copyRam(uint16_t * const Image);
+static void checkpointDriverTest_fillRam(void);
+static uint32_t checkpointDriverTest_getRandom(void);
+static void checkpointDriverTest_powerCycle(void);
+static bool checkpointDriverTest_resume(const uint32_t CutAccess, bool * const Resumed);
+
+/****************************************************************************************************
+ * Function Definitions
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   checkpointDriverTest_accessCallback
+ * BRIEF:   Access Callback
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Accessed Address (Unused)
+ ****************************************************************************************************/
+static void checkpointDriverTest_accessCallback(const uint32_t Address)
+{
+    (void)Address;
+
+    /*** Power Cut Before This Access ***/
+    checkpointDriverTest_accessCount++;
+    if(checkpointDriverTest_accessCount == checkpointDriverTest_cutAccess)
+        longjmp(checkpointDriverTest_powerCut, 1);
+}
+
+/****************************************************************************************************
+ * FUNCT:   checkpointDriverTest_checkpoint
+ * BRIEF:   Checkpoint
+ * RETURN:  bool: Completed (true) Or Power Cut (false)
+ * ARG:     CutAccess: Cut Before This Access Of The Comparator Interrupt (0: Never)
+ * NOTE:    checkpointDriverTest_accessCount Holds The Number Of Accesses Made
+ ****************************************************************************************************/
+static bool checkpointDriverTest_checkpoint(const uint32_t CutAccess)
+{
+    bool completed;
+
+    /*** Supply Collapsing: Comparator Interrupt ***/
+    completed = false;
+    checkpointDriverTest_accessCount = 0;
+    checkpointDriverTest_cutAccess = CutAccess;
+    HW_MEMMAP_REG16(COMP_E_BASE + OFS_CEIV) = CEIV_CEIFG;
+    __enable_interrupt();
+    TEST_ASSERT_TRUE(hwMemmap_registerAccessCallback(checkpointDriverTest_accessCallback));
+    if(setjmp(checkpointDriverTest_powerCut) == 0)
+        completed = intrinsics_callInterruptHandler(interruptHandler_compEVector);
+    hwMemmap_unregisterAccessCallback(checkpointDriverTest_accessCallback);
+    HW_MEMMAP_REG16(COMP_E_BASE + OFS_CEIV) = CEIV_NONE;
+
+    return completed;
+}
+
+/****************************************************************************************************
+ * FUNCT:   checkpointDriverTest_copyRam
+ * BRIEF:   Copy RAM
+ * RETURN:  Returns Nothing
+ * ARG:     Image: Simulated RAM Contents (MEMORY_DRIVER_RAM_LENGTH Bytes)
+ ****************************************************************************************************/
+static void checkpointDriverTest_copyRam(uint16_t * const Image)
+{
+    /*** Copy RAM ***/
+    (void)memcpy(Image, &hwMemmap_memory[MEMORY_DRIVER_RAM_START], MEMORY_DRIVER_RAM_LENGTH);
+}
+
+/****************************************************************************************************
+ * FUNCT:   checkpointDriverTest_fillRam
+ * BRIEF:   Fill RAM
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ ****************************************************************************************************/
+static void checkpointDriverTest_fillRam(void)
+{
+    uint32_t address;
+
+    /*** Random Words ***/
+    for(address = MEMORY_DRIVER_RAM_START; address < (MEMORY_DRIVER_RAM_START + MEMORY_DRIVER_RAM_LENGTH); address += sizeof(uint16_t))
+        HW_MEMMAP_REG16(address) = (uint16_t)checkpointDriverTest_getRandom();
+}
+
+/****************************************************************************************************
+ * FUNCT:   checkpointDriverTest_getRandom
+ * BRIEF:   Get Random
+ * RETURN:  uint32_t: Next Value Of Seeded xorshift32 Sequence
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+static uint32_t checkpointDriverTest_getRandom(void)
+{
+    /*** Get Random ***/
+    checkpointDriverTest_state ^= checkpointDriverTest_state << 13;
+    checkpointDriverTest_state ^= checkpointDriverTest_state >> 17;
+    checkpointDriverTest_state ^= checkpointDriverTest_state << 5;
+    return checkpointDriverTest_state;
+}
+
+/****************************************************************************************************
+ * FUNCT:   checkpointDriverTest_powerCycle
+ * BRIEF:   Power Cycle
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ * NOTE:    Brownout Reset: RAM Holds Garbage, Peripheral Registers Reset (Ports Locked, UART Held In
+ *          Reset), FRAM Untouched
+ ****************************************************************************************************/
+static void checkpointDriverTest_powerCycle(void)
+{
+    /*** Brownout Reset ***/
+    checkpointDriverTest_fillRam();
+    (void)memset(&hwMemmap_memory[CHECKPOINT_DRIVER_TEST_PERIPHERAL_START], 0, CHECKPOINT_DRIVER_TEST_PERIPHERAL_END - CHECKPOINT_DRIVER_TEST_PERIPHERAL_START);
+    HW_MEMMAP_REG16(PMM_BASE + OFS_PM5CTL0) = LOCKLPM5;
+    HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxCTLW0) = UCSWRST;
+    intrinsics_reset();
+}
+
+/****************************************************************************************************
+ * FUNCT:   checkpointDriverTest_resume
+ * BRIEF:   Resume
+ * RETURN:  bool: Completed (true) Or Power Cut (false)
+ * ARG:     CutAccess: Cut Before This Access Of The Resume (0: Never)
+ * ARG:     Resumed: checkpointDriver_resume() Return Value (Completed Only)
+ * NOTE:    After A Brownout (SYSRSTIV_BOR)
+ ****************************************************************************************************/
+static bool checkpointDriverTest_resume(const uint32_t CutAccess, bool * const Resumed)
+{
+    bool completed;
+
+    /*** Resume ***/
+    completed = false;
+    checkpointDriverTest_accessCount = 0;
+    checkpointDriverTest_cutAccess = CutAccess;
+    TEST_ASSERT_TRUE(hwMemmap_registerAccessCallback(checkpointDriverTest_accessCallback));
+    if(setjmp(checkpointDriverTest_powerCut) == 0)
+    {
+        *Resumed = checkpointDriver_resume(SYSRSTIV_BOR);
+        completed = true;
+    }
+    hwMemmap_unregisterAccessCallback(checkpointDriverTest_accessCallback);
+
+    return completed;
+}
+
+/****************************************************************************************************
+ * Test Group
+ ****************************************************************************************************/
+
+TEST_GROUP(checkpoint_driver_test);
+
+/****************************************************************************************************
+ * Test Setup And Teardown
+ ****************************************************************************************************/
+
+TEST_SETUP(checkpoint_driver_test)
+{
+    const char *seed;
+
+    /*** Set Up ***/
+    /* Simulation */
+    hwMemmap_init();
+
+    /* Application */
+    system_init();
+
+    /* Test */
+    seed = getenv(CHECKPOINT_DRIVER_TEST_SEED_VARIABLE);
+    checkpointDriverTest_seed = (seed != NULL) ? (uint32_t)strtoul(seed, NULL, 0) : CHECKPOINT_DRIVER_TEST_SEED_DEFAULT; // Override For Exploration
+    checkpointDriverTest_state = (checkpointDriverTest_seed != 0) ? checkpointDriverTest_seed : 0x9E3779B9u;
+}
+
+TEST_TEAR_DOWN(checkpoint_driver_test)
+{
+    /*** Tear Down ***/
+    intrinsics_reset();
+}
+
+/****************************************************************************************************
+ * Tests
+ ****************************************************************************************************/
+
+TEST(checkpoint_driver_test, init)
+{
+    /********************************************************************************
+     * Test 1: Supply Monitor
+     ********************************************************************************/
+
+    /*** Subtest 1: Comparator On, VCC Divider Against The Reference Ladder ***/
+    TEST_ASSERT_EQUAL_HEX16(CEON, HWREG16(COMP_E_BASE + OFS_CECTL1) & CEON);
+    TEST_ASSERT_EQUAL_HEX16(CERSEL, HWREG16(COMP_E_BASE + OFS_CECTL2) & CERSEL);
+    TEST_ASSERT_EQUAL_HEX16(CEREF0_29 | CEREF1_29, HWREG16(COMP_E_BASE + OFS_CECTL2) & (CEREF0_31 | CEREF1_31));
+
+    /*** Subtest 2: Falling Edge Interrupt ***/
+    TEST_ASSERT_EQUAL_HEX16(CEIES, HWREG16(COMP_E_BASE + OFS_CECTL1) & CEIES);
+    TEST_ASSERT_EQUAL_HEX16(CEIE, HWREG16(COMP_E_BASE + OFS_CEINT) & (CEIE | CEIFG));
+
+    /********************************************************************************
+     * Test 2: No Checkpoint
+     ********************************************************************************/
+
+    /*** Subtest 1: Nothing To Resume ***/
+    TEST_ASSERT_EQUAL_UINT8(CHECKPOINT_DRIVER_SLOT_NONE, checkpointDriver_newestSlot);
+    TEST_ASSERT_FALSE(checkpointDriver_resume(SYSRSTIV_BOR));
+}
+
+TEST(checkpoint_driver_test, powerCut)
+{
+    bool committed, completed, resumed;
+    char message[64];
+    uint16_t current[MEMORY_DRIVER_RAM_LENGTH / sizeof(uint16_t)], previous[MEMORY_DRIVER_RAM_LENGTH / sizeof(uint16_t)];
+    uint32_t checkpointAccesses, cut, i, resumeAccesses;
+    uint8_t slot;
+
+    (void)snprintf(message, sizeof(message), "%s=%lu", CHECKPOINT_DRIVER_TEST_SEED_VARIABLE, (unsigned long)checkpointDriverTest_seed);
+
+    /********************************************************************************
+     * Test 1: Accesses Per Checkpoint And Per Resume
+     ********************************************************************************/
+
+    /*** Subtest 1: Count ***/
+    checkpointDriverTest_fillRam();
+    TEST_ASSERT_TRUE(checkpointDriverTest_checkpoint(0));
+    checkpointAccesses = checkpointDriverTest_accessCount;
+    checkpointDriverTest_powerCycle();
+    TEST_ASSERT_TRUE(checkpointDriverTest_resume(0, &resumed));
+    TEST_ASSERT_TRUE(resumed);
+    resumeAccesses = checkpointDriverTest_accessCount;
+    TEST_ASSERT_GREATER_THAN_UINT32(MEMORY_DRIVER_RAM_LENGTH, checkpointAccesses);
+    TEST_ASSERT_GREATER_THAN_UINT32(MEMORY_DRIVER_RAM_LENGTH, resumeAccesses);
+
+    /********************************************************************************
+     * Test 2: Power Cuts At Random Accesses Never Resume A Torn Or Stale Image
+     ********************************************************************************/
+
+    for(i = 0; i < CHECKPOINT_DRIVER_TEST_POWER_CUTS; i++)
+    {
+        /*** Subtest 1: Two Committed Checkpoints (Both Slots Valid), Cut During A Third ***/
+        checkpointDriverTest_fillRam();
+        TEST_ASSERT_TRUE_MESSAGE(checkpointDriverTest_checkpoint(0), message);
+        checkpointDriverTest_fillRam();
+        TEST_ASSERT_TRUE_MESSAGE(checkpointDriverTest_checkpoint(0), message);
+        checkpointDriverTest_copyRam(previous);
+        checkpointDriverTest_fillRam();
+        slot = checkpointDriver_newestSlot;
+        cut = 1 + (checkpointDriverTest_getRandom() % (checkpointAccesses + (checkpointAccesses / 8))); // Past The End: Completes
+        completed = checkpointDriverTest_checkpoint(cut);
+        TEST_ASSERT_EQUAL_MESSAGE(cut > checkpointAccesses, completed, message);
+        committed = (checkpointDriver_newestSlot != slot); // A Cut While Arming The Rising Edge Still Committed
+        checkpointDriverTest_copyRam(current);
+
+        /*** Subtest 2: Cut While Resuming, Then Resume Again: The Newest Committed Image Or Nothing ***/
+        checkpointDriverTest_powerCycle();
+        cut = 1 + (checkpointDriverTest_getRandom() % (resumeAccesses + (resumeAccesses / 8)));
+        resumed = false;
+        if(!checkpointDriverTest_resume(cut, &resumed))
+        {
+            checkpointDriverTest_powerCycle();
+            TEST_ASSERT_TRUE_MESSAGE(checkpointDriverTest_resume(0, &resumed), message);
+        }
+        else
+        {
+            TEST_ASSERT_TRUE_MESSAGE(resumed, message);
+        }
+        if(resumed)
+        {
+            TEST_ASSERT_EQUAL_HEX16_ARRAY_MESSAGE(committed ? current : previous, &hwMemmap_memory[MEMORY_DRIVER_RAM_START], MEMORY_DRIVER_RAM_LENGTH / sizeof(uint16_t), message);
+        }
+
+        /*** Subtest 3: Consumed ***/
+        TEST_ASSERT_TRUE_MESSAGE(checkpointDriverTest_resume(0, &resumed), message);
+        TEST_ASSERT_FALSE_MESSAGE(resumed, message);
+    }
+}
+
+TEST(checkpoint_driver_test, resume)
+{
+    bool resumed;
+    uint16_t image[MEMORY_DRIVER_RAM_LENGTH / sizeof(uint16_t)];
+
+    /********************************************************************************
+     * Test 1: Resume
+     ********************************************************************************/
+
+    /*** Subtest 1: Checkpoint, Then Brownout ***/
+    HWREG16(SYS_BASE + OFS_SYSCTL) = SYSRIVECT;
+    HWREG16(CS_BASE + OFS_CSCTL2) = 0x0133;
+    HWREG16(PA_BASE + OFS_PAOUT) = 0x0081;
+    HWREG16(LCD_C_BASE + OFS_LCDM1) = 0xA55A;
+    HWREG16(DRIVER_CONFIG_LED_TIMER + OFS_TAxCCR1) = 0x1234;
+    HWREG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxBRW) = 0x0034;
+    HWREG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxIE) = UCRXIE; // Last In The Table
+    checkpointDriverTest_fillRam();
+    TEST_ASSERT_TRUE(checkpointDriverTest_checkpoint(0));
+    checkpointDriverTest_copyRam(image);
+    checkpointDriverTest_powerCycle();
+
+    /*** Subtest 2: RAM, Registers And CPU Context Restored ***/
+    TEST_ASSERT_TRUE(checkpointDriverTest_resume(0, &resumed));
+    TEST_ASSERT_TRUE(resumed);
+    TEST_ASSERT_EQUAL_HEX16_ARRAY(image, &hwMemmap_memory[MEMORY_DRIVER_RAM_START], MEMORY_DRIVER_RAM_LENGTH / sizeof(uint16_t));
+    TEST_ASSERT_EQUAL_HEX16(SYSRIVECT, HWREG16(SYS_BASE + OFS_SYSCTL) & SYSRIVECT);
+    TEST_ASSERT_EQUAL_HEX16(0x0133, HWREG16(CS_BASE + OFS_CSCTL2));
+    TEST_ASSERT_EQUAL_HEX16(0x0081, HWREG16(PA_BASE + OFS_PAOUT));
+    TEST_ASSERT_EQUAL_HEX16(0xA55A, HWREG16(LCD_C_BASE + OFS_LCDM1));
+    TEST_ASSERT_EQUAL_HEX16(0x1234, HWREG16(DRIVER_CONFIG_LED_TIMER + OFS_TAxCCR1));
+    TEST_ASSERT_EQUAL_HEX16(0x0034, HWREG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxBRW));
+    TEST_ASSERT_EQUAL_HEX16(0, HWREG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxCTLW0) & UCSWRST);
+    TEST_ASSERT_EQUAL_HEX16(UCRXIE, HWREG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxIE));
+    TEST_ASSERT_EQUAL_HEX16(0, HWREG16(PMM_BASE + OFS_PM5CTL0) & LOCKLPM5);
+    TEST_ASSERT_EQUAL_HEX16(MEMORY_DRIVER_TEST_STACK_END - 4, __get_SP_register());                      // Program Counter And Status Register Stacked
+    TEST_ASSERT_FALSE(intrinsics_getInterruptsEnabled());                                                 // In The Interrupt Handler
+
+    /*** Subtest 3: Supply Monitor Re-Armed ***/
+    TEST_ASSERT_EQUAL_HEX16(CEON, HWREG16(COMP_E_BASE + OFS_CECTL1) & CEON);
+    TEST_ASSERT_EQUAL_HEX16(CEIE, HWREG16(COMP_E_BASE + OFS_CEINT) & CEIE);
+
+    /*** Subtest 4: Consumed: A Later Reset Starts Cleanly ***/
+    TEST_ASSERT_FALSE(checkpointDriver_resume(SYSRSTIV_BOR));
+}
+
+TEST(checkpoint_driver_test, recover)
+{
+    system_boot_t boot;
+
+    /********************************************************************************
+     * Test 1: Dip And Recover
+     ********************************************************************************/
+
+    /*** Subtest 1: Dip: Checkpoint, Then Watch For Recovery (Rising Edge) ***/
+    checkpointDriverTest_fillRam();
+    TEST_ASSERT_TRUE(checkpointDriverTest_checkpoint(0));
+    TEST_ASSERT_NOT_EQUAL(CHECKPOINT_DRIVER_SLOT_NONE, checkpointDriver_newestSlot);
+    TEST_ASSERT_EQUAL_HEX16(0, HWREG16(COMP_E_BASE + OFS_CECTL1) & CEIES);
+    TEST_ASSERT_EQUAL_HEX16(CEIE, HWREG16(COMP_E_BASE + OFS_CEINT) & (CEIE | CEIFG));
+
+    /*** Subtest 2: Recover: Both Slots Invalidated, Then Watch For The Next Dip (Falling Edge) ***/
+    HW_MEMMAP_REG16(COMP_E_BASE + OFS_CECTL1) |= CEOUT;
+    HW_MEMMAP_REG16(COMP_E_BASE + OFS_CEIV) = CEIV_CEIFG;
+    TEST_ASSERT_TRUE(intrinsics_callInterruptHandler(interruptHandler_compEVector));
+    HW_MEMMAP_REG16(COMP_E_BASE + OFS_CEIV) = CEIV_NONE;
+    TEST_ASSERT_EQUAL_UINT8(CHECKPOINT_DRIVER_SLOT_NONE, checkpointDriver_newestSlot);
+    TEST_ASSERT_EQUAL_HEX16(0, HW_MEMMAP_REG16(CHECKPOINT_DRIVER_TEST_SLOT_START + offsetof(checkpointDriver_slot_t, header.marker)));
+    TEST_ASSERT_EQUAL_HEX16(0, HW_MEMMAP_REG16(CHECKPOINT_DRIVER_TEST_SLOT_START + sizeof(checkpointDriver_slot_t) + offsetof(checkpointDriver_slot_t, header.marker)));
+    TEST_ASSERT_EQUAL_HEX16(CEIES, HWREG16(COMP_E_BASE + OFS_CECTL1) & CEIES);
+    TEST_ASSERT_EQUAL_HEX16(CEIE, HWREG16(COMP_E_BASE + OFS_CEINT) & (CEIE | CEIFG));
+
+    /*** Subtest 3: Watchdog Reset: Cold system_init(), Not The Old Image ***/
+    checkpointDriverTest_fillRam();
+    intrinsics_reset();
+    HW_MEMMAP_REG16(SYS_BASE + OFS_SYSRSTIV) = SYSRSTIV_WDTTO;
+    TEST_ASSERT_FALSE(checkpointDriver_resume(system_getResetCause()));
+    system_init();
+    system_getBoot(&boot);
+    TEST_ASSERT_EQUAL_HEX16(SYSRSTIV_WDTTO, boot.resetCause);
+
+    /********************************************************************************
+     * Test 2: Reset That Isn't A Power Failure
+     ********************************************************************************/
+
+    /*** Subtest 1: Committed Checkpoint, Then RST Pin: Discarded ***/
+    checkpointDriverTest_fillRam();
+    TEST_ASSERT_TRUE(checkpointDriverTest_checkpoint(0));
+    TEST_ASSERT_FALSE(checkpointDriver_resume(SYSRSTIV_RSTNMI));
+    TEST_ASSERT_EQUAL_UINT8(CHECKPOINT_DRIVER_SLOT_NONE, checkpointDriver_newestSlot);
+
+    /*** Subtest 2: A Brownout Afterwards Doesn't Resume It Either ***/
+    TEST_ASSERT_FALSE(checkpointDriver_resume(SYSRSTIV_BOR));
+
+    /*** Subtest 3: Supply Supervisor (SVSH) Is A Power Failure ***/
+    checkpointDriverTest_fillRam();
+    TEST_ASSERT_TRUE(checkpointDriverTest_checkpoint(0));
+    TEST_ASSERT_TRUE(checkpointDriver_resume(SYSRSTIV_SVSHIFG));
+}
+
+TEST(checkpoint_driver_test, save)
+{
+    uint16_t sequence;
+
+    /********************************************************************************
+     * Test 1: Double Buffered
+     ********************************************************************************/
+
+    /*** Subtest 1: First Checkpoint ***/
+    sequence = checkpointDriver_getSequence();
+    checkpointDriverTest_fillRam();
+    TEST_ASSERT_TRUE(checkpointDriverTest_checkpoint(0));
+    TEST_ASSERT_EQUAL_UINT8(0, checkpointDriver_newestSlot);
+    TEST_ASSERT_EQUAL_UINT16(sequence + 1, checkpointDriver_getSequence());
+    TEST_ASSERT_EQUAL_HEX16(CHECKPOINT_DRIVER_MARKER, HW_MEMMAP_REG16(CHECKPOINT_DRIVER_TEST_SLOT_START + offsetof(checkpointDriver_slot_t, header.marker)));
+    TEST_ASSERT_EQUAL_HEX16_ARRAY(&hwMemmap_memory[MEMORY_DRIVER_RAM_START], &hwMemmap_memory[CHECKPOINT_DRIVER_TEST_SLOT_START + offsetof(checkpointDriver_slot_t, image)], MEMORY_DRIVER_RAM_LENGTH / sizeof(uint16_t));
+
+    /*** Subtest 2: Alternating Slots, The Newest Committed One Untouched ***/
+    checkpointDriverTest_fillRam();
+    TEST_ASSERT_TRUE(checkpointDriverTest_checkpoint(0));
+    TEST_ASSERT_EQUAL_UINT8(1, checkpointDriver_newestSlot);
+    TEST_ASSERT_EQUAL_UINT16(sequence + 2, checkpointDriver_getSequence());
+    TEST_ASSERT_EQUAL_HEX16_ARRAY(&hwMemmap_memory[MEMORY_DRIVER_RAM_START], &hwMemmap_memory[CHECKPOINT_DRIVER_TEST_SLOT_START + sizeof(checkpointDriver_slot_t) + offsetof(checkpointDriver_slot_t, image)], MEMORY_DRIVER_RAM_LENGTH / sizeof(uint16_t));
+    checkpointDriverTest_fillRam();
+    TEST_ASSERT_TRUE(checkpointDriverTest_checkpoint(0));
+    TEST_ASSERT_EQUAL_UINT8(0, checkpointDriver_newestSlot);
+    TEST_ASSERT_EQUAL_UINT16(sequence + 3, checkpointDriver_getSequence());
+
+    /********************************************************************************
+     * Test 2: Other Comparator Interrupts
+     ********************************************************************************/
+
+    /*** Subtest 1: Ready (CERDYIFG) Doesn't Checkpoint ***/
+    HW_MEMMAP_REG16(COMP_E_BASE + OFS_CEIV) = CEIV_CERDYIFG;
+    TEST_ASSERT_TRUE(intrinsics_callInterruptHandler(interruptHandler_compEVector));
+    TEST_ASSERT_EQUAL_UINT16(sequence + 3, checkpointDriver_getSequence());
+}
+
+/****************************************************************************************************
+ * Test Group Runner
+ ****************************************************************************************************/
+
+TEST_GROUP_RUNNER(checkpoint_driver_test)
+{
+    RUN_TEST_CASE(checkpoint_driver_test, init)
+    RUN_TEST_CASE(checkpoint_driver_test, powerCut)
+    RUN_TEST_CASE(checkpoint_driver_test, recover)
+    RUN_TEST_CASE(checkpoint_driver_test, resume)
+    RUN_TEST_CASE(checkpoint_driver_test, save)
+}
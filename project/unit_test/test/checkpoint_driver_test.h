@@ -0,0 +1,31 @@
+/****************************************************************************************************
+ * FILE:    checkpoint_driver_test.h
+ * BRIEF:   Checkpoint Driver Test Header File
+ ****************************************************************************************************/
+
+#ifndef CHECKPOINT_DRIVER_TEST_H
+#define CHECKPOINT_DRIVER_TEST_H
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define CHECKPOINT_DRIVER_TEST_POWER_CUTS     (300)
+#define CHECKPOINT_DRIVER_TEST_SEED_DEFAULT   (0x6C078965u) // Fixed, So Every Run Cuts Power At The Same Points
+#define CHECKPOINT_DRIVER_TEST_SEED_VARIABLE  ("CHECKPOINT_DRIVER_TEST_SEED")
+#define CHECKPOINT_DRIVER_TEST_SLOT_START     (0x4400) // Simulated FRAM (Stand-In For The .checkpoint Section)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+extern uint8_t checkpointDriver_newestSlot;
+extern uint16_t checkpointDriver_sequence;
+
+#endif
@@ -3,6 +3,13 @@
  * BRIEF:   Command Line Interface (CLI) Callback Test Source File
  ****************************************************************************************************/
 
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define CLI_CALLBACK_TEST_RANDOM_LINE_COUNT    (1000) // random -c1000 -u
+#define CLI_CALLBACK_TEST_FORMAT_STRING_LENGTH (64)
+
 /****************************************************************************************************
  * Includes
  ****************************************************************************************************/
@@ -16,8 +23,11 @@
 #include "hw_memmap.h"
 #include "msp430fr5xx_6xxgeneric.h"
 #include "status.h"
+#include <stdarg.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
 #include <string.h>
 #include "system.h"
 #include "unity_fixture.h"
@@ -26,8 +36,17 @@
  * Constants and Variables
  ****************************************************************************************************/
 
+static uint32_t cliCallbackTest_multiplyCount;
 static char cliCallbackTest_printfOutput[CLI_CALLBACK_TEST_PRINTF_OUTPUT_LENGTH];
 
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void cliCallbackTest_countMultiply(const uint32_t Address);
+static size_t cliCallbackTest_format(char * const String, const size_t Size, const char * const Format, ...);
+static size_t cliCallbackTest_vsnprintf(char * const String, const size_t Size, const char * const Format, ...);
+
 /****************************************************************************************************
  * Function Definitions
  ****************************************************************************************************/
@@ -44,6 +63,41 @@ void cliCallbackTest_copyPrintfOutput(const char * const Output)
     (void)strcat(cliCallbackTest_printfOutput, Output);
 }
 
+/****************************************************************************************************
+ * FUNCT:   cliCallbackTest_countMultiply
+ * BRIEF:   Count Multiply (Access Callback)
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Address
+ ****************************************************************************************************/
+static void cliCallbackTest_countMultiply(const uint32_t Address)
+{
+    /*** Writing OP2H Starts A 32 x 32 Multiplication ***/
+    if(Address == (MPY32_BASE + OFS_OP2H))
+        cliCallbackTest_multiplyCount++;
+}
+
+/****************************************************************************************************
+ * FUNCT:   cliCallbackTest_format
+ * BRIEF:   Format (CLI Formatter)
+ * RETURN:  size_t: Length Written
+ * ARG:     String: String
+ * ARG:     Size: String Size
+ * ARG:     Format: Format String
+ * ARG:     ...: Optional Arguments
+ ****************************************************************************************************/
+static size_t cliCallbackTest_format(char * const String, const size_t Size, const char * const Format, ...)
+{
+    size_t length;
+    va_list arguments;
+
+    /*** Format ***/
+    va_start(arguments, Format);
+    length = cliCallback_format(String, Size, Format, arguments);
+    va_end(arguments);
+
+    return length;
+}
+
 /****************************************************************************************************
  * FUNCT:   cliCallbackTest_getPrintfOutputCopy
  * BRIEF:   Get Printf Output Copy
@@ -88,6 +142,28 @@ void cliCallbackTest_sendCommand(const char * const Command)
     TEST_ASSERT_EQUAL_INT(STATUS_SUCCESS, cli_processInput());
 }
 
+/****************************************************************************************************
+ * FUNCT:   cliCallbackTest_vsnprintf
+ * BRIEF:   Format (vsnprintf)
+ * RETURN:  size_t: Length Written
+ * ARG:     String: String
+ * ARG:     Size: String Size
+ * ARG:     Format: Format String
+ * ARG:     ...: Optional Arguments
+ ****************************************************************************************************/
+static size_t cliCallbackTest_vsnprintf(char * const String, const size_t Size, const char * const Format, ...)
+{
+    int length;
+    va_list arguments;
+
+    /*** Format ***/
+    va_start(arguments, Format);
+    length = vsnprintf(String, Size, Format, arguments);
+    va_end(arguments);
+
+    return (length > 0) ? (size_t)length : 0;
+}
+
 /****************************************************************************************************
  * Test Group
  ****************************************************************************************************/
@@ -227,19 +303,114 @@ TEST(cli_callback_test, printfCallback)
     expectedOutput = "String With 3.0 Arguments\n";
     
     /* Printf */
-    cliCallback_printfCallback(true, "String %s %0.1f Argume%cts\n", "With", 3.0, 'n'); // Flush
+    cliCallback_printfCallback(true, "String %s %u.%u Argume%cts\n", "With", 3, 0, 'n'); // Flush
     
     /* Output As Expected */
     cliCallbackTest_getPrintfOutputCopy(actualOutput);
     TEST_ASSERT_EQUAL_STRING(expectedOutput, actualOutput);
 }
 
+TEST(cli_callback_test, format)
+{
+    char actualOutput[CLI_CALLBACK_TEST_FORMAT_STRING_LENGTH];
+    uint32_t i, value;
+    
+    /********************************************************************************
+     * Test 1: Conversions
+     ********************************************************************************/
+    
+    /*** Subtest 1: Decimal ***/
+    TEST_ASSERT_EQUAL_size_t(17, cliCallbackTest_format(actualOutput, sizeof(actualOutput), "%d %i %u %d", 0, -1, 65535u, -32768));
+    TEST_ASSERT_EQUAL_STRING("0 -1 65535 -32768", actualOutput);
+    (void)cliCallbackTest_format(actualOutput, sizeof(actualOutput), "%lu %ld %ld", (uint32_t)4294967295u, (int32_t)INT32_MIN, (int32_t)INT32_MAX);
+    TEST_ASSERT_EQUAL_STRING("4294967295 -2147483648 2147483647", actualOutput);
+    (void)cliCallbackTest_format(actualOutput, sizeof(actualOutput), "%llu %lld", (uint64_t)UINT64_MAX, (int64_t)INT64_MIN);
+    TEST_ASSERT_EQUAL_STRING("18446744073709551615 -9223372036854775808", actualOutput);
+    
+    /*** Subtest 2: Hexadecimal, Character, String, Percent ***/
+    (void)cliCallbackTest_format(actualOutput, sizeof(actualOutput), "%x %X %lx %llX", 0xBEEFu, 0xBEEFu, (uint32_t)0xDEADBEEFu, (uint64_t)0x0123456789ABCDEFu);
+    TEST_ASSERT_EQUAL_STRING("beef BEEF deadbeef 123456789ABCDEF", actualOutput);
+    (void)cliCallbackTest_format(actualOutput, sizeof(actualOutput), "%c%s%% %s", 'A', "BC", (const char *)NULL);
+    TEST_ASSERT_EQUAL_STRING("ABC% (null)", actualOutput);
+    
+    /*** Subtest 3: Width And Padding ***/
+    (void)cliCallbackTest_format(actualOutput, sizeof(actualOutput), "[%5d][%-5d][%05d][%04x][%-4s][%3s]", -42, -42, -42, 0xAu, "ab", "abcd");
+    TEST_ASSERT_EQUAL_STRING("[  -42][-42  ][-0042][000a][ab  ][abcd]", actualOutput);
+    
+    /********************************************************************************
+     * Test 2: Truncation
+     ********************************************************************************/
+    
+    TEST_ASSERT_EQUAL_size_t(0, cliCallbackTest_format(actualOutput, 0, "%u", 1u));
+    TEST_ASSERT_EQUAL_size_t(7, cliCallbackTest_format(actualOutput, 8, "%s%lu", "Value: ", (uint32_t)123456u));
+    TEST_ASSERT_EQUAL_STRING("Value: ", actualOutput);
+    
+    /********************************************************************************
+     * Test 3: Matches vsnprintf (Every Digit Count, Both Sides Of Each Power Of 10)
+     ********************************************************************************/
+    
+    for(value = 1, i = 0; i < 10; i++, value *= 10)
+    {
+        char expectedOutput[CLI_CALLBACK_TEST_FORMAT_STRING_LENGTH];
+        
+        (void)cliCallbackTest_vsnprintf(expectedOutput, sizeof(expectedOutput), "%u %u %u %d", value - 1, value, value + 1, -(int32_t)value);
+        (void)cliCallbackTest_format(actualOutput, sizeof(actualOutput), "%lu %lu %lu %ld", value - 1, value, value + 1, -(int32_t)value);
+        TEST_ASSERT_EQUAL_STRING(expectedOutput, actualOutput);
+    }
+}
+
+TEST(cli_callback_test, formatRandomOutput)
+{
+    static char actualOutput[CLI_CALLBACK_TEST_RANDOM_LINE_COUNT * 24], expectedOutput[CLI_CALLBACK_TEST_RANDOM_LINE_COUNT * 24];
+    char message[128];
+    uint32_t i, value;
+    size_t actualLength, expectedLength;
+    
+    /********************************************************************************
+     * Test 1: random -c1000 -u Lines, CLI Formatter Versus vsnprintf
+     ********************************************************************************/
+    
+    /*** vsnprintf ***/
+    expectedLength = 0;
+    for(value = 2463534242u, i = 0; i < CLI_CALLBACK_TEST_RANDOM_LINE_COUNT; i++)
+    {
+        value ^= value << 13; // xorshift32
+        value ^= value >> 17;
+        value ^= value << 5;
+        expectedLength += cliCallbackTest_vsnprintf(&expectedOutput[expectedLength], sizeof(expectedOutput) - expectedLength, "%u: %u\n", i + 1, value);
+    }
+    
+    /*** CLI Formatter (Counting MPY32 Multiplications) ***/
+    actualLength = 0;
+    cliCallbackTest_multiplyCount = 0;
+    TEST_ASSERT_TRUE(hwMemmap_registerAccessCallback(cliCallbackTest_countMultiply));
+    for(value = 2463534242u, i = 0; i < CLI_CALLBACK_TEST_RANDOM_LINE_COUNT; i++)
+    {
+        value ^= value << 13; // xorshift32
+        value ^= value >> 17;
+        value ^= value << 5;
+        actualLength += cliCallbackTest_format(&actualOutput[actualLength], sizeof(actualOutput) - actualLength, "%lu: %lu\n", i + 1, value);
+    }
+    hwMemmap_unregisterAccessCallback(cliCallbackTest_countMultiply);
+    
+    /*** Same Output, One Multiplication Per Digit (": " And "\n" Are The Only Other Characters) ***/
+    TEST_ASSERT_EQUAL_size_t(expectedLength, actualLength);
+    TEST_ASSERT_EQUAL_STRING(expectedOutput, actualOutput);
+    TEST_ASSERT_EQUAL_UINT32(actualLength - (3 * CLI_CALLBACK_TEST_RANDOM_LINE_COUNT), cliCallbackTest_multiplyCount);
+    
+    /*** Report ***/
+    (void)snprintf(message, sizeof(message), "%u Lines, %lu Bytes, %lu MPY32 Multiplications, No Software Division", CLI_CALLBACK_TEST_RANDOM_LINE_COUNT, (unsigned long)actualLength, (unsigned long)cliCallbackTest_multiplyCount);
+    TEST_MESSAGE(message);
+}
+
 /****************************************************************************************************
  * Test Group Runner
  ****************************************************************************************************/
 
 TEST_GROUP_RUNNER(cli_callback_test)
 {
+    RUN_TEST_CASE(cli_callback_test, format)
+    RUN_TEST_CASE(cli_callback_test, formatRandomOutput)
     RUN_TEST_CASE(cli_callback_test, init)
     RUN_TEST_CASE(cli_callback_test, printfCallback)
 }
@@ -10,12 +10,20 @@
  * Defines
  ****************************************************************************************************/
 
-#define CLI_CALLBACK_TEST_PRINTF_OUTPUT_LENGTH (256)
+#define CLI_CALLBACK_TEST_PRINTF_OUTPUT_LENGTH (512)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stdarg.h>
+#include <stddef.h>
 
 /****************************************************************************************************
  * Function Prototypes
  ****************************************************************************************************/
 
+extern size_t cliCallback_format(char * const String, const size_t Size, const char *Format, va_list Arguments);
 extern void cliCallbackTest_copyPrintfOutput(const char * const Output);
 extern void cliCallbackTest_getPrintfOutputCopy(char * const copy);
 extern void cliCallbackTest_init(void);
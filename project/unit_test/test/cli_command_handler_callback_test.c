@@ -170,8 +170,8 @@ TEST(cli_command_handler_callback_test, randomCommandHandlerCallback)
     const cliCommandHandlerCallbackTest_commandTestData_t CommandTestData[] =
     {        
         /* Success */
-        {"random -h\n", "usage: random [OPTION]\n  -c[COUNT], --count=[COUNT]\n  -h, --help\n  -s, --seed\n  -S, --signed\n  -u, --unsigned\n[root/]$ "},
-        {"random --help\n", "usage: random [OPTION]\n  -c[COUNT], --count=[COUNT]\n  -h, --help\n  -s, --seed\n  -S, --signed\n  -u, --unsigned\n[root/]$ "},
+        {"random -h\n", "usage: random [OPTION]\n  -b, --binary\n  -c[COUNT], --count=[COUNT]\n  -h, --help\n  -s, --seed\n  -S, --signed\n  -u, --unsigned\n  -x, --secure\n[root/]$ "},
+        {"random --help\n", "usage: random [OPTION]\n  -b, --binary\n  -c[COUNT], --count=[COUNT]\n  -h, --help\n  -s, --seed\n  -S, --signed\n  -u, --unsigned\n  -x, --secure\n[root/]$ "},
         
         /* Failure */
         {"random -hme\n", "[root/]$ "},
@@ -187,16 +187,36 @@ TEST(cli_command_handler_callback_test, randomCommandHandlerCallback)
         {"random --seed=apple\n", "[root/]$ "},
         
         /*** Signed Integer ***/
-        {"random -S\n", "Random Signed 32-Bit Integer(s):\n1: 1741056371\n[root/]$ "},
-        {"random -c3 -S\n", "Random Signed 32-Bit Integer(s):\n1: 1375685356\n2: 701348523\n3: -218373306\n[root/]$ "},
-        {"random --signed\n", "Random Signed 32-Bit Integer(s):\n1: 2093110520\n[root/]$ "},
-        {"random --count=3 --signed\n", "Random Signed 32-Bit Integer(s):\n1: 468248461\n2: 1985621603\n3: 866109850\n[root/]$ "},
+        {"random -S\n", "Random Signed 32-Bit Integer(s):\n1: -557251491\n[root/]$ "},
+        {"random -c3 -S\n", "Random Signed 32-Bit Integer(s):\n1: -1710711435\n2: -1418210462\n3: -1008638971\n[root/]$ "},
+        {"random --signed\n", "Random Signed 32-Bit Integer(s):\n1: 1553311962\n[root/]$ "},
+        {"random --count=3 --signed\n", "Random Signed 32-Bit Integer(s):\n1: 1625202774\n2: -1034268352\n3: -1540815340\n[root/]$ "},
         
         /*** Unsigned Integer ***/
-        {"random -u\n", "Random Unsigned 32-Bit Integer(s):\n1: 1714556343\n[root/]$ "},
-        {"random -c3 -u\n", "Random Unsigned 32-Bit Integer(s):\n1: 827892570\n2: 626853143\n3: 1491689172\n[root/]$ "},
-        {"random --unsigned\n", "Random Unsigned 32-Bit Integer(s):\n1: 2880622022\n[root/]$ "},
-        {"random --count=3 --unsigned\n", "Random Unsigned 32-Bit Integer(s):\n1: 2612286481\n2: 243430465\n3: 557702279\n[root/]$ "},
+        {"random -u\n", "Random Unsigned 32-Bit Integer(s):\n1: 2651137455\n[root/]$ "},
+        {"random -c3 -u\n", "Random Unsigned 32-Bit Integer(s):\n1: 2503817145\n2: 3398908791\n3: 908887127\n[root/]$ "},
+        {"random --unsigned\n", "Random Unsigned 32-Bit Integer(s):\n1: 2130235912\n[root/]$ "},
+        {"random --count=3 --unsigned\n", "Random Unsigned 32-Bit Integer(s):\n1: 3380871858\n2: 3883848102\n3: 3936895003\n[root/]$ "},
+        
+        /*** Binary (Raw Bytes Bypass The printf Output; Each Integer Advances Stream 0) ***/
+        /* Success */
+        {"random -c2 -b\n", "[root/]$ "},
+        {"random --binary\n", "[root/]$ "},
+        {"random -u\n", "Random Unsigned 32-Bit Integer(s):\n1: 890266661\n[root/]$ "},
+        
+        /* Failure */
+        {"random -b5\n", "[root/]$ "},
+        {"random --binary=please\n", "[root/]$ "},
+        {"random -u\n", "Random Unsigned 32-Bit Integer(s):\n1: 1484993000\n[root/]$ "},
+        
+        /*** Secure (Not Seeded: Entropy Is Gathered In The Background) ***/
+        /* Success */
+        {"random -x -u\n", "Secure Random Not Seeded\n[root/]$ "},
+        {"random --count=3 --secure --binary\n", "Secure Random Not Seeded\n[root/]$ "},
+        {"random --secure\n", "[root/]$ "},
+        
+        /* Failure */
+        {"random --secure=please -u\n", "Random Unsigned 32-Bit Integer(s):\n1: 3517856072\n[root/]$ "},
     };
     size_t CommandTestDataLength = sizeof(CommandTestData) / sizeof(CommandTestData[0]);
     
@@ -233,6 +253,15 @@ TEST(cli_command_handler_callback_test, systemCommandHandlerCallback)
     /*** Test Data ***/
     const cliCommandHandlerCallbackTest_commandTestData_t CommandTestData[] =
     {
+        /*** Boot ***/
+        /* Success */
+        {"system -b\n", "Reset: Cold (SYSRSTIV: 0x0000)\nKept: None\nBoot To CLI Ready: 0 us\n[root/]$ "},
+        {"system --boot\n", "Reset: Cold (SYSRSTIV: 0x0000)\nKept: None\nBoot To CLI Ready: 0 us\n[root/]$ "},
+        
+        /* Failure */
+        {"system -b5\n", "[root/]$ "},
+        {"system --boot=fast\n", "[root/]$ "},
+        
         /*** Clock ***/
         /* Success */
         {"system -c\n", "Auxiliary Clock (ACLK): 32768 Hz\nMaster Clock (MCLK): 8000000 Hz\nSub-Main CLock (SMCLK): 8000000 Hz\n[root/]$ "},
@@ -244,13 +273,44 @@ TEST(cli_command_handler_callback_test, systemCommandHandlerCallback)
         
         /*** Help ***/
         /* Success */
-        {"system -h\n", "usage: system [OPTION]\n  -c, --clock\n  -h, --help\n  -r, --reset\n[root/]$ "},
-        {"system --help\n", "usage: system [OPTION]\n  -c, --clock\n  -h, --help\n  -r, --reset\n[root/]$ "},
+        {"system -h\n", "usage: system [OPTION]\n  -b, --boot\n  -c, --clock\n  -h, --help\n  -i[RESET], --irq=[RESET]\n  -l[ON|OFF], --log=[ON|OFF]\n  -m, --mem\n  -p[MILLISECONDS], --power=[MILLISECONDS]\n  -r, --reset\n  -t, --trace\n[root/]$ "},
+        {"system --help\n", "usage: system [OPTION]\n  -b, --boot\n  -c, --clock\n  -h, --help\n  -i[RESET], --irq=[RESET]\n  -l[ON|OFF], --log=[ON|OFF]\n  -m, --mem\n  -p[MILLISECONDS], --power=[MILLISECONDS]\n  -r, --reset\n  -t, --trace\n[root/]$ "},
         
         /* Failure */
         {"system -hme\n", "[root/]$ "},
         {"system --help=please\n", "[root/]$ "},
         
+        /*** Interrupt Profile ***/
+        /* Success */
+        {"system -i\n", "Vector         Count    Min    Max Log2:Count\nPORT1              0      0      0\nPORT2              0      0      0\nPORT3              0      0      0\nPORT4              0      0      0\nTIMER0_A1          0      0      0\nTIMER0_B1          0      0      0\nUSCI_A1            0      0      0\nInterrupts Disabled Max: 0\n[root/]$ "},
+        {"system -iRESET\n", "Vector         Count    Min    Max Log2:Count\nPORT1              0      0      0\nPORT2              0      0      0\nPORT3              0      0      0\nPORT4              0      0      0\nTIMER0_A1          0      0      0\nTIMER0_B1          0      0      0\nUSCI_A1            0      0      0\nInterrupts Disabled Max: 0\n[root/]$ "},
+        {"system --irq\n", "Vector         Count    Min    Max Log2:Count\nPORT1              0      0      0\nPORT2              0      0      0\nPORT3              0      0      0\nPORT4              0      0      0\nTIMER0_A1          0      0      0\nTIMER0_B1          0      0      0\nUSCI_A1            0      0      0\nInterrupts Disabled Max: 0\n[root/]$ "},
+        {"system --irq=RESET\n", "Vector         Count    Min    Max Log2:Count\nPORT1              0      0      0\nPORT2              0      0      0\nPORT3              0      0      0\nPORT4              0      0      0\nTIMER0_A1          0      0      0\nTIMER0_B1          0      0      0\nUSCI_A1            0      0      0\nInterrupts Disabled Max: 0\n[root/]$ "},
+        
+        /* Failure */
+        {"system -iclear\n", "[root/]$ "},
+        {"system --irq=reset\n", "[root/]$ "},
+        
+        /*** Log ***/
+        /* Success */
+        {"system -l\n", "Log: OFF (Dropped Records: 0)\n[root/]$ "},
+        {"system -lON\n", "Log: ON (Dropped Records: 0)\n[root/]$ "},
+        {"system --log\n", "Log: ON (Dropped Records: 0)\n[root/]$ "},
+        {"system --log=OFF\n", "Log: OFF (Dropped Records: 0)\n[root/]$ "},
+        
+        /* Failure */
+        {"system -lmaybe\n", "[root/]$ "},
+        {"system --log=on\n", "[root/]$ "},
+        
+        /*** Memory ***/
+        /* Success */
+        {"system -m\n", "RAM: 2048 B\n.bss: 768 B\n.data: 64 B\n.TI.noinit: 16 B\n.TI.ramfunc: 96 B (Budget: 256 B)\nVectors: 112 B\nStack: 160 B (High Water: 0 B, Interrupt Entry: 0 B)\nFree: 672 B\n[root/]$ "},
+        {"system --mem\n", "RAM: 2048 B\n.bss: 768 B\n.data: 64 B\n.TI.noinit: 16 B\n.TI.ramfunc: 96 B (Budget: 256 B)\nVectors: 112 B\nStack: 160 B (High Water: 0 B, Interrupt Entry: 0 B)\nFree: 672 B\n[root/]$ "},
+        
+        /* Failure */
+        {"system -mall\n", "[root/]$ "},
+        {"system --mem=stack\n", "[root/]$ "},
+        
         /*** Reset ***/
         /* Success */
         {"system -r\n", "Reset System\n[root/]$ "},
@@ -258,7 +318,16 @@ TEST(cli_command_handler_callback_test, systemCommandHandlerCallback)
         
         /* Failure */
         {"system -rnow\n", "[root/]$ "},
-        {"system --reset=10\n", "[root/]$ "}
+        {"system --reset=10\n", "[root/]$ "},
+        
+        /*** Trace (Binary Dump Bypasses printf) ***/
+        /* Success */
+        {"system -t\n", "[root/]$ "},
+        {"system --trace\n", "[root/]$ "},
+        
+        /* Failure */
+        {"system -tnow\n", "[root/]$ "},
+        {"system --trace=all\n", "[root/]$ "}
     };
     size_t CommandTestDataLength = sizeof(CommandTestData) / sizeof(CommandTestData[0]);
     
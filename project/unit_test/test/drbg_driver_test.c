@@ -0,0 +1,185 @@
+/****************************************************************************************************
+ * FILE:    drbg_driver_test.c
+ * BRIEF:   Deterministic Random Bit Generator (DRBG) Driver Test Source File
+ * NOTE:    NIST CAVP CTR_DRBG Vector (AES-256, Use df, No Prediction Resistance, COUNT = 0); Reseed
+ *          Expectations From A Reference Implementation Checked Against That Vector
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "drbg_driver.h"
+#include "drbg_driver_test.h"
+#include "hw_memmap.h"
+#include <stddef.h>
+#include <stdint.h>
+#include "system.h"
+#include "unity_fixture.h"
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static const uint8_t drbgDriverTest_entropyInput[32] =
+{
+    0x36, 0x40, 0x19, 0x40, 0xFA, 0x8B, 0x1F, 0xBA, 0x91, 0xA1, 0x66, 0x1F, 0x21, 0x1D, 0x78, 0xA0,
+    0xB9, 0x38, 0x9A, 0x74, 0xE5, 0xBC, 0xCF, 0xEC, 0xE8, 0xD7, 0x66, 0xAF, 0x1A, 0x6D, 0x3B, 0x14
+};
+static const uint8_t drbgDriverTest_nonce[16] =
+{
+    0x49, 0x6F, 0x25, 0xB0, 0xF1, 0x30, 0x1B, 0x4F, 0x50, 0x1B, 0xE3, 0x03, 0x80, 0xA1, 0x37, 0xEB
+};
+static const uint8_t drbgDriverTest_returnedBits[64] =
+{
+    0x58, 0x62, 0xEB, 0x38, 0xBD, 0x55, 0x8D, 0xD9, 0x78, 0xA6, 0x96, 0xE6, 0xDF, 0x16, 0x47, 0x82,
+    0xDD, 0xD8, 0x87, 0xE7, 0xE9, 0xA6, 0xC9, 0xF3, 0xF1, 0xFB, 0xAF, 0xB7, 0x89, 0x41, 0xB5, 0x35,
+    0xA6, 0x49, 0x12, 0xDF, 0xD2, 0x24, 0xC6, 0xDC, 0x74, 0x54, 0xE5, 0x25, 0x0B, 0x3D, 0x97, 0x16,
+    0x5E, 0x16, 0x26, 0x0C, 0x2F, 0xAF, 0x1C, 0xC7, 0x73, 0x5C, 0xB7, 0x5F, 0xB4, 0xF0, 0x7E, 0x1D
+};
+static const uint8_t drbgDriverTest_reseedReturnedBits[20] = // Reseed With 0x00 To 0x1F, Generate 20 Bytes
+{
+    0xBB, 0x20, 0x66, 0x4B, 0xF5, 0x8A, 0x53, 0x2C, 0x11, 0x42, 0x81, 0xE5, 0x7F, 0x70, 0x8D, 0x79,
+    0xC6, 0x31, 0x86, 0xCE
+};
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void drbgDriverTest_instantiate(void);
+
+/****************************************************************************************************
+ * Function Definitions
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   drbgDriverTest_instantiate
+ * BRIEF:   Instantiate
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ * NOTE:    Seed Material: Entropy Input || Nonce
+ ****************************************************************************************************/
+static void drbgDriverTest_instantiate(void)
+{
+    size_t i;
+
+    /*** Instantiate ***/
+    drbgDriver_startSeed(sizeof(drbgDriverTest_entropyInput) + sizeof(drbgDriverTest_nonce));
+    for(i = 0; i < sizeof(drbgDriverTest_entropyInput); i++)
+        drbgDriver_addSeed(drbgDriverTest_entropyInput[i]);
+    for(i = 0; i < sizeof(drbgDriverTest_nonce); i++)
+        drbgDriver_addSeed(drbgDriverTest_nonce[i]);
+    TEST_ASSERT_TRUE(drbgDriver_finishSeed());
+}
+
+/****************************************************************************************************
+ * Test Group
+ ****************************************************************************************************/
+
+TEST_GROUP(drbg_driver_test);
+
+/****************************************************************************************************
+ * Test Setup And Teardown
+ ****************************************************************************************************/
+
+TEST_SETUP(drbg_driver_test)
+{
+    /*** Set Up ***/
+    /* Simulation */
+    hwMemmap_init();
+
+    /* Application */
+    system_init();
+}
+
+TEST_TEAR_DOWN(drbg_driver_test)
+{
+    /*** Tear Down ***/
+}
+
+/****************************************************************************************************
+ * Tests
+ ****************************************************************************************************/
+
+TEST(drbg_driver_test, generate)
+{
+    uint8_t buffer[sizeof(drbgDriverTest_returnedBits)];
+
+    /********************************************************************************
+     * Test 1: Not Instantiated
+     ********************************************************************************/
+
+    /*** Subtest 1: Refused ***/
+    TEST_ASSERT_EQUAL_UINT32(0, drbgDriver_getReseedCounter());
+    TEST_ASSERT_FALSE(drbgDriver_generate(buffer, sizeof(buffer)));
+
+    /********************************************************************************
+     * Test 2: NIST CAVP Vector
+     ********************************************************************************/
+
+    /*** Subtest 1: Instantiate, Generate (Discarded), Generate ***/
+    drbgDriverTest_instantiate();
+    TEST_ASSERT_EQUAL_UINT32(1, drbgDriver_getReseedCounter());
+    TEST_ASSERT_TRUE(drbgDriver_generate(buffer, sizeof(buffer)));
+    TEST_ASSERT_TRUE(drbgDriver_generate(buffer, sizeof(buffer)));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(drbgDriverTest_returnedBits, buffer, sizeof(buffer));
+    TEST_ASSERT_EQUAL_UINT32(3, drbgDriver_getReseedCounter());
+
+    /********************************************************************************
+     * Test 3: Reseed Interval
+     ********************************************************************************/
+
+    /*** Subtest 1: Last Request Allowed, Then Refused Until Reseeded ***/
+    drbgDriver_reseedCounter = DRBG_DRIVER_RESEED_INTERVAL;
+    TEST_ASSERT_TRUE(drbgDriver_generate(buffer, sizeof(buffer)));
+    TEST_ASSERT_FALSE(drbgDriver_generate(buffer, sizeof(buffer)));
+    TEST_ASSERT_EQUAL_UINT32(DRBG_DRIVER_RESEED_INTERVAL + 1, drbgDriver_getReseedCounter());
+}
+
+TEST(drbg_driver_test, seed)
+{
+    uint8_t buffer[sizeof(drbgDriverTest_returnedBits)];
+    uint8_t i;
+
+    /********************************************************************************
+     * Test 1: Length Mismatch
+     ********************************************************************************/
+
+    /*** Subtest 1: Short Seed Is Rejected, Not Instantiated ***/
+    drbgDriver_startSeed(sizeof(drbgDriverTest_entropyInput));
+    drbgDriver_addSeed(0x00);
+    TEST_ASSERT_FALSE(drbgDriver_finishSeed());
+    TEST_ASSERT_EQUAL_UINT32(0, drbgDriver_getReseedCounter());
+
+    /*** Subtest 2: Restart Discards The Seed In Progress ***/
+    drbgDriver_startSeed(sizeof(drbgDriverTest_entropyInput));
+    drbgDriver_addSeed(0xFF);
+    drbgDriverTest_instantiate();
+    TEST_ASSERT_TRUE(drbgDriver_generate(buffer, sizeof(buffer)));
+    TEST_ASSERT_TRUE(drbgDriver_generate(buffer, sizeof(buffer)));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(drbgDriverTest_returnedBits, buffer, sizeof(buffer));
+
+    /********************************************************************************
+     * Test 2: Reseed
+     ********************************************************************************/
+
+    /*** Subtest 1: Reseed Counter Restarts, Partial Block Output ***/
+    drbgDriver_startSeed(32);
+    for(i = 0; i < 32; i++)
+        drbgDriver_addSeed(i);
+    TEST_ASSERT_TRUE(drbgDriver_finishSeed());
+    TEST_ASSERT_EQUAL_UINT32(1, drbgDriver_getReseedCounter());
+    TEST_ASSERT_TRUE(drbgDriver_generate(buffer, sizeof(drbgDriverTest_reseedReturnedBits)));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(drbgDriverTest_reseedReturnedBits, buffer, sizeof(drbgDriverTest_reseedReturnedBits));
+}
+
+/****************************************************************************************************
+ * Test Group Runner
+ ****************************************************************************************************/
+
+TEST_GROUP_RUNNER(drbg_driver_test)
+{
+    RUN_TEST_CASE(drbg_driver_test, generate)
+    RUN_TEST_CASE(drbg_driver_test, seed)
+}
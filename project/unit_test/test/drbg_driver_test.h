@@ -0,0 +1,21 @@
+/****************************************************************************************************
+ * FILE:    drbg_driver_test.h
+ * BRIEF:   Deterministic Random Bit Generator (DRBG) Driver Test Header File
+ ****************************************************************************************************/
+
+#ifndef DRBG_DRIVER_TEST_H
+#define DRBG_DRIVER_TEST_H
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+extern uint32_t drbgDriver_reseedCounter;
+
+#endif
@@ -0,0 +1,297 @@
+/****************************************************************************************************
+ * FILE:    entropy_driver_test.c
+ * BRIEF:   Entropy Driver Test Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define ENTROPY_DRIVER_TEST_ACLK_PERIOD (244) // SMCLK Cycles Per ACLK Cycle (8 MHz / 32768 Hz)
+#define ENTROPY_DRIVER_TEST_NOISE_COUNT (8192)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "adc12_model.h"
+#include "driver_config.h"
+#include "entropy_driver.h"
+#include "entropy_driver_test.h"
+#include "hw_memmap.h"
+#include "msp430fr5xx_6xxgeneric.h"
+#include "msp430fr6989.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include "system.h"
+#include "unity_fixture.h"
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static uint32_t entropyDriverTest_jitter; // xorshift32 State
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void entropyDriverTest_captureAccessCallback(const uint32_t Address);
+
+/****************************************************************************************************
+ * Function Definitions
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   entropyDriverTest_enableNoise
+ * BRIEF:   Enable Noise
+ * RETURN:  Returns Nothing
+ * ARG:     Enable: Jittery Captures And A Noisy ADC Input (true) Or No Samples (false)
+ * NOTE:    Capture Control Accesses Flag An ACLK Edge And Move ADC Time On, So A Sample Is Always
+ *          Ready; Every Capture Read Is One ACLK Period Of SMCLK Cycles Later, Give Or Take A Few
+ ****************************************************************************************************/
+void entropyDriverTest_enableNoise(const bool Enable)
+{
+    adc12Model_generator_t generator = {ADC12_MODEL_WAVEFORM_NOISE, 1.65, 0.01, 0.0, 0.0, 0, 1}; // AVCC / 2, ~12 LSB Peak
+
+    /*** Enable ***/
+    if(Enable)
+    {
+        entropyDriverTest_jitter = 0x2545F491u;
+        (void)adc12Model_setGenerator(ADC12_B_INPUT_BATMAP, &generator);
+        (void)hwMemmap_registerAccessCallback(entropyDriverTest_captureAccessCallback);
+    }
+    else
+    {
+        hwMemmap_unregisterAccessCallback(entropyDriverTest_captureAccessCallback);
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   entropyDriverTest_setSample
+ * BRIEF:   Set Sample
+ * RETURN:  Returns Nothing
+ * ARG:     CaptureDelta: SMCLK Cycles Since The Previous Capture
+ * ARG:     Conversion: ADC Result
+ * NOTE:    Both Flagged Ready, As Hardware Would
+ ****************************************************************************************************/
+void entropyDriverTest_setSample(const uint16_t CaptureDelta, const uint16_t Conversion)
+{
+    /*** Capture ***/
+    HW_MEMMAP_REG16(DRIVER_CONFIG_ENTROPY_TIMER + OFS_TAxCCR2) += CaptureDelta;
+    HW_MEMMAP_REG16(DRIVER_CONFIG_ENTROPY_TIMER + OFS_TAxCCTL2) |= CCIFG;
+
+    /*** Conversion ***/
+    HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12MEM0) = Conversion;
+    HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12IFGR0) |= ADC12IFG0;
+}
+
+/****************************************************************************************************
+ * FUNCT:   entropyDriverTest_captureAccessCallback
+ * BRIEF:   Capture Access Callback
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Accessed Address
+ ****************************************************************************************************/
+static void entropyDriverTest_captureAccessCallback(const uint32_t Address)
+{
+    /*** Capture Control: Edge Captured, Conversion Done (Both Always Ready) ***/
+    if(Address == (DRIVER_CONFIG_ENTROPY_TIMER + OFS_TAxCCTL2))
+    {
+        HW_MEMMAP_REG16(DRIVER_CONFIG_ENTROPY_TIMER + OFS_TAxCCTL2) |= CCIFG;
+        adc12Model_advance(30); // About One ACLK Period
+    }
+
+    /*** Capture: ACLK Period Plus -4 To +3 Cycles Of Jitter ***/
+    else if(Address == (DRIVER_CONFIG_ENTROPY_TIMER + OFS_TAxCCR2))
+    {
+        entropyDriverTest_jitter ^= entropyDriverTest_jitter << 13;
+        entropyDriverTest_jitter ^= entropyDriverTest_jitter >> 17;
+        entropyDriverTest_jitter ^= entropyDriverTest_jitter << 5;
+        HW_MEMMAP_REG16(DRIVER_CONFIG_ENTROPY_TIMER + OFS_TAxCCR2) += (uint16_t)(ENTROPY_DRIVER_TEST_ACLK_PERIOD - 4 + (entropyDriverTest_jitter & 0x07));
+    }
+}
+
+/****************************************************************************************************
+ * Test Group
+ ****************************************************************************************************/
+
+TEST_GROUP(entropy_driver_test);
+
+/****************************************************************************************************
+ * Test Setup And Teardown
+ ****************************************************************************************************/
+
+TEST_SETUP(entropy_driver_test)
+{
+    /*** Set Up ***/
+    /* Simulation */
+    hwMemmap_init();
+
+    /* Application */
+    system_init();
+}
+
+TEST_TEAR_DOWN(entropy_driver_test)
+{
+    /*** Tear Down ***/
+    entropyDriverTest_enableNoise(false);
+}
+
+/****************************************************************************************************
+ * Tests
+ ****************************************************************************************************/
+
+TEST(entropy_driver_test, getSample)
+{
+    entropyDriver_statistics_t statistics;
+    uint16_t i;
+    uint8_t sample;
+
+    /********************************************************************************
+     * Test 1: Not Ready
+     ********************************************************************************/
+
+    /*** Subtest 1: No Capture, No Conversion ***/
+    TEST_ASSERT_EQUAL(ENTROPY_DRIVER_RESULT_NONE, entropyDriver_getSample(&sample));
+
+    /*** Subtest 2: Capture Only ***/
+    HW_MEMMAP_REG16(DRIVER_CONFIG_ENTROPY_TIMER + OFS_TAxCCTL2) |= CCIFG;
+    TEST_ASSERT_EQUAL(ENTROPY_DRIVER_RESULT_NONE, entropyDriver_getSample(&sample));
+    HW_MEMMAP_REG16(DRIVER_CONFIG_ENTROPY_TIMER + OFS_TAxCCTL2) &= (uint16_t)~CCIFG;
+
+    /********************************************************************************
+     * Test 2: Startup
+     ********************************************************************************/
+
+    /*** Subtest 1: Tested, Not Used ***/
+    for(i = 0; i < ENTROPY_DRIVER_STARTUP_COUNT; i++)
+    {
+        entropyDriverTest_setSample((uint16_t)(ENTROPY_DRIVER_TEST_ACLK_PERIOD + (i % 3)), (uint16_t)(2048 + (i % 5)));
+        TEST_ASSERT_EQUAL(ENTROPY_DRIVER_RESULT_NONE, entropyDriver_getSample(&sample));
+    }
+
+    /*** Subtest 2: Sample Layout (Capture Delta Bits 3:0, Conversion Bits 3:0) ***/
+    entropyDriverTest_setSample(0x0123, 0x0ABC);
+    TEST_ASSERT_EQUAL(ENTROPY_DRIVER_RESULT_SAMPLE, entropyDriver_getSample(&sample));
+    TEST_ASSERT_EQUAL_HEX8(0x3C, sample);
+
+    /*** Subtest 3: Flags Cleared, Next Conversion Started ***/
+    TEST_ASSERT_EQUAL_HEX16(0, HW_MEMMAP_REG16(DRIVER_CONFIG_ENTROPY_TIMER + OFS_TAxCCTL2) & CCIFG);
+    TEST_ASSERT_EQUAL_HEX16(0, HW_MEMMAP_REG16(ADC12_B_BASE + OFS_ADC12IFGR0) & ADC12IFG0);
+    TEST_ASSERT_EQUAL(ENTROPY_DRIVER_RESULT_NONE, entropyDriver_getSample(&sample));
+    entropyDriver_getStatistics(&statistics);
+    TEST_ASSERT_EQUAL_UINT32(ENTROPY_DRIVER_STARTUP_COUNT + 1, statistics.sampleCount);
+    TEST_ASSERT_EQUAL_UINT16(0, statistics.repetitionFailureCount);
+    TEST_ASSERT_EQUAL_UINT16(0, statistics.proportionFailureCount);
+}
+
+TEST(entropy_driver_test, noise)
+{
+    entropyDriver_statistics_t statistics;
+    uint16_t counts[16], i, samples;
+    uint8_t sample;
+
+    /********************************************************************************
+     * Test 1: Jittery Captures, Noisy ADC
+     ********************************************************************************/
+
+    /*** Subtest 1: Samples After Startup, No Health Test Failures ***/
+    entropyDriverTest_enableNoise(true);
+    for(i = 0; i < 16; i++)
+        counts[i] = 0;
+    samples = 0;
+    for(i = 0; i < ENTROPY_DRIVER_TEST_NOISE_COUNT; i++)
+    {
+        if(entropyDriver_getSample(&sample) == ENTROPY_DRIVER_RESULT_SAMPLE)
+        {
+            counts[sample >> 4]++;
+            samples++;
+        }
+    }
+    entropyDriver_getStatistics(&statistics);
+    TEST_ASSERT_EQUAL_UINT16(0, statistics.repetitionFailureCount);
+    TEST_ASSERT_EQUAL_UINT16(0, statistics.proportionFailureCount);
+    TEST_ASSERT_EQUAL_UINT32(ENTROPY_DRIVER_TEST_NOISE_COUNT, statistics.sampleCount);
+    TEST_ASSERT_EQUAL_UINT16(ENTROPY_DRIVER_TEST_NOISE_COUNT - ENTROPY_DRIVER_STARTUP_COUNT, samples);
+
+    /*** Subtest 2: Jitter Spreads Over Eight Capture Nibbles ***/
+    for(i = 0; i < 16; i++)
+    {
+        if(((i - ((ENTROPY_DRIVER_TEST_ACLK_PERIOD - 4) & 0x0F)) & 0x0F) < 8)
+            TEST_ASSERT_NOT_EQUAL(0, counts[i]);
+        else
+            TEST_ASSERT_EQUAL_UINT16(0, counts[i]);
+    }
+}
+
+TEST(entropy_driver_test, proportion)
+{
+    entropyDriver_statistics_t statistics;
+    entropyDriver_result_t result;
+    uint16_t i;
+    uint8_t sample;
+
+    /********************************************************************************
+     * Test 1: Adaptive Proportion
+     ********************************************************************************/
+
+    /*** Subtest 1: 0x41 19 Samples Out Of 20 (Runs Under The Repetition Cutoff) ***/
+    entropyDriver_startupCount = 0;
+    result = ENTROPY_DRIVER_RESULT_SAMPLE;
+    for(i = 0; (i < 512) && (result == ENTROPY_DRIVER_RESULT_SAMPLE); i++)
+    {
+        if((i % 20) == 19)
+            entropyDriverTest_setSample(5, 2);
+        else
+            entropyDriverTest_setSample(4, 1);
+        result = entropyDriver_getSample(&sample);
+    }
+
+    /*** Subtest 2: Failure Within The Window, On The 410th Occurrence (Sample 431) ***/
+    TEST_ASSERT_EQUAL(ENTROPY_DRIVER_RESULT_FAILURE, result);
+    TEST_ASSERT_EQUAL_UINT16(431, i);
+    entropyDriver_getStatistics(&statistics);
+    TEST_ASSERT_EQUAL_UINT16(1, statistics.proportionFailureCount);
+    TEST_ASSERT_EQUAL_UINT16(0, statistics.repetitionFailureCount);
+
+    /*** Subtest 3: Startup Restarts ***/
+    entropyDriverTest_setSample(3, 7);
+    TEST_ASSERT_EQUAL(ENTROPY_DRIVER_RESULT_NONE, entropyDriver_getSample(&sample));
+    TEST_ASSERT_EQUAL_UINT16(ENTROPY_DRIVER_STARTUP_COUNT - 1, entropyDriver_startupCount);
+}
+
+TEST(entropy_driver_test, repetition)
+{
+    entropyDriver_statistics_t statistics;
+    uint8_t i, sample;
+
+    /********************************************************************************
+     * Test 1: Repetition Count
+     ********************************************************************************/
+
+    /*** Subtest 1: Stuck Source Fails On The Cutoff Sample ***/
+    entropyDriver_startupCount = 0;
+    for(i = 1; i < 21; i++)
+    {
+        entropyDriverTest_setSample(ENTROPY_DRIVER_TEST_ACLK_PERIOD, 2048);
+        TEST_ASSERT_EQUAL(ENTROPY_DRIVER_RESULT_SAMPLE, entropyDriver_getSample(&sample));
+    }
+    entropyDriverTest_setSample(ENTROPY_DRIVER_TEST_ACLK_PERIOD, 2048);
+    TEST_ASSERT_EQUAL(ENTROPY_DRIVER_RESULT_FAILURE, entropyDriver_getSample(&sample));
+    entropyDriver_getStatistics(&statistics);
+    TEST_ASSERT_EQUAL_UINT16(1, statistics.repetitionFailureCount);
+    TEST_ASSERT_EQUAL_UINT16(0, statistics.proportionFailureCount);
+    TEST_ASSERT_EQUAL_UINT16(ENTROPY_DRIVER_STARTUP_COUNT, entropyDriver_startupCount);
+}
+
+/****************************************************************************************************
+ * Test Group Runner
+ ****************************************************************************************************/
+
+TEST_GROUP_RUNNER(entropy_driver_test)
+{
+    RUN_TEST_CASE(entropy_driver_test, getSample)
+    RUN_TEST_CASE(entropy_driver_test, noise)
+    RUN_TEST_CASE(entropy_driver_test, proportion)
+    RUN_TEST_CASE(entropy_driver_test, repetition)
+}
@@ -0,0 +1,29 @@
+/****************************************************************************************************
+ * FILE:    entropy_driver_test.h
+ * BRIEF:   Entropy Driver Test Header File
+ ****************************************************************************************************/
+
+#ifndef ENTROPY_DRIVER_TEST_H
+#define ENTROPY_DRIVER_TEST_H
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+extern uint16_t entropyDriver_startupCount;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern void entropyDriverTest_enableNoise(const bool Enable);
+extern void entropyDriverTest_setSample(const uint16_t CaptureDelta, const uint16_t Conversion);
+
+#endif
@@ -0,0 +1,231 @@
+/****************************************************************************************************
+ * FILE:    init_driver_test.c
+ * BRIEF:   Init Driver Test Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define INIT_DRIVER_TEST_FILL_COUNT         (16) // Random Fills Per Script, After 0x00 And 0xFF
+#define INIT_DRIVER_TEST_PERIPHERAL_LENGTH  (INIT_GENERATOR_PERIPHERAL_END - INIT_GENERATOR_PERIPHERAL_START)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "hw_memmap.h"
+#include "init_driver.h"
+#include "init_driver_table.h"
+#include "init_generator.h"
+#include <stdint.h>
+#include <string.h>
+#include "unity_fixture.h"
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef struct initDriverTest_table_s
+{
+    const initDriver_entry_t *entries;
+    uint16_t length;
+} initDriverTest_table_t;
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static uint8_t initDriverTest_fill[INIT_DRIVER_TEST_PERIPHERAL_LENGTH];
+static const initDriverTest_table_t initDriverTest_table[INIT_GENERATOR_SCRIPT_COUNT] = // initGenerator_script Order
+{
+    {initDriverTable_button, INIT_DRIVER_TABLE_BUTTON_LENGTH},
+    {initDriverTable_cli,    INIT_DRIVER_TABLE_CLI_LENGTH},
+    {initDriverTable_lcd,    INIT_DRIVER_TABLE_LCD_LENGTH},
+    {initDriverTable_led,    INIT_DRIVER_TABLE_LED_LENGTH},
+    {initDriverTable_lfxt,   INIT_DRIVER_TABLE_LFXT_LENGTH}
+};
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void initDriverTest_load(void);
+
+/****************************************************************************************************
+ * Function Definitions
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   initDriverTest_load
+ * BRIEF:   Load
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ * NOTE:    Resets The Simulator, Then Copies initDriverTest_fill Into Peripheral Space
+ ****************************************************************************************************/
+static void initDriverTest_load(void)
+{
+    /*** Load ***/
+    hwMemmap_init();
+    (void)memcpy(&hwMemmap_memory[INIT_GENERATOR_PERIPHERAL_START], initDriverTest_fill, sizeof(initDriverTest_fill));
+}
+
+/****************************************************************************************************
+ * Test Group
+ ****************************************************************************************************/
+
+TEST_GROUP(init_driver_test);
+
+/****************************************************************************************************
+ * Test Setup And Teardown
+ ****************************************************************************************************/
+
+TEST_SETUP(init_driver_test)
+{
+    /*** Set Up ***/
+    /* Simulation */
+    hwMemmap_init();
+}
+
+TEST_TEAR_DOWN(init_driver_test)
+{
+    /*** Tear Down ***/
+}
+
+/****************************************************************************************************
+ * Tests
+ ****************************************************************************************************/
+
+TEST(init_driver_test, apply)
+{
+    const initDriver_entry_t table[] =
+    {
+        {0x0204, 0xFF0F, 0x00A0},
+        {0x0206, 0x0000, 0x1234},
+        {0x0204, 0xFFFC, 0x0001}
+    };
+
+    /********************************************************************************
+     * Test 1: Entries
+     ********************************************************************************/
+
+    /*** Subtest 1: Read-Modify-Write Keeps The AND Mask Bits ***/
+    HW_MEMMAP_REG16(0x0204) = 0x5A5A;
+    HW_MEMMAP_REG16(0x0206) = 0xFFFF;
+    initDriver_apply(table, 1);
+    TEST_ASSERT_EQUAL_HEX16(0x5AAA, HW_MEMMAP_REG16(0x0204));
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, HW_MEMMAP_REG16(0x0206));
+
+    /*** Subtest 2: AND Mask 0 Is A Plain Store ***/
+    initDriver_apply(&table[1], 1);
+    TEST_ASSERT_EQUAL_HEX16(0x1234, HW_MEMMAP_REG16(0x0206));
+
+    /*** Subtest 3: In Order ***/
+    HW_MEMMAP_REG16(0x0204) = 0x5A5A;
+    initDriver_apply(table, 3);
+    TEST_ASSERT_EQUAL_HEX16(0x5AA9, HW_MEMMAP_REG16(0x0204));
+
+    /********************************************************************************
+     * Test 2: Empty
+     ********************************************************************************/
+
+    /*** Subtest 1: Nothing Written ***/
+    HW_MEMMAP_REG16(0x0204) = 0x5A5A;
+    initDriver_apply(table, 0);
+    TEST_ASSERT_EQUAL_HEX16(0x5A5A, HW_MEMMAP_REG16(0x0204));
+}
+
+TEST(init_driver_test, equivalence)
+{
+    static uint8_t expected[INIT_DRIVER_TEST_PERIPHERAL_LENGTH];
+    uint16_t fill, i, script;
+    uint32_t state;
+
+    /********************************************************************************
+     * Test 1: driverlib Path And Table Leave Peripheral Space Bit For Bit Equal
+     ********************************************************************************/
+
+    /*** Subtest 1: Every Script, From 0x00, 0xFF And Random Register Contents ***/
+    for(script = 0; script < INIT_GENERATOR_SCRIPT_COUNT; script++)
+    {
+        state = 0x9E3779B9u;
+        for(fill = 0; fill < (INIT_DRIVER_TEST_FILL_COUNT + 2); fill++)
+        {
+            /* Register Contents */
+            for(i = 0; i < INIT_DRIVER_TEST_PERIPHERAL_LENGTH; i++)
+            {
+                if(fill < 2)
+                {
+                    initDriverTest_fill[i] = (fill == 0) ? 0x00 : 0xFF;
+                }
+                else
+                {
+                    state ^= state << 13;
+                    state ^= state >> 17;
+                    state ^= state << 5;
+                    initDriverTest_fill[i] = (uint8_t)state;
+                }
+            }
+
+            /* driverlib */
+            initDriverTest_load();
+            initGenerator_script[script].configure();
+            hwMemmap_update();
+            (void)memcpy(expected, &hwMemmap_memory[INIT_GENERATOR_PERIPHERAL_START], sizeof(expected));
+
+            /* Table */
+            initDriverTest_load();
+            initDriver_apply(initDriverTest_table[script].entries, initDriverTest_table[script].length);
+            hwMemmap_update();
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, &hwMemmap_memory[INIT_GENERATOR_PERIPHERAL_START], INIT_DRIVER_TEST_PERIPHERAL_LENGTH);
+        }
+    }
+}
+
+TEST(init_driver_test, generate)
+{
+    static initDriver_entry_t table[INIT_GENERATOR_ENTRY_MAXIMUM];
+    uint16_t i, length, script;
+
+    /********************************************************************************
+     * Test 1: Committed Tables Match The driverlib Path ("make init_table" If Not)
+     ********************************************************************************/
+
+    /*** Subtest 1: Every Script ***/
+    for(script = 0; script < INIT_GENERATOR_SCRIPT_COUNT; script++)
+    {
+        TEST_ASSERT_TRUE(initGenerator_generate(&initGenerator_script[script], table, &length));
+        TEST_ASSERT_EQUAL_UINT16(initDriverTest_table[script].length, length);
+        for(i = 0; i < length; i++)
+        {
+            TEST_ASSERT_EQUAL_HEX16(initDriverTest_table[script].entries[i].address, table[i].address);
+            TEST_ASSERT_EQUAL_HEX16(initDriverTest_table[script].entries[i].andMask, table[i].andMask);
+            TEST_ASSERT_EQUAL_HEX16(initDriverTest_table[script].entries[i].orValue, table[i].orValue);
+        }
+    }
+
+    /********************************************************************************
+     * Test 2: Entries
+     ********************************************************************************/
+
+    /*** Subtest 1: Word Aligned, OR Value Within ~AND Mask ***/
+    for(script = 0; script < INIT_GENERATOR_SCRIPT_COUNT; script++)
+    {
+        for(i = 0; i < initDriverTest_table[script].length; i++)
+        {
+            TEST_ASSERT_EQUAL_HEX16(0, initDriverTest_table[script].entries[i].address & 0x0001);
+            TEST_ASSERT_EQUAL_HEX16(0, initDriverTest_table[script].entries[i].orValue & initDriverTest_table[script].entries[i].andMask);
+        }
+    }
+}
+
+/****************************************************************************************************
+ * Test Group Runner
+ ****************************************************************************************************/
+
+TEST_GROUP_RUNNER(init_driver_test)
+{
+    RUN_TEST_CASE(init_driver_test, apply)
+    RUN_TEST_CASE(init_driver_test, equivalence)
+    RUN_TEST_CASE(init_driver_test, generate)
+}
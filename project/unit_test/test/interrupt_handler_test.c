@@ -0,0 +1,502 @@
+/****************************************************************************************************
+ * FILE:    interrupt_handler_test.c
+ * BRIEF:   Interrupt Handler Test Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "button_driver.h"
+#include "button_driver_test.h"
+#include "cli_callback.h"
+#include "cli_callback_test.h"
+#include "driver_config.h"
+#include "gpio.h"
+#include "gpio_model.h"
+#include "hw_memmap.h"
+#include "interrupt_handler.h"
+#include "interrupt_handler_test.h"
+#include "intrinsics.h"
+#include "led_driver.h"
+#include "led_driver_test.h"
+#include "random_callback.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "system.h"
+#include "unity_fixture.h"
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static bool interruptHandlerTest_fuzzerButtonPressed[2];
+static uint32_t interruptHandlerTest_fuzzerInjectionCount[INTERRUPT_HANDLER_TEST_VECTOR_COUNT];
+static uint16_t interruptHandlerTest_fuzzerProbability;
+static char interruptHandlerTest_fuzzerReceive[INTERRUPT_HANDLER_TEST_FUZZER_RECEIVE_LENGTH];
+static size_t interruptHandlerTest_fuzzerReceiveHead, interruptHandlerTest_fuzzerReceiveTail;
+static uint32_t interruptHandlerTest_fuzzerSeed, interruptHandlerTest_fuzzerState;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void interruptHandlerTest_fuzzerAccessCallback(const uint32_t Address);
+static uint32_t interruptHandlerTest_getFuzzerRandom(void);
+static void interruptHandlerTest_injectPort1Vector(void);
+static void interruptHandlerTest_injectTimer0A1Vector(void);
+static void interruptHandlerTest_injectUsciA1Vector(void);
+
+/****************************************************************************************************
+ * Function Definitions
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   interruptHandlerTest_getFuzzerInjectionCount
+ * BRIEF:   Get Fuzzer Injection Count
+ * RETURN:  uint32_t: Number Of Interrupts Injected Since The Fuzzer Was Started
+ * ARG:     Vector: Vector
+ ****************************************************************************************************/
+uint32_t interruptHandlerTest_getFuzzerInjectionCount(const interruptHandlerTest_vector_t Vector)
+{
+    /*** Get Fuzzer Injection Count ***/
+    if(Vector >= INTERRUPT_HANDLER_TEST_VECTOR_COUNT)
+        return 0;
+    return interruptHandlerTest_fuzzerInjectionCount[Vector];
+}
+
+/****************************************************************************************************
+ * FUNCT:   interruptHandlerTest_getFuzzerButtonPressed
+ * BRIEF:   Get Fuzzer Button Pressed
+ * RETURN:  bool: Simulated Button Pressed (true) Or Released (false)
+ * ARG:     Button: Button (BUTTON_DRIVER_BUTTON_1 Or BUTTON_DRIVER_BUTTON_2)
+ ****************************************************************************************************/
+bool interruptHandlerTest_getFuzzerButtonPressed(const uint8_t Button)
+{
+    /*** Get Fuzzer Button Pressed ***/
+    return (Button == BUTTON_DRIVER_BUTTON_2) ? interruptHandlerTest_fuzzerButtonPressed[1] : interruptHandlerTest_fuzzerButtonPressed[0];
+}
+
+/****************************************************************************************************
+ * FUNCT:   interruptHandlerTest_getFuzzerSeed
+ * BRIEF:   Get Fuzzer Seed
+ * RETURN:  uint32_t: Seed; Set INTERRUPT_HANDLER_TEST_SEED To This Value To Replay A Run Exactly
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+uint32_t interruptHandlerTest_getFuzzerSeed(void)
+{
+    /*** Get Fuzzer Seed ***/
+    return interruptHandlerTest_fuzzerSeed;
+}
+
+/****************************************************************************************************
+ * FUNCT:   interruptHandlerTest_queueFuzzerReceiveCharacters
+ * BRIEF:   Queue Fuzzer Receive Characters
+ * RETURN:  bool: Success (true) Or Failure (false) Because Queue Is Full
+ * ARG:     Characters: Characters Delivered One Per Injected USCI A1 Receive Interrupt
+ ****************************************************************************************************/
+bool interruptHandlerTest_queueFuzzerReceiveCharacters(const char * const Characters)
+{
+    size_t i, next;
+
+    /*** Queue Fuzzer Receive Characters ***/
+    for(i = 0; i < strlen(Characters); i++)
+    {
+        next = (interruptHandlerTest_fuzzerReceiveHead + 1) % INTERRUPT_HANDLER_TEST_FUZZER_RECEIVE_LENGTH;
+        if(next == interruptHandlerTest_fuzzerReceiveTail)
+            return false;
+        interruptHandlerTest_fuzzerReceive[interruptHandlerTest_fuzzerReceiveHead] = Characters[i];
+        interruptHandlerTest_fuzzerReceiveHead = next;
+    }
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   interruptHandlerTest_startFuzzer
+ * BRIEF:   Start Fuzzer
+ * RETURN:  Returns Nothing
+ * ARG:     Probability: Probability (Out Of 65536) That An Interrupt Is Injected At A Yield Point
+ * NOTE:    Every HWREGx Access Is A Yield Point; The Seed Comes From INTERRUPT_HANDLER_TEST_SEED,
+ *          If Set (Exploration), Otherwise From INTERRUPT_HANDLER_TEST_FUZZER_SEED_DEFAULT Mixed With
+ *          The Start Count, So Default Runs Are Repeatable; The Sequence Of Injections Depends Only On
+ *          The Seed
+ ****************************************************************************************************/
+void interruptHandlerTest_startFuzzer(const uint16_t Probability)
+{
+    static uint32_t runCount = 0;
+    const char *seed;
+    uint16_t baseAddress;
+
+    /*** Seed ***/
+    seed = getenv(INTERRUPT_HANDLER_TEST_FUZZER_SEED_VARIABLE);
+    if(seed != NULL)
+        interruptHandlerTest_fuzzerSeed = (uint32_t)strtoul(seed, NULL, 0);
+    else
+        interruptHandlerTest_fuzzerSeed = INTERRUPT_HANDLER_TEST_FUZZER_SEED_DEFAULT ^ (++runCount * 0x9E3779B9u);
+    interruptHandlerTest_fuzzerState = (interruptHandlerTest_fuzzerSeed != 0) ? interruptHandlerTest_fuzzerSeed : 0x9E3779B9u;
+
+    /*** Reset Simulated Stimulus ***/
+    interruptHandlerTest_fuzzerButtonPressed[0] = false;
+    interruptHandlerTest_fuzzerButtonPressed[1] = false;
+    (void)memset(interruptHandlerTest_fuzzerInjectionCount, 0, sizeof(interruptHandlerTest_fuzzerInjectionCount));
+    interruptHandlerTest_fuzzerProbability = Probability;
+    interruptHandlerTest_fuzzerReceiveHead = 0;
+    interruptHandlerTest_fuzzerReceiveTail = 0;
+
+    /* Buttons Released (Active Low), Port 1 Flags Dispatched By The GPIO Model */
+    baseAddress = GPIO_PORT_TO_BASE[DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT];
+    HW_MEMMAP_REG8(baseAddress + OFS_PAIN) |= (uint8_t)(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PIN | DRIVER_CONFIG_BUTTON_GPIO_BUTTON_2_PIN);
+    (void)gpioModel_setVectorHandler(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT, interruptHandler_port1Vector);
+
+    /*** Start Fuzzer ***/
+    (void)hwMemmap_registerAccessCallback(interruptHandlerTest_fuzzerAccessCallback);
+}
+
+/****************************************************************************************************
+ * FUNCT:   interruptHandlerTest_stopFuzzer
+ * BRIEF:   Stop Fuzzer
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ ****************************************************************************************************/
+void interruptHandlerTest_stopFuzzer(void)
+{
+    /*** Stop Fuzzer ***/
+    hwMemmap_unregisterAccessCallback(interruptHandlerTest_fuzzerAccessCallback);
+    (void)gpioModel_setVectorHandler(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT, NULL);
+}
+
+/****************************************************************************************************
+ * FUNCT:   interruptHandlerTest_fuzzerAccessCallback
+ * BRIEF:   Fuzzer Access Callback
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Accessed Address (Unused)
+ ****************************************************************************************************/
+static void interruptHandlerTest_fuzzerAccessCallback(const uint32_t Address)
+{
+    (void)Address;
+
+    /*** Interrupts Are Only Taken When Enabled (Cleared While An Interrupt Handler Runs) ***/
+    if(!intrinsics_getInterruptsEnabled())
+        return;
+
+    /*** Inject Interrupt At Random Yield Points ***/
+    if((interruptHandlerTest_getFuzzerRandom() & 0xFFFF) >= interruptHandlerTest_fuzzerProbability)
+        return;
+    switch((interruptHandlerTest_vector_t)(interruptHandlerTest_getFuzzerRandom() % INTERRUPT_HANDLER_TEST_VECTOR_COUNT))
+    {
+        case INTERRUPT_HANDLER_TEST_VECTOR_PORT1:
+            interruptHandlerTest_injectPort1Vector();
+            break;
+        case INTERRUPT_HANDLER_TEST_VECTOR_TIMER0_A1:
+            interruptHandlerTest_injectTimer0A1Vector();
+            break;
+        case INTERRUPT_HANDLER_TEST_VECTOR_USCI_A1:
+            interruptHandlerTest_injectUsciA1Vector();
+            break;
+        case INTERRUPT_HANDLER_TEST_VECTOR_COUNT:
+        default:
+            /* Do Nothing */
+            break;
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   interruptHandlerTest_getFuzzerRandom
+ * BRIEF:   Get Fuzzer Random
+ * RETURN:  uint32_t: Next Value Of Seeded xorshift32 Sequence
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+static uint32_t interruptHandlerTest_getFuzzerRandom(void)
+{
+    /*** Get Fuzzer Random ***/
+    interruptHandlerTest_fuzzerState ^= interruptHandlerTest_fuzzerState << 13;
+    interruptHandlerTest_fuzzerState ^= interruptHandlerTest_fuzzerState >> 17;
+    interruptHandlerTest_fuzzerState ^= interruptHandlerTest_fuzzerState << 5;
+    return interruptHandlerTest_fuzzerState;
+}
+
+/****************************************************************************************************
+ * FUNCT:   interruptHandlerTest_injectPort1Vector
+ * BRIEF:   Inject Port 1 Vector
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ * NOTE:    Toggles A Simulated Button Through The GPIO Model: An Edge Matching PxIES Sets PxIFG, Which
+ *          Is Taken While PxIE Is Set, Like The Hardware; A Flag Left Pending (Postponed While The LED
+ *          Timer Handler Is Nested) Is Taken When That Handler Returns
+ ****************************************************************************************************/
+static void interruptHandlerTest_injectPort1Vector(void)
+{
+    uint8_t button, pin;
+    uint16_t baseAddress;
+
+    /*** Toggle Simulated Button (Active Low) ***/
+    button = (uint8_t)(interruptHandlerTest_getFuzzerRandom() & 1);
+    pin = (button == 0) ? (uint8_t)DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PIN : (uint8_t)DRIVER_CONFIG_BUTTON_GPIO_BUTTON_2_PIN;
+    baseAddress = GPIO_PORT_TO_BASE[DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT];
+    interruptHandlerTest_fuzzerButtonPressed[button] = !interruptHandlerTest_fuzzerButtonPressed[button];
+
+    /*** Inject ***/
+    if(((HW_MEMMAP_REG8(baseAddress + OFS_PAIES) & pin) == pin) == interruptHandlerTest_fuzzerButtonPressed[button])
+        interruptHandlerTest_fuzzerInjectionCount[INTERRUPT_HANDLER_TEST_VECTOR_PORT1]++;
+    gpioModel_setPins(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT, pin, !interruptHandlerTest_fuzzerButtonPressed[button]);
+}
+
+/****************************************************************************************************
+ * FUNCT:   interruptHandlerTest_injectTimer0A1Vector
+ * BRIEF:   Inject Timer A0, Capture/Compare Register 1-4 Vector
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ * NOTE:    The Interrupt Is Only Taken If The Capture/Compare Interrupt Is Enabled (CCIE)
+ ****************************************************************************************************/
+static void interruptHandlerTest_injectTimer0A1Vector(void)
+{
+    uint16_t captureCompareControlOffset, interruptFlag;
+
+    /*** Select Capture/Compare Register ***/
+    if((interruptHandlerTest_getFuzzerRandom() & 1) == 0)
+    {
+        captureCompareControlOffset = OFS_TAxCCTL1;
+        interruptFlag = TA0IV_TACCR1;
+    }
+    else
+    {
+        captureCompareControlOffset = OFS_TAxCCTL2;
+        interruptFlag = TA0IV_TACCR2;
+    }
+
+    /*** Inject ***/
+    if((HW_MEMMAP_REG16(DRIVER_CONFIG_LED_TIMER + captureCompareControlOffset) & CCIE) == CCIE)
+    {
+        HW_MEMMAP_REG16(DRIVER_CONFIG_LED_TIMER + OFS_TAxIV) = interruptFlag;
+        if(intrinsics_callInterruptHandler(interruptHandler_timer0A1Vector))
+            interruptHandlerTest_fuzzerInjectionCount[INTERRUPT_HANDLER_TEST_VECTOR_TIMER0_A1]++;
+        HW_MEMMAP_REG16(DRIVER_CONFIG_LED_TIMER + OFS_TAxIV) = TA0IV_NONE;
+        gpioModel_service(); // Postponed Port 1 Flags, Unmasked On Exit
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   interruptHandlerTest_injectUsciA1Vector
+ * BRIEF:   Inject Universal Serial Communications Interface (USCI) A1 Vector
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ * NOTE:    Delivers The Next Queued Receive Character, If Any, If The Receive Interrupt Is Enabled
+ ****************************************************************************************************/
+static void interruptHandlerTest_injectUsciA1Vector(void)
+{
+    /*** Error Check ***/
+    if(interruptHandlerTest_fuzzerReceiveHead == interruptHandlerTest_fuzzerReceiveTail)
+        return;
+    if((HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxIE) & UCRXIE) != UCRXIE)
+        return;
+
+    /*** Inject ***/
+    HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxRXBUF) = (uint8_t)interruptHandlerTest_fuzzerReceive[interruptHandlerTest_fuzzerReceiveTail];
+    HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxIV) = USCI_UART_UCRXIFG;
+    if(intrinsics_callInterruptHandler(interruptHandler_usciA1Vector))
+    {
+        interruptHandlerTest_fuzzerReceiveTail = (interruptHandlerTest_fuzzerReceiveTail + 1) % INTERRUPT_HANDLER_TEST_FUZZER_RECEIVE_LENGTH;
+        interruptHandlerTest_fuzzerInjectionCount[INTERRUPT_HANDLER_TEST_VECTOR_USCI_A1]++;
+    }
+    HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxIV) = USCI_NONE;
+}
+
+/****************************************************************************************************
+ * Test Group
+ ****************************************************************************************************/
+
+TEST_GROUP(interrupt_handler_test);
+
+/****************************************************************************************************
+ * Test Setup And Teardown
+ ****************************************************************************************************/
+
+TEST_SETUP(interrupt_handler_test)
+{
+    /*** Set Up ***/
+    /* Simulation */
+    hwMemmap_init();
+
+    /* Application */
+    system_init();
+
+    /* Test */
+    cliCallbackTest_init();
+}
+
+TEST_TEAR_DOWN(interrupt_handler_test)
+{
+    /*** Tear Down ***/
+    interruptHandlerTest_stopFuzzer();
+}
+
+/****************************************************************************************************
+ * Tests
+ ****************************************************************************************************/
+
+TEST(interrupt_handler_test, port1Vector)
+{
+    /********************************************************************************
+     * Test 1: Button 1 Interrupt Dispatched To Button Driver
+     ********************************************************************************/
+
+    /* Interrupt */
+    P1IV = P1IV_P1IFG1;
+    TEST_ASSERT_TRUE(intrinsics_callInterruptHandler(interruptHandler_port1Vector));
+
+    /* Button State Changed */
+    TEST_ASSERT_EQUAL_HEX8(BUTTON_DRIVER_BUTTON_1, buttonDriver_state);
+
+    /********************************************************************************
+     * Test 2: Interrupts Disabled
+     ********************************************************************************/
+
+    /* Interrupt */
+    __disable_interrupt();
+    P1IV = P1IV_P1IFG2;
+    TEST_ASSERT_FALSE(intrinsics_callInterruptHandler(interruptHandler_port1Vector));
+
+    /* Button State Not Changed */
+    TEST_ASSERT_EQUAL_HEX8(BUTTON_DRIVER_BUTTON_1, buttonDriver_state);
+}
+
+TEST(interrupt_handler_test, timer0A1Vector)
+{
+    uint16_t baseAddress;
+
+    /********************************************************************************
+     * Test 1: Capture/Compare Register 1 Interrupt Dispatched To LED Driver
+     ********************************************************************************/
+
+    /* Set Up */
+    baseAddress = GPIO_PORT_TO_BASE[DRIVER_CONFIG_LED_GPIO_LED_1_PORT];
+    TEST_ASSERT_TRUE(ledDriver_enableBlink(LED_DRIVER_LED_1, 500, 250));
+    TEST_ASSERT_EQUAL_HEX16(DRIVER_CONFIG_LED_GPIO_LED_1_PIN, HWREG16(baseAddress + OFS_PAOUT) & DRIVER_CONFIG_LED_GPIO_LED_1_PIN); // On
+
+    /* Interrupt */
+    TA0IV = TA0IV_TACCR1;
+    TEST_ASSERT_TRUE(intrinsics_callInterruptHandler(interruptHandler_timer0A1Vector));
+
+    /* LED Toggled */
+    TEST_ASSERT_FALSE(ledDriver_ledBlink[LED_DRIVER_LED_1].on);
+    TEST_ASSERT_EQUAL_HEX16(0, HWREG16(baseAddress + OFS_PAOUT) & DRIVER_CONFIG_LED_GPIO_LED_1_PIN); // Off
+}
+
+TEST(interrupt_handler_test, usciA1Vector)
+{
+    char actualOutput[CLI_CALLBACK_TEST_PRINTF_OUTPUT_LENGTH];
+    char expectedOutput[CLI_CALLBACK_TEST_PRINTF_OUTPUT_LENGTH];
+    const char *command;
+    size_t i;
+
+    /********************************************************************************
+     * Test 1: Receive Interrupt Dispatched To CLI
+     ********************************************************************************/
+
+    /* Receive Command */
+    command = "random -s\n";
+    for(i = 0; i < strlen(command); i++)
+    {
+        HWREG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxRXBUF) = (uint8_t)command[i];
+        UCA1IV = USCI_UART_UCRXIFG;
+        TEST_ASSERT_TRUE(intrinsics_callInterruptHandler(interruptHandler_usciA1Vector));
+    }
+
+    /* Process Input In Main Loop */
+    cliCallback_tick();
+
+    /* Output As Expected */
+    (void)snprintf(expectedOutput, sizeof(expectedOutput), "Seed: %u\n[root/]$ ", randomCallback_getSeed());
+    cliCallbackTest_getPrintfOutputCopy(actualOutput);
+    TEST_ASSERT_EQUAL_STRING(expectedOutput, actualOutput);
+}
+
+TEST(interrupt_handler_test, fuzzMainLoop)
+{
+    char actualOutput[CLI_CALLBACK_TEST_PRINTF_OUTPUT_LENGTH];
+    char expectedOutput[CLI_CALLBACK_TEST_PRINTF_OUTPUT_LENGTH];
+    char message[64];
+    const char *output;
+    uint8_t button, pin;
+    uint16_t baseAddress;
+    uint32_t commandsReceived, commandsSent, i;
+    const uint32_t CommandCount = 50, IterationLimit = 100000;
+
+    /********************************************************************************
+     * Test 1: Interrupts Injected At Random Yield Points While Main Loop Runs
+     ********************************************************************************/
+
+    /*** Set Up ***/
+    TEST_ASSERT_TRUE(ledDriver_enableBlink(LED_DRIVER_LED_1, 100, 100)); // LED 1 Blinks; LED 2 Follows Button 2
+    (void)snprintf(expectedOutput, sizeof(expectedOutput), "Seed: %u\n[root/]$ ", randomCallback_getSeed());
+    commandsReceived = 0;
+    commandsSent = 0;
+    interruptHandlerTest_startFuzzer(4096); // 1 In 16 Yield Points
+    (void)snprintf(message, sizeof(message), "%s=%lu", INTERRUPT_HANDLER_TEST_FUZZER_SEED_VARIABLE, (unsigned long)interruptHandlerTest_getFuzzerSeed());
+
+    /*** Main Loop ***/
+    for(i = 0; (i < IterationLimit) && (commandsReceived < CommandCount); i++)
+    {
+        /* Host Keeps At Most Two Commands Outstanding */
+        if((commandsSent < CommandCount) && ((commandsSent - commandsReceived) < 2))
+        {
+            if(interruptHandlerTest_queueFuzzerReceiveCharacters("random -s\n"))
+                commandsSent++;
+        }
+
+        /* Tick */
+        buttonDriver_tick();
+        cliCallback_tick();
+
+        /* Every Output Is A Complete Response */
+        cliCallbackTest_getPrintfOutputCopy(actualOutput);
+        for(output = actualOutput; *output != '\0'; output += strlen(expectedOutput))
+        {
+            TEST_ASSERT_EQUAL_STRING_LEN_MESSAGE(expectedOutput, output, strlen(expectedOutput), message);
+            commandsReceived++;
+        }
+
+        /* Button State Matches Simulated Buttons And Edge Selection (Interrupt Handlers Are Atomic To Main Loop) */
+        baseAddress = GPIO_PORT_TO_BASE[DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT];
+        for(button = BUTTON_DRIVER_BUTTON_1; button <= BUTTON_DRIVER_BUTTON_2; button++)
+        {
+            pin = (button == BUTTON_DRIVER_BUTTON_1) ? (uint8_t)DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PIN : (uint8_t)DRIVER_CONFIG_BUTTON_GPIO_BUTTON_2_PIN;
+            TEST_ASSERT_EQUAL_MESSAGE(interruptHandlerTest_getFuzzerButtonPressed(button), (buttonDriver_state & button) == button, message);
+            TEST_ASSERT_EQUAL_MESSAGE((buttonDriver_state & button) == button, (HW_MEMMAP_REG8(baseAddress + OFS_PAIES) & pin) == 0, message); // Pressed: Wait For Low To High
+        }
+
+        /* Blinking LED Output Matches Blink State */
+        baseAddress = GPIO_PORT_TO_BASE[DRIVER_CONFIG_LED_GPIO_LED_1_PORT];
+        TEST_ASSERT_EQUAL_MESSAGE(ledDriver_ledBlink[LED_DRIVER_LED_1].on, (HW_MEMMAP_REG8(baseAddress + OFS_PAOUT) & DRIVER_CONFIG_LED_GPIO_LED_1_PIN) == DRIVER_CONFIG_LED_GPIO_LED_1_PIN, message);
+    }
+
+    /*** Clean Up ***/
+    interruptHandlerTest_stopFuzzer();
+
+    /*** Every Command Answered ***/
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(CommandCount, commandsReceived, message);
+    TEST_ASSERT_NOT_EQUAL_MESSAGE(0, interruptHandlerTest_getFuzzerInjectionCount(INTERRUPT_HANDLER_TEST_VECTOR_PORT1), message);
+    TEST_ASSERT_NOT_EQUAL_MESSAGE(0, interruptHandlerTest_getFuzzerInjectionCount(INTERRUPT_HANDLER_TEST_VECTOR_TIMER0_A1), message);
+
+    /*** Button Following LED Settles On Next Tick Without Interrupts ***/
+    buttonDriver_tick();
+    baseAddress = GPIO_PORT_TO_BASE[DRIVER_CONFIG_LED_GPIO_LED_2_PORT];
+    TEST_ASSERT_EQUAL_MESSAGE((buttonDriver_state & BUTTON_DRIVER_BUTTON_2) == BUTTON_DRIVER_BUTTON_2, (HW_MEMMAP_REG8(baseAddress + OFS_PAOUT) & DRIVER_CONFIG_LED_GPIO_LED_2_PIN) == DRIVER_CONFIG_LED_GPIO_LED_2_PIN, message);
+}
+
+/****************************************************************************************************
+ * Test Group Runner
+ ****************************************************************************************************/
+
+TEST_GROUP_RUNNER(interrupt_handler_test)
+{
+    RUN_TEST_CASE(interrupt_handler_test, port1Vector)
+    RUN_TEST_CASE(interrupt_handler_test, timer0A1Vector)
+    RUN_TEST_CASE(interrupt_handler_test, usciA1Vector)
+    RUN_TEST_CASE(interrupt_handler_test, fuzzMainLoop)
+}
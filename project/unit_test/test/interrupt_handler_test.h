@@ -0,0 +1,47 @@
+/****************************************************************************************************
+ * FILE:    interrupt_handler_test.h
+ * BRIEF:   Interrupt Handler Test Header File
+ ****************************************************************************************************/
+
+#ifndef INTERRUPT_HANDLER_TEST_H
+#define INTERRUPT_HANDLER_TEST_H
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define INTERRUPT_HANDLER_TEST_FUZZER_RECEIVE_LENGTH (64)
+#define INTERRUPT_HANDLER_TEST_FUZZER_SEED_DEFAULT   (0x2545F491u) // Fixed, So Every Run Injects The Same Sequence
+#define INTERRUPT_HANDLER_TEST_FUZZER_SEED_VARIABLE  ("INTERRUPT_HANDLER_TEST_SEED")
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef enum interruptHandlerTest_vector_e
+{
+    INTERRUPT_HANDLER_TEST_VECTOR_PORT1,
+    INTERRUPT_HANDLER_TEST_VECTOR_TIMER0_A1,
+    INTERRUPT_HANDLER_TEST_VECTOR_USCI_A1,
+    INTERRUPT_HANDLER_TEST_VECTOR_COUNT
+} interruptHandlerTest_vector_t;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern uint32_t interruptHandlerTest_getFuzzerInjectionCount(const interruptHandlerTest_vector_t Vector);
+extern bool interruptHandlerTest_getFuzzerButtonPressed(const uint8_t Button);
+extern uint32_t interruptHandlerTest_getFuzzerSeed(void);
+extern bool interruptHandlerTest_queueFuzzerReceiveCharacters(const char * const Characters);
+extern void interruptHandlerTest_startFuzzer(const uint16_t Probability);
+extern void interruptHandlerTest_stopFuzzer(void);
+
+#endif
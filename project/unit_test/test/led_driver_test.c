@@ -13,9 +13,49 @@
 #include "led_driver.h"
 #include "led_driver_test.h"
 #include <stdbool.h>
+#include <stdint.h>
 #include "system.h"
 #include "unity_fixture.h"
 
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define LED_DRIVER_TEST_ACCESS_MAXIMUM (8)
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static uint32_t ledDriverTest_access[LED_DRIVER_TEST_ACCESS_MAXIMUM];
+static uint8_t ledDriverTest_accessCount;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void ledDriverTest_accessCallback(const uint32_t Address);
+
+/****************************************************************************************************
+ * Function Definitions
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   ledDriverTest_accessCallback
+ * BRIEF:   Access Callback
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Address
+ * NOTE:    Records Register Accesses (The First LED_DRIVER_TEST_ACCESS_MAXIMUM, Counts Them All)
+ ****************************************************************************************************/
+static void ledDriverTest_accessCallback(const uint32_t Address)
+{
+    /*** Record ***/
+    if(ledDriverTest_accessCount < LED_DRIVER_TEST_ACCESS_MAXIMUM)
+        ledDriverTest_access[ledDriverTest_accessCount] = Address;
+    if(ledDriverTest_accessCount < UINT8_MAX)
+        ledDriverTest_accessCount++;
+}
+
 /****************************************************************************************************
  * Test Group
  ****************************************************************************************************/
@@ -38,6 +78,8 @@ TEST_SETUP(led_driver_test)
 
 TEST_TEAR_DOWN(led_driver_test)
 {
+    /*** Tear Down ***/
+    hwMemmap_unregisterAccessCallback(ledDriverTest_accessCallback);
 }
 
 /****************************************************************************************************
@@ -71,8 +113,8 @@ TEST(led_driver_test, enableBlink)
     /* LED Structure Set */
     TEST_ASSERT_TRUE(ledDriver_ledBlink[LED_DRIVER_LED_1].enabled);
     TEST_ASSERT_FALSE(ledDriver_ledBlink[LED_DRIVER_LED_1].on); // Not Used
-    TEST_ASSERT_EQUAL_UINT16(0, ledDriver_ledBlink[LED_DRIVER_LED_1].onMilliseconds); // Not Used
-    TEST_ASSERT_EQUAL_UINT16(0, ledDriver_ledBlink[LED_DRIVER_LED_1].offMilliseconds); // Not Used
+    TEST_ASSERT_EQUAL_UINT16(0, ledDriver_ledBlink[LED_DRIVER_LED_1].onTicks); // Not Used
+    TEST_ASSERT_EQUAL_UINT16(0, ledDriver_ledBlink[LED_DRIVER_LED_1].offTicks); // Not Used
     
     /* LED On */
     baseAddress = GPIO_PORT_TO_BASE[DRIVER_CONFIG_LED_GPIO_LED_1_PORT];
@@ -92,8 +134,8 @@ TEST(led_driver_test, enableBlink)
     /* LED Structure Set */
     TEST_ASSERT_TRUE(ledDriver_ledBlink[LED_DRIVER_LED_2].enabled);
     TEST_ASSERT_FALSE(ledDriver_ledBlink[LED_DRIVER_LED_1].on); // Not Used
-    TEST_ASSERT_EQUAL_UINT16(0, ledDriver_ledBlink[LED_DRIVER_LED_1].onMilliseconds); // Not Used
-    TEST_ASSERT_EQUAL_UINT16(0, ledDriver_ledBlink[LED_DRIVER_LED_1].offMilliseconds); // Not Used
+    TEST_ASSERT_EQUAL_UINT16(0, ledDriver_ledBlink[LED_DRIVER_LED_1].onTicks); // Not Used
+    TEST_ASSERT_EQUAL_UINT16(0, ledDriver_ledBlink[LED_DRIVER_LED_1].offTicks); // Not Used
     
     /* LED Off */
     baseAddress = GPIO_PORT_TO_BASE[DRIVER_CONFIG_LED_GPIO_LED_2_PORT];
@@ -117,8 +159,8 @@ TEST(led_driver_test, enableBlink)
     /* LED Structure Set */
     TEST_ASSERT_TRUE(ledDriver_ledBlink[LED_DRIVER_LED_1].enabled);
     TEST_ASSERT_TRUE(ledDriver_ledBlink[LED_DRIVER_LED_1].on); // true = On
-    TEST_ASSERT_EQUAL_UINT16(onMilliseconds, ledDriver_ledBlink[LED_DRIVER_LED_1].onMilliseconds);
-    TEST_ASSERT_EQUAL_UINT16(offMilliseconds, ledDriver_ledBlink[LED_DRIVER_LED_1].offMilliseconds);
+    TEST_ASSERT_EQUAL_UINT16(LED_DRIVER_CONVERT_MILLISECONDS_TO_TICKS(onMilliseconds), ledDriver_ledBlink[LED_DRIVER_LED_1].onTicks);
+    TEST_ASSERT_EQUAL_UINT16(LED_DRIVER_CONVERT_MILLISECONDS_TO_TICKS(offMilliseconds), ledDriver_ledBlink[LED_DRIVER_LED_1].offTicks);
     
     /* LED On */
     baseAddress = GPIO_PORT_TO_BASE[DRIVER_CONFIG_LED_GPIO_LED_1_PORT];
@@ -147,8 +189,8 @@ TEST(led_driver_test, enableBlink)
     /* LED Structure Set */
     TEST_ASSERT_FALSE(ledDriver_ledBlink[LED_DRIVER_LED_2].enabled);
     TEST_ASSERT_FALSE(ledDriver_ledBlink[LED_DRIVER_LED_2].on);
-    TEST_ASSERT_EQUAL_UINT16(0, ledDriver_ledBlink[LED_DRIVER_LED_2].onMilliseconds);
-    TEST_ASSERT_EQUAL_UINT16(0, ledDriver_ledBlink[LED_DRIVER_LED_2].offMilliseconds);
+    TEST_ASSERT_EQUAL_UINT16(0, ledDriver_ledBlink[LED_DRIVER_LED_2].onTicks);
+    TEST_ASSERT_EQUAL_UINT16(0, ledDriver_ledBlink[LED_DRIVER_LED_2].offTicks);
 }
 
 TEST(led_driver_test, init)
@@ -186,8 +228,8 @@ TEST(led_driver_test, init)
     {
     	TEST_ASSERT_FALSE(ledDriver_ledBlink[led].enabled);
         TEST_ASSERT_FALSE(ledDriver_ledBlink[led].on);
-        TEST_ASSERT_EQUAL_UINT16(0, ledDriver_ledBlink[led].onMilliseconds);
-        TEST_ASSERT_EQUAL_UINT16(0, ledDriver_ledBlink[led].offMilliseconds);
+        TEST_ASSERT_EQUAL_UINT16(0, ledDriver_ledBlink[led].onTicks);
+        TEST_ASSERT_EQUAL_UINT16(0, ledDriver_ledBlink[led].offTicks);
     }
     
     /*** Subtest 4: LED States (Off) ***/
@@ -275,8 +317,8 @@ TEST(led_driver_test, timerInterruptHandler)
 			/* LED Structure Set */
 			TEST_ASSERT_TRUE(ledDriver_ledBlink[LED_DRIVER_LED_1].enabled); // Didn't Change
 			TEST_ASSERT_TRUE(ledDriver_ledBlink[LED_DRIVER_LED_1].on); // true = On
-			TEST_ASSERT_EQUAL_UINT16(onMilliseconds, ledDriver_ledBlink[LED_DRIVER_LED_1].onMilliseconds); // Didn't Change
-			TEST_ASSERT_EQUAL_UINT16(offMilliseconds, ledDriver_ledBlink[LED_DRIVER_LED_1].offMilliseconds); // Didn't Change
+			TEST_ASSERT_EQUAL_UINT16(LED_DRIVER_CONVERT_MILLISECONDS_TO_TICKS(onMilliseconds), ledDriver_ledBlink[LED_DRIVER_LED_1].onTicks); // Didn't Change
+			TEST_ASSERT_EQUAL_UINT16(LED_DRIVER_CONVERT_MILLISECONDS_TO_TICKS(offMilliseconds), ledDriver_ledBlink[LED_DRIVER_LED_1].offTicks); // Didn't Change
 
 			/* LED On */
 			TEST_ASSERT_EQUAL_HEX16(DRIVER_CONFIG_LED_GPIO_LED_1_PIN, HWREG16(baseAddress + OFS_PAOUT) & DRIVER_CONFIG_LED_GPIO_LED_1_PIN);
@@ -296,8 +338,8 @@ TEST(led_driver_test, timerInterruptHandler)
 			/* LED Structure Set */
 			TEST_ASSERT_TRUE(ledDriver_ledBlink[LED_DRIVER_LED_1].enabled); // Didn't Change
 			TEST_ASSERT_FALSE(ledDriver_ledBlink[LED_DRIVER_LED_1].on); // false = Off
-			TEST_ASSERT_EQUAL_UINT16(onMilliseconds, ledDriver_ledBlink[LED_DRIVER_LED_1].onMilliseconds); // Didn't Change
-			TEST_ASSERT_EQUAL_UINT16(offMilliseconds, ledDriver_ledBlink[LED_DRIVER_LED_1].offMilliseconds); // Didn't Change
+			TEST_ASSERT_EQUAL_UINT16(LED_DRIVER_CONVERT_MILLISECONDS_TO_TICKS(onMilliseconds), ledDriver_ledBlink[LED_DRIVER_LED_1].onTicks); // Didn't Change
+			TEST_ASSERT_EQUAL_UINT16(LED_DRIVER_CONVERT_MILLISECONDS_TO_TICKS(offMilliseconds), ledDriver_ledBlink[LED_DRIVER_LED_1].offTicks); // Didn't Change
 
 			/* LED Off */
 			TEST_ASSERT_EQUAL_HEX16(0, HWREG16(baseAddress + OFS_PAOUT) & DRIVER_CONFIG_LED_GPIO_LED_1_PIN);
@@ -316,6 +358,26 @@ TEST(led_driver_test, timerInterruptHandler)
     	/* Interrupt */
     	ledDriver_timerInterruptHandler(TA0IV_TACCR1);
     }
+
+    /********************************************************************************
+     * Test 2: Register Accesses (hal.h)
+     ********************************************************************************/
+
+    /*** Subtest 1: One Pin Write And One Compare Update, Nothing Else ***/
+    TEST_ASSERT_TRUE(ledDriver_enableBlink(LED_DRIVER_LED_2, onMilliseconds, offMilliseconds));
+    expectedCompareValue = (uint16_t)(HWREG16(DRIVER_CONFIG_LED_TIMER + DRIVER_CONFIG_LED_TIMER_LED_2_CCR + OFS_TAxR) + LED_DRIVER_CONVERT_MILLISECONDS_TO_TICKS(offMilliseconds));
+    ledDriverTest_accessCount = 0;
+    TEST_ASSERT_TRUE(hwMemmap_registerAccessCallback(ledDriverTest_accessCallback));
+    ledDriver_timerInterruptHandler(TA0IV_TACCR2);
+    hwMemmap_unregisterAccessCallback(ledDriverTest_accessCallback);
+    TEST_ASSERT_EQUAL_UINT8(2, ledDriverTest_accessCount);
+    TEST_ASSERT_EQUAL_HEX32(GPIO_PORT_TO_BASE[DRIVER_CONFIG_LED_GPIO_LED_2_PORT] + OFS_PAOUT, ledDriverTest_access[0]);
+    TEST_ASSERT_EQUAL_HEX32(DRIVER_CONFIG_LED_TIMER + DRIVER_CONFIG_LED_TIMER_LED_2_CCR + OFS_TAxR, ledDriverTest_access[1]);
+
+    /*** Subtest 2: Off, Next Match One Off Period After The Last ***/
+    baseAddress = GPIO_PORT_TO_BASE[DRIVER_CONFIG_LED_GPIO_LED_2_PORT];
+    TEST_ASSERT_EQUAL_HEX16(0, HWREG16(baseAddress + OFS_PAOUT) & DRIVER_CONFIG_LED_GPIO_LED_2_PIN);
+    TEST_ASSERT_EQUAL_HEX16(expectedCompareValue, HWREG16(DRIVER_CONFIG_LED_TIMER + DRIVER_CONFIG_LED_TIMER_LED_2_CCR + OFS_TAxR));
 }
 
 /****************************************************************************************************
@@ -0,0 +1,215 @@
+/****************************************************************************************************
+ * FILE:    log_driver_test.c
+ * BRIEF:   Log Driver Test Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define LOG_DRIVER_TEST_OUTPUT_LENGTH (1024)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "driver_config.h"
+#include "hw_memmap.h"
+#include "log_decoder.h"
+#include "log_driver.h"
+#include "log_driver_test.h"
+#include "msp430fr5xx_6xxgeneric.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "system.h"
+#include "unity_fixture.h"
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static uint8_t logDriverTest_output[LOG_DRIVER_TEST_OUTPUT_LENGTH];
+static size_t logDriverTest_outputLength;
+static uint16_t logDriverTest_writeCount;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void logDriverTest_writeCallback(const uint8_t * const Data, const size_t Length);
+
+/****************************************************************************************************
+ * Function Definitions
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   logDriverTest_writeCallback
+ * BRIEF:   Write Callback (Capture)
+ * RETURN:  Returns Nothing
+ * ARG:     Data: Data
+ * ARG:     Length: Length (Bytes)
+ ****************************************************************************************************/
+static void logDriverTest_writeCallback(const uint8_t * const Data, const size_t Length)
+{
+    /*** Capture ***/
+    if(Length <= (sizeof(logDriverTest_output) - logDriverTest_outputLength))
+    {
+        (void)memcpy(&logDriverTest_output[logDriverTest_outputLength], Data, Length);
+        logDriverTest_outputLength += Length;
+    }
+    logDriverTest_writeCount++;
+}
+
+/****************************************************************************************************
+ * Test Group
+ ****************************************************************************************************/
+
+TEST_GROUP(log_driver_test);
+
+/****************************************************************************************************
+ * Test Setup And Teardown
+ ****************************************************************************************************/
+
+TEST_SETUP(log_driver_test)
+{
+    /*** Set Up ***/
+    /* Simulation */
+    hwMemmap_init();
+
+    /* Application */
+    system_init();
+
+    /* Test */
+    logDriver_init(logDriverTest_writeCallback);
+    logDriverTest_outputLength = 0;
+    logDriverTest_writeCount = 0;
+}
+
+TEST_TEAR_DOWN(log_driver_test)
+{
+}
+
+/****************************************************************************************************
+ * Tests
+ ****************************************************************************************************/
+
+TEST(log_driver_test, decode)
+{
+    const uint8_t Prompt[] = "Log: ON (Dropped Records: 0)\n";
+    char actualOutput[LOG_DRIVER_TEST_OUTPUT_LENGTH], string[64];
+    logDecoder_t decoder;
+    FILE *output;
+
+    /********************************************************************************
+     * Test 1: Decode Records From This Executable
+     ********************************************************************************/
+
+    /*** Set Up ***/
+    if(!logDecoder_open(&decoder, "/proc/self/exe"))
+        TEST_IGNORE_MESSAGE("Executable Not Readable As An ELF File");
+    (void)memset(actualOutput, 0, sizeof(actualOutput));
+    output = fmemopen(actualOutput, sizeof(actualOutput) - 1, "w");
+    TEST_ASSERT_NOT_NULL(output);
+    logDriver_setEnabled(true);
+
+    /*** Subtest 1: Text And Records (Split Anywhere) ***/
+    logDecoder_decode(&decoder, Prompt, sizeof(Prompt) - 1, output);
+    HWREG16(DRIVER_CONFIG_LOG_TIMER + OFS_TAxR) = 0xFFF0;
+    LOG_DRIVER_LOG3("Count %u Of %u, Delta %d", 2, 10, -15);
+    HWREG16(DRIVER_CONFIG_LOG_TIMER + OFS_TAxR) = 0x0010; // Wrapped
+    LOG_DRIVER_LOG2("Value 0x%04X '%c'", 0xBEEF, 'z');
+    logDriver_tick();
+    logDecoder_decode(&decoder, logDriverTest_output, 7, output);
+    logDecoder_decode(&decoder, &logDriverTest_output[7], logDriverTest_outputLength - 7, output);
+    (void)fclose(output);
+    TEST_ASSERT_EQUAL_STRING("Log: ON (Dropped Records: 0)\n[   1.999512] Count 2 Of 10, Delta -15\n[   2.000488] Value 0xBEEF 'z'\n", actualOutput);
+
+    /*** Subtest 2: Unknown ID ***/
+    TEST_ASSERT_FALSE(logDecoder_format(&decoder, (uint16_t)decoder.stringsLength, NULL, 0, string, sizeof(string)));
+
+    /*** Clean Up ***/
+    logDecoder_close(&decoder);
+}
+
+TEST(log_driver_test, init)
+{
+    /********************************************************************************
+     * Test 1: Initialize
+     ********************************************************************************/
+
+    /*** Subtest 1: Disabled And Empty ***/
+    TEST_ASSERT_FALSE(logDriver_isEnabled());
+    TEST_ASSERT_EQUAL_UINT16(0, logDriver_getDropCount());
+    TEST_ASSERT_EQUAL_UINT8(logDriver_head, logDriver_tail);
+
+    /*** Subtest 2: Disabled Records Nothing ***/
+    LOG_DRIVER_LOG0("Disabled");
+    logDriver_tick();
+    TEST_ASSERT_EQUAL_UINT16(0, logDriverTest_writeCount);
+}
+
+TEST(log_driver_test, record)
+{
+    const uint8_t ExpectedRecord[] = {0xF2, 0x00, 0x00, 0x34, 0x12, 0x07, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF};
+    uint16_t id;
+    uint8_t i;
+
+    /********************************************************************************
+     * Test 1: Record Layout
+     ********************************************************************************/
+
+    /*** Set Up ***/
+    logDriver_setEnabled(true);
+    HWREG16(DRIVER_CONFIG_LOG_TIMER + OFS_TAxR) = 0x1234;
+
+    /*** Subtest 1: Record ***/
+    {
+        static const char Format[] LOG_DRIVER_SECTION = "Record %u %d";
+
+        id = LOG_DRIVER_ID(Format);
+        logDriver_record(id, 2, (const uint32_t[]){7, (uint32_t)-2});
+    }
+    logDriver_tick();
+    TEST_ASSERT_EQUAL_UINT16(1, logDriverTest_writeCount);
+    TEST_ASSERT_EQUAL_size_t(sizeof(ExpectedRecord), logDriverTest_outputLength);
+    TEST_ASSERT_EQUAL_HEX8(ExpectedRecord[0], logDriverTest_output[0]);
+    TEST_ASSERT_EQUAL_HEX16(id, (uint16_t)(logDriverTest_output[1] | (logDriverTest_output[2] << 8)));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(&ExpectedRecord[3], &logDriverTest_output[3], sizeof(ExpectedRecord) - 3);
+
+    /*** Subtest 2: ID Resolves In The Log Section ***/
+    TEST_ASSERT_EQUAL_STRING("Record %u %d", &logDriver_sectionStart[id]);
+
+    /********************************************************************************
+     * Test 2: Full Buffer
+     ********************************************************************************/
+
+    /*** Subtest 1: Records That Don't Fit Are Dropped And Counted ***/
+    for(i = 0; i < 20; i++)
+        LOG_DRIVER_LOG4("Full %u %u %u %u", i, 1, 2, 3); // 21 Bytes: 12 Fit In 255
+    TEST_ASSERT_EQUAL_UINT16(8, logDriver_getDropCount());
+
+    /*** Subtest 2: Drained In Order Across The Wrap Around ***/
+    logDriverTest_outputLength = 0;
+    logDriverTest_writeCount = 0;
+    logDriver_tick();
+    TEST_ASSERT_EQUAL_UINT16(2, logDriverTest_writeCount);
+    TEST_ASSERT_EQUAL_size_t(12 * 21, logDriverTest_outputLength);
+    for(i = 0; i < 12; i++)
+    {
+        TEST_ASSERT_EQUAL_HEX8(0xF4, logDriverTest_output[i * 21]);
+        TEST_ASSERT_EQUAL_UINT8(i, logDriverTest_output[(i * 21) + 5]);
+    }
+}
+
+/****************************************************************************************************
+ * Test Group Runner
+ ****************************************************************************************************/
+
+TEST_GROUP_RUNNER(log_driver_test)
+{
+    RUN_TEST_CASE(log_driver_test, decode)
+    RUN_TEST_CASE(log_driver_test, init)
+    RUN_TEST_CASE(log_driver_test, record)
+}
@@ -0,0 +1,27 @@
+/****************************************************************************************************
+ * FILE:    log_driver_test.h
+ * BRIEF:   Log Driver Test Header File
+ ****************************************************************************************************/
+
+#ifndef LOG_DRIVER_TEST_H
+#define LOG_DRIVER_TEST_H
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "log_driver.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+extern uint8_t logDriver_buffer[LOG_DRIVER_BUFFER_LENGTH];
+extern volatile uint16_t logDriver_dropCount;
+extern volatile bool logDriver_enabled;
+extern volatile uint8_t logDriver_head;
+extern volatile uint8_t logDriver_tail;
+
+#endif
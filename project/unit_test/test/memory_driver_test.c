@@ -0,0 +1,151 @@
+/****************************************************************************************************
+ * FILE:    memory_driver_test.c
+ * BRIEF:   Memory Driver Test Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "hw_memmap.h"
+#include "interrupt_handler.h"
+#include "intrinsics.h"
+#include "memory_driver.h"
+#include "memory_driver_test.h"
+#include "msp430fr5xx_6xxgeneric.h"
+#include "msp430fr6989.h"
+#include <stdint.h>
+#include "system.h"
+#include "unity_fixture.h"
+#include "vector_driver.h"
+
+/****************************************************************************************************
+ * Test Group
+ ****************************************************************************************************/
+
+TEST_GROUP(memory_driver_test);
+
+/****************************************************************************************************
+ * Test Setup And Teardown
+ ****************************************************************************************************/
+
+TEST_SETUP(memory_driver_test)
+{
+    /*** Set Up ***/
+    /* Simulation */
+    hwMemmap_init();
+
+    /* Application */
+    system_init();
+}
+
+TEST_TEAR_DOWN(memory_driver_test)
+{
+    /*** Tear Down ***/
+    __set_SP_register(MEMORY_DRIVER_TEST_STACK_END);
+}
+
+/****************************************************************************************************
+ * Tests
+ ****************************************************************************************************/
+
+TEST(memory_driver_test, getUsage)
+{
+    memoryDriver_usage_t usage;
+
+    /********************************************************************************
+     * Test 1: Sections
+     ********************************************************************************/
+
+    /*** Subtest 1: Lengths From The Linker Symbols ***/
+    memoryDriver_getUsage(&usage);
+    TEST_ASSERT_EQUAL_UINT16(0x0300, usage.bssLength);
+    TEST_ASSERT_EQUAL_UINT16(0x0040, usage.dataLength);
+    TEST_ASSERT_EQUAL_UINT16(0x0010, usage.noinitLength);
+    TEST_ASSERT_EQUAL_UINT16(0x0060, usage.ramfuncLength);
+    TEST_ASSERT_EQUAL_UINT16(160, usage.stackLength);
+    TEST_ASSERT_EQUAL_UINT16(MEMORY_DRIVER_RAM_LENGTH - 0x0300 - 0x0040 - 0x0010 - 160 - VECTOR_DRIVER_RAMFUNC_BUDGET - VECTOR_DRIVER_RAM_LENGTH, usage.freeLength);
+
+    /********************************************************************************
+     * Test 2: Stack High Water Mark
+     ********************************************************************************/
+
+    /*** Subtest 1: Untouched ***/
+    TEST_ASSERT_EQUAL_UINT16(0, usage.stackHighWater);
+    TEST_ASSERT_FALSE(usage.stackOverflow);
+
+    /*** Subtest 2: Deepest Overwritten Word ***/
+    HWREG16(MEMORY_DRIVER_TEST_STACK_END - 10) = 0x0000;
+    HWREG16(MEMORY_DRIVER_TEST_STACK_END - 64) = 0x1234;
+    memoryDriver_getUsage(&usage);
+    TEST_ASSERT_EQUAL_UINT16(64, usage.stackHighWater);
+    TEST_ASSERT_FALSE(usage.stackOverflow);
+
+    /*** Subtest 3: Overflow (Lowest Word Overwritten) ***/
+    HWREG16(MEMORY_DRIVER_TEST_STACK_START) = 0x0000;
+    memoryDriver_getUsage(&usage);
+    TEST_ASSERT_EQUAL_UINT16(160, usage.stackHighWater);
+    TEST_ASSERT_TRUE(usage.stackOverflow);
+}
+
+TEST(memory_driver_test, init)
+{
+    memoryDriver_usage_t usage;
+    uint16_t address;
+
+    /********************************************************************************
+     * Test 1: Paint Below The Stack Pointer
+     ********************************************************************************/
+
+    /*** Subtest 1: Whole Stack Free ***/
+    TEST_ASSERT_EQUAL_HEX16(MEMORY_DRIVER_TEST_STACK_END, memoryDriver_paintEnd);
+    for(address = MEMORY_DRIVER_TEST_STACK_START; address < MEMORY_DRIVER_TEST_STACK_END; address += 2)
+        TEST_ASSERT_EQUAL_HEX16(MEMORY_DRIVER_PAINT, HW_MEMMAP_REG16(address));
+
+    /*** Subtest 2: Stack In Use Left Alone And Counted ***/
+    HW_MEMMAP_REG16(MEMORY_DRIVER_TEST_STACK_END - 2) = 0x1234;
+    __set_SP_register(MEMORY_DRIVER_TEST_STACK_END - 32);
+    memoryDriver_init();
+    TEST_ASSERT_EQUAL_HEX16(MEMORY_DRIVER_TEST_STACK_END - 32, memoryDriver_paintEnd);
+    TEST_ASSERT_EQUAL_HEX16(0x1234, HW_MEMMAP_REG16(MEMORY_DRIVER_TEST_STACK_END - 2));
+    memoryDriver_getUsage(&usage);
+    TEST_ASSERT_EQUAL_UINT16(32, usage.stackHighWater);
+    TEST_ASSERT_EQUAL_UINT16(0, usage.interruptEntryMaximum);
+}
+
+TEST(memory_driver_test, recordInterruptEntry)
+{
+    memoryDriver_usage_t usage;
+
+    /********************************************************************************
+     * Test 1: Deepest Stack On Interrupt Entry
+     ********************************************************************************/
+
+    /*** Subtest 1: Empty Main Context (Return Address And Status Register Only) ***/
+    HWREG16(TIMER_B0_BASE + OFS_TBxIV) = TB0IV_NONE;
+    TEST_ASSERT_TRUE(intrinsics_callInterruptHandler(interruptHandler_timer0B1Vector));
+    memoryDriver_getUsage(&usage);
+    TEST_ASSERT_EQUAL_UINT16(4, usage.interruptEntryMaximum);
+    TEST_ASSERT_EQUAL_UINT16(4, usage.stackHighWater);
+    TEST_ASSERT_EQUAL_HEX16(MEMORY_DRIVER_TEST_STACK_END, __get_SP_register()); // Popped
+
+    /*** Subtest 2: Deeper Main Context ***/
+    __set_SP_register(MEMORY_DRIVER_TEST_STACK_END - 48);
+    TEST_ASSERT_TRUE(intrinsics_callInterruptHandler(interruptHandler_timer0B1Vector));
+    __set_SP_register(MEMORY_DRIVER_TEST_STACK_END - 8);
+    TEST_ASSERT_TRUE(intrinsics_callInterruptHandler(interruptHandler_timer0B1Vector));
+    memoryDriver_getUsage(&usage);
+    TEST_ASSERT_EQUAL_UINT16(52, usage.interruptEntryMaximum);
+    TEST_ASSERT_EQUAL_UINT16(52, usage.stackHighWater);
+}
+
+/****************************************************************************************************
+ * Test Group Runner
+ ****************************************************************************************************/
+
+TEST_GROUP_RUNNER(memory_driver_test)
+{
+    RUN_TEST_CASE(memory_driver_test, getUsage)
+    RUN_TEST_CASE(memory_driver_test, init)
+    RUN_TEST_CASE(memory_driver_test, recordInterruptEntry)
+}
@@ -0,0 +1,38 @@
+/****************************************************************************************************
+ * FILE:    memory_driver_test.h
+ * BRIEF:   Memory Driver Test Header File
+ ****************************************************************************************************/
+
+#ifndef MEMORY_DRIVER_TEST_H
+#define MEMORY_DRIVER_TEST_H
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+/*** Simulated RAM Layout (Stand-Ins For The Linker Symbols; 160-Byte Stack Below RAMFUNC And The Vectors) ***/
+#define MEMORY_DRIVER_TEST_BSS_START     (0x1C00)
+#define MEMORY_DRIVER_TEST_BSS_END       (0x1F00)
+#define MEMORY_DRIVER_TEST_DATA_START    (0x1F00)
+#define MEMORY_DRIVER_TEST_DATA_END      (0x1F40)
+#define MEMORY_DRIVER_TEST_NOINIT_START  (0x1F40)
+#define MEMORY_DRIVER_TEST_NOINIT_END    (0x1F50)
+#define MEMORY_DRIVER_TEST_RAMFUNC_START (0x2290)
+#define MEMORY_DRIVER_TEST_RAMFUNC_END   (0x22F0)
+#define MEMORY_DRIVER_TEST_STACK_START   (0x21F0)
+#define MEMORY_DRIVER_TEST_STACK_END     (0x2290)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+extern volatile uint16_t memoryDriver_interruptEntryMaximum;
+extern uint16_t memoryDriver_paintEnd;
+
+#endif
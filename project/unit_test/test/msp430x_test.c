@@ -0,0 +1,307 @@
+/****************************************************************************************************
+ * FILE:    msp430x_test.c
+ * BRIEF:   MSP430X CPU Emulator Test Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define MSP430X_TEST_CODE_ADDRESS  (0x4400) // FRAM Start
+#define MSP430X_TEST_STACK_ADDRESS (0x2400) // RAM End
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "hw_memmap.h"
+#include "msp430x.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include "unity_fixture.h"
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void msp430xTest_writeCode(const uint32_t Address, const uint16_t * const Words, const uint8_t Count);
+
+/****************************************************************************************************
+ * Function Definitions
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   msp430xTest_writeCode
+ * BRIEF:   Write Code
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Address
+ * ARG:     Words: Instruction Words
+ * ARG:     Count: Number Of Words
+ ****************************************************************************************************/
+static void msp430xTest_writeCode(const uint32_t Address, const uint16_t * const Words, const uint8_t Count)
+{
+    uint8_t i;
+
+    /*** Write Code ***/
+    for(i = 0; i < Count; i++)
+    {
+        msp430x_writeByte(Address + (2u * i), (uint8_t)Words[i]);
+        msp430x_writeByte(Address + (2u * i) + 1, (uint8_t)(Words[i] >> 8));
+    }
+}
+
+/****************************************************************************************************
+ * Test Group
+ ****************************************************************************************************/
+
+TEST_GROUP(msp430x_test);
+
+/****************************************************************************************************
+ * Test Setup And Teardown
+ ****************************************************************************************************/
+
+TEST_SETUP(msp430x_test)
+{
+    /*** Set Up ***/
+    /* Simulation */
+    hwMemmap_init();
+
+    /* Emulator */
+    msp430x_init();
+    msp430x_setRegister(MSP430X_REGISTER_PC, MSP430X_TEST_CODE_ADDRESS);
+    msp430x_setRegister(MSP430X_REGISTER_SP, MSP430X_TEST_STACK_ADDRESS);
+}
+
+TEST_TEAR_DOWN(msp430x_test)
+{
+}
+
+/****************************************************************************************************
+ * Tests
+ ****************************************************************************************************/
+
+TEST(msp430x_test, callReturn)
+{
+    const msp430x_function_t *function;
+    uint64_t cycles;
+    static const uint16_t code[] = {0x12B0, 0x4410, 0x3FFF}; // CALL #0x4410, JMP $
+    static const uint16_t subroutine[] = {0x431C, 0x4130}; // MOV #1,R12, RET
+
+    /********************************************************************************
+     * Test 1: CALL And RET
+     ********************************************************************************/
+
+    /*** Set Up ***/
+    msp430xTest_writeCode(MSP430X_TEST_CODE_ADDRESS, code, sizeof(code) / sizeof(code[0]));
+    msp430xTest_writeCode(0x4410, subroutine, sizeof(subroutine) / sizeof(subroutine[0]));
+    TEST_ASSERT_TRUE(msp430x_addFunction("subroutine", 0x4410, 4));
+
+    /*** Call ***/
+    TEST_ASSERT_TRUE(msp430x_step());
+    TEST_ASSERT_EQUAL_HEX32(0x4410, msp430x_getRegister(MSP430X_REGISTER_PC));
+    TEST_ASSERT_EQUAL_HEX32(MSP430X_TEST_STACK_ADDRESS - 2, msp430x_getRegister(MSP430X_REGISTER_SP));
+    TEST_ASSERT_EQUAL_UINT64(4, msp430x_getCycles());
+
+    /*** Return ***/
+    TEST_ASSERT_TRUE(msp430x_step());
+    TEST_ASSERT_TRUE(msp430x_step());
+    TEST_ASSERT_EQUAL_HEX32(0x4404, msp430x_getRegister(MSP430X_REGISTER_PC));
+    TEST_ASSERT_EQUAL_HEX32(MSP430X_TEST_STACK_ADDRESS, msp430x_getRegister(MSP430X_REGISTER_SP));
+    TEST_ASSERT_EQUAL_HEX32(1, msp430x_getRegister(12));
+    TEST_ASSERT_EQUAL_UINT64(9, msp430x_getCycles());
+
+    /*** Profile ***/
+    function = msp430x_findFunction("subroutine");
+    TEST_ASSERT_NOT_NULL(function);
+    TEST_ASSERT_EQUAL_UINT64(1, function->calls);
+    TEST_ASSERT_EQUAL_UINT64(9, function->inclusiveCycles);
+    TEST_ASSERT_EQUAL_UINT64(9, function->exclusiveCycles);
+
+    /********************************************************************************
+     * Test 2: Host Call
+     ********************************************************************************/
+
+    /*** Call ***/
+    msp430x_setRegister(12, 0);
+    TEST_ASSERT_TRUE(msp430x_call(0x4410, NULL, 0, 100, &cycles));
+    TEST_ASSERT_EQUAL_UINT64(5, cycles);
+    TEST_ASSERT_EQUAL_HEX32(1, msp430x_getRegister(12));
+    TEST_ASSERT_EQUAL_HEX32(0x4404, msp430x_getRegister(MSP430X_REGISTER_PC));
+    TEST_ASSERT_EQUAL_HEX32(MSP430X_TEST_STACK_ADDRESS, msp430x_getRegister(MSP430X_REGISTER_SP));
+    TEST_ASSERT_EQUAL_UINT64(2, function->calls);
+    TEST_ASSERT_EQUAL_UINT64(5, function->minimumCycles);
+    TEST_ASSERT_EQUAL_UINT64(9, function->maximumCycles);
+
+    /*** Timeout (JMP $ Never Returns) ***/
+    TEST_ASSERT_FALSE(msp430x_call(0x4404, NULL, 0, 100, &cycles));
+    TEST_ASSERT_EQUAL_HEX32(0x4404, msp430x_getRegister(MSP430X_REGISTER_PC));
+}
+
+TEST(msp430x_test, extended)
+{
+    static const uint16_t code[] =
+    {
+        0x0184, 0x2345,        // MOVA #0x12345,R4
+        0x04E4,                // ADDA R4,R4
+        0x1415,                // PUSHM.A #2,R5
+        0x1616,                // POPM.A #2,R7
+        0x1843, 0x1106,        // RPT #4 RRAX.W R6
+        0x1801, 0x44C2, 0x2000 // MOVX.A R4,&0x12000
+    };
+
+    /********************************************************************************
+     * Test 1: 20-Bit Address Instructions
+     ********************************************************************************/
+
+    /*** Set Up ***/
+    msp430xTest_writeCode(MSP430X_TEST_CODE_ADDRESS, code, sizeof(code) / sizeof(code[0]));
+    msp430x_setRegister(5, 0xABCDE);
+
+    /*** MOVA, ADDA ***/
+    TEST_ASSERT_TRUE(msp430x_step());
+    TEST_ASSERT_EQUAL_HEX32(0x12345, msp430x_getRegister(4));
+    TEST_ASSERT_EQUAL_UINT64(2, msp430x_getCycles());
+    TEST_ASSERT_TRUE(msp430x_step());
+    TEST_ASSERT_EQUAL_HEX32(0x2468A, msp430x_getRegister(4));
+    TEST_ASSERT_EQUAL_UINT64(3, msp430x_getCycles());
+
+    /*** PUSHM.A, POPM.A ***/
+    TEST_ASSERT_TRUE(msp430x_step());
+    TEST_ASSERT_EQUAL_HEX32(MSP430X_TEST_STACK_ADDRESS - 8, msp430x_getRegister(MSP430X_REGISTER_SP));
+    TEST_ASSERT_EQUAL_HEX8(0x8A, msp430x_readByte(MSP430X_TEST_STACK_ADDRESS - 8));
+    TEST_ASSERT_EQUAL_HEX8(0x02, msp430x_readByte(MSP430X_TEST_STACK_ADDRESS - 6));
+    TEST_ASSERT_EQUAL_HEX8(0x0A, msp430x_readByte(MSP430X_TEST_STACK_ADDRESS - 2));
+    TEST_ASSERT_EQUAL_UINT64(9, msp430x_getCycles());
+    TEST_ASSERT_TRUE(msp430x_step());
+    TEST_ASSERT_EQUAL_HEX32(0x2468A, msp430x_getRegister(6));
+    TEST_ASSERT_EQUAL_HEX32(0xABCDE, msp430x_getRegister(7));
+    TEST_ASSERT_EQUAL_HEX32(MSP430X_TEST_STACK_ADDRESS, msp430x_getRegister(MSP430X_REGISTER_SP));
+    TEST_ASSERT_EQUAL_UINT64(15, msp430x_getCycles());
+
+    /********************************************************************************
+     * Test 2: Extended Instructions
+     ********************************************************************************/
+
+    /*** Repeated Word Rotate (Clears Bits 19:16) ***/
+    TEST_ASSERT_TRUE(msp430x_step());
+    TEST_ASSERT_EQUAL_HEX32(0x0468, msp430x_getRegister(6));
+    TEST_ASSERT_EQUAL_HEX32(MSP430X_SR_C, msp430x_getRegister(MSP430X_REGISTER_SR) & MSP430X_SR_C);
+    TEST_ASSERT_EQUAL_UINT64(19, msp430x_getCycles());
+
+    /*** 20-Bit Store Above 64 KB ***/
+    TEST_ASSERT_TRUE(msp430x_step());
+    TEST_ASSERT_EQUAL_HEX8(0x8A, msp430x_readByte(0x12000));
+    TEST_ASSERT_EQUAL_HEX8(0x46, msp430x_readByte(0x12001));
+    TEST_ASSERT_EQUAL_HEX8(0x02, msp430x_readByte(0x12002));
+    TEST_ASSERT_EQUAL_HEX8(0x00, msp430x_readByte(0x12003));
+    TEST_ASSERT_EQUAL_UINT64(23, msp430x_getCycles());
+}
+
+TEST(msp430x_test, formatI)
+{
+    static const uint16_t code[] =
+    {
+        0x4034, 0x1234, // MOV #0x1234,R4
+        0x4482, 0x1C00, // MOV R4,&0x1C00
+        0x5034, 0xEDCC, // ADD #0xEDCC,R4
+        0x9314          // CMP #1,R4
+    };
+
+    /********************************************************************************
+     * Test 1: Results, Flags And Cycles
+     ********************************************************************************/
+
+    /*** Set Up ***/
+    msp430xTest_writeCode(MSP430X_TEST_CODE_ADDRESS, code, sizeof(code) / sizeof(code[0]));
+
+    /*** MOV Immediate ***/
+    TEST_ASSERT_TRUE(msp430x_step());
+    TEST_ASSERT_EQUAL_HEX32(0x1234, msp430x_getRegister(4));
+    TEST_ASSERT_EQUAL_UINT64(2, msp430x_getCycles());
+
+    /*** MOV Absolute ***/
+    TEST_ASSERT_TRUE(msp430x_step());
+    TEST_ASSERT_EQUAL_HEX16(0x1234, HW_MEMMAP_REG16(0x1C00));
+    TEST_ASSERT_EQUAL_UINT64(5, msp430x_getCycles());
+
+    /*** ADD Carry And Zero ***/
+    TEST_ASSERT_TRUE(msp430x_step());
+    TEST_ASSERT_EQUAL_HEX32(0, msp430x_getRegister(4));
+    TEST_ASSERT_EQUAL_HEX32(MSP430X_SR_C | MSP430X_SR_Z, msp430x_getRegister(MSP430X_REGISTER_SR));
+    TEST_ASSERT_EQUAL_UINT64(7, msp430x_getCycles());
+
+    /*** CMP Constant Generator Borrow And Negative ***/
+    TEST_ASSERT_TRUE(msp430x_step());
+    TEST_ASSERT_EQUAL_HEX32(0, msp430x_getRegister(4));
+    TEST_ASSERT_EQUAL_HEX32(MSP430X_SR_N, msp430x_getRegister(MSP430X_REGISTER_SR));
+    TEST_ASSERT_EQUAL_UINT64(8, msp430x_getCycles());
+
+    /********************************************************************************
+     * Test 2: FRAM Wait States
+     ********************************************************************************/
+
+    /*** 1 Wait State On Cache Miss Only ***/
+    msp430x_reset();
+    msp430x_setRegister(MSP430X_REGISTER_PC, MSP430X_TEST_CODE_ADDRESS);
+    HW_MEMMAP_REG16(FRAM_BASE + OFS_FRCTL0) = NWAITS_1;
+    TEST_ASSERT_TRUE(msp430x_step());
+    TEST_ASSERT_EQUAL_UINT64(11, msp430x_getCycles());
+    TEST_ASSERT_TRUE(msp430x_step());
+    TEST_ASSERT_EQUAL_UINT64(14, msp430x_getCycles());
+}
+
+TEST(msp430x_test, interrupt)
+{
+    const msp430x_vector_t *vector;
+    static const uint16_t code[] = {0xD232, 0x3FFF}; // BIS #GIE,SR, JMP $
+    static const uint16_t handler[] = {0x1300}; // RETI
+
+    /********************************************************************************
+     * Test 1: Acceptance And RETI
+     ********************************************************************************/
+
+    /*** Set Up ***/
+    msp430xTest_writeCode(MSP430X_TEST_CODE_ADDRESS, code, sizeof(code) / sizeof(code[0]));
+    msp430xTest_writeCode(0x4420, handler, sizeof(handler) / sizeof(handler[0]));
+    msp430x_writeByte(MSP430X_VECTOR_ADDRESS(USCI_A1_VECTOR), 0x20);
+    msp430x_writeByte(MSP430X_VECTOR_ADDRESS(USCI_A1_VECTOR) + 1, 0x44);
+
+    /*** Masked Until GIE ***/
+    msp430x_setInterruptRequest(USCI_A1_VECTOR, true);
+    TEST_ASSERT_TRUE(msp430x_step());
+    TEST_ASSERT_EQUAL_HEX32(0x4402, msp430x_getRegister(MSP430X_REGISTER_PC));
+    TEST_ASSERT_EQUAL_UINT64(1, msp430x_getCycles());
+
+    /*** Acceptance ***/
+    TEST_ASSERT_TRUE(msp430x_step());
+    TEST_ASSERT_EQUAL_HEX32(0x4420, msp430x_getRegister(MSP430X_REGISTER_PC));
+    TEST_ASSERT_EQUAL_HEX32(0, msp430x_getRegister(MSP430X_REGISTER_SR));
+    TEST_ASSERT_EQUAL_HEX32(MSP430X_TEST_STACK_ADDRESS - 4, msp430x_getRegister(MSP430X_REGISTER_SP));
+    TEST_ASSERT_EQUAL_UINT64(7, msp430x_getCycles());
+
+    /*** RETI ***/
+    msp430x_setInterruptRequest(USCI_A1_VECTOR, false);
+    TEST_ASSERT_TRUE(msp430x_step());
+    TEST_ASSERT_EQUAL_HEX32(0x4402, msp430x_getRegister(MSP430X_REGISTER_PC));
+    TEST_ASSERT_EQUAL_HEX32(MSP430X_SR_GIE, msp430x_getRegister(MSP430X_REGISTER_SR));
+    TEST_ASSERT_EQUAL_HEX32(MSP430X_TEST_STACK_ADDRESS, msp430x_getRegister(MSP430X_REGISTER_SP));
+    TEST_ASSERT_EQUAL_UINT64(12, msp430x_getCycles());
+
+    /*** Vector Statistics ***/
+    vector = msp430x_getVector(USCI_A1_VECTOR);
+    TEST_ASSERT_EQUAL_UINT64(1, vector->count);
+    TEST_ASSERT_EQUAL_UINT64(11, vector->cycles);
+    TEST_ASSERT_EQUAL_UINT64(1, vector->maximumLatencyCycles);
+}
+
+/****************************************************************************************************
+ * Test Group Runner
+ ****************************************************************************************************/
+
+TEST_GROUP_RUNNER(msp430x_test)
+{
+    RUN_TEST_CASE(msp430x_test, callReturn)
+    RUN_TEST_CASE(msp430x_test, extended)
+    RUN_TEST_CASE(msp430x_test, formatI)
+    RUN_TEST_CASE(msp430x_test, interrupt)
+}
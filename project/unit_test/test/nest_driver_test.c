@@ -0,0 +1,626 @@
+/****************************************************************************************************
+ * FILE:    nest_driver_test.c
+ * BRIEF:   Nest Driver Test Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define NEST_DRIVER_TEST_BAUD_RATE       (921600)  // 86 Cycles Per Character At 8 MHz
+#define NEST_DRIVER_TEST_CHARACTER_BITS  (10)      // Start, 8 Data, Stop
+#define NEST_DRIVER_TEST_CHARACTER_COUNT (1000)
+#define NEST_DRIVER_TEST_MCLK            (8000000)
+#define NEST_DRIVER_TEST_STRETCH_CYCLES  (2000)    // Added To Each LED Pin Write: Stands In For A Long Low Priority Handler
+#define NEST_DRIVER_TEST_TIMER_PERIOD    (5000)    // Cycles Between LED Timer Interrupts
+
+/*** Per-Call Costs (MCLK Cycles), Measured On The Release Image (DRIVER_CONFIG_DEBUG 0) By The Emulator:
+     make emulator; build/emulator.exe -e ELF -b 921600 -i 'led -l0 -o5 -O5\n...' -x 43:3000:0x036E:2 -p ***/
+#define NEST_DRIVER_TEST_ENTRY_CYCLES        (45)  // LED Timer, Acceptance To EINT ("Interrupts Disabled In interruptHandler_timer0A1Vector (Entry)")
+#define NEST_DRIVER_TEST_BODY_CYCLES         (351) // LED Timer, Interrupts Enabled (ledDriver_timerInterruptHandler Maximum)
+#define NEST_DRIVER_TEST_EXIT_CYCLES         (46)  // LED Timer, DINT To RETI ("Interrupts Disabled In interruptHandler_timer0A1Vector")
+#define NEST_DRIVER_TEST_POLL_CYCLES         (10)  // Main Loop ("Interrupts Disabled In powerDriver_idle")
+#define NEST_DRIVER_TEST_RECEIVE_CYCLES      (77)  // USCI_A1, Acceptance To RETI (Vector 42 Maximum)
+#define NEST_DRIVER_TEST_RECEIVE_READ_CYCLES (30)  // USCI_A1, Acceptance To The UCA1RXBUF Read ("UART: ... Handler")
+
+#define NEST_DRIVER_TEST_CHARACTER_CYCLES(BAUD_RATE) ((NEST_DRIVER_TEST_MCLK * NEST_DRIVER_TEST_CHARACTER_BITS) / (BAUD_RATE)) // 86 (86.8) At 921600
+#define NEST_DRIVER_TEST_LED_OUT          ((uint32_t)(GPIO_PORT_TO_BASE[DRIVER_CONFIG_LED_GPIO_LED_1_PORT] + OFS_PAOUT))
+#define NEST_DRIVER_TEST_LOG_LENGTH       (NEST_DRIVER_WORK_COUNT * 2)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "button_driver.h"
+#include "button_driver_test.h"
+#include "cli_callback_test.h"
+#include "driver_config.h"
+#include "gpio.h"
+#include "gpio_model.h"
+#include "hw_memmap.h"
+#include "interrupt_handler.h"
+#include "intrinsics.h"
+#include "led_driver.h"
+#include "led_driver_test.h"
+#include "msp430fr6989.h"
+#include "nest_driver.h"
+#include "nest_driver_test.h"
+#include "power_driver.h"
+#include "profile_driver.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "system.h"
+#include "unity_fixture.h"
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+/*** Deferred Work ***/
+static char nestDriverTest_log[NEST_DRIVER_TEST_LOG_LENGTH + 1];
+static size_t nestDriverTest_logLength;
+
+/*** Preemption ***/
+static bool nestDriverTest_preempted;
+static uint16_t nestDriverTest_preemptEnable; // TA0CCTL1 While Preempted
+static uint8_t nestDriverTest_preemptDepth;   // nestDriver_depth While Preempted
+static uint8_t nestDriverTest_lowPowerModeCount;
+
+/*** Postponement (While Nested) ***/
+static bool nestDriverTest_postponeRaised, nestDriverTest_postponedTimerTaken;
+static uint8_t nestDriverTest_postponedButtonState;
+static uint16_t nestDriverTest_postponedPortEnable, nestDriverTest_postponedTimerEnable; // P1IE/P2IE, TA0CCTL2
+
+/*** Receiver Model ***/
+static uint32_t nestDriverTest_arrivalCount, nestDriverTest_overrunCount, nestDriverTest_readCount;
+static uint32_t nestDriverTest_baudRate;
+static uint32_t nestDriverTest_cycles;
+static bool nestDriverTest_ledTimerEntered; // Between The TA0IV Read And The Exit Window
+static bool nestDriverTest_ledTimerNested;  // Interrupts Enabled Since The TA0IV Read
+static bool nestDriverTest_receiving;       // In The USCI_A1 Vector
+static uint32_t nestDriverTest_stretchCycles;
+static bool nestDriverTest_unread;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void nestDriverTest_advance(uint32_t Cycles);
+static void nestDriverTest_blockingTimer0A1Vector(void);
+static bool nestDriverTest_lowPowerModeHandler(void);
+static void nestDriverTest_postponeAccessCallback(const uint32_t Address);
+static void nestDriverTest_preemptAccessCallback(const uint32_t Address);
+static void nestDriverTest_receiverAccessCallback(const uint32_t Address);
+static uint32_t nestDriverTest_run(const intrinsics_interruptHandler_t TimerVector, const uint32_t BaudRate);
+static void nestDriverTest_workA(void);
+static void nestDriverTest_workB(void);
+static void nestDriverTest_workC(void);
+
+/****************************************************************************************************
+ * Function Definitions
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   nestDriverTest_advance
+ * BRIEF:   Advance
+ * RETURN:  Returns Nothing
+ * ARG:     Cycles: Simulated MCLK Cycles
+ * NOTE:    Steps One Cycle At A Time, So A Character Arriving During A Long Stretch Is Taken As Soon
+ *          As Interrupts Are Enabled, And Mirrors The Cycle Count Into The Profile Timer
+ ****************************************************************************************************/
+static void nestDriverTest_advance(uint32_t Cycles)
+{
+    while(Cycles > 0)
+    {
+        /*** Time ***/
+        Cycles--;
+        nestDriverTest_cycles++;
+        HW_MEMMAP_REG16(DRIVER_CONFIG_PROFILE_TIMER + OFS_TBxR) = (uint16_t)nestDriverTest_cycles;
+
+        /*** Characters Arrive Every Character Time; One Arriving Over An Unread One Is An Overrun ***/
+        while((nestDriverTest_arrivalCount < NEST_DRIVER_TEST_CHARACTER_COUNT) &&
+              (nestDriverTest_cycles >= (uint32_t)(((uint64_t)(nestDriverTest_arrivalCount + 1) * NEST_DRIVER_TEST_MCLK * NEST_DRIVER_TEST_CHARACTER_BITS) / nestDriverTest_baudRate)))
+        {
+            if(nestDriverTest_unread)
+                nestDriverTest_overrunCount++;
+            HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxRXBUF) = 'x';
+            nestDriverTest_unread = true;
+            nestDriverTest_arrivalCount++;
+        }
+
+        /*** Receive Interrupt Taken When Enabled (Cleared While Any Unnested Handler Runs) ***/
+        if(nestDriverTest_unread && intrinsics_getInterruptsEnabled() && ((HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxIE) & UCRXIE) == UCRXIE))
+        {
+            HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxIFG) |= UCRXIFG;
+            nestDriverTest_receiving = true;
+            (void)intrinsics_callInterruptHandler(interruptHandler_usciA1Vector);
+            nestDriverTest_receiving = false;
+            HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxIFG) &= (uint16_t)~UCRXIFG;
+        }
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   nestDriverTest_blockingTimer0A1Vector
+ * BRIEF:   Blocking Timer A0, Capture/Compare Register 1-4 Vector
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ * NOTE:    interruptHandler_timer0A1Vector Without Nesting (Interrupts Disabled Throughout), For The
+ *          Control Case
+ ****************************************************************************************************/
+static void nestDriverTest_blockingTimer0A1Vector(void)
+{
+    /*** Handle Interrupt ***/
+    ledDriver_timerInterruptHandler((uint16_t)TA0IV);
+}
+
+/****************************************************************************************************
+ * FUNCT:   nestDriverTest_lowPowerModeHandler
+ * BRIEF:   Low Power Mode Handler
+ * RETURN:  bool: Interrupt Delivered (true) Or Nothing Left To Wake The CPU (false)
+ * ARG:     No Arguments
+ * NOTE:    Delivers The LED Timer Interrupt Once; Being Called Again Means The CPU Slept On
+ ****************************************************************************************************/
+static bool nestDriverTest_lowPowerModeHandler(void)
+{
+    /*** Deliver Once ***/
+    if(++nestDriverTest_lowPowerModeCount > 1)
+        return false;
+    HW_MEMMAP_REG16(DRIVER_CONFIG_LED_TIMER + OFS_TAxIV) = TA0IV_TACCR1;
+    return intrinsics_callInterruptHandler(interruptHandler_timer0A1Vector);
+}
+
+/****************************************************************************************************
+ * FUNCT:   nestDriverTest_postponeAccessCallback
+ * BRIEF:   Postpone Access Callback
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Accessed Address
+ * NOTE:    At The LED Pin Write, If Interrupts Are Enabled There, Raises Two More Low Priority Sources:
+ *          Button 1 (Port 1 Vector, Through The GPIO Model) And Timer A0 Capture/Compare Register 2
+ *          (Timer A0 Vector Again), Then Records What They Left Behind
+ ****************************************************************************************************/
+static void nestDriverTest_postponeAccessCallback(const uint32_t Address)
+{
+    /*** Error Check ***/
+    if((Address != NEST_DRIVER_TEST_LED_OUT) || nestDriverTest_postponeRaised || !intrinsics_getInterruptsEnabled())
+        return;
+
+    /*** Raise ***/
+    nestDriverTest_postponeRaised = true;
+    gpioModel_setPins(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT, DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PIN, false); // Press
+    HW_MEMMAP_REG16(DRIVER_CONFIG_LED_TIMER + OFS_TAxCCTL2) |= CCIFG;
+    HW_MEMMAP_REG16(DRIVER_CONFIG_LED_TIMER + OFS_TAxIV) = TA0IV_TACCR2;
+    nestDriverTest_postponedTimerTaken = intrinsics_callInterruptHandler(interruptHandler_timer0A1Vector);
+
+    /*** Record ***/
+    nestDriverTest_postponedButtonState = buttonDriver_state;
+    nestDriverTest_postponedPortEnable = HW_MEMMAP_REG16(GPIO_PORT_TO_BASE[DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT] + OFS_PAIE);
+    nestDriverTest_postponedTimerEnable = HW_MEMMAP_REG16(DRIVER_CONFIG_LED_TIMER + OFS_TAxCCTL2);
+}
+
+/****************************************************************************************************
+ * FUNCT:   nestDriverTest_preemptAccessCallback
+ * BRIEF:   Preempt Access Callback
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Accessed Address
+ * NOTE:    Delivers One Received Character At The LED Pin Write, If Interrupts Are Enabled There
+ ****************************************************************************************************/
+static void nestDriverTest_preemptAccessCallback(const uint32_t Address)
+{
+    /*** Error Check ***/
+    if((Address != NEST_DRIVER_TEST_LED_OUT) || nestDriverTest_preempted || !intrinsics_getInterruptsEnabled())
+        return;
+
+    /*** Preempt ***/
+    nestDriverTest_preemptEnable = HW_MEMMAP_REG16(DRIVER_CONFIG_LED_TIMER + OFS_TAxCCTL1);
+    nestDriverTest_preemptDepth = nestDriver_depth;
+    HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxRXBUF) = 'x';
+    HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxIV) = USCI_UART_UCRXIFG;
+    nestDriverTest_preempted = intrinsics_callInterruptHandler(interruptHandler_usciA1Vector);
+    HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxIV) = USCI_NONE;
+}
+
+/****************************************************************************************************
+ * FUNCT:   nestDriverTest_receiverAccessCallback
+ * BRIEF:   Receiver Access Callback
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Accessed Address
+ * NOTE:    Time Is Charged Per Call, Not Per Access: Each Handler Window Costs Its Cycles At The Access
+ *          That Marks It (Interrupts Disabled Or Enabled As In The Handler), Everything Else Is Free;
+ *          The LED Pin Write Also Costs nestDriverTest_stretchCycles; The Receive Buffer Is Freed Once
+ *          NEST_DRIVER_TEST_RECEIVE_READ_CYCLES Into The Handler
+ ****************************************************************************************************/
+static void nestDriverTest_receiverAccessCallback(const uint32_t Address)
+{
+    /*** LED Timer: Entry Window (TA0IV), Body (Pin Write), Exit Window (Profile Timer Read After DINT) ***/
+    if(nestDriverTest_ledTimerEntered && intrinsics_getInterruptsEnabled())
+        nestDriverTest_ledTimerNested = true;
+    if(Address == (uint32_t)(DRIVER_CONFIG_LED_TIMER + OFS_TAxIV))
+    {
+        nestDriverTest_ledTimerEntered = true;
+        nestDriverTest_ledTimerNested = false;
+        nestDriverTest_advance(NEST_DRIVER_TEST_ENTRY_CYCLES);
+    }
+    else if(Address == NEST_DRIVER_TEST_LED_OUT)
+    {
+        nestDriverTest_advance(NEST_DRIVER_TEST_BODY_CYCLES + nestDriverTest_stretchCycles);
+    }
+    else if((Address == (uint32_t)(DRIVER_CONFIG_PROFILE_TIMER + OFS_TBxR)) && nestDriverTest_ledTimerNested && !nestDriverTest_receiving && !intrinsics_getInterruptsEnabled())
+    {
+        nestDriverTest_ledTimerEntered = false;
+        nestDriverTest_ledTimerNested = false;
+        nestDriverTest_advance(NEST_DRIVER_TEST_EXIT_CYCLES);
+    }
+
+    /*** USCI_A1: Up To The Receive Buffer Read, Which Frees It, Then The Rest ***/
+    else if((Address == (uint32_t)(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxRXBUF)) && nestDriverTest_unread)
+    {
+        nestDriverTest_advance(NEST_DRIVER_TEST_RECEIVE_READ_CYCLES);
+        nestDriverTest_unread = false;
+        nestDriverTest_readCount++;
+        nestDriverTest_advance(NEST_DRIVER_TEST_RECEIVE_CYCLES - NEST_DRIVER_TEST_RECEIVE_READ_CYCLES);
+    }
+
+    /*** Main Loop ***/
+    else if(Address == (uint32_t)(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxSTATW))
+    {
+        nestDriverTest_advance(NEST_DRIVER_TEST_POLL_CYCLES);
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   nestDriverTest_run
+ * BRIEF:   Run
+ * RETURN:  uint32_t: Overrun Count
+ * ARG:     TimerVector: LED Timer Vector, Taken Every NEST_DRIVER_TEST_TIMER_PERIOD Cycles
+ * ARG:     BaudRate: Baud Rate
+ * NOTE:    Receives NEST_DRIVER_TEST_CHARACTER_COUNT Back-To-Back Characters While The Main Loop Idles
+ ****************************************************************************************************/
+static uint32_t nestDriverTest_run(const intrinsics_interruptHandler_t TimerVector, const uint32_t BaudRate)
+{
+    uint32_t nextTimer;
+
+    /*** Set Up ***/
+    nestDriverTest_arrivalCount = 0;
+    nestDriverTest_overrunCount = 0;
+    nestDriverTest_readCount = 0;
+    nestDriverTest_baudRate = BaudRate;
+    nestDriverTest_cycles = 0;
+    nestDriverTest_ledTimerEntered = false;
+    nestDriverTest_ledTimerNested = false;
+    nestDriverTest_receiving = false;
+    nestDriverTest_stretchCycles = NEST_DRIVER_TEST_STRETCH_CYCLES;
+    nestDriverTest_unread = false;
+    nextTimer = NEST_DRIVER_TEST_TIMER_PERIOD;
+    profileDriver_reset();
+    (void)hwMemmap_registerAccessCallback(nestDriverTest_receiverAccessCallback);
+    __enable_interrupt();
+
+    /*** Run ***/
+    while((nestDriverTest_arrivalCount < NEST_DRIVER_TEST_CHARACTER_COUNT) || nestDriverTest_unread)
+    {
+        /* Main Loop (Every Access Is A Yield Point) */
+        (void)HWREG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxSTATW);
+
+        /* LED Timer */
+        if(nestDriverTest_cycles >= nextTimer)
+        {
+            HW_MEMMAP_REG16(DRIVER_CONFIG_LED_TIMER + OFS_TAxIV) = TA0IV_TACCR1;
+            TEST_ASSERT_TRUE(intrinsics_callInterruptHandler(TimerVector));
+            HW_MEMMAP_REG16(DRIVER_CONFIG_LED_TIMER + OFS_TAxIV) = TA0IV_NONE;
+            nextTimer += NEST_DRIVER_TEST_TIMER_PERIOD;
+        }
+    }
+
+    /*** Tear Down ***/
+    hwMemmap_unregisterAccessCallback(nestDriverTest_receiverAccessCallback);
+
+    return nestDriverTest_overrunCount;
+}
+
+/****************************************************************************************************
+ * FUNCT:   nestDriverTest_workA
+ * BRIEF:   Work A
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ ****************************************************************************************************/
+static void nestDriverTest_workA(void)
+{
+    /*** Log ***/
+    if(nestDriverTest_logLength < NEST_DRIVER_TEST_LOG_LENGTH)
+        nestDriverTest_log[nestDriverTest_logLength++] = 'A';
+}
+
+/****************************************************************************************************
+ * FUNCT:   nestDriverTest_workB
+ * BRIEF:   Work B
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ * NOTE:    Defers Work A Again, Which Runs In The Same Tick
+ ****************************************************************************************************/
+static void nestDriverTest_workB(void)
+{
+    /*** Log ***/
+    if(nestDriverTest_logLength < NEST_DRIVER_TEST_LOG_LENGTH)
+        nestDriverTest_log[nestDriverTest_logLength++] = 'B';
+    (void)nestDriver_defer(nestDriverTest_workA);
+}
+
+/****************************************************************************************************
+ * FUNCT:   nestDriverTest_workC
+ * BRIEF:   Work C
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ ****************************************************************************************************/
+static void nestDriverTest_workC(void)
+{
+    /*** Log ***/
+    if(nestDriverTest_logLength < NEST_DRIVER_TEST_LOG_LENGTH)
+        nestDriverTest_log[nestDriverTest_logLength++] = 'C';
+}
+
+/****************************************************************************************************
+ * Test Group
+ ****************************************************************************************************/
+
+TEST_GROUP(nest_driver_test);
+
+/****************************************************************************************************
+ * Test Setup And Teardown
+ ****************************************************************************************************/
+
+TEST_SETUP(nest_driver_test)
+{
+    /*** Set Up ***/
+    /* Simulation */
+    hwMemmap_init();
+
+    /* Application */
+    system_init();
+
+    /* Test */
+    cliCallbackTest_init();
+    nestDriverTest_logLength = 0;
+    nestDriverTest_log[0] = '\0';
+    nestDriverTest_preempted = false;
+    nestDriverTest_preemptEnable = 0;
+    nestDriverTest_preemptDepth = 0;
+    nestDriverTest_lowPowerModeCount = 0;
+    nestDriverTest_postponeRaised = false;
+    nestDriverTest_postponedTimerTaken = false;
+}
+
+TEST_TEAR_DOWN(nest_driver_test)
+{
+    /*** Tear Down ***/
+    hwMemmap_unregisterAccessCallback(nestDriverTest_postponeAccessCallback);
+    hwMemmap_unregisterAccessCallback(nestDriverTest_preemptAccessCallback);
+    hwMemmap_unregisterAccessCallback(nestDriverTest_receiverAccessCallback);
+    intrinsics_setLowPowerModeHandler(NULL);
+}
+
+/****************************************************************************************************
+ * Tests
+ ****************************************************************************************************/
+
+TEST(nest_driver_test, defer)
+{
+    size_t i;
+
+    /********************************************************************************
+     * Test 1: Error Check
+     ********************************************************************************/
+
+    TEST_ASSERT_FALSE(nestDriver_defer(NULL));
+    TEST_ASSERT_EQUAL_UINT8(nestDriver_workTail, nestDriver_workHead);
+
+    /********************************************************************************
+     * Test 2: Run In Order, Once Each
+     ********************************************************************************/
+
+    /* Defer */
+    TEST_ASSERT_TRUE(nestDriver_defer(nestDriverTest_workC));
+    TEST_ASSERT_TRUE(nestDriver_defer(nestDriverTest_workB));
+    TEST_ASSERT_TRUE(nestDriver_defer(nestDriverTest_workC)); // Already Queued
+    TEST_ASSERT_EQUAL_STRING("", nestDriverTest_log);
+
+    /* Tick (Work B Defers Work A) */
+    nestDriver_tick();
+    nestDriverTest_log[nestDriverTest_logLength] = '\0';
+    TEST_ASSERT_EQUAL_STRING("CBA", nestDriverTest_log);
+    TEST_ASSERT_EQUAL_UINT8(nestDriver_workTail, nestDriver_workHead);
+
+    /********************************************************************************
+     * Test 3: Queue Full
+     ********************************************************************************/
+
+    /* Fill (One Slot Stays Empty) */
+    nestDriver_workHead = 0;
+    nestDriver_workTail = 0;
+    for(i = 0; i < (NEST_DRIVER_WORK_COUNT - 2); i++)
+        nestDriver_work[nestDriver_workHead++] = nestDriverTest_workA;
+    TEST_ASSERT_TRUE(nestDriver_defer(nestDriverTest_workC));
+    TEST_ASSERT_FALSE(nestDriver_defer(nestDriverTest_workB));
+    TEST_ASSERT_TRUE(nestDriver_defer(nestDriverTest_workC)); // Already Queued
+
+    /* Interrupt State Restored */
+    TEST_ASSERT_TRUE(intrinsics_getInterruptsEnabled());
+}
+
+TEST(nest_driver_test, enterExit)
+{
+    nestDriver_context_t context;
+    uint16_t enableAddress;
+
+    /********************************************************************************
+     * Test 1: Interrupts Enabled While Nested, Source Left Alone
+     ********************************************************************************/
+
+    /* Enter (Interrupt Handler: Interrupts Disabled) */
+    enableAddress = DRIVER_CONFIG_LED_TIMER + OFS_TAxCCTL1;
+    HWREG16(enableAddress) = CCIE | OUTMOD_4;
+    __disable_interrupt();
+    nestDriver_enter(&context, profileDriver_getCount());
+    TEST_ASSERT_EQUAL_UINT8(1, nestDriver_depth);
+    TEST_ASSERT_EQUAL_HEX16(CCIE | OUTMOD_4, HWREG16(enableAddress));
+    TEST_ASSERT_TRUE(intrinsics_getInterruptsEnabled());
+
+    /* Exit */
+    TEST_ASSERT_FALSE(nestDriver_exit(&context));
+    TEST_ASSERT_EQUAL_UINT8(0, nestDriver_depth);
+    TEST_ASSERT_EQUAL_HEX16(CCIE | OUTMOD_4, HWREG16(enableAddress));
+    TEST_ASSERT_FALSE(intrinsics_getInterruptsEnabled());
+
+    /********************************************************************************
+     * Test 2: Priority Mask Lifted By The Exit
+     ********************************************************************************/
+
+    nestDriver_enter(&context, profileDriver_getCount());
+    TEST_ASSERT_TRUE(nestDriver_postpone());
+    TEST_ASSERT_TRUE(nestDriver_masked);
+    TEST_ASSERT_EQUAL_HEX16(OUTMOD_4, HWREG16(enableAddress));
+    TEST_ASSERT_FALSE(nestDriver_exit(&context));
+    TEST_ASSERT_FALSE(nestDriver_masked);
+    TEST_ASSERT_EQUAL_HEX16(CCIE | OUTMOD_4, HWREG16(enableAddress));
+
+    /********************************************************************************
+     * Test 3: Wake Requested While Nested
+     ********************************************************************************/
+
+    nestDriver_enter(&context, profileDriver_getCount());
+    powerDriver_recordActivity();
+    TEST_ASSERT_TRUE(nestDriver_exit(&context));
+}
+
+TEST(nest_driver_test, postpone)
+{
+    uint16_t baseAddress, pins;
+    bool on;
+
+    /********************************************************************************
+     * Test 1: Not Nested: Handled Now
+     ********************************************************************************/
+
+    TEST_ASSERT_FALSE(nestDriver_postpone());
+
+    /********************************************************************************
+     * Test 2: Low Priority Sources Firing Inside The Nested LED Timer Handler Wait
+     ********************************************************************************/
+
+    /* Set Up */
+    baseAddress = GPIO_PORT_TO_BASE[DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT];
+    pins = DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PIN | DRIVER_CONFIG_BUTTON_GPIO_BUTTON_2_PIN;
+    TEST_ASSERT_TRUE(ledDriver_enableBlink(LED_DRIVER_LED_1, 500, 250));
+    TEST_ASSERT_TRUE(ledDriver_enableBlink(LED_DRIVER_LED_2, 500, 250));
+    TEST_ASSERT_TRUE(gpioModel_setVectorHandler(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT, interruptHandler_port1Vector));
+    gpioModel_setPins(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT, (uint8_t)pins, true); // Pulled Up
+    (void)hwMemmap_registerAccessCallback(nestDriverTest_postponeAccessCallback);
+
+    /* Interrupt */
+    TA0IV = TA0IV_TACCR1;
+    TEST_ASSERT_TRUE(intrinsics_callInterruptHandler(interruptHandler_timer0A1Vector));
+    hwMemmap_unregisterAccessCallback(nestDriverTest_postponeAccessCallback);
+
+    /* Both Taken While Nested, Neither Handled: Every Low Priority Source Masked */
+    TEST_ASSERT_TRUE(nestDriverTest_postponeRaised);
+    TEST_ASSERT_TRUE(nestDriverTest_postponedTimerTaken);
+    TEST_ASSERT_EQUAL_HEX8(0x00, nestDriverTest_postponedButtonState);
+    TEST_ASSERT_EQUAL_HEX16(0, nestDriverTest_postponedPortEnable);
+    TEST_ASSERT_EQUAL_HEX16(0, nestDriverTest_postponedTimerEnable & CCIE);
+
+    /* Unmasked On Exit, Flags Still Set */
+    TEST_ASSERT_EQUAL_HEX16(pins, HWREG16(baseAddress + OFS_PAIE) & pins);
+    TEST_ASSERT_EQUAL_HEX16(DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PIN, HWREG16(baseAddress + OFS_PAIFG) & pins);
+    TEST_ASSERT_EQUAL_HEX16(CCIE, HWREG16(DRIVER_CONFIG_LED_TIMER + OFS_TAxCCTL1) & CCIE);
+    TEST_ASSERT_EQUAL_HEX16(CCIE | CCIFG, HWREG16(DRIVER_CONFIG_LED_TIMER + OFS_TAxCCTL2) & (CCIE | CCIFG));
+    TEST_ASSERT_TRUE(intrinsics_getInterruptsEnabled());
+
+    /* Taken Again After RETI And Handled (TA0IV Still Presents Capture/Compare Register 2) */
+    gpioModel_service();
+    TEST_ASSERT_EQUAL_HEX8(BUTTON_DRIVER_BUTTON_1, buttonDriver_state);
+    on = ledDriver_ledBlink[LED_DRIVER_LED_2].on;
+    TEST_ASSERT_TRUE(intrinsics_callInterruptHandler(interruptHandler_timer0A1Vector));
+    TEST_ASSERT_NOT_EQUAL(on, ledDriver_ledBlink[LED_DRIVER_LED_2].on);
+}
+
+TEST(nest_driver_test, receiver)
+{
+    profileDriver_statistics_t statistics;
+
+    /********************************************************************************
+     * Test 1: Nested LED Timer: No Overruns At 921600 Baud
+     ********************************************************************************/
+
+    /* Run */
+    TEST_ASSERT_TRUE(ledDriver_enableBlink(LED_DRIVER_LED_1, 500, 250));
+    TEST_ASSERT_EQUAL_UINT32(0, nestDriverTest_run(interruptHandler_timer0A1Vector, NEST_DRIVER_TEST_BAUD_RATE));
+    TEST_ASSERT_EQUAL_UINT32(NEST_DRIVER_TEST_CHARACTER_COUNT, nestDriverTest_readCount);
+    profileDriver_getStatistics(PROFILE_DRIVER_VECTOR_USCI_A1, &statistics);
+    TEST_ASSERT_EQUAL_UINT32(NEST_DRIVER_TEST_CHARACTER_COUNT, statistics.count);
+
+    /* LED Timer Ran Longer Than A Character Time, Interrupts Were Never Disabled That Long (Entry Window The Longest Recorded) */
+    profileDriver_getStatistics(PROFILE_DRIVER_VECTOR_TIMER0_A1, &statistics);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, statistics.count);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT16(NEST_DRIVER_TEST_STRETCH_CYCLES, statistics.maximum);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT16(NEST_DRIVER_TEST_ENTRY_CYCLES, profileDriver_getDisabledMaximum());
+    TEST_ASSERT_LESS_THAN_UINT16(NEST_DRIVER_TEST_CHARACTER_CYCLES(NEST_DRIVER_TEST_BAUD_RATE), profileDriver_getDisabledMaximum());
+
+    /********************************************************************************
+     * Test 2: Control: Unnested LED Timer Overruns
+     ********************************************************************************/
+
+    TEST_ASSERT_GREATER_THAN_UINT32(0, nestDriverTest_run(nestDriverTest_blockingTimer0A1Vector, NEST_DRIVER_TEST_BAUD_RATE));
+    TEST_ASSERT_LESS_THAN_UINT32(NEST_DRIVER_TEST_CHARACTER_COUNT, nestDriverTest_readCount);
+}
+
+TEST(nest_driver_test, timer0A1Vector)
+{
+    profileDriver_statistics_t statistics;
+
+    /********************************************************************************
+     * Test 1: Receive Preempts The LED Timer Handler
+     ********************************************************************************/
+
+    /* Interrupt */
+    TEST_ASSERT_TRUE(ledDriver_enableBlink(LED_DRIVER_LED_1, 500, 250));
+    (void)hwMemmap_registerAccessCallback(nestDriverTest_preemptAccessCallback);
+    TA0IV = TA0IV_TACCR1;
+    TEST_ASSERT_TRUE(intrinsics_callInterruptHandler(interruptHandler_timer0A1Vector));
+
+    /* Preempted While Nested (Source Left Enabled: A Repeat Is Postponed), Not Nested After */
+    TEST_ASSERT_TRUE(nestDriverTest_preempted);
+    TEST_ASSERT_EQUAL_UINT8(1, nestDriverTest_preemptDepth);
+    TEST_ASSERT_EQUAL_HEX16(CCIE, nestDriverTest_preemptEnable & CCIE);
+    TEST_ASSERT_EQUAL_UINT8(0, nestDriver_depth);
+    profileDriver_getStatistics(PROFILE_DRIVER_VECTOR_USCI_A1, &statistics);
+    TEST_ASSERT_EQUAL_UINT32(1, statistics.count);
+    TEST_ASSERT_TRUE(intrinsics_getInterruptsEnabled());
+
+    /********************************************************************************
+     * Test 2: Wake Requested By The Preempting Handler Wakes The CPU
+     ********************************************************************************/
+
+    /* Sleep */
+    nestDriverTest_preempted = false;
+    intrinsics_setLowPowerModeHandler(nestDriverTest_lowPowerModeHandler);
+    __bis_SR_register(LPM3_bits | GIE);
+
+    /* Woken By The First Interrupt */
+    TEST_ASSERT_TRUE(nestDriverTest_preempted);
+    TEST_ASSERT_EQUAL_UINT8(1, nestDriverTest_lowPowerModeCount);
+    TEST_ASSERT_EQUAL_HEX16(0, intrinsics_getLowPowerMode());
+}
+
+/****************************************************************************************************
+ * Test Group Runner
+ ****************************************************************************************************/
+
+TEST_GROUP_RUNNER(nest_driver_test)
+{
+    RUN_TEST_CASE(nest_driver_test, defer)
+    RUN_TEST_CASE(nest_driver_test, enterExit)
+    RUN_TEST_CASE(nest_driver_test, postpone)
+    RUN_TEST_CASE(nest_driver_test, receiver)
+    RUN_TEST_CASE(nest_driver_test, timer0A1Vector)
+}
@@ -0,0 +1,23 @@
+/****************************************************************************************************
+ * FILE:    nest_driver_test.h
+ * BRIEF:   Nest Driver Test Header File
+ ****************************************************************************************************/
+
+#ifndef NEST_DRIVER_TEST_H
+#define NEST_DRIVER_TEST_H
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "nest_driver.h"
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+extern volatile uint8_t nestDriver_workHead, nestDriver_workTail;
+extern nestDriver_work_t nestDriver_work[NEST_DRIVER_WORK_COUNT];
+
+#endif
@@ -0,0 +1,324 @@
+/****************************************************************************************************
+ * FILE:    port_driver_test.c
+ * BRIEF:   Port Driver Test Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define PORT_DRIVER_TEST_EVENT_MAXIMUM (8)
+#define PORT_DRIVER_TEST_IES(PORT)     HWREG8(GPIO_PORT_TO_BASE[PORT] + OFS_PAIES + (((PORT) & 1) ^ 1)) // Odd Port: Low Byte, Even Port: High Byte
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "driver_config.h"
+#include "gpio.h"
+#include "gpio_model.h"
+#include "hw_memmap.h"
+#include "interrupt_handler.h"
+#include "msp430fr6989.h"
+#include "port_driver.h"
+#include "port_driver_test.h"
+#include <stddef.h>
+#include <stdint.h>
+#include "system.h"
+#include "unity_fixture.h"
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static uint8_t portDriverTest_eventCount;
+static portDriver_event_t portDriverTest_events[PORT_DRIVER_TEST_EVENT_MAXIMUM];
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void portDriverTest_callback(const portDriver_event_t * const Event);
+static void portDriverTest_otherCallback(const portDriver_event_t * const Event);
+
+/****************************************************************************************************
+ * Function Definitions
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   portDriverTest_callback
+ * BRIEF:   Callback
+ * RETURN:  Returns Nothing
+ * ARG:     Event: Edge
+ ****************************************************************************************************/
+static void portDriverTest_callback(const portDriver_event_t * const Event)
+{
+    /*** Record ***/
+    if(portDriverTest_eventCount < PORT_DRIVER_TEST_EVENT_MAXIMUM)
+        portDriverTest_events[portDriverTest_eventCount++] = *Event;
+}
+
+/****************************************************************************************************
+ * FUNCT:   portDriverTest_otherCallback
+ * BRIEF:   Other Callback
+ * RETURN:  Returns Nothing
+ * ARG:     Event: Edge
+ * NOTE:    A Second Owner, For Ownership Checks; Never Dispatched
+ ****************************************************************************************************/
+static void portDriverTest_otherCallback(const portDriver_event_t * const Event)
+{
+    /*** Ignore ***/
+    (void)Event;
+}
+
+/****************************************************************************************************
+ * Test Group
+ ****************************************************************************************************/
+
+TEST_GROUP(port_driver_test);
+
+/****************************************************************************************************
+ * Test Setup And Teardown
+ ****************************************************************************************************/
+
+TEST_SETUP(port_driver_test)
+{
+    /*** Set Up ***/
+    /* Simulation */
+    hwMemmap_init();
+
+    /* Application */
+    system_init();
+
+    /* Test */
+    portDriverTest_eventCount = 0;
+}
+
+TEST_TEAR_DOWN(port_driver_test)
+{
+    /*** Tear Down ***/
+}
+
+/****************************************************************************************************
+ * Tests
+ ****************************************************************************************************/
+
+TEST(port_driver_test, init)
+{
+    uint8_t i, port;
+
+    /********************************************************************************
+     * Test 1: Initialize
+     ********************************************************************************/
+
+    /*** Subtest 1: Only The Buttons Are Owned ***/
+    for(port = 0; port < PORT_DRIVER_PORT_COUNT; port++)
+    {
+        for(i = 0; i <= PORT_DRIVER_PIN_COUNT; i++)
+        {
+            if(((port + GPIO_PORT_P1) == DRIVER_CONFIG_BUTTON_GPIO_BUTTON_1_PORT) && ((i == (P1IV_P1IFG1 >> 1)) || (i == (P1IV_P1IFG2 >> 1))))
+            {
+                TEST_ASSERT_NOT_NULL(portDriver_handler[port][i].callback);
+                TEST_ASSERT_EQUAL_HEX8(PORT_DRIVER_FLAG_TOGGLE_EDGE, portDriver_handler[port][i].flags);
+            }
+            else
+            {
+                TEST_ASSERT_NULL(portDriver_handler[port][i].callback);
+            }
+        }
+    }
+
+    /*** Subtest 2: Cleared ***/
+    portDriver_init();
+    for(port = 0; port < PORT_DRIVER_PORT_COUNT; port++)
+    {
+        for(i = 0; i <= PORT_DRIVER_PIN_COUNT; i++)
+        {
+            TEST_ASSERT_NULL(portDriver_handler[port][i].callback);
+            TEST_ASSERT_EQUAL_HEX8(PORT_DRIVER_FLAG_NONE, portDriver_handler[port][i].flags);
+        }
+    }
+}
+
+TEST(port_driver_test, interruptHandler)
+{
+    /********************************************************************************
+     * Test 1: Dispatch
+     ********************************************************************************/
+
+    /*** Set Up ***/
+    TEST_ASSERT_TRUE(portDriver_register(GPIO_PORT_P3, GPIO_PIN5, portDriverTest_callback, PORT_DRIVER_FLAG_NONE));
+    PORT_DRIVER_TEST_IES(GPIO_PORT_P3) = 0x00;
+
+    /*** Subtest 1: Owned Pin ***/
+    portDriver_interruptHandler(GPIO_PORT_P3, P3IV_P3IFG5);
+    TEST_ASSERT_EQUAL_UINT8(1, portDriverTest_eventCount);
+    TEST_ASSERT_EQUAL_UINT8(GPIO_PORT_P3, portDriverTest_events[0].port);
+    TEST_ASSERT_EQUAL_HEX8(GPIO_PIN5, portDriverTest_events[0].pin);
+    TEST_ASSERT_TRUE(portDriverTest_events[0].rising);
+    TEST_ASSERT_EQUAL_UINT16(0, portDriverTest_events[0].timestamp);
+    TEST_ASSERT_EQUAL_HEX8(0x00, PORT_DRIVER_TEST_IES(GPIO_PORT_P3)); // No Toggle
+
+    /*** Subtest 2: Falling Edge ***/
+    PORT_DRIVER_TEST_IES(GPIO_PORT_P3) = GPIO_PIN5;
+    portDriver_interruptHandler(GPIO_PORT_P3, P3IV_P3IFG5);
+    TEST_ASSERT_EQUAL_UINT8(2, portDriverTest_eventCount);
+    TEST_ASSERT_FALSE(portDriverTest_events[1].rising);
+
+    /*** Subtest 3: Unowned Pin, No Interrupt And Out Of Range Are Dropped ***/
+    portDriver_interruptHandler(GPIO_PORT_P3, P3IV_P3IFG4);
+    portDriver_interruptHandler(GPIO_PORT_P3, P3IV_NONE);
+    portDriver_interruptHandler(GPIO_PORT_P4, P4IV_P4IFG5);
+    portDriver_interruptHandler(GPIO_PORT_P3, P3IV_P3IFG7 + 2);
+    portDriver_interruptHandler(GPIO_PORT_P5, P3IV_P3IFG5);
+    portDriver_interruptHandler(GPIO_PORT_PJ, P3IV_P3IFG5);
+    TEST_ASSERT_EQUAL_UINT8(2, portDriverTest_eventCount);
+
+    /********************************************************************************
+     * Test 2: Toggle Edge
+     ********************************************************************************/
+
+    /*** Set Up ***/
+    TEST_ASSERT_TRUE(portDriver_register(GPIO_PORT_P2, GPIO_PIN7, portDriverTest_callback, PORT_DRIVER_FLAG_TOGGLE_EDGE));
+    PORT_DRIVER_TEST_IES(GPIO_PORT_P2) = GPIO_PIN7 | GPIO_PIN0;
+    portDriverTest_eventCount = 0;
+
+    /*** Subtest 1: Falling, Then Rising; Only The Pin's PxIES Bit Changes ***/
+    portDriver_interruptHandler(GPIO_PORT_P2, P2IV_P2IFG7);
+    TEST_ASSERT_FALSE(portDriverTest_events[0].rising);
+    TEST_ASSERT_EQUAL_HEX8(GPIO_PIN0, PORT_DRIVER_TEST_IES(GPIO_PORT_P2));
+    TEST_ASSERT_EQUAL_HEX8(0x00, PORT_DRIVER_TEST_IES(GPIO_PORT_P1) & GPIO_PIN7); // Port Pair Neighbour (Low Byte)
+    portDriver_interruptHandler(GPIO_PORT_P2, P2IV_P2IFG7);
+    TEST_ASSERT_TRUE(portDriverTest_events[1].rising);
+    TEST_ASSERT_EQUAL_HEX8(GPIO_PIN7 | GPIO_PIN0, PORT_DRIVER_TEST_IES(GPIO_PORT_P2));
+
+    /********************************************************************************
+     * Test 3: Timestamp
+     ********************************************************************************/
+
+    /*** Set Up ***/
+    TEST_ASSERT_TRUE(portDriver_register(GPIO_PORT_P4, GPIO_PIN0, portDriverTest_callback, PORT_DRIVER_FLAG_TIMESTAMP | PORT_DRIVER_FLAG_TOGGLE_EDGE));
+    PORT_DRIVER_TEST_IES(GPIO_PORT_P4) = 0x00;
+    portDriverTest_eventCount = 0;
+
+    /*** Subtest 1: Port Timer Count ***/
+    HWREG16(DRIVER_CONFIG_PORT_TIMER + OFS_TAxR) = 0x1234;
+    portDriver_interruptHandler(GPIO_PORT_P4, P4IV_P4IFG0);
+    TEST_ASSERT_EQUAL_UINT8(1, portDriverTest_eventCount);
+    TEST_ASSERT_EQUAL_HEX16(0x1234, portDriverTest_events[0].timestamp);
+    TEST_ASSERT_TRUE(portDriverTest_events[0].rising);
+    TEST_ASSERT_EQUAL_HEX8(GPIO_PIN0, PORT_DRIVER_TEST_IES(GPIO_PORT_P4));
+}
+
+TEST(port_driver_test, register)
+{
+    /********************************************************************************
+     * Test 1: Invalid
+     ********************************************************************************/
+
+    /*** Subtest 1: Port (PJ Has No Interrupts) ***/
+    TEST_ASSERT_FALSE(portDriver_register(GPIO_PORT_PJ, GPIO_PIN0, portDriverTest_callback, PORT_DRIVER_FLAG_NONE));
+    TEST_ASSERT_FALSE(portDriver_register(GPIO_PORT_P5, GPIO_PIN0, portDriverTest_callback, PORT_DRIVER_FLAG_NONE));
+    TEST_ASSERT_FALSE(portDriver_register(0, GPIO_PIN0, portDriverTest_callback, PORT_DRIVER_FLAG_NONE));
+
+    /*** Subtest 2: Pin (Exactly One) ***/
+    TEST_ASSERT_FALSE(portDriver_register(GPIO_PORT_P2, 0x00, portDriverTest_callback, PORT_DRIVER_FLAG_NONE));
+    TEST_ASSERT_FALSE(portDriver_register(GPIO_PORT_P2, GPIO_PIN0 | GPIO_PIN1, portDriverTest_callback, PORT_DRIVER_FLAG_NONE));
+
+    /*** Subtest 3: Callback ***/
+    TEST_ASSERT_FALSE(portDriver_register(GPIO_PORT_P2, GPIO_PIN0, NULL, PORT_DRIVER_FLAG_NONE));
+
+    /********************************************************************************
+     * Test 2: Table Index Is PxIV >> 1
+     ********************************************************************************/
+
+    /*** Subtest 1: Every Pin ***/
+    TEST_ASSERT_TRUE(portDriver_register(GPIO_PORT_P2, GPIO_PIN0, portDriverTest_callback, PORT_DRIVER_FLAG_TIMESTAMP));
+    TEST_ASSERT_TRUE(portDriver_register(GPIO_PORT_P2, GPIO_PIN7, portDriverTest_callback, PORT_DRIVER_FLAG_TOGGLE_EDGE));
+    TEST_ASSERT_TRUE(portDriver_register(GPIO_PORT_P4, GPIO_PIN3, portDriverTest_callback, PORT_DRIVER_FLAG_NONE));
+    TEST_ASSERT_EQUAL_PTR(portDriverTest_callback, portDriver_handler[GPIO_PORT_P2 - GPIO_PORT_P1][P2IV_P2IFG0 >> 1].callback);
+    TEST_ASSERT_EQUAL_HEX8(PORT_DRIVER_FLAG_TIMESTAMP, portDriver_handler[GPIO_PORT_P2 - GPIO_PORT_P1][P2IV_P2IFG0 >> 1].flags);
+    TEST_ASSERT_EQUAL_PTR(portDriverTest_callback, portDriver_handler[GPIO_PORT_P2 - GPIO_PORT_P1][P2IV_P2IFG7 >> 1].callback);
+    TEST_ASSERT_EQUAL_HEX8(PORT_DRIVER_FLAG_TOGGLE_EDGE, portDriver_handler[GPIO_PORT_P2 - GPIO_PORT_P1][P2IV_P2IFG7 >> 1].flags);
+    TEST_ASSERT_EQUAL_PTR(portDriverTest_callback, portDriver_handler[GPIO_PORT_P4 - GPIO_PORT_P1][P4IV_P4IFG3 >> 1].callback);
+    TEST_ASSERT_NULL(portDriver_handler[GPIO_PORT_P2 - GPIO_PORT_P1][P2IV_NONE].callback);
+
+    /********************************************************************************
+     * Test 3: Ownership
+     ********************************************************************************/
+
+    /*** Subtest 1: Owned By Another Callback ***/
+    TEST_ASSERT_FALSE(portDriver_register(GPIO_PORT_P2, GPIO_PIN0, portDriverTest_otherCallback, PORT_DRIVER_FLAG_NONE));
+    TEST_ASSERT_EQUAL_PTR(portDriverTest_callback, portDriver_handler[GPIO_PORT_P2 - GPIO_PORT_P1][P2IV_P2IFG0 >> 1].callback);
+
+    /*** Subtest 2: Same Callback Updates The Flags ***/
+    TEST_ASSERT_TRUE(portDriver_register(GPIO_PORT_P2, GPIO_PIN0, portDriverTest_callback, PORT_DRIVER_FLAG_TOGGLE_EDGE));
+    TEST_ASSERT_EQUAL_HEX8(PORT_DRIVER_FLAG_TOGGLE_EDGE, portDriver_handler[GPIO_PORT_P2 - GPIO_PORT_P1][P2IV_P2IFG0 >> 1].flags);
+
+    /*** Subtest 3: Unregister, Then Another Callback ***/
+    TEST_ASSERT_TRUE(portDriver_unregister(GPIO_PORT_P2, GPIO_PIN0));
+    TEST_ASSERT_NULL(portDriver_handler[GPIO_PORT_P2 - GPIO_PORT_P1][P2IV_P2IFG0 >> 1].callback);
+    TEST_ASSERT_TRUE(portDriver_register(GPIO_PORT_P2, GPIO_PIN0, portDriverTest_otherCallback, PORT_DRIVER_FLAG_NONE));
+
+    /*** Subtest 4: Unregister Invalid ***/
+    TEST_ASSERT_FALSE(portDriver_unregister(GPIO_PORT_PJ, GPIO_PIN0));
+    TEST_ASSERT_FALSE(portDriver_unregister(GPIO_PORT_P2, GPIO_PIN0 | GPIO_PIN1));
+}
+
+TEST(port_driver_test, stimulus)
+{
+    const uint8_t Ports[] = {GPIO_PORT_P2, GPIO_PORT_P3, GPIO_PORT_P4};
+    const intrinsics_interruptHandler_t Handlers[] = {interruptHandler_port2Vector, interruptHandler_port3Vector, interruptHandler_port4Vector};
+    uint8_t i;
+
+    /********************************************************************************
+     * Test 1: Press And Release Through Each Port Vector
+     ********************************************************************************/
+
+    for(i = 0; i < (sizeof(Ports) / sizeof(Ports[0])); i++)
+    {
+        /*** Set Up ***/
+        portDriverTest_eventCount = 0;
+        TEST_ASSERT_TRUE(gpioModel_setVectorHandler(Ports[i], Handlers[i]));
+        gpioModel_setPins(Ports[i], GPIO_PIN6, true);
+        GPIO_setAsInputPinWithPullUpResistor(Ports[i], GPIO_PIN6);
+        GPIO_selectInterruptEdge(Ports[i], GPIO_PIN6, GPIO_HIGH_TO_LOW_TRANSITION);
+        GPIO_clearInterrupt(Ports[i], GPIO_PIN6);
+        GPIO_enableInterrupt(Ports[i], GPIO_PIN6);
+        TEST_ASSERT_TRUE(portDriver_register(Ports[i], GPIO_PIN6, portDriverTest_callback, PORT_DRIVER_FLAG_TOGGLE_EDGE));
+
+        /*** Subtest 1: Falling Edge ***/
+        gpioModel_setPins(Ports[i], GPIO_PIN6, false);
+        TEST_ASSERT_EQUAL_UINT8(1, portDriverTest_eventCount);
+        TEST_ASSERT_EQUAL_UINT8(Ports[i], portDriverTest_events[0].port);
+        TEST_ASSERT_EQUAL_HEX8(GPIO_PIN6, portDriverTest_events[0].pin);
+        TEST_ASSERT_FALSE(portDriverTest_events[0].rising);
+        TEST_ASSERT_EQUAL_HEX8(0, GPIO_getInterruptStatus(Ports[i], GPIO_PIN6));
+
+        /*** Subtest 2: Rising Edge (Toggled) ***/
+        gpioModel_setPins(Ports[i], GPIO_PIN6, true);
+        TEST_ASSERT_EQUAL_UINT8(2, portDriverTest_eventCount);
+        TEST_ASSERT_TRUE(portDriverTest_events[1].rising);
+
+        /*** Subtest 3: Unowned Pin On The Same Port Is Cleared And Dropped ***/
+        TEST_ASSERT_TRUE(portDriver_unregister(Ports[i], GPIO_PIN6));
+        gpioModel_setPins(Ports[i], GPIO_PIN6, false);
+        TEST_ASSERT_EQUAL_UINT8(2, portDriverTest_eventCount);
+        TEST_ASSERT_EQUAL_HEX8(0, GPIO_getInterruptStatus(Ports[i], GPIO_PIN6));
+
+        /*** Clean Up ***/
+        TEST_ASSERT_TRUE(gpioModel_setVectorHandler(Ports[i], NULL));
+    }
+}
+
+/****************************************************************************************************
+ * Test Group Runner
+ ****************************************************************************************************/
+
+TEST_GROUP_RUNNER(port_driver_test)
+{
+    RUN_TEST_CASE(port_driver_test, init)
+    RUN_TEST_CASE(port_driver_test, interruptHandler)
+    RUN_TEST_CASE(port_driver_test, register)
+    RUN_TEST_CASE(port_driver_test, stimulus)
+}
@@ -0,0 +1,21 @@
+/****************************************************************************************************
+ * FILE:    port_driver_test.h
+ * BRIEF:   Port Driver Test Header File
+ ****************************************************************************************************/
+
+#ifndef PORT_DRIVER_TEST_H
+#define PORT_DRIVER_TEST_H
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "port_driver.h"
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+extern portDriver_handler_t portDriver_handler[PORT_DRIVER_PORT_COUNT][PORT_DRIVER_PIN_COUNT + 1];
+
+#endif
@@ -0,0 +1,300 @@
+/****************************************************************************************************
+ * FILE:    power_driver_test.c
+ * BRIEF:   Power Driver Test Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define POWER_DRIVER_TEST_TIMER_STEP (0x4000) // ACLK Ticks Per Main Loop (Power Timer Wraps Every 4 Loops)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "cli_callback.h"
+#include "cli_callback_test.h"
+#include "cs.h"
+#include "dma.h"
+#include "driver_config.h"
+#include "eusci_a_uart.h"
+#include "hw_memmap.h"
+#include "interrupt_handler.h"
+#include "intrinsics.h"
+#include "msp430fr5xx_6xxgeneric.h"
+#include "msp430fr6989.h"
+#include "power_driver.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "system.h"
+#include "unity_fixture.h"
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static uint8_t powerDriverTest_handlerCount;
+static bool powerDriverTest_sleptInLpm3;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void powerDriverTest_idle(const uint8_t Count);
+static bool powerDriverTest_lowPowerModeHandler(void);
+static void powerDriverTest_receive(const char * const Characters);
+
+/****************************************************************************************************
+ * Function Definitions
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   powerDriverTest_idle
+ * BRIEF:   Idle
+ * RETURN:  Returns Nothing
+ * ARG:     Count: Main Loops, Each POWER_DRIVER_TEST_TIMER_STEP ACLK Ticks Long
+ ****************************************************************************************************/
+static void powerDriverTest_idle(const uint8_t Count)
+{
+    uint8_t i;
+
+    /*** Idle ***/
+    for(i = 0; i < Count; i++)
+    {
+        HW_MEMMAP_REG16(DRIVER_CONFIG_POWER_TIMER + OFS_TAxR) += POWER_DRIVER_TEST_TIMER_STEP;
+        powerDriver_idle(false);
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   powerDriverTest_lowPowerModeHandler
+ * BRIEF:   Low Power Mode Handler
+ * RETURN:  bool: Interrupt Delivered (true) Or Nothing Left To Deliver (false)
+ * ARG:     void: No Arguments
+ * NOTE:    First A Timer A0 Interrupt That Doesn't Wake The CPU, Then The CLI UART Start Bit
+ ****************************************************************************************************/
+static bool powerDriverTest_lowPowerModeHandler(void)
+{
+    /*** Asleep In LPM3, Start Bit Armed, SMCLK Timers Stopped ***/
+    powerDriverTest_sleptInLpm3 = (intrinsics_getLowPowerMode() == LPM3_bits) &&
+                                  ((HW_MEMMAP_REG16(DRIVER_CONFIG_POWER_WAKE_UART + OFS_UCAxIE) & UCSTTIE) == UCSTTIE) &&
+                                  ((HW_MEMMAP_REG16(DRIVER_CONFIG_TRACE_TIMER + OFS_TBxCTL) & MC) == 0) &&
+                                  ((HW_MEMMAP_REG16(DRIVER_CONFIG_ENTROPY_TIMER + OFS_TAxCTL) & MC) == 0);
+
+    /*** Deliver ***/
+    powerDriverTest_handlerCount++;
+    if(powerDriverTest_handlerCount == 1)
+    {
+        HW_MEMMAP_REG16(DRIVER_CONFIG_POWER_TIMER + OFS_TAxIV) = TA0IV_NONE;
+        return intrinsics_callInterruptHandler(interruptHandler_timer0A1Vector);
+    }
+    if(powerDriverTest_handlerCount == 2)
+    {
+        HW_MEMMAP_REG16(DRIVER_CONFIG_POWER_WAKE_UART + OFS_UCAxIFG) |= UCSTTIFG;
+        HW_MEMMAP_REG16(DRIVER_CONFIG_POWER_WAKE_UART + OFS_UCAxIV) = USCI_UART_UCSTTIFG;
+        return intrinsics_callInterruptHandler(interruptHandler_usciA1Vector);
+    }
+
+    return false;
+}
+
+/****************************************************************************************************
+ * FUNCT:   powerDriverTest_receive
+ * BRIEF:   Receive
+ * RETURN:  Returns Nothing
+ * ARG:     Characters: Characters Delivered One Per CLI UART Receive Interrupt
+ ****************************************************************************************************/
+static void powerDriverTest_receive(const char * const Characters)
+{
+    size_t i;
+
+    /*** Receive ***/
+    for(i = 0; i < strlen(Characters); i++)
+    {
+        HW_MEMMAP_REG16(DRIVER_CONFIG_POWER_WAKE_UART + OFS_UCAxRXBUF) = (uint8_t)Characters[i];
+        HW_MEMMAP_REG16(DRIVER_CONFIG_POWER_WAKE_UART + OFS_UCAxIV) = USCI_UART_UCRXIFG;
+        TEST_ASSERT_TRUE(intrinsics_callInterruptHandler(interruptHandler_usciA1Vector));
+    }
+    HW_MEMMAP_REG16(DRIVER_CONFIG_POWER_WAKE_UART + OFS_UCAxIV) = USCI_NONE;
+}
+
+/****************************************************************************************************
+ * Test Group
+ ****************************************************************************************************/
+
+TEST_GROUP(power_driver_test);
+
+/****************************************************************************************************
+ * Test Setup And Teardown
+ ****************************************************************************************************/
+
+TEST_SETUP(power_driver_test)
+{
+    /*** Set Up ***/
+    /* Simulation */
+    hwMemmap_init();
+    intrinsics_setLowPowerModeHandler(powerDriverTest_lowPowerModeHandler);
+
+    /* Application */
+    system_init();
+
+    /* Test */
+    cliCallbackTest_init();
+    powerDriverTest_handlerCount = 0;
+    powerDriverTest_sleptInLpm3 = false;
+}
+
+TEST_TEAR_DOWN(power_driver_test)
+{
+    /*** Tear Down ***/
+    intrinsics_setLowPowerModeHandler(NULL);
+}
+
+/****************************************************************************************************
+ * Tests
+ ****************************************************************************************************/
+
+TEST(power_driver_test, idle)
+{
+    char actualOutput[CLI_CALLBACK_TEST_PRINTF_OUTPUT_LENGTH];
+
+    /********************************************************************************
+     * Test 1: Awake Until Quiet For The Quiet Period (5000 ms: 163840 ACLK Ticks, 10 Loops)
+     ********************************************************************************/
+
+    /*** Subtest 1: Quiet Time Accumulates Across Power Timer Wraps ***/
+    powerDriverTest_idle(9);
+    TEST_ASSERT_EQUAL_UINT8(0, powerDriverTest_handlerCount);
+    TEST_ASSERT_EQUAL_UINT32(0, powerDriver_getSleepCount());
+
+    /*** Subtest 2: Busy Restarts The Quiet Period ***/
+    powerDriver_idle(true);
+    powerDriverTest_idle(9);
+    TEST_ASSERT_EQUAL_UINT32(0, powerDriver_getSleepCount());
+
+    /*** Subtest 3: Interrupt Activity (Port 1) Restarts The Quiet Period ***/
+    P1IV = P1IV_NONE;
+    TEST_ASSERT_TRUE(intrinsics_callInterruptHandler(interruptHandler_port1Vector));
+    powerDriver_idle(false);
+    powerDriverTest_idle(9);
+    TEST_ASSERT_EQUAL_UINT32(0, powerDriver_getSleepCount());
+
+    /********************************************************************************
+     * Test 2: Sleep And Wake On The Start Bit
+     ********************************************************************************/
+
+    /*** Subtest 1: Sleep In LPM3, Wake Only On The Start Bit ***/
+    powerDriverTest_idle(1);
+    TEST_ASSERT_EQUAL_UINT32(1, powerDriver_getSleepCount());
+    TEST_ASSERT_EQUAL_UINT8(2, powerDriverTest_handlerCount); // Timer A0 Interrupt Didn't Wake
+    TEST_ASSERT_TRUE(powerDriverTest_sleptInLpm3);
+
+    /*** Subtest 2: Awake: Start Bit Disarmed, SMCLK Timers Running, Interrupts Enabled ***/
+    TEST_ASSERT_EQUAL_HEX16(0, intrinsics_getLowPowerMode());
+    TEST_ASSERT_TRUE(intrinsics_getInterruptsEnabled());
+    TEST_ASSERT_EQUAL_HEX16(0, HW_MEMMAP_REG16(DRIVER_CONFIG_POWER_WAKE_UART + OFS_UCAxIE) & UCSTTIE);
+    TEST_ASSERT_EQUAL_HEX16(MC_2, HW_MEMMAP_REG16(DRIVER_CONFIG_TRACE_TIMER + OFS_TBxCTL) & MC);
+    TEST_ASSERT_EQUAL_HEX16(MC_2, HW_MEMMAP_REG16(DRIVER_CONFIG_ENTROPY_TIMER + OFS_TAxCTL) & MC);
+
+    /*** Subtest 3: Command Received After The Start Bit Wake ***/
+    powerDriverTest_receive("system -p\n");
+    cliCallback_tick();
+    cliCallbackTest_getPrintfOutputCopy(actualOutput);
+    TEST_ASSERT_EQUAL_STRING("Power: LPM3 After 5000 ms Quiet (Sleeps: 1)\n[root/]$ ", actualOutput);
+
+    /*** Subtest 4: Quiet Period Restarted, Not Until The Transmit Is Done ***/
+    powerDriverTest_idle(9);
+    powerDriver_idle(cliCallback_isBusy());
+    TEST_ASSERT_EQUAL_UINT32(1, powerDriver_getSleepCount());
+    DMA_disableTransfers(DRIVER_CONFIG_CLI_DMA_CHANNEL);
+    powerDriverTest_idle(9);
+    TEST_ASSERT_EQUAL_UINT32(1, powerDriver_getSleepCount());
+    powerDriverTest_idle(1);
+    TEST_ASSERT_EQUAL_UINT32(2, powerDriver_getSleepCount());
+}
+
+TEST(power_driver_test, init)
+{
+    /********************************************************************************
+     * Test 1: Initialize
+     ********************************************************************************/
+
+    /*** Subtest 1: SMCLK Clock Request Enabled, Start Bit Interrupt Disarmed ***/
+    TEST_ASSERT_EQUAL_HEX16(SMCLKREQEN, HW_MEMMAP_REG16(CS_BASE + OFS_CSCTL6) & SMCLKREQEN);
+    TEST_ASSERT_EQUAL_HEX16(0, HW_MEMMAP_REG16(DRIVER_CONFIG_POWER_WAKE_UART + OFS_UCAxIE) & UCSTTIE);
+
+    /*** Subtest 2: Defaults ***/
+    TEST_ASSERT_EQUAL_UINT16(POWER_DRIVER_QUIET_PERIOD_DEFAULT, powerDriver_getQuietPeriod());
+    TEST_ASSERT_EQUAL_UINT32(0, powerDriver_getSleepCount());
+}
+
+TEST(power_driver_test, isBusy)
+{
+    /********************************************************************************
+     * Test 1: CLI Busy Keeps SMCLK Running
+     ********************************************************************************/
+
+    /*** Subtest 1: Idle ***/
+    TEST_ASSERT_FALSE(cliCallback_isBusy());
+
+    /*** Subtest 2: Input To Process ***/
+    powerDriverTest_receive("\n");
+    TEST_ASSERT_TRUE(cliCallback_isBusy());
+    cliCallback_tick();
+
+    /*** Subtest 3: Transmit In Flight ***/
+    TEST_ASSERT_TRUE(cliCallback_isBusy()); // Prompt
+    DMA_disableTransfers(DRIVER_CONFIG_CLI_DMA_CHANNEL);
+    TEST_ASSERT_FALSE(cliCallback_isBusy());
+
+    /*** Subtest 4: Character In Flight ***/
+    HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxSTATW) |= UCBUSY;
+    TEST_ASSERT_TRUE(cliCallback_isBusy());
+}
+
+TEST(power_driver_test, quietPeriod)
+{
+    char actualOutput[CLI_CALLBACK_TEST_PRINTF_OUTPUT_LENGTH];
+
+    /********************************************************************************
+     * Test 1: Set From The CLI ("system --power")
+     ********************************************************************************/
+
+    /*** Subtest 1: Report ***/
+    cliCallbackTest_sendCommand("system -p\n");
+    cliCallbackTest_getPrintfOutputCopy(actualOutput);
+    TEST_ASSERT_EQUAL_STRING("Power: LPM3 After 5000 ms Quiet (Sleeps: 0)\n[root/]$ ", actualOutput);
+
+    /*** Subtest 2: Never Sleep ***/
+    cliCallbackTest_sendCommand("system -p0\n");
+    cliCallbackTest_getPrintfOutputCopy(actualOutput);
+    TEST_ASSERT_EQUAL_STRING("Power: Never Sleep (Sleeps: 0)\n[root/]$ ", actualOutput);
+    powerDriverTest_idle(100);
+    TEST_ASSERT_EQUAL_UINT32(0, powerDriver_getSleepCount());
+
+    /*** Subtest 3: Shorter (1000 ms: 32768 ACLK Ticks, 2 Loops) ***/
+    cliCallbackTest_sendCommand("system --power=1000\n");
+    cliCallbackTest_getPrintfOutputCopy(actualOutput);
+    TEST_ASSERT_EQUAL_STRING("Power: LPM3 After 1000 ms Quiet (Sleeps: 0)\n[root/]$ ", actualOutput);
+    powerDriver_idle(false); // Setting Restarts The Quiet Period
+    HW_MEMMAP_REG16(DRIVER_CONFIG_POWER_TIMER + OFS_TAxR) += 32767;
+    powerDriver_idle(false);
+    TEST_ASSERT_EQUAL_UINT32(0, powerDriver_getSleepCount());
+    powerDriverTest_idle(1);
+    TEST_ASSERT_EQUAL_UINT32(1, powerDriver_getSleepCount());
+}
+
+/****************************************************************************************************
+ * Test Group Runner
+ ****************************************************************************************************/
+
+TEST_GROUP_RUNNER(power_driver_test)
+{
+    RUN_TEST_CASE(power_driver_test, idle)
+    RUN_TEST_CASE(power_driver_test, init)
+    RUN_TEST_CASE(power_driver_test, isBusy)
+    RUN_TEST_CASE(power_driver_test, quietPeriod)
+}
@@ -0,0 +1,241 @@
+/****************************************************************************************************
+ * FILE:    profile_driver_test.c
+ * BRIEF:   Profile Driver Test Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define PROFILE_DRIVER_TEST_TIMER_STEP (3) // Profile Timer Cycles Per Register Access
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "cli_callback_test.h"
+#include "driver_config.h"
+#include "hw_memmap.h"
+#include "interrupt_handler.h"
+#include "intrinsics.h"
+#include "msp430fr5xx_6xxgeneric.h"
+#include "msp430fr6989.h"
+#include "profile_driver.h"
+#include "profile_driver_test.h"
+#include <stdint.h>
+#include "system.h"
+#include "unity_fixture.h"
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void profileDriverTest_timerAccessCallback(const uint32_t Address);
+
+/****************************************************************************************************
+ * Function Definitions
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   profileDriverTest_timerAccessCallback
+ * BRIEF:   Timer Access Callback
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Accessed Address (Unused)
+ * NOTE:    The Profile Timer Advances On Every Register Access
+ ****************************************************************************************************/
+static void profileDriverTest_timerAccessCallback(const uint32_t Address)
+{
+    (void)Address;
+
+    /*** Advance ***/
+    HW_MEMMAP_REG16(DRIVER_CONFIG_PROFILE_TIMER + OFS_TBxR) += PROFILE_DRIVER_TEST_TIMER_STEP;
+}
+
+/****************************************************************************************************
+ * Test Group
+ ****************************************************************************************************/
+
+TEST_GROUP(profile_driver_test);
+
+/****************************************************************************************************
+ * Test Setup And Teardown
+ ****************************************************************************************************/
+
+TEST_SETUP(profile_driver_test)
+{
+    /*** Set Up ***/
+    /* Simulation */
+    hwMemmap_init();
+
+    /* Application */
+    system_init();
+
+    /* Test */
+    cliCallbackTest_init();
+}
+
+TEST_TEAR_DOWN(profile_driver_test)
+{
+    /*** Tear Down ***/
+    hwMemmap_unregisterAccessCallback(profileDriverTest_timerAccessCallback);
+}
+
+/****************************************************************************************************
+ * Tests
+ ****************************************************************************************************/
+
+TEST(profile_driver_test, init)
+{
+    profileDriver_statistics_t statistics;
+    uint8_t bin, vector;
+
+    /********************************************************************************
+     * Test 1: Initialize
+     ********************************************************************************/
+
+    /*** Subtest 1: Empty ***/
+    for(vector = 0; vector < PROFILE_DRIVER_VECTOR_COUNT; vector++)
+    {
+        profileDriver_getStatistics((profileDriver_vector_t)vector, &statistics);
+        TEST_ASSERT_EQUAL_UINT32(0, statistics.count);
+        TEST_ASSERT_EQUAL_HEX16(UINT16_MAX, statistics.minimum);
+        TEST_ASSERT_EQUAL_UINT16(0, statistics.maximum);
+        for(bin = 0; bin < PROFILE_DRIVER_HISTOGRAM_BIN_COUNT; bin++)
+            TEST_ASSERT_EQUAL_UINT16(0, statistics.histogram[bin]);
+    }
+    TEST_ASSERT_EQUAL_UINT16(0, profileDriver_getDisabledMaximum());
+}
+
+TEST(profile_driver_test, interruptHandler)
+{
+    profileDriver_statistics_t statistics;
+
+    /********************************************************************************
+     * Test 1: Interrupt Handlers Stamp Entry And Exit
+     ********************************************************************************/
+
+    /*** Set Up ***/
+    TEST_ASSERT_TRUE(hwMemmap_registerAccessCallback(profileDriverTest_timerAccessCallback));
+
+    /*** Subtest 1: Timer B0 Overflow ***/
+    HWREG16(DRIVER_CONFIG_TRACE_TIMER + OFS_TBxIV) = TB0IV_TBIFG;
+    TEST_ASSERT_TRUE(intrinsics_callInterruptHandler(interruptHandler_timer0B1Vector));
+    TEST_ASSERT_TRUE(intrinsics_callInterruptHandler(interruptHandler_timer0B1Vector));
+    profileDriver_getStatistics(PROFILE_DRIVER_VECTOR_TIMER0_B1, &statistics);
+    TEST_ASSERT_EQUAL_UINT32(2, statistics.count);
+    TEST_ASSERT_NOT_EQUAL(0, statistics.minimum);
+    TEST_ASSERT_EQUAL_UINT16(statistics.minimum, statistics.maximum); // Same Path Both Times
+    TEST_ASSERT_EQUAL_UINT16(statistics.maximum, profileDriver_getDisabledMaximum());
+
+    /*** Subtest 2: Other Vectors Untouched ***/
+    profileDriver_getStatistics(PROFILE_DRIVER_VECTOR_PORT1, &statistics);
+    TEST_ASSERT_EQUAL_UINT32(0, statistics.count);
+}
+
+TEST(profile_driver_test, recordCriticalSection)
+{
+    /********************************************************************************
+     * Test 1: Longest Window
+     ********************************************************************************/
+
+    /*** Subtest 1: Longer Window Kept ***/
+    HWREG16(DRIVER_CONFIG_PROFILE_TIMER + OFS_TBxR) = 1000;
+    profileDriver_recordCriticalSection(900);
+    TEST_ASSERT_EQUAL_UINT16(100, profileDriver_getDisabledMaximum());
+
+    /*** Subtest 2: Shorter Window Ignored ***/
+    profileDriver_recordCriticalSection(990);
+    TEST_ASSERT_EQUAL_UINT16(100, profileDriver_getDisabledMaximum());
+
+    /*** Subtest 3: Timer Wrap ***/
+    HWREG16(DRIVER_CONFIG_PROFILE_TIMER + OFS_TBxR) = 0x0100;
+    profileDriver_recordCriticalSection(0xFF00);
+    TEST_ASSERT_EQUAL_UINT16(0x0200, profileDriver_getDisabledMaximum());
+}
+
+TEST(profile_driver_test, recordInterrupt)
+{
+    profileDriver_statistics_t statistics;
+    char actualOutput[CLI_CALLBACK_TEST_PRINTF_OUTPUT_LENGTH];
+
+    /********************************************************************************
+     * Test 1: Statistics
+     ********************************************************************************/
+
+    /*** Subtest 1: Count, Minimum, Maximum, Histogram ***/
+    HWREG16(DRIVER_CONFIG_PROFILE_TIMER + OFS_TBxR) = 300;
+    profileDriver_recordInterrupt(PROFILE_DRIVER_VECTOR_USCI_A1, 100); // 200 Cycles: Bin 7
+    HWREG16(DRIVER_CONFIG_PROFILE_TIMER + OFS_TBxR) = 0x0010;
+    profileDriver_recordInterrupt(PROFILE_DRIVER_VECTOR_USCI_A1, 0xFFF0); // 32 Cycles Across The Wrap: Bin 5
+    HWREG16(DRIVER_CONFIG_PROFILE_TIMER + OFS_TBxR) = 50;
+    profileDriver_recordInterrupt(PROFILE_DRIVER_VECTOR_USCI_A1, 49); // 1 Cycle: Bin 0
+    profileDriver_getStatistics(PROFILE_DRIVER_VECTOR_USCI_A1, &statistics);
+    TEST_ASSERT_EQUAL_UINT32(3, statistics.count);
+    TEST_ASSERT_EQUAL_UINT16(1, statistics.minimum);
+    TEST_ASSERT_EQUAL_UINT16(200, statistics.maximum);
+    TEST_ASSERT_EQUAL_UINT16(1, statistics.histogram[0]);
+    TEST_ASSERT_EQUAL_UINT16(1, statistics.histogram[5]);
+    TEST_ASSERT_EQUAL_UINT16(1, statistics.histogram[7]);
+    TEST_ASSERT_EQUAL_UINT16(200, profileDriver_getDisabledMaximum());
+
+    /*** Subtest 2: Histogram Bin Edges ***/
+    HWREG16(DRIVER_CONFIG_PROFILE_TIMER + OFS_TBxR) = 0xFFFF;
+    profileDriver_recordInterrupt(PROFILE_DRIVER_VECTOR_PORT1, 0x7FFF); // 32768 Cycles: Bin 15
+    profileDriver_recordInterrupt(PROFILE_DRIVER_VECTOR_PORT1, 0x8000); // 32767 Cycles: Bin 14
+    TEST_ASSERT_EQUAL_UINT16(1, profileDriver_statistics[PROFILE_DRIVER_VECTOR_PORT1].histogram[15]);
+    TEST_ASSERT_EQUAL_UINT16(1, profileDriver_statistics[PROFILE_DRIVER_VECTOR_PORT1].histogram[14]);
+
+    /*** Subtest 3: Histogram Saturates ***/
+    profileDriver_statistics[PROFILE_DRIVER_VECTOR_PORT1].histogram[0] = UINT16_MAX;
+    profileDriver_recordInterrupt(PROFILE_DRIVER_VECTOR_PORT1, 0xFFFF);
+    TEST_ASSERT_EQUAL_HEX16(UINT16_MAX, profileDriver_statistics[PROFILE_DRIVER_VECTOR_PORT1].histogram[0]);
+    TEST_ASSERT_EQUAL_UINT32(3, profileDriver_statistics[PROFILE_DRIVER_VECTOR_PORT1].count);
+
+    /*** Subtest 4: Invalid Vector ***/
+    profileDriver_recordInterrupt(PROFILE_DRIVER_VECTOR_COUNT, 0);
+    TEST_ASSERT_EQUAL_HEX16(0x8000, profileDriver_getDisabledMaximum());
+
+    /********************************************************************************
+     * Test 2: Report And Reset ("system --irq")
+     ********************************************************************************/
+
+    /*** Set Up ***/
+    profileDriver_reset();
+    HWREG16(DRIVER_CONFIG_PROFILE_TIMER + OFS_TBxR) = 300;
+    profileDriver_recordInterrupt(PROFILE_DRIVER_VECTOR_USCI_A1, 100);
+    profileDriver_recordInterrupt(PROFILE_DRIVER_VECTOR_USCI_A1, 290);
+    profileDriver_recordCriticalSection(0);
+
+    /*** Subtest 1: Report ***/
+    cliCallbackTest_sendCommand("system --irq=RESET\n");
+    cliCallbackTest_getPrintfOutputCopy(actualOutput);
+    TEST_ASSERT_EQUAL_STRING("Vector         Count    Min    Max Log2:Count\n"
+                             "PORT1              0      0      0\n"
+                             "PORT2              0      0      0\n"
+                             "PORT3              0      0      0\n"
+                             "PORT4              0      0      0\n"
+                             "TIMER0_A1          0      0      0\n"
+                             "TIMER0_B1          0      0      0\n"
+                             "USCI_A1            2     10    200 3:1 7:1\n"
+                             "Interrupts Disabled Max: 300\n"
+                             "[root/]$ ", actualOutput);
+
+    /*** Subtest 2: Reset ***/
+    profileDriver_getStatistics(PROFILE_DRIVER_VECTOR_USCI_A1, &statistics);
+    TEST_ASSERT_EQUAL_UINT32(0, statistics.count);
+    TEST_ASSERT_EQUAL_HEX16(UINT16_MAX, statistics.minimum);
+    TEST_ASSERT_EQUAL_UINT16(0, statistics.histogram[7]);
+    TEST_ASSERT_EQUAL_UINT16(0, profileDriver_getDisabledMaximum());
+}
+
+/****************************************************************************************************
+ * Test Group Runner
+ ****************************************************************************************************/
+
+TEST_GROUP_RUNNER(profile_driver_test)
+{
+    RUN_TEST_CASE(profile_driver_test, init)
+    RUN_TEST_CASE(profile_driver_test, interruptHandler)
+    RUN_TEST_CASE(profile_driver_test, recordCriticalSection)
+    RUN_TEST_CASE(profile_driver_test, recordInterrupt)
+}
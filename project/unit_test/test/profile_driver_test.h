@@ -0,0 +1,23 @@
+/****************************************************************************************************
+ * FILE:    profile_driver_test.h
+ * BRIEF:   Profile Driver Test Header File
+ ****************************************************************************************************/
+
+#ifndef PROFILE_DRIVER_TEST_H
+#define PROFILE_DRIVER_TEST_H
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "profile_driver.h"
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+extern volatile uint16_t profileDriver_disabledMaximum;
+extern profileDriver_statistics_t profileDriver_statistics[PROFILE_DRIVER_SLOT_COUNT];
+
+#endif
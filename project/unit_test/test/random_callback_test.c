@@ -0,0 +1,345 @@
+/****************************************************************************************************
+ * FILE:    random_callback_test.c
+ * BRIEF:   Random Callback Test Source File
+ * NOTE:    Expected Values From The xoshiro128** And SplitMix64 Reference Implementations
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define RANDOM_CALLBACK_TEST_FILL_COUNT        (8)    // 32-Bit Integers
+#define RANDOM_CALLBACK_TEST_INSTANTIATE_COUNT (384)  // Entropy Samples: Entropy Input And Nonce
+#define RANDOM_CALLBACK_TEST_POOL_LENGTH       (32)   // Bytes
+#define RANDOM_CALLBACK_TEST_RESEED_COUNT      (256)  // Entropy Samples: Entropy Input
+#define RANDOM_CALLBACK_TEST_STREAM_COUNT      (4)
+#define RANDOM_CALLBACK_TEST_VALUE_COUNT       (1000) // Per Stream (Overlap Check)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "cli_callback_test.h"
+#include "cli_command_handler_callback_test.h"
+#include "drbg_driver.h"
+#include "drbg_driver_test.h"
+#include "entropy_driver.h"
+#include "entropy_driver_test.h"
+#include "hw_memmap.h"
+#include "random.h"
+#include "random_callback.h"
+#include "random_callback_test.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "system.h"
+#include "unity_fixture.h"
+
+/****************************************************************************************************
+ * Test Group
+ ****************************************************************************************************/
+
+TEST_GROUP(random_callback_test);
+
+/****************************************************************************************************
+ * Test Setup And Teardown
+ ****************************************************************************************************/
+
+TEST_SETUP(random_callback_test)
+{
+    /*** Set Up ***/
+    /* Simulation */
+    hwMemmap_init();
+
+    /* Application */
+    randomCallback_seed = 0; // Set To Known State, So Random Values Known
+    system_init();
+
+    /* Test */
+    cliCallbackTest_init();
+}
+
+TEST_TEAR_DOWN(random_callback_test)
+{
+    /*** Tear Down ***/
+    entropyDriverTest_enableNoise(false);
+}
+
+/****************************************************************************************************
+ * Tests
+ ****************************************************************************************************/
+
+TEST(random_callback_test, fill)
+{
+    randomCallback_stream_t stream;
+    uint8_t actual[(RANDOM_CALLBACK_TEST_FILL_COUNT * sizeof(uint32_t)) + 1], expected[sizeof(actual)];
+    size_t i, length;
+    uint32_t value;
+
+    /********************************************************************************
+     * Test 1: Fill Versus Next
+     ********************************************************************************/
+
+    /*** Subtest 1: Whole And Partial Trailing Values (Little-Endian) ***/
+    value = 0;
+    for(length = 0; length < sizeof(actual); length++)
+    {
+        randomCallback_initStream(&stream, 1);
+        (void)memset(expected, 0xEE, sizeof(expected));
+        for(i = 0; i < length; i++)
+        {
+            if((i % sizeof(value)) == 0)
+                value = randomCallback_next(&stream);
+            expected[i] = (uint8_t)(value >> ((i % sizeof(value)) * 8));
+        }
+        value = randomCallback_next(&stream);
+
+        randomCallback_initStream(&stream, 1);
+        (void)memset(actual, 0xEE, sizeof(actual));
+        randomCallback_fill(&stream, actual, length);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, actual, sizeof(actual));
+        TEST_ASSERT_EQUAL_HEX32(value, randomCallback_next(&stream)); // Advanced By ceil(Length / 4)
+    }
+
+    /********************************************************************************
+     * Test 2: Stream 0 (NULL) Is Shared With random_getRandom*()
+     ********************************************************************************/
+
+    /*** Subtest 1: Fill Then Get ***/
+    randomCallback_fill(NULL, actual, 2 * sizeof(uint32_t));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(((const uint8_t []){0x5D, 0x04, 0xC9, 0xDE, 0x75, 0x9D, 0x08, 0x9A}), actual, 2 * sizeof(uint32_t)); // 3737715805, 2584255861
+    TEST_ASSERT_EQUAL_UINT32(2876756834u, random_getRandomUnsigned32BitInteger());
+}
+
+TEST(random_callback_test, init)
+{
+    /********************************************************************************
+     * Test 1: Seed 0 (SplitMix64 Expansion)
+     ********************************************************************************/
+
+    /*** Subtest 1: State ***/
+    TEST_ASSERT_EQUAL_UINT16(0, randomCallback_getSeed());
+    TEST_ASSERT_EQUAL_HEX32(0x7B1DCDAF, randomCallback_stream.state[0]);
+    TEST_ASSERT_EQUAL_HEX32(0xE220A839, randomCallback_stream.state[1]);
+    TEST_ASSERT_EQUAL_HEX32(0xA1B965F4, randomCallback_stream.state[2]);
+    TEST_ASSERT_EQUAL_HEX32(0x6E789E6A, randomCallback_stream.state[3]);
+
+    /*** Subtest 2: Values ***/
+    TEST_ASSERT_EQUAL_UINT32(3737715805u, randomCallback_getRandomUnsigned32BitIntegerCallback());
+    TEST_ASSERT_EQUAL_UINT32(2584255861u, randomCallback_getRandomUnsigned32BitIntegerCallback());
+    TEST_ASSERT_EQUAL_INT32(-1418210462, random_getRandomSigned32BitInteger());
+
+    /********************************************************************************
+     * Test 2: Reinitialize (Next Boot)
+     ********************************************************************************/
+
+    /*** Subtest 1: Seed Advances, Sequence Changes ***/
+    randomCallback_init();
+    TEST_ASSERT_EQUAL_UINT16(1, randomCallback_getSeed());
+    TEST_ASSERT_NOT_EQUAL(3737715805u, randomCallback_getRandomUnsigned32BitIntegerCallback());
+}
+
+TEST(random_callback_test, initStream)
+{
+    randomCallback_stream_t stream, streams[RANDOM_CALLBACK_TEST_STREAM_COUNT];
+    static uint32_t values[RANDOM_CALLBACK_TEST_STREAM_COUNT][RANDOM_CALLBACK_TEST_VALUE_COUNT];
+    size_t i, j, k;
+
+    /********************************************************************************
+     * Test 1: Stream Indexes
+     ********************************************************************************/
+
+    /*** Subtest 1: Index 0 Matches Stream 0 ***/
+    randomCallback_initStream(&stream, 0);
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(randomCallback_stream.state, stream.state, 4);
+
+    /*** Subtest 2: Index N Is Index N - 1 Jumped ***/
+    for(i = 1; i < RANDOM_CALLBACK_TEST_STREAM_COUNT; i++)
+    {
+        randomCallback_initStream(&stream, (uint16_t)(i - 1));
+        randomCallback_jump(&stream);
+        randomCallback_initStream(&streams[i], (uint16_t)i);
+        TEST_ASSERT_EQUAL_HEX32_ARRAY(stream.state, streams[i].state, 4);
+    }
+
+    /********************************************************************************
+     * Test 2: Independent Streams
+     ********************************************************************************/
+
+    /*** Subtest 1: No Stream Starts Inside Another Stream's Window ***/
+    for(i = 0; i < RANDOM_CALLBACK_TEST_STREAM_COUNT; i++)
+    {
+        randomCallback_initStream(&streams[i], (uint16_t)i);
+        for(j = 0; j < RANDOM_CALLBACK_TEST_VALUE_COUNT; j++)
+            values[i][j] = randomCallback_next(&streams[i]);
+    }
+    for(i = 0; i < RANDOM_CALLBACK_TEST_STREAM_COUNT; i++)
+    {
+        for(k = 0; k < RANDOM_CALLBACK_TEST_STREAM_COUNT; k++)
+        {
+            if(k == i)
+                continue;
+            for(j = 0; j < (RANDOM_CALLBACK_TEST_VALUE_COUNT - 1); j++)
+                TEST_ASSERT_FALSE((values[k][j] == values[i][0]) && (values[k][j + 1] == values[i][1]));
+        }
+    }
+}
+
+TEST(random_callback_test, jump)
+{
+    randomCallback_stream_t stream = {{1, 2, 3, 4}};
+
+    /********************************************************************************
+     * Test 1: Jump 2^64 Values
+     ********************************************************************************/
+
+    /*** Subtest 1: Reference State ***/
+    randomCallback_jump(&stream);
+    TEST_ASSERT_EQUAL_HEX32(0xA9765206, stream.state[0]);
+    TEST_ASSERT_EQUAL_HEX32(0x797AA168, stream.state[1]);
+    TEST_ASSERT_EQUAL_HEX32(0x5B62E331, stream.state[2]);
+    TEST_ASSERT_EQUAL_HEX32(0x02ABD971, stream.state[3]);
+    TEST_ASSERT_EQUAL_HEX32(0x472FA5A7, randomCallback_next(&stream));
+}
+
+TEST(random_callback_test, next)
+{
+    randomCallback_stream_t stream = {{1, 2, 3, 4}};
+
+    /********************************************************************************
+     * Test 1: xoshiro128**
+     ********************************************************************************/
+
+    /*** Subtest 1: Reference Values ***/
+    TEST_ASSERT_EQUAL_UINT32(11520, randomCallback_next(&stream));
+    TEST_ASSERT_EQUAL_UINT32(0, randomCallback_next(&stream));
+    TEST_ASSERT_EQUAL_UINT32(5927040, randomCallback_next(&stream));
+    TEST_ASSERT_EQUAL_UINT32(70819200, randomCallback_next(&stream));
+}
+
+TEST(random_callback_test, secure)
+{
+    char output[CLI_CALLBACK_TEST_PRINTF_OUTPUT_LENGTH];
+    uint8_t buffer[RANDOM_CALLBACK_TEST_POOL_LENGTH + 8], previous[sizeof(buffer)];
+    uint16_t i;
+
+    /********************************************************************************
+     * Test 1: Not Seeded
+     ********************************************************************************/
+
+    /*** Subtest 1: Refused, Never Waits ***/
+    TEST_ASSERT_FALSE(randomCallback_fillSecure(buffer, sizeof(buffer)));
+    randomCallback_tick(); // No Sample Ready
+    TEST_ASSERT_EQUAL_UINT32(0, drbgDriver_getReseedCounter());
+    cliCallbackTest_sendCommand("random -x -u\n");
+    cliCallbackTest_getPrintfOutputCopy(output);
+    TEST_ASSERT_EQUAL_STRING("Secure Random Not Seeded\n[root/]$ ", output);
+
+    /********************************************************************************
+     * Test 2: Background Seeding
+     ********************************************************************************/
+
+    /*** Subtest 1: Instantiated After The Startup And Seed Samples, Pool Filled ***/
+    entropyDriverTest_enableNoise(true);
+    for(i = 0; (i < (2 * (ENTROPY_DRIVER_STARTUP_COUNT + RANDOM_CALLBACK_TEST_INSTANTIATE_COUNT))) && (drbgDriver_getReseedCounter() == 0); i++)
+        randomCallback_tick();
+    TEST_ASSERT_EQUAL_UINT16(ENTROPY_DRIVER_STARTUP_COUNT + RANDOM_CALLBACK_TEST_INSTANTIATE_COUNT, i);
+    TEST_ASSERT_EQUAL_UINT32(2, drbgDriver_getReseedCounter()); // Pool Refill
+    TEST_ASSERT_EQUAL_UINT8(RANDOM_CALLBACK_TEST_POOL_LENGTH, randomCallback_securePoolLength);
+
+    /********************************************************************************
+     * Test 3: Fill Secure
+     ********************************************************************************/
+
+    /*** Subtest 1: From The Pool Only ***/
+    TEST_ASSERT_TRUE(randomCallback_fillSecure(previous, 8));
+    TEST_ASSERT_EQUAL_UINT8(RANDOM_CALLBACK_TEST_POOL_LENGTH - 8, randomCallback_securePoolLength);
+    TEST_ASSERT_EQUAL_UINT32(2, drbgDriver_getReseedCounter());
+
+    /*** Subtest 2: Rest Of The Pool, Then Generated ***/
+    TEST_ASSERT_TRUE(randomCallback_fillSecure(buffer, sizeof(buffer)));
+    TEST_ASSERT_EQUAL_UINT8(0, randomCallback_securePoolLength);
+    TEST_ASSERT_EQUAL_UINT32(3, drbgDriver_getReseedCounter());
+    TEST_ASSERT_FALSE(memcmp(previous, buffer, 8) == 0);
+
+    /*** Subtest 3: Pool Refilled On The Next Tick ***/
+    randomCallback_tick();
+    TEST_ASSERT_EQUAL_UINT8(RANDOM_CALLBACK_TEST_POOL_LENGTH, randomCallback_securePoolLength);
+    TEST_ASSERT_EQUAL_UINT32(4, drbgDriver_getReseedCounter());
+
+    /*** Subtest 4: CLI ***/
+    cliCallbackTest_sendCommand("random -x -u\n");
+    cliCallbackTest_getPrintfOutputCopy(output);
+    TEST_ASSERT_EQUAL_STRING_LEN("Random Unsigned 32-Bit Integer(s):\n1: ", output, 38);
+    TEST_ASSERT_EQUAL_UINT8(RANDOM_CALLBACK_TEST_POOL_LENGTH - 4, randomCallback_securePoolLength);
+
+    /********************************************************************************
+     * Test 4: Background Reseed
+     ********************************************************************************/
+
+    /*** Subtest 1: Past Half The Reseed Interval ***/
+    drbgDriver_reseedCounter = (DRBG_DRIVER_RESEED_INTERVAL / 2) + 1;
+    for(i = 0; (i < (2 * RANDOM_CALLBACK_TEST_RESEED_COUNT)) && (drbgDriver_getReseedCounter() != 1); i++)
+        randomCallback_tick();
+    TEST_ASSERT_EQUAL_UINT16(RANDOM_CALLBACK_TEST_RESEED_COUNT, i);
+
+    /*** Subtest 2: Health Test Failure Discards The Seed In Progress ***/
+    drbgDriver_reseedCounter = (DRBG_DRIVER_RESEED_INTERVAL / 2) + 1;
+    for(i = 0; i < 10; i++)
+        randomCallback_tick();
+    entropyDriverTest_enableNoise(false);
+    for(i = 0; (i < 64) && (randomCallback_secureSeedLength != 0); i++)
+    {
+        entropyDriverTest_setSample(244, 2048); // Stuck
+        randomCallback_tick();
+    }
+    TEST_ASSERT_EQUAL_UINT16(0, randomCallback_secureSeedLength);
+    entropyDriverTest_enableNoise(true);
+    for(i = 0; (i < (2 * (ENTROPY_DRIVER_STARTUP_COUNT + RANDOM_CALLBACK_TEST_RESEED_COUNT))) && (drbgDriver_getReseedCounter() != 1); i++)
+        randomCallback_tick();
+    TEST_ASSERT_EQUAL_UINT16(ENTROPY_DRIVER_STARTUP_COUNT + RANDOM_CALLBACK_TEST_RESEED_COUNT, i);
+
+    /********************************************************************************
+     * Test 5: CLI Past The Reseed Interval (Nothing Reseeds Inside The Command)
+     ********************************************************************************/
+
+    /*** Subtest 1: Integers Stop At The Interval ***/
+    randomCallback_securePoolLength = 0;
+    drbgDriver_reseedCounter = DRBG_DRIVER_RESEED_INTERVAL - 1; // Two Generate Requests Left
+    cliCallbackTest_sendCommand("random -x -c2000 -u\n");
+    cliCallbackTest_getPrintfOutputCopy(output);
+    TEST_ASSERT_EQUAL_STRING_LEN("Random Unsigned 32-Bit Integer(s):\n1: ", output, 38);
+    TEST_ASSERT_NOT_NULL(strstr(output, "\n2: "));
+    TEST_ASSERT_NULL(strstr(output, "\n3: "));
+    TEST_ASSERT_NOT_NULL(strstr(output, "\nSecure Random Reseed Required\n[root/]$ "));
+    TEST_ASSERT_EQUAL_UINT32(DRBG_DRIVER_RESEED_INTERVAL + 1, drbgDriver_getReseedCounter());
+
+    /*** Subtest 2: Binary Stops At The Interval ***/
+    drbgDriver_reseedCounter = DRBG_DRIVER_RESEED_INTERVAL - 1;
+    cliCallbackTest_sendCommand("random -x -c20000 -b\n");
+    cliCallbackTest_getPrintfOutputCopy(output);
+    TEST_ASSERT_EQUAL_STRING("Secure Random Reseed Required\n[root/]$ ", output);
+    TEST_ASSERT_EQUAL_UINT32(DRBG_DRIVER_RESEED_INTERVAL + 1, drbgDriver_getReseedCounter());
+
+    /*** Subtest 3: Reseeded In The Background, Then Served Again ***/
+    for(i = 0; (i < (2 * RANDOM_CALLBACK_TEST_RESEED_COUNT)) && (drbgDriver_getReseedCounter() > DRBG_DRIVER_RESEED_INTERVAL); i++)
+        randomCallback_tick();
+    cliCallbackTest_sendCommand("random -x -c3 -u\n");
+    cliCallbackTest_getPrintfOutputCopy(output);
+    TEST_ASSERT_NOT_NULL(strstr(output, "\n3: "));
+    TEST_ASSERT_NULL(strstr(output, "Reseed Required"));
+}
+
+/****************************************************************************************************
+ * Test Group Runner
+ ****************************************************************************************************/
+
+TEST_GROUP_RUNNER(random_callback_test)
+{
+    RUN_TEST_CASE(random_callback_test, fill)
+    RUN_TEST_CASE(random_callback_test, init)
+    RUN_TEST_CASE(random_callback_test, initStream)
+    RUN_TEST_CASE(random_callback_test, jump)
+    RUN_TEST_CASE(random_callback_test, next)
+    RUN_TEST_CASE(random_callback_test, secure)
+}
@@ -0,0 +1,24 @@
+/****************************************************************************************************
+ * FILE:    random_callback_test.h
+ * BRIEF:   Random Callback Test Header File
+ ****************************************************************************************************/
+
+#ifndef RANDOM_CALLBACK_TEST_H
+#define RANDOM_CALLBACK_TEST_H
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "random_callback.h"
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+extern uint8_t randomCallback_securePoolLength;
+extern uint16_t randomCallback_secureSeedLength;
+extern randomCallback_stream_t randomCallback_stream;
+
+#endif
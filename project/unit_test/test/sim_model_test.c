@@ -0,0 +1,647 @@
+/****************************************************************************************************
+ * FILE:    sim_model_test.c
+ * BRIEF:   Simulator Peripheral Model Test Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define SIM_MODEL_TEST_ADC12_CSV_PATH "sim_model_test.csv"
+#define SIM_MODEL_TEST_ADC12_WAV_PATH "sim_model_test.wav"
+#define SIM_MODEL_TEST_CHECK_STRING   "123456789" // Standard CRC Check Input
+#define SIM_MODEL_TEST_DMA_BUFFER     (0x1C00)    // RAM
+#define SIM_MODEL_TEST_MEMMAP_PATH    "sim_model_test.memmap"
+#define SIM_MODEL_TEST_STIMULUS_PATH  "sim_model_test.stimulus"
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "adc12_b.h"
+#include "adc12_model.h"
+#include "aes256.h"
+#include "crc.h"
+#include "crc32.h"
+#include "dma.h"
+#include "gpio.h"
+#include "gpio_model.h"
+#include "hw_memmap.h"
+#include "hw_memmap_layout.h"
+#include "intrinsics.h"
+#include "mpy32.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "unity_fixture.h"
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void simModelTest_adc12Handler(void);
+static void simModelTest_port3Handler(void);
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static uint32_t simModelTest_adc12Results, simModelTest_adc12Window[3]; // Window: High, Low, In
+static uint16_t simModelTest_port3Vectors[4];
+static uint8_t simModelTest_port3VectorCount;
+
+/****************************************************************************************************
+ * Function Definitions
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   simModelTest_adc12Handler
+ * BRIEF:   ADC12 Vector Interrupt Handler
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+static void simModelTest_adc12Handler(void)
+{
+    uint16_t vector;
+
+    /*** Count Results And Window Comparator Flags ***/
+    vector = HWREG16(ADC12_B_BASE + OFS_ADC12IV);
+    if(vector >= ADC12IV_ADC12IFG0)
+    {
+        (void)HWREG16(ADC12_B_BASE + OFS_ADC12MEM0 + (vector - ADC12IV_ADC12IFG0));
+        simModelTest_adc12Results++;
+    }
+    else if((vector >= ADC12IV_ADC12HIIFG) && (vector <= ADC12IV_ADC12INIFG))
+    {
+        simModelTest_adc12Window[(vector - ADC12IV_ADC12HIIFG) / 2]++;
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   simModelTest_port3Handler
+ * BRIEF:   Port 3 Vector Interrupt Handler
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+static void simModelTest_port3Handler(void)
+{
+    /*** Record Vector ***/
+    if(simModelTest_port3VectorCount < (sizeof(simModelTest_port3Vectors) / sizeof(simModelTest_port3Vectors[0])))
+        simModelTest_port3Vectors[simModelTest_port3VectorCount++] = HWREG16(P3_BASE + OFS_P3IV);
+}
+
+/****************************************************************************************************
+ * Test Group
+ ****************************************************************************************************/
+
+TEST_GROUP(sim_model_test);
+
+/****************************************************************************************************
+ * Test Setup And Teardown
+ ****************************************************************************************************/
+
+TEST_SETUP(sim_model_test)
+{
+    /*** Set Up ***/
+    /* Simulation */
+    hwMemmap_init();
+}
+
+TEST_TEAR_DOWN(sim_model_test)
+{
+}
+
+/****************************************************************************************************
+ * Tests
+ ****************************************************************************************************/
+
+TEST(sim_model_test, adc12)
+{
+    static const uint8_t wavHeader[44] =
+    {
+        'R', 'I', 'F', 'F', 42, 0, 0, 0, 'W', 'A', 'V', 'E',        // 36 + 6 Data Bytes
+        'f', 'm', 't', ' ', 16, 0, 0, 0, 1, 0, 1, 0,                // PCM, Mono
+        0xE8, 0x03, 0, 0, 0xD0, 0x07, 0, 0, 2, 0, 16, 0,            // 1000 Hz, 16 Bits
+        'd', 'a', 't', 'a', 6, 0, 0, 0
+    };
+    static const uint8_t wavData[6] = {0x00, 0x80, 0x00, 0x00, 0xFF, 0x7F}; // -32768, 0, 32767
+    adc12Model_generator_t generator = {ADC12_MODEL_WAVEFORM_CONSTANT, 1.65, 0.0, 0.0, 0.0, 0, 0};
+    ADC12_B_configureMemoryParam memoryParam = {ADC12_B_MEMORY_0, ADC12_B_INPUT_A0, ADC12_B_VREFPOS_AVCC_VREFNEG_VSS, ADC12_B_ENDOFSEQUENCE, ADC12_B_WINDOW_COMPARATOR_DISABLE, ADC12_B_DIFFERENTIAL_MODE_DISABLE};
+    ADC12_B_initParam initParam = {ADC12_B_SAMPLEHOLDSOURCE_SC, ADC12_B_CLOCKSOURCE_ADC12OSC, ADC12_B_CLOCKDIVIDER_1, ADC12_B_CLOCKPREDIVIDER__1, ADC12_B_NOINTCH};
+    DMA_initParam dmaParam = {DMA_CHANNEL_0, DMA_TRANSFER_SINGLE, 16, DMA_TRIGGERSOURCE_26, DMA_SIZE_SRCWORD_DSTWORD, DMA_TRIGGER_RISINGEDGE};
+    adc12Model_statistics_t statistics;
+    bool interruptsEnabled;
+    FILE *file;
+    uint8_t i;
+
+    /****************************************************************************************************
+     * Test 1: Single Conversion (16 + 14 Cycles At 5 MHz: 6 us)
+     ****************************************************************************************************/
+
+    /*** Set Up (A0: 1.65 V Of 3.3 V) ***/
+    adc12Model_setClock(5000000);
+    TEST_ASSERT_TRUE(adc12Model_setGenerator(0, &generator));
+    TEST_ASSERT_EQUAL(MSP430_STATUS_SUCCESS, ADC12_B_init(ADC12_B_BASE, &initParam));
+    ADC12_B_enable(ADC12_B_BASE);
+    ADC12_B_setupSamplingTimer(ADC12_B_BASE, ADC12_B_CYCLEHOLD_16_CYCLES, ADC12_B_CYCLEHOLD_4_CYCLES, ADC12_B_MULTIPLESAMPLESDISABLE);
+    ADC12_B_configureMemory(ADC12_B_BASE, &memoryParam);
+
+    /*** Convert ***/
+    ADC12_B_startConversion(ADC12_B_BASE, ADC12_B_START_AT_ADC12MEM0, ADC12_B_SINGLECHANNEL);
+    adc12Model_advance(5);
+    TEST_ASSERT_NOT_EQUAL(0, ADC12_B_isBusy(ADC12_B_BASE));
+    TEST_ASSERT_EQUAL_HEX16(0, ADC12_B_getInterruptStatus(ADC12_B_BASE, 0, ADC12_B_IFG0));
+    adc12Model_advance(1);
+    TEST_ASSERT_EQUAL(0, ADC12_B_isBusy(ADC12_B_BASE));
+    TEST_ASSERT_EQUAL_HEX16(ADC12_B_IFG0, ADC12_B_getInterruptStatus(ADC12_B_BASE, 0, ADC12_B_IFG0));
+    TEST_ASSERT_EQUAL_UINT16(2048, ADC12_B_getResults(ADC12_B_BASE, ADC12_B_MEMORY_0));
+    TEST_ASSERT_EQUAL_HEX16(0, ADC12_B_getInterruptStatus(ADC12_B_BASE, 0, ADC12_B_IFG0));
+
+    /*** Signed Left-Aligned (2.475 V: 3071 - 2048) ***/
+    generator.offset = 2.475;
+    TEST_ASSERT_TRUE(adc12Model_setGenerator(0, &generator));
+    ADC12_B_setDataReadBackFormat(ADC12_B_BASE, ADC12_B_SIGNED_2SCOMPLEMENT);
+    ADC12_B_startConversion(ADC12_B_BASE, ADC12_B_START_AT_ADC12MEM0, ADC12_B_SINGLECHANNEL);
+    adc12Model_advance(6);
+    TEST_ASSERT_EQUAL_HEX16(1023 << 4, ADC12_B_getResults(ADC12_B_BASE, ADC12_B_MEMORY_0));
+    ADC12_B_setDataReadBackFormat(ADC12_B_BASE, ADC12_B_UNSIGNED_BINARY);
+
+    /****************************************************************************************************
+     * Test 2: Repeated Sequence Throughput With Window Comparator
+     ****************************************************************************************************/
+
+    /*** Set Up (A0: Sine, A1: Noise, A2: Chirp; ADC12MEM0 To ADC12MEM2, Back To Back) ***/
+    generator = (adc12Model_generator_t){ADC12_MODEL_WAVEFORM_SINE, 1.65, 1.5, 1000.0, 0.0, 0, 0};
+    TEST_ASSERT_TRUE(adc12Model_setGenerator(0, &generator));
+    generator = (adc12Model_generator_t){ADC12_MODEL_WAVEFORM_NOISE, 1.65, 0.1, 0.0, 0.0, 0, 1};
+    TEST_ASSERT_TRUE(adc12Model_setGenerator(1, &generator));
+    generator = (adc12Model_generator_t){ADC12_MODEL_WAVEFORM_CHIRP, 1.65, 1.0, 100.0, 10000.0, 10000, 0};
+    TEST_ASSERT_TRUE(adc12Model_setGenerator(2, &generator));
+    ADC12_B_disableConversions(ADC12_B_BASE, ADC12_B_PREEMPTCONVERSION);
+    ADC12_B_setupSamplingTimer(ADC12_B_BASE, ADC12_B_CYCLEHOLD_16_CYCLES, ADC12_B_CYCLEHOLD_4_CYCLES, ADC12_B_MULTIPLESAMPLESENABLE);
+    memoryParam.endOfSequence = ADC12_B_NOTENDOFSEQUENCE;
+    memoryParam.windowComparatorSelect = ADC12_B_WINDOW_COMPARATOR_ENABLE;
+    ADC12_B_configureMemory(ADC12_B_BASE, &memoryParam);
+    memoryParam = (ADC12_B_configureMemoryParam){ADC12_B_MEMORY_1, ADC12_B_INPUT_A1, ADC12_B_VREFPOS_AVCC_VREFNEG_VSS, ADC12_B_NOTENDOFSEQUENCE, ADC12_B_WINDOW_COMPARATOR_DISABLE, ADC12_B_DIFFERENTIAL_MODE_DISABLE};
+    ADC12_B_configureMemory(ADC12_B_BASE, &memoryParam);
+    memoryParam = (ADC12_B_configureMemoryParam){ADC12_B_MEMORY_2, ADC12_B_INPUT_A2, ADC12_B_VREFPOS_AVCC_VREFNEG_VSS, ADC12_B_ENDOFSEQUENCE, ADC12_B_WINDOW_COMPARATOR_DISABLE, ADC12_B_DIFFERENTIAL_MODE_DISABLE};
+    ADC12_B_configureMemory(ADC12_B_BASE, &memoryParam);
+    ADC12_B_setWindowCompAdvanced(ADC12_B_BASE, 3000, 1000);
+    ADC12_B_enableInterrupt(ADC12_B_BASE, ADC12_B_IE0 | ADC12_B_IE1 | ADC12_B_IE2, 0, ADC12_B_HIIE | ADC12_B_LOIE | ADC12_B_INIE);
+
+    /*** Run 10 ms With The Handler Keeping Up: 1666 Conversions, 556 Of A0, No Overflow ***/
+    interruptsEnabled = intrinsics_getInterruptsEnabled();
+    __enable_interrupt();
+    adc12Model_setVectorHandler(simModelTest_adc12Handler);
+    simModelTest_adc12Results = 0;
+    (void)memset(simModelTest_adc12Window, 0, sizeof(simModelTest_adc12Window));
+    ADC12_B_startConversion(ADC12_B_BASE, ADC12_B_START_AT_ADC12MEM0, ADC12_B_REPEATED_SEQOFCHANNELS);
+    adc12Model_advance(10000);
+    adc12Model_getStatistics(&statistics);
+    TEST_ASSERT_EQUAL_UINT32(1666 + 2, statistics.conversions); // Plus Test 1
+    TEST_ASSERT_EQUAL_UINT32(0, statistics.overflows);
+    TEST_ASSERT_EQUAL_UINT32(1666, simModelTest_adc12Results);
+    TEST_ASSERT_EQUAL_UINT32(556, simModelTest_adc12Window[0] + simModelTest_adc12Window[1] + simModelTest_adc12Window[2]);
+    TEST_ASSERT_NOT_EQUAL(0, simModelTest_adc12Window[0]);
+    TEST_ASSERT_NOT_EQUAL(0, simModelTest_adc12Window[1]);
+    TEST_ASSERT_NOT_EQUAL(0, simModelTest_adc12Window[2]);
+
+    /*** Clearing ADC12ENC Stops At The End Of The Sequence ***/
+    HWREG8(ADC12_B_BASE + OFS_ADC12CTL0_L) &= (uint8_t)~ADC12ENC;
+    adc12Model_advance(18);
+    TEST_ASSERT_EQUAL(0, ADC12_B_isBusy(ADC12_B_BASE));
+
+    /*** Without The Handler Results Are Overwritten ***/
+    adc12Model_setVectorHandler(NULL);
+    ADC12_B_startConversion(ADC12_B_BASE, ADC12_B_START_AT_ADC12MEM0, ADC12_B_REPEATED_SEQOFCHANNELS);
+    adc12Model_advance(36);
+    adc12Model_getStatistics(&statistics);
+    TEST_ASSERT_EQUAL_UINT32(3, statistics.overflows);
+    TEST_ASSERT_EQUAL_HEX16(ADC12OVIFG, HWREG16(ADC12_B_BASE + OFS_ADC12IFGR2) & ADC12OVIFG);
+    ADC12_B_disableConversions(ADC12_B_BASE, ADC12_B_PREEMPTCONVERSION);
+    HWREG8(ADC12_B_BASE + OFS_ADC12CTL0_L) &= (uint8_t)~ADC12ON;
+    if(!interruptsEnabled)
+        __disable_interrupt();
+
+    /****************************************************************************************************
+     * Test 3: Timer Trigger, CSV Field Data And DMA
+     ****************************************************************************************************/
+
+    /*** Write CSV (Ramp: 0.1 V Every 100 us; 4.095 V Reference: 1 LSB Per mV) ***/
+    file = fopen(SIM_MODEL_TEST_ADC12_CSV_PATH, "w");
+    TEST_ASSERT_NOT_NULL(file);
+    (void)fputs("time_us,a3\n", file);
+    for(i = 0; i < 40; i++)
+        (void)fprintf(file, "%u,%.1f\n", (unsigned int)(i * 100), (double)i * 0.1);
+    (void)fclose(file);
+
+    /*** Set Up (A3, 10 kHz Trigger, Repeated Single Channel, DMA To RAM) ***/
+    hwMemmap_init();
+    adc12Model_setClock(5000000);
+    adc12Model_setReference(4.095);
+    TEST_ASSERT_TRUE(adc12Model_loadCsvFile(SIM_MODEL_TEST_ADC12_CSV_PATH, 3));
+    initParam.sampleHoldSignalSourceSelect = ADC12_B_SAMPLEHOLDSOURCE_1;
+    TEST_ASSERT_EQUAL(MSP430_STATUS_SUCCESS, ADC12_B_init(ADC12_B_BASE, &initParam));
+    ADC12_B_enable(ADC12_B_BASE);
+    ADC12_B_setupSamplingTimer(ADC12_B_BASE, ADC12_B_CYCLEHOLD_16_CYCLES, ADC12_B_CYCLEHOLD_4_CYCLES, ADC12_B_MULTIPLESAMPLESDISABLE);
+    memoryParam = (ADC12_B_configureMemoryParam){ADC12_B_MEMORY_0, ADC12_B_INPUT_A3, ADC12_B_VREFPOS_AVCC_VREFNEG_VSS, ADC12_B_ENDOFSEQUENCE, ADC12_B_WINDOW_COMPARATOR_DISABLE, ADC12_B_DIFFERENTIAL_MODE_DISABLE};
+    ADC12_B_configureMemory(ADC12_B_BASE, &memoryParam);
+    DMA_init(&dmaParam);
+    DMA_setSrcAddress(DMA_CHANNEL_0, ADC12_B_getMemoryAddressForDMA(ADC12_B_BASE, ADC12_B_MEMORY_0), DMA_DIRECTION_UNCHANGED);
+    DMA_setDstAddress(DMA_CHANNEL_0, SIM_MODEL_TEST_DMA_BUFFER, DMA_DIRECTION_INCREMENT);
+    DMA_enableTransfers(DMA_CHANNEL_0);
+    adc12Model_setTriggerRate(10000);
+    ADC12_B_startConversion(ADC12_B_BASE, ADC12_B_START_AT_ADC12MEM0, ADC12_B_REPEATED_SINGLECHANNEL);
+
+    /*** 16 Triggers (100 us To 1600 us): Sample k Is The Row At k x 100 us ***/
+    adc12Model_advance(1606);
+    TEST_ASSERT_EQUAL_HEX16(DMA_INT_ACTIVE, DMA_getInterruptStatus(DMA_CHANNEL_0));
+    TEST_ASSERT_EQUAL_HEX16(0, HWREG16(DMA_BASE + OFS_DMA0CTL) & DMAEN);
+    for(i = 0; i < 16; i++)
+        TEST_ASSERT_EQUAL_UINT16(100u * (i + 1u), HWREG16(SIM_MODEL_TEST_DMA_BUFFER + (2u * i)));
+    TEST_ASSERT_EQUAL_HEX16(0, ADC12_B_getInterruptStatus(ADC12_B_BASE, 0, ADC12_B_IFG0));
+
+    /*** Unread Results Overflow Once DMA Is Done; A Trigger While Converting Is A Time Overflow ***/
+    adc12Model_advance(200);
+    adc12Model_getStatistics(&statistics);
+    TEST_ASSERT_EQUAL_UINT32(18, statistics.conversions);
+    TEST_ASSERT_EQUAL_UINT32(16, statistics.dmaTransfers);
+    TEST_ASSERT_EQUAL_UINT32(1, statistics.overflows);
+    adc12Model_setTriggerRate(250000);
+    adc12Model_advance(100);
+    adc12Model_getStatistics(&statistics);
+    TEST_ASSERT_NOT_EQUAL(0, statistics.timeOverflows);
+
+    /****************************************************************************************************
+     * Test 4: WAV Field Data
+     ****************************************************************************************************/
+
+    /*** Write WAV (1 kHz: 0 V, Mid-Scale, Full Scale) ***/
+    file = fopen(SIM_MODEL_TEST_ADC12_WAV_PATH, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    (void)fwrite(wavHeader, 1, sizeof(wavHeader), file);
+    (void)fwrite(wavData, 1, sizeof(wavData), file);
+    (void)fclose(file);
+
+    /*** Convert Once Per Sample ***/
+    hwMemmap_init();
+    adc12Model_setClock(5000000);
+    TEST_ASSERT_TRUE(adc12Model_loadWavFile(SIM_MODEL_TEST_ADC12_WAV_PATH, 4));
+    initParam.sampleHoldSignalSourceSelect = ADC12_B_SAMPLEHOLDSOURCE_SC;
+    TEST_ASSERT_EQUAL(MSP430_STATUS_SUCCESS, ADC12_B_init(ADC12_B_BASE, &initParam));
+    ADC12_B_enable(ADC12_B_BASE);
+    ADC12_B_setupSamplingTimer(ADC12_B_BASE, ADC12_B_CYCLEHOLD_16_CYCLES, ADC12_B_CYCLEHOLD_4_CYCLES, ADC12_B_MULTIPLESAMPLESDISABLE);
+    memoryParam.inputSourceSelect = ADC12_B_INPUT_A4;
+    ADC12_B_configureMemory(ADC12_B_BASE, &memoryParam);
+    ADC12_B_startConversion(ADC12_B_BASE, ADC12_B_START_AT_ADC12MEM0, ADC12_B_SINGLECHANNEL);
+    adc12Model_advance(1000);
+    TEST_ASSERT_EQUAL_UINT16(0, ADC12_B_getResults(ADC12_B_BASE, ADC12_B_MEMORY_0));
+    ADC12_B_startConversion(ADC12_B_BASE, ADC12_B_START_AT_ADC12MEM0, ADC12_B_SINGLECHANNEL);
+    adc12Model_advance(1000);
+    TEST_ASSERT_EQUAL_UINT16(2048, ADC12_B_getResults(ADC12_B_BASE, ADC12_B_MEMORY_0));
+    ADC12_B_startConversion(ADC12_B_BASE, ADC12_B_START_AT_ADC12MEM0, ADC12_B_SINGLECHANNEL);
+    adc12Model_advance(1000);
+    TEST_ASSERT_EQUAL_UINT16(4095, ADC12_B_getResults(ADC12_B_BASE, ADC12_B_MEMORY_0));
+
+    /*** Clean Up ***/
+    hwMemmap_init();
+    (void)remove(SIM_MODEL_TEST_ADC12_CSV_PATH);
+    (void)remove(SIM_MODEL_TEST_ADC12_WAV_PATH);
+}
+
+TEST(sim_model_test, aes256)
+{
+    static const uint8_t plainText[16] = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF};
+    static const uint8_t cipherText128[16] = {0x69, 0xC4, 0xE0, 0xD8, 0x6A, 0x7B, 0x04, 0x30, 0xD8, 0xCD, 0xB7, 0x80, 0x70, 0xB4, 0xC5, 0x5A};
+    static const uint8_t cipherText192[16] = {0xDD, 0xA9, 0x7C, 0xA4, 0x86, 0x4C, 0xDF, 0xE0, 0x6E, 0xAF, 0x70, 0xA0, 0xEC, 0x0D, 0x71, 0x91};
+    static const uint8_t cipherText256[16] = {0x8E, 0xA2, 0xB7, 0xCA, 0x51, 0x67, 0x45, 0xBF, 0xEA, 0xFC, 0x49, 0x90, 0x4B, 0x49, 0x60, 0x89};
+    uint8_t data[16], i, key[32];
+
+    /****************************************************************************************************
+     * Test 1: FIPS-197 Appendix C Vectors
+     ****************************************************************************************************/
+
+    for(i = 0; i < sizeof(key); i++)
+        key[i] = i;
+
+    /*** AES-128 ***/
+    TEST_ASSERT_EQUAL_UINT8(MSP430_STATUS_SUCCESS, AES256_setCipherKey(AES256_BASE, key, AES256_KEYLENGTH_128BIT));
+    AES256_encryptData(AES256_BASE, plainText, data);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(cipherText128, data, sizeof(data));
+    TEST_ASSERT_EQUAL_UINT8(MSP430_STATUS_SUCCESS, AES256_setDecipherKey(AES256_BASE, key, AES256_KEYLENGTH_128BIT));
+    AES256_decryptData(AES256_BASE, cipherText128, data);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(plainText, data, sizeof(data));
+
+    /*** AES-192 ***/
+    TEST_ASSERT_EQUAL_UINT8(MSP430_STATUS_SUCCESS, AES256_setCipherKey(AES256_BASE, key, AES256_KEYLENGTH_192BIT));
+    AES256_encryptData(AES256_BASE, plainText, data);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(cipherText192, data, sizeof(data));
+
+    /*** AES-256 ***/
+    TEST_ASSERT_EQUAL_UINT8(MSP430_STATUS_SUCCESS, AES256_setCipherKey(AES256_BASE, key, AES256_KEYLENGTH_256BIT));
+    AES256_encryptData(AES256_BASE, plainText, data);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(cipherText256, data, sizeof(data));
+    TEST_ASSERT_EQUAL_UINT8(MSP430_STATUS_SUCCESS, AES256_setDecipherKey(AES256_BASE, key, AES256_KEYLENGTH_256BIT));
+    AES256_decryptData(AES256_BASE, cipherText256, data);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(plainText, data, sizeof(data));
+
+    /****************************************************************************************************
+     * Test 2: Status And Software Reset
+     ****************************************************************************************************/
+
+    /*** Ready Flag ***/
+    TEST_ASSERT_NOT_EQUAL(0, AES256_getInterruptStatus(AES256_BASE));
+    AES256_clearInterrupt(AES256_BASE);
+    TEST_ASSERT_EQUAL(0, AES256_getInterruptStatus(AES256_BASE));
+    TEST_ASSERT_EQUAL(0, AES256_isBusy(AES256_BASE));
+
+    /*** Data Without A Key ***/
+    AES256_reset(AES256_BASE);
+    TEST_ASSERT_EQUAL_HEX16(0, HWREG16(AES256_BASE + OFS_AESACTL0) & AESSWRST);
+    AES256_startEncryptData(AES256_BASE, plainText);
+    TEST_ASSERT_NOT_EQUAL(0, AES256_getErrorFlagStatus(AES256_BASE));
+}
+
+TEST(sim_model_test, crc)
+{
+    const uint8_t * const data = (const uint8_t *)SIM_MODEL_TEST_CHECK_STRING;
+    uint8_t i;
+
+    /****************************************************************************************************
+     * Test 1: CRC Module
+     ****************************************************************************************************/
+
+    /*** CRC-16/CCITT-FALSE (MSB First) ***/
+    CRC_setSeed(CRC_BASE, 0xFFFF);
+    for(i = 0; i < strlen(SIM_MODEL_TEST_CHECK_STRING); i++)
+        CRC_set8BitDataReversed(CRC_BASE, data[i]);
+    TEST_ASSERT_EQUAL_HEX16(0x29B1, CRC_getResult(CRC_BASE));
+
+    /*** CRC-16/MCRF4XX (LSB First, Reversed Result) ***/
+    CRC_setSeed(CRC_BASE, 0xFFFF);
+    for(i = 0; i < strlen(SIM_MODEL_TEST_CHECK_STRING); i++)
+        CRC_set8BitData(CRC_BASE, data[i]);
+    TEST_ASSERT_EQUAL_HEX16(0x6F91, CRC_getResultBitsReversed(CRC_BASE));
+
+    /*** Word Writes Feed The Low Byte First ***/
+    CRC_setSeed(CRC_BASE, 0xFFFF);
+    for(i = 0; i < 8; i += 2)
+        CRC_set16BitData(CRC_BASE, (uint16_t)(data[i] | (data[i + 1] << 8)));
+    CRC_set8BitData(CRC_BASE, data[8]);
+    TEST_ASSERT_EQUAL_HEX16(0x6F91, CRC_getResultBitsReversed(CRC_BASE));
+
+    /****************************************************************************************************
+     * Test 2: CRC32 Module
+     ****************************************************************************************************/
+
+    /*** CRC-32/ISO-HDLC ***/
+    CRC32_setSeed(0xFFFFFFFF, CRC32_MODE);
+    for(i = 0; i < strlen(SIM_MODEL_TEST_CHECK_STRING); i++)
+        CRC32_set8BitData(data[i], CRC32_MODE);
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, CRC32_getResultReversed(CRC32_MODE) ^ 0xFFFFFFFF);
+
+    /*** CRC-16 In The CRC32 Module ***/
+    CRC32_setSeed(0xFFFF, CRC16_MODE);
+    for(i = 0; i < strlen(SIM_MODEL_TEST_CHECK_STRING); i++)
+        CRC32_set8BitData(data[i], CRC16_MODE);
+    TEST_ASSERT_EQUAL_HEX16(0x6F91, CRC32_getResultReversed(CRC16_MODE));
+}
+
+TEST(sim_model_test, gpio)
+{
+    FILE *file;
+
+    /****************************************************************************************************
+     * Test 1: Edge Select, Interrupt Enable And Vector Priority
+     ****************************************************************************************************/
+
+    /*** Set Up (P3.3 Falling, P3.5 Rising, P3.6 Not Enabled) ***/
+    simModelTest_port3VectorCount = 0;
+    GPIO_setAsInputPin(GPIO_PORT_P3, GPIO_PIN3 | GPIO_PIN5 | GPIO_PIN6);
+    gpioModel_setPins(GPIO_PORT_P3, GPIO_PIN3, true);
+    GPIO_selectInterruptEdge(GPIO_PORT_P3, GPIO_PIN3, GPIO_HIGH_TO_LOW_TRANSITION);
+    GPIO_selectInterruptEdge(GPIO_PORT_P3, GPIO_PIN5 | GPIO_PIN6, GPIO_LOW_TO_HIGH_TRANSITION);
+    GPIO_clearInterrupt(GPIO_PORT_P3, GPIO_PIN_ALL8);
+    GPIO_enableInterrupt(GPIO_PORT_P3, GPIO_PIN3 | GPIO_PIN5);
+
+    /*** Wrong Edges ***/
+    gpioModel_setPins(GPIO_PORT_P3, GPIO_PIN3, true);
+    gpioModel_setPins(GPIO_PORT_P3, GPIO_PIN5, false);
+    TEST_ASSERT_EQUAL_HEX16(0, GPIO_getInterruptStatus(GPIO_PORT_P3, GPIO_PIN_ALL8));
+
+    /*** Matching Edges, No Handler: Flags Pending (P3.6 Too, Without PxIE) ***/
+    gpioModel_setPins(GPIO_PORT_P3, GPIO_PIN3, false);
+    gpioModel_setPins(GPIO_PORT_P3, GPIO_PIN5 | GPIO_PIN6, true);
+    TEST_ASSERT_EQUAL_HEX16(GPIO_PIN3 | GPIO_PIN5 | GPIO_PIN6, GPIO_getInterruptStatus(GPIO_PORT_P3, GPIO_PIN_ALL8));
+    TEST_ASSERT_EQUAL_HEX8(GPIO_INPUT_PIN_HIGH, GPIO_getInputPinValue(GPIO_PORT_P3, GPIO_PIN5));
+    TEST_ASSERT_EQUAL_HEX8(GPIO_INPUT_PIN_HIGH, GPIO_getInputPinValue(GPIO_PORT_P3, GPIO_PIN6));
+
+    /*** Dispatch (Lowest Pin First, Each PxIV Read Clears Its Flag) ***/
+    TEST_ASSERT_TRUE(gpioModel_setVectorHandler(GPIO_PORT_P3, simModelTest_port3Handler));
+    gpioModel_service();
+    TEST_ASSERT_EQUAL_UINT8(2, simModelTest_port3VectorCount);
+    TEST_ASSERT_EQUAL_HEX16(P3IV_P3IFG3, simModelTest_port3Vectors[0]);
+    TEST_ASSERT_EQUAL_HEX16(P3IV_P3IFG5, simModelTest_port3Vectors[1]);
+    TEST_ASSERT_EQUAL_HEX16(GPIO_PIN6, GPIO_getInterruptStatus(GPIO_PORT_P3, GPIO_PIN_ALL8));
+    TEST_ASSERT_EQUAL_HEX16(P3IV_NONE, HWREG16(P3_BASE + OFS_P3IV));
+
+    /****************************************************************************************************
+     * Test 2: Stimulus File
+     ****************************************************************************************************/
+
+    /*** Write Stimulus ***/
+    file = fopen(SIM_MODEL_TEST_STIMULUS_PATH, "w");
+    TEST_ASSERT_NOT_NULL(file);
+    (void)fputs("# TIME_US PORT PIN LEVEL\n100 3 3 1\n250 3 3 0\n900 3 3 1\n", file);
+    (void)fclose(file);
+
+    /*** Run Stimulus ***/
+    simModelTest_port3VectorCount = 0;
+    TEST_ASSERT_TRUE(gpioModel_loadStimulusFile(SIM_MODEL_TEST_STIMULUS_PATH));
+    gpioModel_advance(200);
+    TEST_ASSERT_EQUAL_UINT8(0, simModelTest_port3VectorCount);
+    gpioModel_advance(100);
+    TEST_ASSERT_EQUAL_UINT8(1, simModelTest_port3VectorCount);
+    TEST_ASSERT_EQUAL_UINT32(300, gpioModel_getTime());
+    gpioModel_advance(1000);
+    TEST_ASSERT_EQUAL_UINT8(1, simModelTest_port3VectorCount);
+    TEST_ASSERT_EQUAL_HEX8(GPIO_INPUT_PIN_HIGH, GPIO_getInputPinValue(GPIO_PORT_P3, GPIO_PIN3));
+
+    /*** Clean Up ***/
+    TEST_ASSERT_TRUE(gpioModel_loadStimulus(NULL, 0));
+    (void)remove(SIM_MODEL_TEST_STIMULUS_PATH);
+}
+
+TEST(sim_model_test, memmap)
+{
+    hwMemmapLayout_header_t header;
+    uint8_t lcdMemory, timerCount[2];
+    FILE *file;
+    bool found;
+    uint16_t i;
+
+    /*** Map (Contents Carry Over) And Write Through HWREGx ***/
+    HWREG16(TIMER_A0_BASE + OFS_TAxR) = 0x1234;
+    TEST_ASSERT_FALSE(hwMemmap_map(""));
+    TEST_ASSERT_TRUE(hwMemmap_map(SIM_MODEL_TEST_MEMMAP_PATH));
+    TEST_ASSERT_EQUAL_HEX16(0x1234, HWREG16(TIMER_A0_BASE + OFS_TAxR));
+    HWREG8(LCD_C_BASE + OFS_LCDM1) = 0xA5;
+
+    /*** Independent View: Layout Header ***/
+    file = fopen(SIM_MODEL_TEST_MEMMAP_PATH, "rb");
+    TEST_ASSERT_NOT_NULL(file);
+    TEST_ASSERT_EQUAL_UINT(1, fread(&header, sizeof(header), 1, file));
+    TEST_ASSERT_EQUAL_HEX32(HW_MEMMAP_LAYOUT_MAGIC, header.magic);
+    TEST_ASSERT_EQUAL_UINT16(HW_MEMMAP_LAYOUT_VERSION, header.version);
+    TEST_ASSERT_EQUAL_HEX32(HW_MEMMAP_LAYOUT_MEMORY_OFFSET, header.memoryOffset);
+    TEST_ASSERT_EQUAL_HEX32(HW_MEMMAP_LAYOUT_MEMORY_LENGTH, header.memoryLength);
+    for(found = false, i = 0; !found && (i < header.entryCount); i++)
+        found = (strcmp(header.entries[i].name, "LCD_C") == 0) && (header.entries[i].baseAddress == LCD_C_BASE);
+    TEST_ASSERT_TRUE(found);
+
+    /*** Independent View: Registers In Place ***/
+    TEST_ASSERT_EQUAL_INT(0, fseek(file, (long)(header.memoryOffset + LCD_C_BASE + OFS_LCDM1), SEEK_SET));
+    TEST_ASSERT_EQUAL_UINT(1, fread(&lcdMemory, 1, 1, file));
+    TEST_ASSERT_EQUAL_HEX8(0xA5, lcdMemory);
+    TEST_ASSERT_EQUAL_INT(0, fseek(file, (long)(header.memoryOffset + TIMER_A0_BASE + OFS_TAxR), SEEK_SET));
+    TEST_ASSERT_EQUAL_UINT(2, fread(timerCount, 1, 2, file));
+    TEST_ASSERT_EQUAL_HEX8(0x34, timerCount[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x12, timerCount[1]);
+    (void)fclose(file);
+
+    /*** Unmap (Contents Carry Back) ***/
+    hwMemmap_unmap();
+    TEST_ASSERT_EQUAL_HEX8(0xA5, HWREG8(LCD_C_BASE + OFS_LCDM1));
+    TEST_ASSERT_EQUAL_HEX16(0x1234, HWREG16(TIMER_A0_BASE + OFS_TAxR));
+    (void)remove(SIM_MODEL_TEST_MEMMAP_PATH);
+}
+
+TEST(sim_model_test, powerUpClear)
+{
+    /*** Before: Registers, LCD, RTC And RAM Written ***/
+    HWREG16(TIMER_A0_BASE + OFS_TAxCTL) = 0x0224;
+    HWREG16(WDT_A_BASE + OFS_WDTCTL) = 0x0080; // Password Violation
+    HWREG8(LCD_C_BASE + OFS_LCDM1) = 0xA5;
+    HWREG16(LCD_C_BASE + OFS_LCDCVCTL) = LCDCPEN;
+    HWREG16(RTC_C_BASE + OFS_RTCCTL0) = 0x1234;
+    HWREG16(SIM_MODEL_TEST_DMA_BUFFER) = 0x5678;
+    HWREG16(CS_BASE + OFS_CSCTL3) = 0;
+
+    /*** Power-Up Clear ***/
+    hwMemmap_powerUpClear(SYSRSTIV_WDTKEY);
+
+    /*** Cleared: Peripheral Registers; Clock System At Its Reset Values ***/
+    TEST_ASSERT_EQUAL_HEX16(0, HWREG16(TIMER_A0_BASE + OFS_TAxCTL));
+    TEST_ASSERT_EQUAL_HEX16(0, HWREG16(WDT_A_BASE + OFS_WDTCTL));
+    TEST_ASSERT_EQUAL_HEX16(DIVS__8 | DIVM__8, HWREG16(CS_BASE + OFS_CSCTL3));
+    TEST_ASSERT_EQUAL_HEX16(LFXTOFF, HWREG16(CS_BASE + OFS_CSCTL4) & LFXTOFF);
+
+    /*** Kept: Brownout-Only Registers And Memory ***/
+    TEST_ASSERT_EQUAL_HEX8(0xA5, HWREG8(LCD_C_BASE + OFS_LCDM1));
+    TEST_ASSERT_EQUAL_HEX16(LCDCPEN, HWREG16(LCD_C_BASE + OFS_LCDCVCTL));
+    TEST_ASSERT_EQUAL_HEX16(0x1234, HWREG16(RTC_C_BASE + OFS_RTCCTL0));
+    TEST_ASSERT_EQUAL_HEX16(0x5678, HWREG16(SIM_MODEL_TEST_DMA_BUFFER));
+
+    /*** Cause Latched ***/
+    TEST_ASSERT_EQUAL_HEX16(SYSRSTIV_WDTKEY, HWREG16(SYS_BASE + OFS_SYSRSTIV));
+}
+
+TEST(sim_model_test, mpy32)
+{
+    /****************************************************************************************************
+     * Test 1: Multiply
+     ****************************************************************************************************/
+
+    /*** 16 x 16 Unsigned ***/
+    MPY32_setOperandOne16Bit(MPY32_MULTIPLY_UNSIGNED, 0xFFFF);
+    MPY32_setOperandTwo16Bit(0xFFFF);
+    TEST_ASSERT_EQUAL_HEX64(0xFFFE0001, MPY32_getResult());
+    TEST_ASSERT_EQUAL_HEX16(0x0000, MPY32_getSumExtension());
+
+    /*** 16 x 16 Signed ***/
+    MPY32_setOperandOne16Bit(MPY32_MULTIPLY_SIGNED, 0xFFFE);
+    MPY32_setOperandTwo16Bit(3);
+    TEST_ASSERT_EQUAL_HEX64(0xFFFFFFFFFFFFFFFA, MPY32_getResult());
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, MPY32_getSumExtension());
+    TEST_ASSERT_EQUAL_HEX16(0xFFFA, HWREG16(MPY32_BASE + OFS_RESLO));
+
+    /*** 8 x 8 Signed (Byte Writes Are Sign-Extended) ***/
+    MPY32_setOperandOne8Bit(MPY32_MULTIPLY_SIGNED, 0x80);
+    MPY32_setOperandTwo8Bit(0x02);
+    TEST_ASSERT_EQUAL_HEX64(0xFFFFFFFFFFFFFF00, MPY32_getResult());
+
+    /*** 32 x 32 Unsigned ***/
+    MPY32_setOperandOne32Bit(MPY32_MULTIPLY_UNSIGNED, 0xFFFFFFFF);
+    MPY32_setOperandTwo32Bit(0xFFFFFFFF);
+    TEST_ASSERT_EQUAL_HEX64(0xFFFFFFFE00000001, MPY32_getResult());
+
+    /*** 24 x 16 Signed ***/
+    MPY32_setOperandOne24Bit(MPY32_MULTIPLY_SIGNED, 0xFFFFFE);
+    MPY32_setOperandTwo16Bit(0x7FFF);
+    TEST_ASSERT_EQUAL_HEX64(0xFFFFFFFFFFFF0002, MPY32_getResult());
+
+    /****************************************************************************************************
+     * Test 2: Multiply And Accumulate
+     ****************************************************************************************************/
+
+    /*** 16 x 16 Unsigned Carry ***/
+    MPY32_preloadResult(0xFFFFFFFF);
+    MPY32_setOperandOne16Bit(MPY32_MULTIPLYACCUMULATE_UNSIGNED, 1);
+    MPY32_setOperandTwo16Bit(1);
+    TEST_ASSERT_EQUAL_HEX64(0, MPY32_getResult());
+    TEST_ASSERT_EQUAL_HEX16(0x0001, MPY32_getSumExtension());
+    TEST_ASSERT_EQUAL_HEX16(MPYC, HWREG16(MPY32_BASE + OFS_MPY32CTL0) & MPYC);
+
+    /*** 32 x 32 Signed ***/
+    MPY32_preloadResult(100);
+    MPY32_setOperandOne32Bit(MPY32_MULTIPLYACCUMULATE_SIGNED, 0xFFFFFFFF);
+    MPY32_setOperandTwo32Bit(101);
+    TEST_ASSERT_EQUAL_HEX64(0xFFFFFFFFFFFFFFFF, MPY32_getResult());
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, MPY32_getSumExtension());
+
+    /****************************************************************************************************
+     * Test 3: Fractional And Saturation
+     ****************************************************************************************************/
+
+    /*** Q15 x Q15 (0.5 x 0.5) ***/
+    MPY32_enableFractionalMode();
+    MPY32_setOperandOne16Bit(MPY32_MULTIPLY_SIGNED, 0x4000);
+    MPY32_setOperandTwo16Bit(0x4000);
+    TEST_ASSERT_EQUAL_HEX64(0x20000000, MPY32_getResult());
+
+    /*** -1 x -1 Overflows Without, Saturates With MPYSAT ***/
+    MPY32_setOperandOne16Bit(MPY32_MULTIPLY_SIGNED, 0x8000);
+    MPY32_setOperandTwo16Bit(0x8000);
+    TEST_ASSERT_EQUAL_HEX32(0x80000000, (uint32_t)MPY32_getResult());
+    MPY32_enableSaturationMode();
+    TEST_ASSERT_EQUAL_HEX32(0x7FFFFFFF, (uint32_t)MPY32_getResult());
+    MPY32_disableFractionalMode();
+
+    /*** Signed Accumulate Overflow ***/
+    MPY32_setOperandOne16Bit(MPY32_MULTIPLY_SIGNED, 0x7FFF);
+    MPY32_setOperandTwo16Bit(0x7FFF);
+    MPY32_setOperandOne16Bit(MPY32_MULTIPLYACCUMULATE_SIGNED, 0x7FFF);
+    MPY32_setOperandTwo16Bit(0x7FFF);
+    MPY32_setOperandOne16Bit(MPY32_MULTIPLYACCUMULATE_SIGNED, 0x7FFF);
+    MPY32_setOperandTwo16Bit(0x7FFF);
+    TEST_ASSERT_EQUAL_HEX32(0x7FFFFFFF, (uint32_t)MPY32_getResult());
+    TEST_ASSERT_EQUAL_HEX16(0x0000, MPY32_getSumExtension());
+    MPY32_disableSaturationMode();
+    TEST_ASSERT_EQUAL_HEX32(0xBFFD0003, (uint32_t)MPY32_getResult());
+}
+
+/****************************************************************************************************
+ * Test Group Runner
+ ****************************************************************************************************/
+
+TEST_GROUP_RUNNER(sim_model_test)
+{
+    RUN_TEST_CASE(sim_model_test, adc12)
+    RUN_TEST_CASE(sim_model_test, aes256)
+    RUN_TEST_CASE(sim_model_test, crc)
+    RUN_TEST_CASE(sim_model_test, gpio)
+    RUN_TEST_CASE(sim_model_test, memmap)
+    RUN_TEST_CASE(sim_model_test, mpy32)
+    RUN_TEST_CASE(sim_model_test, powerUpClear)
+}
@@ -12,9 +12,12 @@
 #include "gpio.h"
 #include "hw_memmap.h"
 #include "intrinsics.h"
+#include "lcd_c.h"
+#include "msp430fr5xx_6xxgeneric.h"
 #include "msp430fr6989.h"
 #include <stdint.h>
 #include "system.h"
+#include "system_test.h"
 #include "unity_fixture.h"
 
 /****************************************************************************************************
@@ -45,6 +48,91 @@ TEST_TEAR_DOWN(system_test)
  * Tests
  ****************************************************************************************************/
 
+TEST(system_test, boot)
+{
+    system_boot_t boot;
+
+    /********************************************************************************
+     * Test 1: Cold Boot
+     ********************************************************************************/
+
+    /*** Subtest 1: No Reset Cause (Setup): Everything Initialized ***/
+    system_getBoot(&boot);
+    TEST_ASSERT_FALSE(boot.warm);
+    TEST_ASSERT_EQUAL_HEX16(0, boot.kept);
+    TEST_ASSERT_EQUAL_HEX16(SYSTEM_SIGNATURE ^ SYSTEM_SUBSYSTEM_LCD, system_signatures[SYSTEM_SUBSYSTEM_LCD]);
+
+    /*** Subtest 2: Brownout ***/
+    HWREG16(CS_BASE + OFS_CSCTL4) &= (uint16_t)~LFXTDRIVE_3; // Marks: Rewritten Only If Initialized Again
+    HWREG16(LCD_C_BASE + OFS_LCDCCTL0) &= (uint16_t)~(LCDMX2 | LCDMX1 | LCDMX0);
+    HWREG16(SYS_BASE + OFS_SYSRSTIV) = SYSRSTIV_BOR;
+    system_init();
+    system_getBoot(&boot);
+    TEST_ASSERT_EQUAL_HEX16(SYSRSTIV_BOR, boot.resetCause);
+    TEST_ASSERT_FALSE(boot.warm);
+    TEST_ASSERT_EQUAL_HEX16(0, boot.kept);
+    TEST_ASSERT_EQUAL_HEX16(CS_LFXT_DRIVE_3, HWREG16(CS_BASE + OFS_CSCTL4) & LFXTDRIVE_3);
+    TEST_ASSERT_EQUAL_HEX16(LCD_C_4_MUX, HWREG16(LCD_C_BASE + OFS_LCDCCTL0) & (LCDMX2 | LCDMX1 | LCDMX0));
+
+    /********************************************************************************
+     * Test 2: Warm Boot
+     ********************************************************************************/
+
+    /*** Subtest 1: Watchdog Password Violation (system_reset()): LCD Skipped (Its Registers Survive The PUC), LFXT Started Again (PUC Resets CS) ***/
+    HWREG16(LCD_C_BASE + OFS_LCDCCTL0) &= (uint16_t)~(LCDMX2 | LCDMX1 | LCDMX0);
+    system_reset();
+    hwMemmap_powerUpClear(SYSRSTIV_WDTKEY);
+    TEST_ASSERT_EQUAL_HEX16(SYSRSTIV_WDTKEY, system_getResetCause());
+    system_init();
+    system_getBoot(&boot);
+    TEST_ASSERT_EQUAL_HEX16(SYSRSTIV_WDTKEY, boot.resetCause);
+    TEST_ASSERT_TRUE(boot.warm);
+    TEST_ASSERT_EQUAL_HEX16(1u << SYSTEM_SUBSYSTEM_LCD, boot.kept);
+    TEST_ASSERT_EQUAL_HEX16(0, HWREG16(CS_BASE + OFS_CSCTL4) & LFXTOFF);
+    TEST_ASSERT_EQUAL_HEX16(CS_LFXT_DRIVE_3, HWREG16(CS_BASE + OFS_CSCTL4) & LFXTDRIVE_3);
+    TEST_ASSERT_EQUAL_HEX16(0, HWREG16(LCD_C_BASE + OFS_LCDCCTL0) & (LCDMX2 | LCDMX1 | LCDMX0));
+
+    /*** Subtest 2: Everything Else Initialized As Usual ***/
+    TEST_ASSERT_NOT_EQUAL(0, HWREG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxBRW));
+    TEST_ASSERT_EQUAL_UINT32(32768, CS_getACLK());
+    TEST_ASSERT_EQUAL_UINT32(8000000, CS_getSMCLK());
+    TEST_ASSERT_TRUE(intrinsics_getInterruptsEnabled());
+
+    /*** Subtest 3: LCD No Longer Configured (Charge Pump Off) Is Initialized Again ***/
+    HWREG16(LCD_C_BASE + OFS_LCDCVCTL) &= (uint16_t)~LCDCPEN;
+    hwMemmap_powerUpClear(SYSRSTIV_WDTTO);
+    system_init();
+    system_getBoot(&boot);
+    TEST_ASSERT_TRUE(boot.warm);
+    TEST_ASSERT_EQUAL_HEX16(0, boot.kept);
+    TEST_ASSERT_EQUAL_HEX16(LCDCPEN, HWREG16(LCD_C_BASE + OFS_LCDCVCTL) & LCDCPEN);
+
+    /*** Subtest 4: Reset Part Way Through Initialization (Signature Cleared) ***/
+    system_signatures[SYSTEM_SUBSYSTEM_LCD] = 0;
+    hwMemmap_powerUpClear(SYSRSTIV_WDTTO);
+    HWREG16(LCD_C_BASE + OFS_LCDCCTL0) &= (uint16_t)~(LCDMX2 | LCDMX1 | LCDMX0);
+    system_init();
+    system_getBoot(&boot);
+    TEST_ASSERT_EQUAL_HEX16(0, boot.kept);
+    TEST_ASSERT_EQUAL_HEX16(LCD_C_4_MUX, HWREG16(LCD_C_BASE + OFS_LCDCCTL0) & (LCDMX2 | LCDMX1 | LCDMX0));
+    TEST_ASSERT_EQUAL_HEX16(SYSTEM_SIGNATURE ^ SYSTEM_SUBSYSTEM_LCD, system_signatures[SYSTEM_SUBSYSTEM_LCD]);
+
+    /********************************************************************************
+     * Test 3: Boot To CLI Ready Time
+     ********************************************************************************/
+
+    /*** Subtest 1: Reset SMCLK (1 MHz, Even After A PUC) Until The Clocks Are Set, Then 8 MHz (Simulated Timer Holds Its Count) ***/
+    hwMemmap_powerUpClear(SYSRSTIV_WDTTO);
+    TEST_ASSERT_EQUAL_UINT32(SYSTEM_RESET_SMCLK, CS_getSMCLK());
+    HWREG16(DRIVER_CONFIG_BOOT_TIMER + OFS_TAxR) = 100;
+    system_init();
+    system_getBoot(&boot);
+    TEST_ASSERT_EQUAL_UINT32((100 * SYSTEM_BOOT_TIMER_DIVIDER) + ((100 * SYSTEM_BOOT_TIMER_DIVIDER) / 8), boot.time);
+
+    /*** Subtest 2: Boot Timer Stopped ***/
+    TEST_ASSERT_EQUAL_HEX16(MC__STOP, HWREG16(DRIVER_CONFIG_BOOT_TIMER + OFS_TAxCTL) & MC);
+}
+
 TEST(system_test, init)
 {
     /********************************************************************************
@@ -135,6 +223,7 @@ TEST(system_test, reset)
 
 TEST_GROUP_RUNNER(system_test)
 {
+    RUN_TEST_CASE(system_test, boot)
     RUN_TEST_CASE(system_test, init)
     RUN_TEST_CASE(system_test, initClocks)
     RUN_TEST_CASE(system_test, reset)
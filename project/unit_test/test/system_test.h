@@ -0,0 +1,23 @@
+/****************************************************************************************************
+ * FILE:    system_test.h
+ * BRIEF:   System Test Header File
+ ****************************************************************************************************/
+
+#ifndef SYSTEM_TEST_H
+#define SYSTEM_TEST_H
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "system.h"
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+extern system_boot_t system_boot;
+extern uint16_t system_signatures[SYSTEM_SUBSYSTEM_COUNT];
+
+#endif
@@ -0,0 +1,365 @@
+/****************************************************************************************************
+ * FILE:    trace_driver_test.c
+ * BRIEF:   Trace Driver Test Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define TRACE_DRIVER_TEST_CAPTURE_LENGTH (4096)
+#define TRACE_DRIVER_TEST_JSON_LENGTH    (16384)
+#define TRACE_DRIVER_TEST_TIMER_STEP     (97) // Timer Ticks Per Register Access (Wraps Every ~676 Accesses)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "button_driver.h"
+#include "cli_callback.h"
+#include "cli_callback_test.h"
+#include "driver_config.h"
+#include "hw_memmap.h"
+#include "interrupt_handler.h"
+#include "interrupt_handler_test.h"
+#include "intrinsics.h"
+#include "log_driver.h"
+#include "msp430fr5xx_6xxgeneric.h"
+#include "msp430fr6989.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "system.h"
+#include "trace_converter.h"
+#include "trace_driver.h"
+#include "trace_driver_test.h"
+#include "unity_fixture.h"
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static uint8_t traceDriverTest_capture[TRACE_DRIVER_TEST_CAPTURE_LENGTH];
+static size_t traceDriverTest_captureLength;
+static char traceDriverTest_json[TRACE_DRIVER_TEST_JSON_LENGTH];
+static uint32_t traceDriverTest_overflowCount;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void traceDriverTest_timerAccessCallback(const uint32_t Address);
+static void traceDriverTest_writeCallback(const uint8_t * const Data, const size_t Length);
+
+/****************************************************************************************************
+ * Function Definitions
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   traceDriverTest_timerAccessCallback
+ * BRIEF:   Timer Access Callback
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Accessed Address (Unused)
+ * NOTE:    The Trace Timer Advances On Every Register Access; An Overflow Sets TBIFG, And The
+ *          Overflow Interrupt Is Taken At The First Access With Interrupts Enabled
+ ****************************************************************************************************/
+static void traceDriverTest_timerAccessCallback(const uint32_t Address)
+{
+    uint16_t count;
+
+    (void)Address;
+
+    /*** Advance ***/
+    count = HW_MEMMAP_REG16(DRIVER_CONFIG_TRACE_TIMER + OFS_TBxR);
+    HW_MEMMAP_REG16(DRIVER_CONFIG_TRACE_TIMER + OFS_TBxR) = (uint16_t)(count + TRACE_DRIVER_TEST_TIMER_STEP);
+    if((uint16_t)(count + TRACE_DRIVER_TEST_TIMER_STEP) < count)
+    {
+        HW_MEMMAP_REG16(DRIVER_CONFIG_TRACE_TIMER + OFS_TBxCTL) |= TBIFG;
+        traceDriverTest_overflowCount++;
+    }
+
+    /*** Overflow Interrupt (Reading TB0IV Clears TBIFG) ***/
+    if(((HW_MEMMAP_REG16(DRIVER_CONFIG_TRACE_TIMER + OFS_TBxCTL) & TBIFG) == TBIFG) && intrinsics_getInterruptsEnabled())
+    {
+        HW_MEMMAP_REG16(DRIVER_CONFIG_TRACE_TIMER + OFS_TBxCTL) &= (uint16_t)~TBIFG;
+        HW_MEMMAP_REG16(DRIVER_CONFIG_TRACE_TIMER + OFS_TBxIV) = TB0IV_TBIFG;
+        (void)intrinsics_callInterruptHandler(interruptHandler_timer0B1Vector);
+        HW_MEMMAP_REG16(DRIVER_CONFIG_TRACE_TIMER + OFS_TBxIV) = TB0IV_NONE;
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   traceDriverTest_writeCallback
+ * BRIEF:   Write Callback (Capture)
+ * RETURN:  Returns Nothing
+ * ARG:     Data: Data
+ * ARG:     Length: Length (Bytes)
+ ****************************************************************************************************/
+static void traceDriverTest_writeCallback(const uint8_t * const Data, const size_t Length)
+{
+    /*** Capture ***/
+    if(Length <= (sizeof(traceDriverTest_capture) - traceDriverTest_captureLength))
+    {
+        (void)memcpy(&traceDriverTest_capture[traceDriverTest_captureLength], Data, Length);
+        traceDriverTest_captureLength += Length;
+    }
+}
+
+/****************************************************************************************************
+ * Test Group
+ ****************************************************************************************************/
+
+TEST_GROUP(trace_driver_test);
+
+/****************************************************************************************************
+ * Test Setup And Teardown
+ ****************************************************************************************************/
+
+TEST_SETUP(trace_driver_test)
+{
+    /*** Set Up ***/
+    /* Simulation */
+    hwMemmap_init();
+
+    /* Application */
+    system_init();
+
+    /* Test */
+    cliCallbackTest_init();
+    traceDriver_init(traceDriverTest_writeCallback);
+    traceDriverTest_captureLength = 0;
+    traceDriverTest_overflowCount = 0;
+}
+
+TEST_TEAR_DOWN(trace_driver_test)
+{
+    /*** Tear Down ***/
+    interruptHandlerTest_stopFuzzer();
+    hwMemmap_unregisterAccessCallback(traceDriverTest_timerAccessCallback);
+}
+
+/****************************************************************************************************
+ * Tests
+ ****************************************************************************************************/
+
+TEST(trace_driver_test, dump)
+{
+    traceDriver_dumpHeader_t header;
+    traceDriver_record_t record;
+    FILE *output;
+    uint16_t i;
+
+    /********************************************************************************
+     * Test 1: Oldest Records Overwritten
+     ********************************************************************************/
+
+    /*** Set Up ***/
+    for(i = 0; i < (TRACE_DRIVER_RECORD_COUNT + 8); i++)
+    {
+        HWREG16(DRIVER_CONFIG_TRACE_TIMER + OFS_TBxR) = (uint16_t)(i * 100);
+        if((i % 2) == 0)
+            TRACE_DRIVER_BEGIN(TRACE_DRIVER_EVENT_PORT1_VECTOR, i);
+        else
+            TRACE_DRIVER_END(TRACE_DRIVER_EVENT_PORT1_VECTOR, i);
+    }
+    traceDriver_dump();
+
+    /*** Subtest 1: Header ***/
+    TEST_ASSERT_EQUAL_size_t(sizeof(header) + (TRACE_DRIVER_RECORD_COUNT * sizeof(record)), traceDriverTest_captureLength);
+    (void)memcpy(&header, traceDriverTest_capture, sizeof(header));
+    TEST_ASSERT_EQUAL_HEX32(TRACE_DRIVER_DUMP_MAGIC, header.magic);
+    TEST_ASSERT_EQUAL_UINT32(8000000, header.hertz);
+    TEST_ASSERT_EQUAL_UINT16(TRACE_DRIVER_RECORD_COUNT, header.recordCount);
+    TEST_ASSERT_EQUAL_UINT16(8, header.lostCount);
+
+    /*** Subtest 2: Records Oldest First ***/
+    for(i = 0; i < TRACE_DRIVER_RECORD_COUNT; i++)
+    {
+        (void)memcpy(&record, &traceDriverTest_capture[sizeof(header) + (i * sizeof(record))], sizeof(record));
+        TEST_ASSERT_EQUAL_UINT32((uint32_t)(i + 8) * 100, record.timestamp);
+        TEST_ASSERT_EQUAL_HEX16(TRACE_DRIVER_EVENT_PORT1_VECTOR | (((i % 2) == 0) ? 0 : TRACE_DRIVER_EVENT_END), record.event);
+        TEST_ASSERT_EQUAL_UINT16(i + 8, record.payload);
+    }
+
+    /*** Subtest 3: Chrome Trace JSON ***/
+    (void)memset(traceDriverTest_json, 0, sizeof(traceDriverTest_json));
+    output = fmemopen(traceDriverTest_json, sizeof(traceDriverTest_json) - 1, "w");
+    TEST_ASSERT_NOT_NULL(output);
+    TEST_ASSERT_EQUAL_size_t(TRACE_DRIVER_RECORD_COUNT, traceConverter_convert(traceDriverTest_capture, traceDriverTest_captureLength, output));
+    (void)fclose(output);
+    TEST_ASSERT_NOT_NULL(strstr(traceDriverTest_json, "{\"name\":\"8 Records Lost\",\"ph\":\"i\",\"s\":\"g\",\"ts\":100.000,"));
+    TEST_ASSERT_NOT_NULL(strstr(traceDriverTest_json, "{\"name\":\"PORT1_VECTOR\",\"ph\":\"B\",\"ts\":100.000,\"pid\":1,\"tid\":1,\"args\":{\"payload\":8}}"));
+    TEST_ASSERT_NOT_NULL(strstr(traceDriverTest_json, "{\"name\":\"PORT1_VECTOR\",\"ph\":\"E\",\"ts\":287.500,\"pid\":1,\"tid\":1,\"args\":{\"payload\":23}}"));
+
+    /********************************************************************************
+     * Test 2: Only New Records In The Next Dump
+     ********************************************************************************/
+
+    /*** Subtest 1: Empty ***/
+    traceDriverTest_captureLength = 0;
+    traceDriver_dump();
+    (void)memcpy(&header, traceDriverTest_capture, sizeof(header));
+    TEST_ASSERT_EQUAL_size_t(sizeof(header), traceDriverTest_captureLength);
+    TEST_ASSERT_EQUAL_UINT16(0, header.recordCount);
+    TEST_ASSERT_EQUAL_UINT16(0, header.lostCount);
+
+    /*** Subtest 2: Wrapped Around The Ring ***/
+    traceDriverTest_captureLength = 0;
+    TRACE_DRIVER_BEGIN(TRACE_DRIVER_EVENT_LOG_DRAIN, 1);
+    traceDriver_dump();
+    TEST_ASSERT_EQUAL_size_t(sizeof(header) + sizeof(record), traceDriverTest_captureLength);
+    (void)memcpy(&record, &traceDriverTest_capture[sizeof(header)], sizeof(record));
+    TEST_ASSERT_EQUAL_HEX16(TRACE_DRIVER_EVENT_LOG_DRAIN, record.event);
+}
+
+TEST(trace_driver_test, fuzzMainLoop)
+{
+    traceDriver_dumpHeader_t header;
+    traceDriver_record_t record, previous;
+    char message[64];
+    bool havePrevious, pairOpen;
+    size_t offset;
+    uint32_t commandsSent, i, interruptSpans;
+    const uint32_t IterationLimit = 20000;
+
+    /********************************************************************************
+     * Test 1: Records From Interrupts Injected At Random Yield Points
+     ********************************************************************************/
+
+    /*** Set Up ***/
+    commandsSent = 0;
+    interruptHandlerTest_startFuzzer(4096); // 1 In 16 Yield Points
+    TEST_ASSERT_TRUE(hwMemmap_registerAccessCallback(traceDriverTest_timerAccessCallback));
+    (void)snprintf(message, sizeof(message), "%s=%lu", INTERRUPT_HANDLER_TEST_FUZZER_SEED_VARIABLE, (unsigned long)interruptHandlerTest_getFuzzerSeed());
+
+    /*** Main Loop, Dumping Every Iteration ***/
+    havePrevious = false;
+    interruptSpans = 0;
+    for(i = 0; i < IterationLimit; i++)
+    {
+        /* Host Keeps Sending Commands */
+        if(interruptHandlerTest_queueFuzzerReceiveCharacters("random -s\n"))
+            commandsSent++;
+
+        /* Tick */
+        buttonDriver_tick();
+        cliCallback_tick();
+        logDriver_tick();
+        traceDriverTest_captureLength = 0;
+        traceDriver_dump();
+
+        /* Dump */
+        TEST_ASSERT_TRUE_MESSAGE(traceDriverTest_captureLength >= sizeof(header), message);
+        (void)memcpy(&header, traceDriverTest_capture, sizeof(header));
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE(TRACE_DRIVER_DUMP_MAGIC, header.magic, message);
+        TEST_ASSERT_EQUAL_size_t_MESSAGE(sizeof(header) + (header.recordCount * sizeof(record)), traceDriverTest_captureLength, message);
+        if(header.lostCount > 0)
+            havePrevious = false;
+
+        /* Records: Timestamps Strictly Increase; Interrupt Handlers Run To Completion (Begin Then Its End) */
+        pairOpen = false;
+        for(offset = sizeof(header); offset < traceDriverTest_captureLength; offset += sizeof(record))
+        {
+            (void)memcpy(&record, &traceDriverTest_capture[offset], sizeof(record));
+            if(havePrevious)
+                TEST_ASSERT_TRUE_MESSAGE(record.timestamp > previous.timestamp, message);
+            if(pairOpen)
+            {
+                TEST_ASSERT_EQUAL_HEX16_MESSAGE(previous.event | TRACE_DRIVER_EVENT_END, record.event, message);
+                TEST_ASSERT_EQUAL_UINT16_MESSAGE(previous.payload, record.payload, message);
+                pairOpen = false;
+                interruptSpans++;
+            }
+            else if((record.event >= TRACE_DRIVER_EVENT_PORT1_VECTOR) && (record.event <= TRACE_DRIVER_EVENT_USCI_A1_VECTOR))
+            {
+                pairOpen = true;
+            }
+            previous = record;
+            havePrevious = true;
+        }
+    }
+
+    /*** Clean Up ***/
+    interruptHandlerTest_stopFuzzer();
+    hwMemmap_unregisterAccessCallback(traceDriverTest_timerAccessCallback);
+
+    /*** Interrupts Traced, Timer Extended Past 16 Bits ***/
+    TEST_ASSERT_NOT_EQUAL_MESSAGE(0, commandsSent, message);
+    TEST_ASSERT_NOT_EQUAL_MESSAGE(0, interruptSpans, message);
+    TEST_ASSERT_NOT_EQUAL_MESSAGE(0, traceDriverTest_overflowCount, message);
+    if((HW_MEMMAP_REG16(DRIVER_CONFIG_TRACE_TIMER + OFS_TBxCTL) & TBIFG) == TBIFG)
+        traceDriverTest_overflowCount--; // Last Overflow Still Pending
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE((uint16_t)traceDriverTest_overflowCount, traceDriver_overflowCount, message);
+}
+
+TEST(trace_driver_test, init)
+{
+    /********************************************************************************
+     * Test 1: Initialize
+     ********************************************************************************/
+
+    /*** Subtest 1: Timer: SMCLK, Continuous Mode, Overflow Interrupt ***/
+    TEST_ASSERT_EQUAL_HEX16(TBSSEL__SMCLK, HWREG16(DRIVER_CONFIG_TRACE_TIMER + OFS_TBxCTL) & (TBSSEL1 | TBSSEL0));
+    TEST_ASSERT_EQUAL_HEX16(MC__CONTINUOUS, HWREG16(DRIVER_CONFIG_TRACE_TIMER + OFS_TBxCTL) & MC);
+    TEST_ASSERT_EQUAL_HEX16(TBIE, HWREG16(DRIVER_CONFIG_TRACE_TIMER + OFS_TBxCTL) & TBIE);
+
+    /*** Subtest 2: Empty ***/
+    TEST_ASSERT_EQUAL_UINT16(0, traceDriver_index);
+    TEST_ASSERT_EQUAL_UINT16(0, traceDriver_dumpIndex);
+}
+
+TEST(trace_driver_test, record)
+{
+    /********************************************************************************
+     * Test 1: Timestamp
+     ********************************************************************************/
+
+    /*** Subtest 1: Overflow Count And Timer Count ***/
+    traceDriver_overflowCount = 2;
+    HWREG16(DRIVER_CONFIG_TRACE_TIMER + OFS_TBxR) = 0x1234;
+    TRACE_DRIVER_BEGIN(TRACE_DRIVER_EVENT_USCI_A1_VECTOR, USCI_UART_UCRXIFG);
+    TEST_ASSERT_EQUAL_HEX32(0x00021234, traceDriver_records[0].timestamp);
+    TEST_ASSERT_EQUAL_HEX16(TRACE_DRIVER_EVENT_USCI_A1_VECTOR, traceDriver_records[0].event);
+    TEST_ASSERT_EQUAL_HEX16(USCI_UART_UCRXIFG, traceDriver_records[0].payload);
+
+    /*** Subtest 2: Overflow Pending, Timer Count Read After It ***/
+    HWREG16(DRIVER_CONFIG_TRACE_TIMER + OFS_TBxCTL) |= TBIFG;
+    HWREG16(DRIVER_CONFIG_TRACE_TIMER + OFS_TBxR) = 0x0005;
+    TRACE_DRIVER_END(TRACE_DRIVER_EVENT_USCI_A1_VECTOR, USCI_UART_UCRXIFG);
+    TEST_ASSERT_EQUAL_HEX32(0x00030005, traceDriver_records[1].timestamp);
+    TEST_ASSERT_EQUAL_HEX16(TRACE_DRIVER_EVENT_USCI_A1_VECTOR | TRACE_DRIVER_EVENT_END, traceDriver_records[1].event);
+
+    /*** Subtest 3: Overflow Pending, Timer Count Read Before It ***/
+    HWREG16(DRIVER_CONFIG_TRACE_TIMER + OFS_TBxR) = 0xFFFE;
+    TRACE_DRIVER_BEGIN(TRACE_DRIVER_EVENT_CLI_PROCESS_INPUT, 0);
+    TEST_ASSERT_EQUAL_HEX32(0x0002FFFE, traceDriver_records[2].timestamp);
+
+    /*** Subtest 4: Overflow Counted By The Interrupt Handler ***/
+    HWREG16(DRIVER_CONFIG_TRACE_TIMER + OFS_TBxIV) = TB0IV_TBIFG;
+    TEST_ASSERT_TRUE(intrinsics_callInterruptHandler(interruptHandler_timer0B1Vector));
+    TEST_ASSERT_EQUAL_UINT16(3, traceDriver_overflowCount);
+    TEST_ASSERT_EQUAL_UINT16(3, traceDriver_index); // Not Traced Itself
+
+    /********************************************************************************
+     * Test 2: Paused While Dumping
+     ********************************************************************************/
+
+    /*** Subtest 1: Nothing Recorded ***/
+    traceDriver_paused = true;
+    TRACE_DRIVER_BEGIN(TRACE_DRIVER_EVENT_LOG_DRAIN, 0);
+    TEST_ASSERT_EQUAL_UINT16(3, traceDriver_index);
+}
+
+/****************************************************************************************************
+ * Test Group Runner
+ ****************************************************************************************************/
+
+TEST_GROUP_RUNNER(trace_driver_test)
+{
+    RUN_TEST_CASE(trace_driver_test, dump)
+    RUN_TEST_CASE(trace_driver_test, fuzzMainLoop)
+    RUN_TEST_CASE(trace_driver_test, init)
+    RUN_TEST_CASE(trace_driver_test, record)
+}
@@ -0,0 +1,27 @@
+/****************************************************************************************************
+ * FILE:    trace_driver_test.h
+ * BRIEF:   Trace Driver Test Header File
+ ****************************************************************************************************/
+
+#ifndef TRACE_DRIVER_TEST_H
+#define TRACE_DRIVER_TEST_H
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "trace_driver.h"
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+extern volatile uint16_t traceDriver_dumpIndex;
+extern volatile uint16_t traceDriver_index;
+extern volatile uint16_t traceDriver_overflowCount;
+extern volatile bool traceDriver_paused;
+extern traceDriver_record_t traceDriver_records[TRACE_DRIVER_RING_COUNT];
+
+#endif
@@ -0,0 +1,199 @@
+/****************************************************************************************************
+ * FILE:    vector_driver_test.c
+ * BRIEF:   Vector Driver Test Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define VECTOR_DRIVER_TEST_FRAM(VECTOR) HW_MEMMAP_REG16(VECTOR_DRIVER_FRAM_START + ((VECTOR) * 2))
+#define VECTOR_DRIVER_TEST_RAM(VECTOR)  HW_MEMMAP_REG16(VECTOR_DRIVER_RAM_START + ((VECTOR) * 2))
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "hw_memmap.h"
+#include "msp430fr5xx_6xxgeneric.h"
+#include "msp430fr6989.h"
+#include <stddef.h>
+#include <stdint.h>
+#include "unity_fixture.h"
+#include "vector_driver.h"
+#include "vector_driver_test.h"
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void vectorDriverTest_handler(void);
+static void vectorDriverTest_otherHandler(void);
+
+/****************************************************************************************************
+ * Function Definitions
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   vectorDriverTest_handler
+ * BRIEF:   Handler
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ ****************************************************************************************************/
+static void vectorDriverTest_handler(void)
+{
+    /*** Nothing To Do ***/
+}
+
+/****************************************************************************************************
+ * FUNCT:   vectorDriverTest_otherHandler
+ * BRIEF:   Other Handler
+ * RETURN:  Returns Nothing
+ * ARG:     No Arguments
+ ****************************************************************************************************/
+static void vectorDriverTest_otherHandler(void)
+{
+    /*** Nothing To Do ***/
+}
+
+/****************************************************************************************************
+ * Test Group
+ ****************************************************************************************************/
+
+TEST_GROUP(vector_driver_test);
+
+/****************************************************************************************************
+ * Test Setup And Teardown
+ ****************************************************************************************************/
+
+TEST_SETUP(vector_driver_test)
+{
+    uint8_t vector;
+
+    /*** Set Up ***/
+    /* Simulation: Linked Handlers In The FRAM Table */
+    hwMemmap_init();
+    for(vector = 0; vector < VECTOR_DRIVER_COUNT; vector++)
+        VECTOR_DRIVER_TEST_FRAM(vector) = (uint16_t)(0x4400 + (vector * 0x10));
+
+    /* Initialization */
+    vectorDriver_init();
+}
+
+TEST_TEAR_DOWN(vector_driver_test)
+{
+    /*** Tear Down ***/
+}
+
+/****************************************************************************************************
+ * Tests
+ ****************************************************************************************************/
+
+TEST(vector_driver_test, init)
+{
+    uint8_t vector;
+
+    /********************************************************************************
+     * Test 1: RAM Table
+     ********************************************************************************/
+
+    /*** Subtest 1: Copy Of The FRAM Table, Nothing Installed ***/
+    for(vector = 0; vector < VECTOR_DRIVER_COUNT; vector++)
+    {
+        TEST_ASSERT_EQUAL_HEX16(VECTOR_DRIVER_TEST_FRAM(vector), VECTOR_DRIVER_TEST_RAM(vector));
+        TEST_ASSERT_NULL(vectorDriver_getHandler(vector));
+    }
+
+    /*** Subtest 2: Ends At The Top Of RAM ***/
+    TEST_ASSERT_EQUAL_HEX16(0x2400, VECTOR_DRIVER_RAM_START + VECTOR_DRIVER_RAM_LENGTH);
+
+    /********************************************************************************
+     * Test 2: SYSRIVECT
+     ********************************************************************************/
+
+    /*** Subtest 1: Vectors Fetched From RAM ***/
+    TEST_ASSERT_EQUAL_HEX16(SYSRIVECT, HW_MEMMAP_REG16(SYS_BASE + OFS_SYSCTL) & SYSRIVECT);
+
+    /********************************************************************************
+     * Test 3: Re-Initialization
+     ********************************************************************************/
+
+    /*** Subtest 1: Installed Handlers Dropped ***/
+    TEST_ASSERT_TRUE(vectorDriver_install(USCI_A1_VECTOR, vectorDriverTest_handler));
+    vectorDriver_init();
+    TEST_ASSERT_EQUAL_HEX16(VECTOR_DRIVER_TEST_FRAM(USCI_A1_VECTOR), VECTOR_DRIVER_TEST_RAM(USCI_A1_VECTOR));
+    TEST_ASSERT_NULL(vectorDriver_getHandler(USCI_A1_VECTOR));
+}
+
+TEST(vector_driver_test, install)
+{
+    /********************************************************************************
+     * Test 1: Install
+     ********************************************************************************/
+
+    /*** Subtest 1: Slot Points At The Handler, Neighbours Untouched ***/
+    TEST_ASSERT_TRUE(vectorDriver_install(USCI_A1_VECTOR, vectorDriverTest_handler));
+    TEST_ASSERT_EQUAL_HEX16((uint16_t)(uintptr_t)vectorDriverTest_handler, VECTOR_DRIVER_TEST_RAM(USCI_A1_VECTOR));
+    TEST_ASSERT_EQUAL_PTR(vectorDriverTest_handler, vectorDriver_getHandler(USCI_A1_VECTOR));
+    TEST_ASSERT_EQUAL_HEX16(VECTOR_DRIVER_TEST_FRAM(USCI_A1_VECTOR - 1), VECTOR_DRIVER_TEST_RAM(USCI_A1_VECTOR - 1));
+    TEST_ASSERT_EQUAL_HEX16(VECTOR_DRIVER_TEST_FRAM(USCI_A1_VECTOR + 1), VECTOR_DRIVER_TEST_RAM(USCI_A1_VECTOR + 1));
+
+    /*** Subtest 2: Replace ***/
+    TEST_ASSERT_TRUE(vectorDriver_install(USCI_A1_VECTOR, vectorDriverTest_otherHandler));
+    TEST_ASSERT_EQUAL_PTR(vectorDriverTest_otherHandler, vectorDriver_getHandler(USCI_A1_VECTOR));
+
+    /*** Subtest 3: FRAM Table Untouched ***/
+    TEST_ASSERT_EQUAL_HEX16(0x4400 + (USCI_A1_VECTOR * 0x10), VECTOR_DRIVER_TEST_FRAM(USCI_A1_VECTOR));
+
+    /********************************************************************************
+     * Test 2: Invalid
+     ********************************************************************************/
+
+    /*** Subtest 1: Reset Vector ***/
+    TEST_ASSERT_FALSE(vectorDriver_install(RESET_VECTOR, vectorDriverTest_handler));
+    TEST_ASSERT_EQUAL_HEX16(VECTOR_DRIVER_TEST_FRAM(RESET_VECTOR), VECTOR_DRIVER_TEST_RAM(RESET_VECTOR));
+
+    /*** Subtest 2: Out Of Range ***/
+    TEST_ASSERT_FALSE(vectorDriver_install(VECTOR_DRIVER_COUNT, vectorDriverTest_handler));
+    TEST_ASSERT_NULL(vectorDriver_getHandler(VECTOR_DRIVER_COUNT));
+
+    /*** Subtest 3: NULL Handler ***/
+    TEST_ASSERT_FALSE(vectorDriver_install(PORT1_VECTOR, NULL));
+    TEST_ASSERT_EQUAL_HEX16(VECTOR_DRIVER_TEST_FRAM(PORT1_VECTOR), VECTOR_DRIVER_TEST_RAM(PORT1_VECTOR));
+}
+
+TEST(vector_driver_test, restore)
+{
+    /********************************************************************************
+     * Test 1: Restore
+     ********************************************************************************/
+
+    /*** Subtest 1: Back To The Linked Handler ***/
+    TEST_ASSERT_TRUE(vectorDriver_install(TIMER0_A1_VECTOR, vectorDriverTest_handler));
+    TEST_ASSERT_TRUE(vectorDriver_restore(TIMER0_A1_VECTOR));
+    TEST_ASSERT_EQUAL_HEX16(VECTOR_DRIVER_TEST_FRAM(TIMER0_A1_VECTOR), VECTOR_DRIVER_TEST_RAM(TIMER0_A1_VECTOR));
+    TEST_ASSERT_NULL(vectorDriver_getHandler(TIMER0_A1_VECTOR));
+
+    /*** Subtest 2: Nothing Installed ***/
+    TEST_ASSERT_TRUE(vectorDriver_restore(TIMER0_A1_VECTOR));
+    TEST_ASSERT_EQUAL_HEX16(VECTOR_DRIVER_TEST_FRAM(TIMER0_A1_VECTOR), VECTOR_DRIVER_TEST_RAM(TIMER0_A1_VECTOR));
+
+    /********************************************************************************
+     * Test 2: Invalid
+     ********************************************************************************/
+
+    /*** Subtest 1: Reset Vector And Out Of Range ***/
+    TEST_ASSERT_FALSE(vectorDriver_restore(RESET_VECTOR));
+    TEST_ASSERT_FALSE(vectorDriver_restore(VECTOR_DRIVER_COUNT));
+}
+
+/****************************************************************************************************
+ * Test Group Runner
+ ****************************************************************************************************/
+
+TEST_GROUP_RUNNER(vector_driver_test)
+{
+    RUN_TEST_CASE(vector_driver_test, init)
+    RUN_TEST_CASE(vector_driver_test, install)
+    RUN_TEST_CASE(vector_driver_test, restore)
+}
@@ -0,0 +1,21 @@
+/****************************************************************************************************
+ * FILE:    vector_driver_test.h
+ * BRIEF:   Vector Driver Test Header File
+ ****************************************************************************************************/
+
+#ifndef VECTOR_DRIVER_TEST_H
+#define VECTOR_DRIVER_TEST_H
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "vector_driver.h"
+
+/****************************************************************************************************
+ * Constants And Variables
+ ****************************************************************************************************/
+
+extern vectorDriver_handler_t vectorDriver_handlers[VECTOR_DRIVER_COUNT];
+
+#endif
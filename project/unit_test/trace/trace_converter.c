@@ -0,0 +1,129 @@
+/****************************************************************************************************
+ * FILE:    trace_converter.c
+ * BRIEF:   Trace Converter Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define TRACE_CONVERTER_PROCESS_ID (1)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "trace_converter.h"
+#include "trace_driver.h"
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef enum traceConverter_track_e
+{
+    TRACE_CONVERTER_TRACK_MAIN_LOOP,
+    TRACE_CONVERTER_TRACK_INTERRUPTS
+} traceConverter_track_t;
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static const char * const traceConverter_eventNames[TRACE_DRIVER_EVENT_COUNT] =
+{
+    [TRACE_DRIVER_EVENT_NONE] = "None",
+    [TRACE_DRIVER_EVENT_PORT1_VECTOR] = "PORT1_VECTOR",
+    [TRACE_DRIVER_EVENT_TIMER0_A1_VECTOR] = "TIMER0_A1_VECTOR",
+    [TRACE_DRIVER_EVENT_USCI_A1_VECTOR] = "USCI_A1_VECTOR",
+    [TRACE_DRIVER_EVENT_CLI_PROCESS_INPUT] = "cli_processInput",
+    [TRACE_DRIVER_EVENT_LOG_DRAIN] = "logDriver_tick",
+    [TRACE_DRIVER_EVENT_PORT2_VECTOR] = "PORT2_VECTOR",
+    [TRACE_DRIVER_EVENT_PORT3_VECTOR] = "PORT3_VECTOR",
+    [TRACE_DRIVER_EVENT_PORT4_VECTOR] = "PORT4_VECTOR",
+};
+
+static const traceConverter_track_t traceConverter_eventTracks[TRACE_DRIVER_EVENT_COUNT] =
+{
+    [TRACE_DRIVER_EVENT_NONE] = TRACE_CONVERTER_TRACK_MAIN_LOOP,
+    [TRACE_DRIVER_EVENT_PORT1_VECTOR] = TRACE_CONVERTER_TRACK_INTERRUPTS,
+    [TRACE_DRIVER_EVENT_TIMER0_A1_VECTOR] = TRACE_CONVERTER_TRACK_INTERRUPTS,
+    [TRACE_DRIVER_EVENT_USCI_A1_VECTOR] = TRACE_CONVERTER_TRACK_INTERRUPTS,
+    [TRACE_DRIVER_EVENT_CLI_PROCESS_INPUT] = TRACE_CONVERTER_TRACK_MAIN_LOOP,
+    [TRACE_DRIVER_EVENT_LOG_DRAIN] = TRACE_CONVERTER_TRACK_MAIN_LOOP,
+    [TRACE_DRIVER_EVENT_PORT2_VECTOR] = TRACE_CONVERTER_TRACK_INTERRUPTS,
+    [TRACE_DRIVER_EVENT_PORT3_VECTOR] = TRACE_CONVERTER_TRACK_INTERRUPTS,
+    [TRACE_DRIVER_EVENT_PORT4_VECTOR] = TRACE_CONVERTER_TRACK_INTERRUPTS,
+};
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   traceConverter_convert
+ * BRIEF:   Convert
+ * RETURN:  size_t: Number Of Records Converted
+ * ARG:     Data: Capture (Dumps Anywhere In It; Other Bytes Are Skipped)
+ * ARG:     Length: Length (Bytes)
+ * ARG:     Output: Output (One JSON Document)
+ * NOTE:    A Span End Without Its Begin (Overwritten, Or In The Previous Dump) Is Dropped; Lost
+ *          Records Are Marked With A Global Instant Event
+ ****************************************************************************************************/
+size_t traceConverter_convert(const uint8_t * const Data, const size_t Length, FILE * const Output)
+{
+    traceDriver_dumpHeader_t header;
+    traceDriver_record_t record;
+    uint32_t open[TRACE_DRIVER_EVENT_COUNT];
+    uint16_t event, i;
+    size_t converted, offset;
+    double microseconds;
+    bool end;
+
+    /*** Metadata ***/
+    (void)fprintf(Output, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    (void)fprintf(Output, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":\"MSP430FR6989\"}},\n", TRACE_CONVERTER_PROCESS_ID);
+    (void)fprintf(Output, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"Main Loop\"}},\n", TRACE_CONVERTER_PROCESS_ID, TRACE_CONVERTER_TRACK_MAIN_LOOP);
+    (void)fprintf(Output, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"Interrupts\"}}", TRACE_CONVERTER_PROCESS_ID, TRACE_CONVERTER_TRACK_INTERRUPTS);
+
+    /*** Dumps ***/
+    converted = 0;
+    (void)memset(open, 0, sizeof(open));
+    for(offset = 0; (offset + sizeof(header)) <= Length; offset++)
+    {
+        /* Header */
+        (void)memcpy(&header, &Data[offset], sizeof(header));
+        if((header.magic != TRACE_DRIVER_DUMP_MAGIC) || (header.hertz == 0) || (header.recordCount > TRACE_DRIVER_RECORD_COUNT) || ((header.recordCount * sizeof(record)) > (Length - offset - sizeof(header))))
+            continue;
+        offset += sizeof(header);
+
+        /* Records */
+        for(i = 0; i < header.recordCount; i++, offset += sizeof(record))
+        {
+            (void)memcpy(&record, &Data[offset], sizeof(record));
+            microseconds = ((double)record.timestamp * 1e6) / header.hertz;
+            if((i == 0) && (header.lostCount > 0))
+                (void)fprintf(Output, ",\n{\"name\":\"%u Records Lost\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%.3f,\"pid\":%d,\"tid\":%d}", header.lostCount, microseconds, TRACE_CONVERTER_PROCESS_ID, TRACE_CONVERTER_TRACK_MAIN_LOOP);
+
+            /* Span Begin Or End */
+            end = ((record.event & TRACE_DRIVER_EVENT_END) == TRACE_DRIVER_EVENT_END);
+            event = (uint16_t)(record.event & ~TRACE_DRIVER_EVENT_END);
+            if((event == TRACE_DRIVER_EVENT_NONE) || (event >= TRACE_DRIVER_EVENT_COUNT))
+                continue;
+            if(end && (open[event] == 0))
+                continue;
+            open[event] = end ? (open[event] - 1) : (open[event] + 1);
+            (void)fprintf(Output, ",\n{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":%d,\"tid\":%d,\"args\":{\"payload\":%u}}", traceConverter_eventNames[event], end ? 'E' : 'B', microseconds, TRACE_CONVERTER_PROCESS_ID, traceConverter_eventTracks[event], record.payload);
+            converted++;
+        }
+        offset--; // Loop Increment
+    }
+    (void)fprintf(Output, "\n]}\n");
+
+    return converted;
+}
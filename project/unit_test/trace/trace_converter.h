@@ -0,0 +1,26 @@
+/****************************************************************************************************
+ * FILE:    trace_converter.h
+ * BRIEF:   Trace Converter Header File
+ * NOTE:    Host Side Of The Trace Ring (trace_driver.h): Finds "system --trace" Dumps In A Capture Of
+ *          The CLI Wire And Writes Chrome Trace Event JSON, Which chrome://tracing And
+ *          ui.perfetto.dev Open Directly; Interrupt Handlers And Main Loop Work Are Separate Tracks
+ ****************************************************************************************************/
+
+#ifndef TRACE_CONVERTER_H
+#define TRACE_CONVERTER_H
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern size_t traceConverter_convert(const uint8_t * const Data, const size_t Length, FILE * const Output);
+
+#endif
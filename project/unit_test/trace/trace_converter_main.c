@@ -0,0 +1,80 @@
+/****************************************************************************************************
+ * FILE:    trace_converter_main.c
+ * BRIEF:   Trace Converter Main Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "trace_converter.h"
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   main
+ * BRIEF:   Main Entry
+ * RETURN:  int: Exit Status
+ * ARG:     argc: Argument Count
+ * ARG:     argv: Arguments: CAPTURE [JSON]
+ * NOTE:    CAPTURE Holds The Bytes Received After "system --trace" (e.g. Saved By A Terminal
+ *          Program); JSON Defaults To stdout
+ ****************************************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint8_t *data;
+    FILE *input, *output;
+    size_t converted, length;
+    long inputLength;
+
+    /*** Parse Arguments ***/
+    if((argc < 2) || (argc > 3))
+    {
+        (void)fprintf(stderr, "Usage: %s CAPTURE [JSON]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    /*** Read Capture ***/
+    input = fopen(argv[1], "rb");
+    if(input == NULL)
+    {
+        perror(argv[1]);
+        return EXIT_FAILURE;
+    }
+    data = NULL;
+    length = 0;
+    if((fseek(input, 0, SEEK_END) == 0) && ((inputLength = ftell(input)) > 0) && (fseek(input, 0, SEEK_SET) == 0))
+    {
+        length = (size_t)inputLength;
+        data = malloc(length);
+        if((data != NULL) && (fread(data, 1, length, input) != length))
+            length = 0;
+    }
+    (void)fclose(input);
+    if(data == NULL)
+    {
+        (void)fprintf(stderr, "%s: Empty Or Unreadable\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    /*** Convert ***/
+    output = (argc == 3) ? fopen(argv[2], "w") : stdout;
+    if(output == NULL)
+    {
+        perror(argv[2]);
+        free(data);
+        return EXIT_FAILURE;
+    }
+    converted = traceConverter_convert(data, length, output);
+    if(output != stdout)
+        (void)fclose(output);
+    free(data);
+    (void)fprintf(stderr, "%zu Records\n", converted);
+
+    return (converted > 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
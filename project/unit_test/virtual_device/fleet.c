@@ -0,0 +1,386 @@
+/****************************************************************************************************
+ * FILE:    fleet.c
+ * BRIEF:   Fleet Source File
+ * NOTE:    Runs Many Independent Virtual Devices In One Process; Each Instance Is A Private Copy Of
+ *          The Virtual Device Image (Memory Map, Driver Statics, CLI State), Loaded From An In-Memory
+ *          Snapshot, And Is Time-Sliced As A Coroutine On A Worker Thread Pool
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define _GNU_SOURCE
+
+#define FLEET_RECEIVE_CHUNK_LENGTH (256)
+#define FLEET_STACK_SIZE           (256 * 1024)
+#define FLEET_YIELD_ACCESS_COUNT   (1000) // Register Accesses Per Time Slice
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <dlfcn.h>
+#include <libgen.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include "virtual_device.h"
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef struct fleet_worker_s
+{
+    ucontext_t context;
+    size_t index;
+    pthread_t thread;
+} fleet_worker_t;
+
+typedef struct fleet_instance_s
+{
+    bool (*addReceiveCharacter)(const char Character);
+    ucontext_t context;
+    int (*getPseudoTerminal)(void);
+    bool (*open)(const char * const LinkPath, const unsigned long BaudRate);
+    void (*run)(void);
+    void (*setYieldCallback)(const virtualDevice_yieldCallback_t Callback, void * const Argument, const uint32_t AccessCount);
+    fleet_worker_t *worker;
+} fleet_instance_t;
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static __thread fleet_instance_t *fleet_currentInstance;
+static uint8_t *fleet_image;
+static size_t fleet_imageLength;
+static size_t fleet_instanceCount;
+static fleet_instance_t *fleet_instances;
+static size_t fleet_workerCount;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static bool fleet_createInstance(fleet_instance_t * const Instance, const char * const LinkPath, const unsigned long BaudRate);
+static bool fleet_loadImage(const char * const Path);
+static void *fleet_receiveThread(void *Argument);
+static void fleet_runInstance(void);
+static void *fleet_workerThread(void *Argument);
+static void fleet_yield(void *Argument);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   main
+ * BRIEF:   Main Entry
+ * RETURN:  int: Exit Status (Only Returns On Error)
+ * ARG:     argc: Argument Count
+ * ARG:     argv: Arguments: -n COUNT [-w WORKERS] [-b BAUD_RATE] [-d LINK_DIRECTORY] [-i IMAGE]
+ * NOTE:    Device i Is Linked As LINK_DIRECTORY/device_i; The Default Image Is Next To This Executable
+ ****************************************************************************************************/
+int main(int argc, char *argv[])
+{
+    unsigned long baudRate = VIRTUAL_DEVICE_BAUD_RATE_DEFAULT;
+    char executablePath[PATH_MAX] = {0}, imagePath[PATH_MAX], linkPath[PATH_MAX];
+    const char *image = NULL, *linkDirectory = NULL;
+    fleet_worker_t *workers;
+    int option;
+    pthread_t receiveThread;
+    size_t i;
+
+    /*** Parse Arguments ***/
+    fleet_instanceCount = 0;
+    fleet_workerCount = (size_t)sysconf(_SC_NPROCESSORS_ONLN);
+    while((option = getopt(argc, argv, "b:d:i:n:w:")) != -1)
+    {
+        switch(option)
+        {
+            case 'b':
+                baudRate = strtoul(optarg, NULL, 0);
+                break;
+            case 'd':
+                linkDirectory = optarg;
+                break;
+            case 'i':
+                image = optarg;
+                break;
+            case 'n':
+                fleet_instanceCount = strtoul(optarg, NULL, 0);
+                break;
+            case 'w':
+                fleet_workerCount = strtoul(optarg, NULL, 0);
+                break;
+            default:
+                fleet_instanceCount = 0;
+                break;
+        }
+    }
+    if((fleet_instanceCount == 0) || (fleet_workerCount == 0))
+    {
+        (void)fprintf(stderr, "Usage: %s -n COUNT [-w WORKERS] [-b BAUD_RATE (0: Unthrottled)] [-d LINK_DIRECTORY] [-i IMAGE]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if(fleet_workerCount > fleet_instanceCount)
+        fleet_workerCount = fleet_instanceCount;
+
+    /*** Load Snapshot Of Device Image ***/
+    if(image == NULL)
+    {
+        if(readlink("/proc/self/exe", executablePath, sizeof(executablePath) - 1) < 0)
+        {
+            perror("/proc/self/exe");
+            return EXIT_FAILURE;
+        }
+        (void)snprintf(imagePath, sizeof(imagePath), "%s/%s", dirname(executablePath), VIRTUAL_DEVICE_IMAGE);
+        image = imagePath;
+    }
+    if(!fleet_loadImage(image))
+        return EXIT_FAILURE;
+
+    /*** Create Instances ***/
+    fleet_instances = calloc(fleet_instanceCount, sizeof(fleet_instance_t));
+    workers = calloc(fleet_workerCount, sizeof(fleet_worker_t));
+    if((fleet_instances == NULL) || (workers == NULL))
+    {
+        perror("calloc");
+        return EXIT_FAILURE;
+    }
+    for(i = 0; i < fleet_instanceCount; i++)
+    {
+        if(linkDirectory != NULL)
+            (void)snprintf(linkPath, sizeof(linkPath), "%s/device_%zu", linkDirectory, i);
+        fleet_instances[i].worker = &workers[i % fleet_workerCount];
+        if(!fleet_createInstance(&fleet_instances[i], (linkDirectory != NULL) ? linkPath : NULL, baudRate))
+            return EXIT_FAILURE;
+        (void)printf("Virtual Device %zu CLI: %s\n", i, (linkDirectory != NULL) ? linkPath : ptsname(fleet_instances[i].getPseudoTerminal()));
+    }
+    (void)fflush(stdout);
+
+    /*** Run ***/
+    if(pthread_create(&receiveThread, NULL, fleet_receiveThread, NULL) != 0)
+    {
+        perror("pthread_create");
+        return EXIT_FAILURE;
+    }
+    for(i = 0; i < fleet_workerCount; i++)
+    {
+        workers[i].index = i;
+        if(pthread_create(&workers[i].thread, NULL, fleet_workerThread, &workers[i]) != 0)
+        {
+            perror("pthread_create");
+            return EXIT_FAILURE;
+        }
+    }
+    (void)pthread_join(receiveThread, NULL);
+
+    return EXIT_SUCCESS;
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   fleet_createInstance
+ * BRIEF:   Create Instance
+ * RETURN:  bool: Success (true) Or Failure (false)
+ * ARG:     Instance: Instance
+ * ARG:     LinkPath: Symbolic Link To Create To The Instance's Pseudo-Terminal (NULL: None)
+ * ARG:     BaudRate: Baud Rate (0: Unthrottled)
+ * NOTE:    Copies The Image Snapshot Into An Anonymous File And Loads It, So Every Instance Has Its
+ *          Own Globals; The Instance Boots From Reset On Its First Time Slice
+ ****************************************************************************************************/
+static bool fleet_createInstance(fleet_instance_t * const Instance, const char * const LinkPath, const unsigned long BaudRate)
+{
+    char path[64];
+    int file;
+    void *handle;
+
+    /*** Copy Snapshot ***/
+    file = memfd_create(VIRTUAL_DEVICE_IMAGE, MFD_CLOEXEC);
+    if((file < 0) || (write(file, fleet_image, fleet_imageLength) != (ssize_t)fleet_imageLength))
+    {
+        perror("memfd_create");
+        return false;
+    }
+
+    /*** Load ***/
+    (void)snprintf(path, sizeof(path), "/proc/self/fd/%d", file);
+    handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    (void)close(file);
+    if(handle == NULL)
+    {
+        (void)fprintf(stderr, "%s\n", dlerror());
+        return false;
+    }
+    *(void **)&Instance->addReceiveCharacter = dlsym(handle, "virtualDevice_addReceiveCharacter");
+    *(void **)&Instance->getPseudoTerminal = dlsym(handle, "virtualDevice_getPseudoTerminal");
+    *(void **)&Instance->open = dlsym(handle, "virtualDevice_open");
+    *(void **)&Instance->run = dlsym(handle, "virtualDevice_run");
+    *(void **)&Instance->setYieldCallback = dlsym(handle, "virtualDevice_setYieldCallback");
+    if((Instance->addReceiveCharacter == NULL) || (Instance->getPseudoTerminal == NULL) || (Instance->open == NULL) || (Instance->run == NULL) || (Instance->setYieldCallback == NULL))
+    {
+        (void)fprintf(stderr, "%s\n", dlerror());
+        return false;
+    }
+
+    /*** Open Virtual UART ***/
+    if(!Instance->open(LinkPath, BaudRate))
+        return false;
+    Instance->setYieldCallback(fleet_yield, Instance, FLEET_YIELD_ACCESS_COUNT);
+
+    /*** Coroutine ***/
+    (void)getcontext(&Instance->context);
+    Instance->context.uc_stack.ss_size = FLEET_STACK_SIZE;
+    Instance->context.uc_stack.ss_sp = mmap(NULL, FLEET_STACK_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if(Instance->context.uc_stack.ss_sp == MAP_FAILED)
+    {
+        perror("mmap");
+        return false;
+    }
+    Instance->context.uc_link = NULL;
+    makecontext(&Instance->context, fleet_runInstance, 0);
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   fleet_loadImage
+ * BRIEF:   Load Image
+ * RETURN:  bool: Success (true) Or Failure (false)
+ * ARG:     Path: Virtual Device Image Path
+ ****************************************************************************************************/
+static bool fleet_loadImage(const char * const Path)
+{
+    FILE *file;
+    long length;
+
+    /*** Load Image ***/
+    file = fopen(Path, "rb");
+    if(file == NULL)
+    {
+        perror(Path);
+        return false;
+    }
+    (void)fseek(file, 0, SEEK_END);
+    length = ftell(file);
+    (void)fseek(file, 0, SEEK_SET);
+    fleet_image = (length > 0) ? malloc((size_t)length) : NULL;
+    if((fleet_image == NULL) || (fread(fleet_image, 1, (size_t)length, file) != (size_t)length))
+    {
+        perror(Path);
+        (void)fclose(file);
+        return false;
+    }
+    fleet_imageLength = (size_t)length;
+    (void)fclose(file);
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   fleet_receiveThread
+ * BRIEF:   Receive Thread
+ * RETURN:  void *: Returns Nothing (Does Not Return)
+ * ARG:     Argument: Argument (Unused)
+ * NOTE:    Single Producer For Every Instance's Receive Buffer
+ ****************************************************************************************************/
+static void *fleet_receiveThread(void *Argument)
+{
+    char characters[FLEET_RECEIVE_CHUNK_LENGTH];
+    struct epoll_event event;
+    int poll;
+    size_t i;
+    ssize_t j, length;
+
+    (void)Argument;
+
+    /*** Watch Every Pseudo-Terminal ***/
+    poll = epoll_create1(EPOLL_CLOEXEC);
+    for(i = 0; i < fleet_instanceCount; i++)
+    {
+        event.events = EPOLLIN;
+        event.data.u64 = i;
+        (void)epoll_ctl(poll, EPOLL_CTL_ADD, fleet_instances[i].getPseudoTerminal(), &event);
+    }
+
+    /*** Receive Characters From Hosts ***/
+    while(epoll_wait(poll, &event, 1, -1) >= 0)
+    {
+        i = (size_t)event.data.u64;
+        length = read(fleet_instances[i].getPseudoTerminal(), characters, sizeof(characters));
+        for(j = 0; j < length; j++)
+        {
+            /* Wait For Space (Host Is Faster Than The Firmware) */
+            while(!fleet_instances[i].addReceiveCharacter(characters[j]))
+                (void)usleep(100);
+        }
+    }
+
+    return NULL;
+}
+
+/****************************************************************************************************
+ * FUNCT:   fleet_runInstance
+ * BRIEF:   Run Instance
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Coroutine Entry; Does Not Return
+ ****************************************************************************************************/
+static void fleet_runInstance(void)
+{
+    /*** Run Firmware ***/
+    fleet_currentInstance->run();
+}
+
+/****************************************************************************************************
+ * FUNCT:   fleet_workerThread
+ * BRIEF:   Worker Thread
+ * RETURN:  void *: Returns Nothing (Does Not Return)
+ * ARG:     Argument: Worker
+ * NOTE:    Round-Robins The Instances Assigned To This Worker (Instance Index Modulo Worker Count)
+ ****************************************************************************************************/
+static void *fleet_workerThread(void *Argument)
+{
+    fleet_worker_t *worker = Argument;
+    size_t i;
+
+    /*** Run Time Slices ***/
+    while(true)
+    {
+        for(i = worker->index; i < fleet_instanceCount; i += fleet_workerCount)
+        {
+            fleet_currentInstance = &fleet_instances[i];
+            (void)swapcontext(&worker->context, &fleet_instances[i].context);
+        }
+    }
+
+    return NULL;
+}
+
+/****************************************************************************************************
+ * FUNCT:   fleet_yield
+ * BRIEF:   Yield
+ * RETURN:  Returns Nothing
+ * ARG:     Argument: Instance Whose Time Slice Ended
+ ****************************************************************************************************/
+static void fleet_yield(void *Argument)
+{
+    fleet_instance_t *instance = Argument;
+
+    /*** Return To Worker ***/
+    (void)swapcontext(&instance->context, &instance->worker->context);
+}
@@ -0,0 +1,421 @@
+/****************************************************************************************************
+ * FILE:    virtual_device.c
+ * BRIEF:   Virtual Device Source File
+ * NOTE:    Runs The Real Firmware (main(), system_init(), Interrupt Handlers) Against The Simulated
+ *          Peripherals And Bridges The CLI UART (USCI A1) To A Host Pseudo-Terminal (PTY); Every
+ *          Global Lives In The Device Image, So Each Loaded Copy Of The Image Is An Independent Device
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define _GNU_SOURCE
+
+#define VIRTUAL_DEVICE_BITS_PER_CHARACTER     (10) // 8-N-1: Start Bit, 8 Data Bits, 1 Stop Bit
+#define VIRTUAL_DEVICE_HOST_ADDRESS_MINIMUM   (0x10000) // DMA Addresses Beyond Simulated Memory Are Host Addresses
+#define VIRTUAL_DEVICE_NANOSECONDS_PER_SECOND (1000000000ull)
+#define VIRTUAL_DEVICE_RECEIVE_BUFFER_LENGTH  (4096)
+#define VIRTUAL_DEVICE_TRANSMIT_BUFFER_LENGTH (65536)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "dma.h"
+#include "driver_config.h"
+#include "hw_memmap.h"
+#include "interrupt_handler.h"
+#include "intrinsics.h"
+#include "msp430fr5xx_6xxgeneric.h"
+#include <fcntl.h>
+#include <setjmp.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "virtual_device.h"
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static uint32_t virtualDevice_accessCount;
+static uint64_t virtualDevice_characterNanoseconds; // 0: Unthrottled
+static jmp_buf virtualDevice_powerUpClear;
+static int virtualDevice_pseudoTerminalMaster = -1, virtualDevice_pseudoTerminalSlave = -1;
+static char virtualDevice_receiveBuffer[VIRTUAL_DEVICE_RECEIVE_BUFFER_LENGTH];
+static atomic_size_t virtualDevice_receiveHead, virtualDevice_receiveTail;
+static uint64_t virtualDevice_receiveReadyTime, virtualDevice_transmitReadyTime;
+static uint8_t virtualDevice_transmitBuffer[VIRTUAL_DEVICE_TRANSMIT_BUFFER_LENGTH];
+static size_t virtualDevice_transmitHead, virtualDevice_transmitTail;
+static void *virtualDevice_yieldArgument;
+static virtualDevice_yieldCallback_t virtualDevice_yieldCallback;
+static uint32_t virtualDevice_yieldAccessCount;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern void virtualDevice_firmwareMain(void); // app/main.c main(), Renamed When Building The Virtual Device
+
+static void virtualDevice_accessCallback(const uint32_t Address);
+static uint8_t *virtualDevice_getHostAddress(const uint32_t Address);
+static uint64_t virtualDevice_getTime(void);
+static void virtualDevice_stepDma(void);
+static void virtualDevice_stepUart(void);
+static void virtualDevice_stepWatchdog(void);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   virtualDevice_addReceiveCharacter
+ * BRIEF:   Add Receive Character
+ * RETURN:  bool: Success (true) Or Failure (false) Because Receive Buffer Is Full
+ * ARG:     Character: Character Received From The Host
+ * NOTE:    Single Producer (Host Thread); The Firmware Is The Single Consumer
+ ****************************************************************************************************/
+bool virtualDevice_addReceiveCharacter(const char Character)
+{
+    size_t head;
+
+    /*** Error Check ***/
+    head = atomic_load_explicit(&virtualDevice_receiveHead, memory_order_relaxed);
+    if(((head + 1) % VIRTUAL_DEVICE_RECEIVE_BUFFER_LENGTH) == atomic_load_explicit(&virtualDevice_receiveTail, memory_order_acquire))
+        return false;
+
+    /*** Add Receive Character ***/
+    virtualDevice_receiveBuffer[head] = Character;
+    atomic_store_explicit(&virtualDevice_receiveHead, (head + 1) % VIRTUAL_DEVICE_RECEIVE_BUFFER_LENGTH, memory_order_release);
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   virtualDevice_getPseudoTerminal
+ * BRIEF:   Get Pseudo-Terminal
+ * RETURN:  int: Pseudo-Terminal Master File Descriptor (Host Reads Received Characters From It)
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+int virtualDevice_getPseudoTerminal(void)
+{
+    /*** Get Pseudo-Terminal ***/
+    return virtualDevice_pseudoTerminalMaster;
+}
+
+/****************************************************************************************************
+ * FUNCT:   virtualDevice_open
+ * BRIEF:   Open
+ * RETURN:  bool: Success (true) Or Failure (false)
+ * ARG:     LinkPath: Symbolic Link To Create To The Pseudo-Terminal (NULL: None)
+ * ARG:     BaudRate: Baud Rate (0: Unthrottled)
+ * NOTE:    The Slave Side Is Kept Open So The Device Keeps Running While No Host Tool Is Attached
+ ****************************************************************************************************/
+bool virtualDevice_open(const char * const LinkPath, const unsigned long BaudRate)
+{
+    const char *slaveName;
+    struct termios attributes;
+
+    /*** Baud Clock ***/
+    virtualDevice_characterNanoseconds = (BaudRate > 0) ? ((VIRTUAL_DEVICE_BITS_PER_CHARACTER * VIRTUAL_DEVICE_NANOSECONDS_PER_SECOND) / BaudRate) : 0;
+
+    /*** Open Master (Non-Blocking: A Host That Isn't Reading Holds The UART Busy Instead) ***/
+    virtualDevice_pseudoTerminalMaster = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if((virtualDevice_pseudoTerminalMaster < 0) || (grantpt(virtualDevice_pseudoTerminalMaster) != 0) || (unlockpt(virtualDevice_pseudoTerminalMaster) != 0))
+    {
+        perror("posix_openpt");
+        return false;
+    }
+    slaveName = ptsname(virtualDevice_pseudoTerminalMaster);
+
+    /*** Open Slave In Raw Mode (Bytes Pass Through Unchanged, Like A Serial Port) ***/
+    virtualDevice_pseudoTerminalSlave = open(slaveName, O_RDWR | O_NOCTTY);
+    if((virtualDevice_pseudoTerminalSlave < 0) || (tcgetattr(virtualDevice_pseudoTerminalSlave, &attributes) != 0))
+    {
+        perror(slaveName);
+        return false;
+    }
+    cfmakeraw(&attributes);
+    (void)tcsetattr(virtualDevice_pseudoTerminalSlave, TCSANOW, &attributes);
+
+    /*** Link ***/
+    if(LinkPath != NULL)
+    {
+        (void)unlink(LinkPath);
+        if(symlink(slaveName, LinkPath) != 0)
+        {
+            perror(LinkPath);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   virtualDevice_run
+ * BRIEF:   Run
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Does Not Return; Power-Up Clear (PUC) Restarts The Firmware From main() With Peripherals
+ *          Reset (Firmware Variables Are Not Re-Initialized; Every Module Initializes Its Own State)
+ * NOTE:    Power On Latches SYSRSTIV_BOR; A PUC Keeps What Only A Brownout Resets (LCD_C, RTC_C,
+ *          Memory) And Latches Its Cause, So system_init() Takes The Warm Path After "system -r"
+ ****************************************************************************************************/
+void virtualDevice_run(void)
+{
+    /*** Attach Peripheral Models ***/
+    (void)hwMemmap_registerAccessCallback(virtualDevice_accessCallback);
+
+    /*** Power On (Brownout) ***/
+    hwMemmap_init();
+    HW_MEMMAP_REG16(SYS_BASE + OFS_SYSRSTIV) = SYSRSTIV_BOR;
+
+    /*** Power-Up Clear (PUC) ***/
+    if(setjmp(virtualDevice_powerUpClear) != 0)
+        hwMemmap_powerUpClear(SYSRSTIV_WDTKEY); // Watchdog Password Violation (virtualDevice_stepWatchdog())
+    virtualDevice_receiveReadyTime = 0;
+    virtualDevice_transmitReadyTime = 0;
+    virtualDevice_transmitHead = 0;
+    virtualDevice_transmitTail = 0;
+
+    /*** Run Firmware ***/
+    virtualDevice_firmwareMain();
+}
+
+/****************************************************************************************************
+ * FUNCT:   virtualDevice_setYieldCallback
+ * BRIEF:   Set Yield Callback
+ * RETURN:  Returns Nothing
+ * ARG:     Callback: Callback (NULL: Never Yield)
+ * ARG:     Argument: Callback Argument
+ * ARG:     AccessCount: Register Accesses Between Yields
+ * NOTE:    Lets A Host Scheduler Time-Slice Many Devices (The Firmware Main Loop Never Returns)
+ ****************************************************************************************************/
+void virtualDevice_setYieldCallback(const virtualDevice_yieldCallback_t Callback, void * const Argument, const uint32_t AccessCount)
+{
+    /*** Set Yield Callback ***/
+    virtualDevice_yieldArgument = Argument;
+    virtualDevice_yieldAccessCount = AccessCount;
+    virtualDevice_yieldCallback = Callback;
+}
+
+/****************************************************************************************************
+ * FUNCT:   cliCallbackTest_copyPrintfOutput
+ * BRIEF:   Copy Printf Output
+ * RETURN:  Returns Nothing
+ * ARG:     Output: Output (Unused)
+ * NOTE:    The Virtual Device Transmits Output Through The DMA And UART Models Instead
+ ****************************************************************************************************/
+void cliCallbackTest_copyPrintfOutput(const char * const Output)
+{
+    (void)Output;
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   virtualDevice_accessCallback
+ * BRIEF:   Access Callback
+ * RETURN:  Returns Nothing
+ * ARG:     Address: Accessed Address (Unused)
+ * NOTE:    Every Register Access Advances The Peripheral Models
+ ****************************************************************************************************/
+static void virtualDevice_accessCallback(const uint32_t Address)
+{
+    (void)Address;
+
+    /*** Step Peripheral Models ***/
+    virtualDevice_stepWatchdog();
+    virtualDevice_stepDma();
+    virtualDevice_stepUart();
+
+    /*** Yield ***/
+    if((virtualDevice_yieldCallback != NULL) && (++virtualDevice_accessCount >= virtualDevice_yieldAccessCount))
+    {
+        virtualDevice_accessCount = 0;
+        virtualDevice_yieldCallback(virtualDevice_yieldArgument);
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   virtualDevice_getHostAddress
+ * BRIEF:   Get Host Address
+ * RETURN:  uint8_t *: Host Address
+ * ARG:     Address: 32-Bit Address Written By The Firmware ((uint32_t)Pointer)
+ * NOTE:    The Upper Bits Are Lost By The Firmware's Cast; Firmware Buffers Live In This Image, So
+ *          The Nearest Address To An Object In This Image With The Same Lower 32 Bits Is The Buffer
+ ****************************************************************************************************/
+static uint8_t *virtualDevice_getHostAddress(const uint32_t Address)
+{
+    uint64_t candidate, reference;
+
+    /*** Get Host Address ***/
+    reference = (uint64_t)(uintptr_t)virtualDevice_receiveBuffer;
+    candidate = (reference & 0xFFFFFFFF00000000ull) | Address;
+    if(candidate > (reference + 0x80000000ull))
+        candidate -= 0x100000000ull;
+    else if((candidate + 0x80000000ull) < reference)
+        candidate += 0x100000000ull;
+
+    return (uint8_t *)(uintptr_t)candidate;
+}
+
+/****************************************************************************************************
+ * FUNCT:   virtualDevice_getTime
+ * BRIEF:   Get Time
+ * RETURN:  uint64_t: Monotonic Time (Nanoseconds)
+ * ARG:     void: No Arguments
+ ****************************************************************************************************/
+static uint64_t virtualDevice_getTime(void)
+{
+    struct timespec time;
+
+    /*** Get Time ***/
+    (void)clock_gettime(CLOCK_MONOTONIC, &time);
+    return ((uint64_t)time.tv_sec * VIRTUAL_DEVICE_NANOSECONDS_PER_SECOND) + (uint64_t)time.tv_nsec;
+}
+
+/****************************************************************************************************
+ * FUNCT:   virtualDevice_stepDma
+ * BRIEF:   Step Direct Memory Access (DMA) Model
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Requested Byte Transfers Complete Immediately; Bytes Written To The CLI UART Transmit
+ *          Buffer Are Queued For The Pseudo-Terminal And Keep The UART Busy Until Sent
+ ****************************************************************************************************/
+static void virtualDevice_stepDma(void)
+{
+    uint8_t byte, channel;
+    uint16_t control, count, i;
+    uint32_t destination, source;
+
+    for(channel = DMA_CHANNEL_0; channel <= DMA_CHANNEL_2; channel += DMA_CHANNEL_1)
+    {
+        /*** Transfer Requested? ***/
+        control = HW_MEMMAP_REG16(DMA_BASE + channel + OFS_DMA0CTL);
+        if((control & (DMAEN | DMAREQ)) != (DMAEN | DMAREQ))
+            continue;
+
+        /*** Transfer Block ***/
+        count = 0;
+        source = HW_MEMMAP_REG32(DMA_BASE + channel + OFS_DMA0SA);
+        destination = HW_MEMMAP_REG32(DMA_BASE + channel + OFS_DMA0DA);
+        for(i = 0; i < HW_MEMMAP_REG16(DMA_BASE + channel + OFS_DMA0SZ); i++)
+        {
+            /* Read */
+            byte = (source >= VIRTUAL_DEVICE_HOST_ADDRESS_MINIMUM) ? *virtualDevice_getHostAddress(source) : HW_MEMMAP_REG8(source);
+
+            /* Write */
+            if((destination == (DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxTXBUF)) && (((virtualDevice_transmitHead + 1) % VIRTUAL_DEVICE_TRANSMIT_BUFFER_LENGTH) != virtualDevice_transmitTail))
+            {
+                virtualDevice_transmitBuffer[virtualDevice_transmitHead] = byte;
+                virtualDevice_transmitHead = (virtualDevice_transmitHead + 1) % VIRTUAL_DEVICE_TRANSMIT_BUFFER_LENGTH;
+                count++;
+            }
+            else if(destination >= VIRTUAL_DEVICE_HOST_ADDRESS_MINIMUM)
+            {
+                *virtualDevice_getHostAddress(destination) = byte;
+            }
+            else
+            {
+                HW_MEMMAP_REG8(destination) = byte;
+            }
+
+            /* Next Address */
+            if((control & DMASRCINCR_3) == DMASRCINCR_3)
+                source++;
+            else if((control & DMASRCINCR_3) == DMASRCINCR_2)
+                source--;
+            if((control & DMADSTINCR_3) == DMADSTINCR_3)
+                destination++;
+            else if((control & DMADSTINCR_3) == DMADSTINCR_2)
+                destination--;
+        }
+        HW_MEMMAP_REG16(DMA_BASE + channel + OFS_DMA0CTL) = (uint16_t)((control & ~(DMAEN | DMAREQ)) | DMAIFG); // Block Transfer Complete
+
+        /*** UART Busy For The Baud Clock Time ***/
+        if(count > 0)
+        {
+            HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxSTATW) |= UCBUSY;
+            if(virtualDevice_characterNanoseconds > 0)
+                virtualDevice_transmitReadyTime = virtualDevice_getTime() + (count * virtualDevice_characterNanoseconds);
+        }
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   virtualDevice_stepUart
+ * BRIEF:   Step CLI Universal Asynchronous Receiver/Transmitter (UART) Model
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Received Characters Are Delivered No Faster Than The Baud Clock (Unless Unthrottled)
+ ****************************************************************************************************/
+static void virtualDevice_stepUart(void)
+{
+    size_t length, tail;
+    ssize_t written;
+    uint64_t now = 0;
+
+    /*** Transmit ***/
+    /* Send Queued Characters */
+    if(virtualDevice_transmitHead != virtualDevice_transmitTail)
+    {
+        length = (virtualDevice_transmitHead > virtualDevice_transmitTail) ? (virtualDevice_transmitHead - virtualDevice_transmitTail) : (VIRTUAL_DEVICE_TRANSMIT_BUFFER_LENGTH - virtualDevice_transmitTail);
+        written = write(virtualDevice_pseudoTerminalMaster, &virtualDevice_transmitBuffer[virtualDevice_transmitTail], length);
+        if(written > 0)
+            virtualDevice_transmitTail = (virtualDevice_transmitTail + (size_t)written) % VIRTUAL_DEVICE_TRANSMIT_BUFFER_LENGTH;
+    }
+
+    /* Not Busy Once Sent And Baud Clock Time Elapsed */
+    if(virtualDevice_characterNanoseconds > 0)
+        now = virtualDevice_getTime();
+    if(((HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxSTATW) & UCBUSY) == UCBUSY) && (virtualDevice_transmitHead == virtualDevice_transmitTail) && (now >= virtualDevice_transmitReadyTime))
+        HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxSTATW) &= (uint16_t)~UCBUSY;
+
+    /*** Receive ***/
+    /* Character Available, Interrupt Can Be Taken And Baud Clock Allows */
+    tail = atomic_load_explicit(&virtualDevice_receiveTail, memory_order_relaxed);
+    if(tail == atomic_load_explicit(&virtualDevice_receiveHead, memory_order_acquire))
+        return;
+    if(!intrinsics_getInterruptsEnabled() || ((HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxCTLW0) & UCSWRST) == UCSWRST) || ((HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxIE) & UCRXIE) != UCRXIE))
+        return;
+    if(now < virtualDevice_receiveReadyTime)
+        return;
+
+    /* Interrupt */
+    HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxRXBUF) = (uint8_t)virtualDevice_receiveBuffer[tail];
+    HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxIFG) |= UCRXIFG;
+    HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxIV) = USCI_UART_UCRXIFG;
+    atomic_store_explicit(&virtualDevice_receiveTail, (tail + 1) % VIRTUAL_DEVICE_RECEIVE_BUFFER_LENGTH, memory_order_release);
+    virtualDevice_receiveReadyTime = now + virtualDevice_characterNanoseconds;
+    (void)intrinsics_callInterruptHandler(interruptHandler_usciA1Vector);
+    HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxIFG) &= (uint16_t)~UCRXIFG; // Reading Receive Buffer Clears Flag
+    HW_MEMMAP_REG16(DRIVER_CONFIG_CLI_UART_BASE_ADDRESS + OFS_UCAxIV) = USCI_NONE;
+}
+
+/****************************************************************************************************
+ * FUNCT:   virtualDevice_stepWatchdog
+ * BRIEF:   Step Watchdog Timer Model
+ * RETURN:  Returns Nothing
+ * ARG:     void: No Arguments
+ * NOTE:    Writing WDTCTL Without The Password Generates A Power-Up Clear (PUC) Reset
+ ****************************************************************************************************/
+static void virtualDevice_stepWatchdog(void)
+{
+    uint16_t control;
+
+    /*** Password Violation ***/
+    control = HW_MEMMAP_REG16(WDT_A_BASE + OFS_WDTCTL);
+    if((control != 0) && ((control & 0xFF00) != WDTPW))
+        longjmp(virtualDevice_powerUpClear, 1);
+}
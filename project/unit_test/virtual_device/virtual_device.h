@@ -0,0 +1,39 @@
+/****************************************************************************************************
+ * FILE:    virtual_device.h
+ * BRIEF:   Virtual Device Header File
+ ****************************************************************************************************/
+
+#ifndef VIRTUAL_DEVICE_H
+#define VIRTUAL_DEVICE_H
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define VIRTUAL_DEVICE_BAUD_RATE_DEFAULT (115200)
+#define VIRTUAL_DEVICE_IMAGE             ("virtual_device.so") // Shared Object Image Loaded Once Per Fleet Instance
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef void (*virtualDevice_yieldCallback_t)(void *Argument);
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern bool virtualDevice_addReceiveCharacter(const char Character);
+extern int virtualDevice_getPseudoTerminal(void);
+extern bool virtualDevice_open(const char * const LinkPath, const unsigned long BaudRate);
+extern void virtualDevice_run(void);
+extern void virtualDevice_setYieldCallback(const virtualDevice_yieldCallback_t Callback, void * const Argument, const uint32_t AccessCount);
+
+#endif
@@ -0,0 +1,124 @@
+/****************************************************************************************************
+ * FILE:    virtual_device_main.c
+ * BRIEF:   Virtual Device Main Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define _GNU_SOURCE
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "hw_memmap.h"
+#include "virtual_device.h"
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void *virtualDeviceMain_receiveThread(void *Argument);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   main
+ * BRIEF:   Main Entry
+ * RETURN:  int: Exit Status (Only Returns On Error)
+ * ARG:     argc: Argument Count
+ * ARG:     argv: Arguments: [-b BAUD_RATE] [-l LINK_PATH] [-s SHARED_MEMORY]
+ * NOTE:    A Baud Rate Of 0 Runs The Simulated UART Unthrottled; The Default Is 115200 Like The Board
+ * NOTE:    SHARED_MEMORY: Memory Map Shared With External Tools (hwMemmap_map()), So LCD Segments,
+ *          Timers And LEDs Can Be Watched Live
+ ****************************************************************************************************/
+int main(int argc, char *argv[])
+{
+    unsigned long baudRate = VIRTUAL_DEVICE_BAUD_RATE_DEFAULT;
+    const char *linkPath = NULL, *sharedMemoryPath = NULL;
+    int option;
+    pthread_t receiveThread;
+
+    /*** Parse Arguments ***/
+    while((option = getopt(argc, argv, "b:l:s:")) != -1)
+    {
+        switch(option)
+        {
+            case 'b':
+                baudRate = strtoul(optarg, NULL, 0);
+                break;
+            case 'l':
+                linkPath = optarg;
+                break;
+            case 's':
+                sharedMemoryPath = optarg;
+                break;
+            default:
+                (void)fprintf(stderr, "Usage: %s [-b BAUD_RATE (0: Unthrottled)] [-l LINK_PATH] [-s SHARED_MEMORY]\n", argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    /*** Bridge CLI UART To Pseudo-Terminal ***/
+    if(!virtualDevice_open(linkPath, baudRate))
+        return EXIT_FAILURE;
+    if((sharedMemoryPath != NULL) && !hwMemmap_map(sharedMemoryPath))
+    {
+        (void)fprintf(stderr, "%s: Cannot Map\n", sharedMemoryPath);
+        return EXIT_FAILURE;
+    }
+    if(pthread_create(&receiveThread, NULL, virtualDeviceMain_receiveThread, NULL) != 0)
+    {
+        perror("pthread_create");
+        return EXIT_FAILURE;
+    }
+    (void)printf("Virtual Device CLI: %s\n", (linkPath != NULL) ? linkPath : ptsname(virtualDevice_getPseudoTerminal()));
+    (void)fflush(stdout);
+
+    /*** Run Firmware (Does Not Return) ***/
+    virtualDevice_run();
+
+    return EXIT_SUCCESS;
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   virtualDeviceMain_receiveThread
+ * BRIEF:   Receive Thread
+ * RETURN:  void *: Returns Nothing (Does Not Return)
+ * ARG:     Argument: Argument (Unused)
+ ****************************************************************************************************/
+static void *virtualDeviceMain_receiveThread(void *Argument)
+{
+    char character;
+    struct pollfd pseudoTerminal;
+
+    (void)Argument;
+
+    /*** Receive Characters From Host ***/
+    pseudoTerminal.fd = virtualDevice_getPseudoTerminal();
+    pseudoTerminal.events = POLLIN;
+    while(poll(&pseudoTerminal, 1, -1) >= 0)
+    {
+        while(read(pseudoTerminal.fd, &character, 1) == 1)
+        {
+            /* Wait For Space (Host Is Faster Than The Firmware) */
+            while(!virtualDevice_addReceiveCharacter(character))
+                (void)usleep(100);
+        }
+    }
+
+    return NULL;
+}